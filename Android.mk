@@ -8,7 +8,9 @@ LOCAL_ARM_MODE := arm
 LOCAL_SRC_FILES =       src/LP2LSPConversion.c \
                         src/LPSynthesisFilter.c \
                         src/LSPQuantization.c \
+                        src/activeSpeaker.c \
                         src/adaptativeCodebookSearch.c \
+                        src/analyzer.c \
                         src/codebooks.c \
                         src/computeAdaptativeCodebookGain.c \
                         src/computeLP.c \
@@ -23,10 +25,19 @@ LOCAL_SRC_FILES =       src/LP2LSPConversion.c \
                         src/fixedCodebookSearch.c \
                         src/gainQuantization.c \
                         src/interpolateqLSP.c \
+                        src/multiChannelLSP.c \
                         src/postFilter.c \
                         src/postProcessing.c \
                         src/preProcessing.c \
                         src/qLSP2LP.c \
+                        src/rtp.c \
+                        src/jitterBuffer.c \
+                        src/playoutAdjustment.c \
+                        src/decoderState.c \
+                        src/recording.c \
+                        src/chunk.c \
+                        src/voiceActivity.c \
+                        src/trace.c \
                         src/utils.c
 LOCAL_C_INCLUDES += \
 	$(LOCAL_PATH)/include
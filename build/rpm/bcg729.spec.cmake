@@ -86,6 +86,7 @@ rm -rf $RPM_BUILD_ROOT
 %defattr(-,root,root)
 %doc AUTHORS.md CHANGELOG.md LICENSE.txt README.md
 %{_libdir}/*.so.*
+%{_bindir}/bcg729
 
 %files devel
 %defattr(-,root,root)
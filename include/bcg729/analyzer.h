@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef ANALYZER_H
+#define ANALYZER_H
+#include <stdint.h>
+typedef struct bcg729AnalyzerChannelContextStruct_struct bcg729AnalyzerChannelContextStruct;
+
+#ifdef _WIN32
+	#ifdef BCG729_STATIC
+		#define BCG729_VISIBILITY
+	#else
+		#ifdef BCG729_EXPORTS
+			#define BCG729_VISIBILITY __declspec(dllexport)
+		#else
+			#define BCG729_VISIBILITY __declspec(dllimport)
+		#endif
+	#endif
+#else
+	#define BCG729_VISIBILITY __attribute__ ((visibility ("default")))
+#endif
+
+/* Frame types */
+#define BCG729_FRAME_TYPE_UNTRANSMITTED	0 /* no payload */
+#define BCG729_FRAME_TYPE_ACTIVE	1 /* 10 bytes speech frame */
+#define BCG729_FRAME_TYPE_SID		2 /* 2 bytes G729 Annex B SID frame (or RFC3389 payload) */
+#define BCG729_FRAME_TYPE_ERASED	3 /* erased frame following an active one, parameters are extrapolated */
+#define BCG729_FRAME_TYPE_INVALID	0xFF /* payload length is not 0, 2 or 10 bytes */
+
+/* Parameters of a frame as in spec 4 - Table 8 and spec B4.3, fields not present in the frame are set to 0 */
+typedef struct {
+	uint16_t L0; /* switched MA predictor of LSP quantizer (1 bit) */
+	uint16_t L1; /* first stage vector of LSP quantizer (7 bits, 5 bits in SID frames) */
+	uint16_t L2; /* second stage lower vector of LSP quantizer (5 bits, 4 bits in SID frames) */
+	uint16_t L3; /* second stage higher vector of LSP quantizer (5 bits) */
+	uint16_t P1; /* pitch delay first subframe (8 bits) */
+	uint16_t P0; /* parity bit for pitch delay (1 bit) */
+	uint16_t C1; /* fixed codebook first subframe (13 bits) */
+	uint16_t S1; /* signs of fixed codebook pulses first subframe (4 bits) */
+	uint16_t GA1; /* gain codebook (stage 1) first subframe (3 bits) */
+	uint16_t GB1; /* gain codebook (stage 2) first subframe (4 bits) */
+	uint16_t P2; /* pitch delay second subframe (5 bits) */
+	uint16_t C2; /* fixed codebook second subframe (13 bits) */
+	uint16_t S2; /* signs of fixed codebook pulses second subframe (4 bits) */
+	uint16_t GA2; /* gain codebook (stage 1) second subframe (3 bits) */
+	uint16_t GB2; /* gain codebook (stage 2) second subframe (4 bits) */
+	uint16_t gain; /* SID frames only: quantized energy (5 bits) */
+} bcg729FrameParameters;
+
+/* Features derived from a frame without excitation synthesis, LP synthesis filter nor post filter */
+typedef struct {
+	uint8_t frameType; /* one of BCG729_FRAME_TYPE_*: ACTIVE, ERASED or SID (untransmitted frames during a silence period are SID) */
+	int16_t LSP[10]; /* decoded qLSP in Q0.15, for SID frames the comfort noise ones */
+	int16_t LSF[10]; /* decoded qLSF in radians in Q2.13 */
+	int16_t intPitchDelay[2]; /* integer part of pitch delay for each subframe, 0 on SID frames */
+	int16_t fracPitchDelay[2]; /* fractional part of pitch delay in 1/3 of samples: -1, 0 or 1 */
+	int16_t adaptativeCodebookGain[2]; /* pitch gain for each subframe in Q14, 0 on SID frames */
+	int16_t fixedCodebookGain[2]; /* fixed codebook gain for each subframe in Q1, 0 on SID frames */
+	int32_t energy; /* estimated mean energy of the frame excitation per sample in Q0: this is not the output */
+			/* signal energy as the LP synthesis filter gain is not applied. SID frames: comfort noise target energy */
+	int16_t energydB; /* 10*log10(energy) in Q8, 0 when energy is null */
+	uint8_t voiceActivity; /* 1 when voice activity is detected on the channel(with a 200ms hangover), 0 otherwise */
+} bcg729FrameFeatures;
+
+/*****************************************************************************/
+/* bcg729UnpackFrame : extract the parameters of a frame, stateless          */
+/*    parameters:                                                            */
+/*      -(i) bitStream : the frame payload                                   */
+/*      -(i) bitStreamLength : in bytes, 10 for active frames, 2 for SID     */
+/*           frames, 0 for untransmitted ones                                */
+/*      -(o) parameters : the frame parameters                               */
+/*    return value : frame type: BCG729_FRAME_TYPE_ACTIVE, SID,              */
+/*           UNTRANSMITTED or INVALID(parameters are all set to 0)           */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint8_t bcg729UnpackFrame(const uint8_t bitStream[], uint8_t bitStreamLength, bcg729FrameParameters *parameters);
+
+/*****************************************************************************/
+/* bcg729UnpackFrames : extract the parameters of consecutive frames, as     */
+/*      output by bcg729EncoderStream, stateless                             */
+/*    parameters:                                                            */
+/*      -(i) bitStream : the frames payloads, concatenated                   */
+/*      -(i) bitStreamLength : in bytes, length of each frame payload        */
+/*      -(i) framesNbr : number of frames                                    */
+/*      -(o) parameters : framesNbr frames parameters                        */
+/*    return value : number of frames unpacked, stops on the first invalid   */
+/*           frame length                                                    */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint16_t bcg729UnpackFrames(const uint8_t bitStream[], const uint8_t bitStreamLength[], uint16_t framesNbr, bcg729FrameParameters parameters[]);
+
+/*****************************************************************************/
+/* bcg729PackFrames : pack the parameters of consecutive frames, reverse     */
+/*      operation of bcg729UnpackFrames                                      */
+/*    parameters:                                                            */
+/*      -(i) parameters : framesNbr frames parameters                        */
+/*      -(i) bitStreamLength : in bytes, 10 for active frames, 2 for SID     */
+/*           frames, 0 for untransmitted ones                                */
+/*      -(i) framesNbr : number of frames                                    */
+/*      -(o) bitStream : the frames payloads, concatenated                   */
+/*    return value : number of frames packed, stops on the first invalid     */
+/*           frame length                                                    */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint16_t bcg729PackFrames(const bcg729FrameParameters parameters[], const uint8_t bitStreamLength[], uint16_t framesNbr, uint8_t bitStream[]);
+
+/*****************************************************************************/
+/* initBcg729AnalyzerChannel : create context structure and initialise it    */
+/*    return value :                                                         */
+/*      - the analyzer channel context data                                  */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY bcg729AnalyzerChannelContextStruct *initBcg729AnalyzerChannel(void);
+
+/*****************************************************************************/
+/* closeBcg729AnalyzerChannel : free memory of context structure             */
+/*    parameters:                                                            */
+/*      -(i) analyzerChannelContext : the channel context data               */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void closeBcg729AnalyzerChannel(bcg729AnalyzerChannelContextStruct *analyzerChannelContext);
+
+/*****************************************************************************/
+/* bcg729AnalyzeFrame : decode LSP, pitch delays and gains of a frame, and   */
+/*      estimate its energy, no signal is produced. Frames must be given in  */
+/*      sequence, as they would be to bcg729Decoder: the LSP and gain        */
+/*      predictors are tracked exactly as in the decoder                     */
+/*    parameters:                                                            */
+/*      -(i/o) analyzerChannelContext : the channel context data             */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i) bitStreamLength : in bytes, length of previous buffer           */
+/*      -(i) frameErasureFlag : flag: true, frame has been erased            */
+/*      -(i) SIDFrameFlag : flag: true, frame is a SID one                   */
+/*      -(i) rfc3389PayloadFlag : true when CN payload follow rfc3389        */
+/*      -(o) features : the frame features                                   */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729AnalyzeFrame(bcg729AnalyzerChannelContextStruct *analyzerChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, bcg729FrameFeatures *features);
+#endif /* ifndef ANALYZER_H */
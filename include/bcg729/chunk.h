@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef CHUNK_H
+#define CHUNK_H
+#include <stdint.h>
+#include "encoder.h"
+#include "decoder.h"
+
+/* Offline processing of a long stream split in chunks processed concurrently, one thread per chunk. Each chunk is     */
+/* processed by its own channel, started warmUpFramesNbr frames before the chunk, and the chunks outputs are           */
+/* concatenated in order to get the whole stream output. The output of the first chunk(no warm-up) is bit exact.       */
+/* Decoder: the channel state(LSP MA predictor, gain predictor, excitation and filters memories) converges to the      */
+/* sequential one during the warm-up, a long enough warm-up(256 frames on speech) gives a bit exact output.            */
+/* Encoder: the output of the other chunks is NOT bit exact and does not reconverge whatever the warm-up, small state  */
+/* differences change the codebooks searches until the end of the chunk. The bitstream is valid and its coding         */
+/* quality is the sequential one, but it differs from a sequential encoding on most frames.                            */
+
+/*****************************************************************************/
+/* bcg729EncodeChunk : encode a chunk of a stream after a warm-up            */
+/*    parameters:                                                            */
+/*      -(i) input : warmUpFramesNbr + framesNbr frames of 80 16 bits PCM    */
+/*           samples, the warm-up frames preceding the chunk in the stream   */
+/*      -(i) warmUpFramesNbr : number of frames encoded before the chunk,    */
+/*           their output is discarded. Shall be 0 for the first chunk       */
+/*      -(i) framesNbr : number of frames of the chunk                       */
+/*      -(i) enableVAD : flag set to 1: VAD/DTX is enabled                   */
+/*      -(o) bitStream : the encoded frames concatenated, each of them being */
+/*           10, 2 or 0 bytes long, must hold 10*framesNbr bytes             */
+/*      -(o) bitStreamLength : length of each encoded frame, framesNbr values*/
+/*    return value : length of bitStream in bytes                            */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint32_t bcg729EncodeChunk(const int16_t input[], uint32_t warmUpFramesNbr, uint32_t framesNbr, uint8_t enableVAD, uint8_t bitStream[], uint8_t bitStreamLength[]);
+
+/*****************************************************************************/
+/* bcg729DecodeChunk : decode a chunk of a stream after a warm-up            */
+/*    parameters:                                                            */
+/*      -(i) bitStream : warmUpFramesNbr + framesNbr encoded frames          */
+/*           concatenated, as output by bcg729EncodeChunk, the warm-up       */
+/*           frames preceding the chunk in the stream                        */
+/*      -(i) bitStreamLength : length of each frame: 10, 2 or 0(frame not    */
+/*           transmitted), warmUpFramesNbr + framesNbr values                */
+/*      -(i) warmUpFramesNbr : number of frames decoded before the chunk,    */
+/*           their output is discarded. Shall be 0 for the first chunk       */
+/*      -(i) framesNbr : number of frames of the chunk                       */
+/*      -(o) signal : decoded signal(16 bits PCM), 80 samples per frame      */
+/*    return value : number of frames decoded, stops on the first invalid    */
+/*           frame length                                                    */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint32_t bcg729DecodeChunk(const uint8_t bitStream[], const uint8_t bitStreamLength[], uint32_t warmUpFramesNbr, uint32_t framesNbr, int16_t signal[]);
+#endif /* ifndef CHUNK_H */
@@ -20,6 +20,7 @@
 #define DECODER_H
 typedef struct bcg729DecoderChannelContextStruct_struct bcg729DecoderChannelContextStruct;
 #include <stdint.h>
+#include "encoder.h"
 
 // Version number is 1.1.1, map it on an integer
 // Note: This define starts with version 1.1.1
@@ -39,6 +40,48 @@ typedef struct bcg729DecoderChannelContextStruct_struct bcg729DecoderChannelCont
 	#define BCG729_VISIBILITY __attribute__ ((visibility ("default")))
 #endif
 
+/* Decoder modes: select the output stages run by bcg729Decoder, mode can be changed on any frame */
+/* STANDARD: complete ITU G729 Annex A decoder, post filter(long term, short term, tilt compensation and */
+/*           adaptive gain control) and post processing(high pass filter and upscaling) */
+/* NO_POSTFILTER: post filter is bypassed, post processing is performed. Intended for machine consumers */
+/*           (ASR, analytics). The post filter being perceptual only, the output keeps the decoded      */
+/*           spectral envelope and energy but formant/pitch enhancement is lost */
+/* RAW: post filter and post processing high pass filter are bypassed, output is the LP synthesis filter  */
+/*           output upscaled by 2. Low frequency content(< 100Hz) is not removed */
+/* Filters contexts are kept up to date in bypass modes so STANDARD mode can be resumed without reset, */
+/* the first subframe after resuming is not bit exact with a decoder which stayed in STANDARD mode */
+#define BCG729_DECODER_MODE_STANDARD		0
+#define BCG729_DECODER_MODE_NO_POSTFILTER	1
+#define BCG729_DECODER_MODE_RAW			2
+
+/* Output formats: select the samples written by bcg729DecoderFormatted, format can be changed on any frame */
+/* PCM16: 80 samples 16 bits PCM at 8kHz, the bcg729Decoder output(160 bytes) */
+/* FLOAT: 80 samples 32 bits float at 8kHz in [-1, 1[, the PCM16 output divided by 32768(320 bytes) */
+/* ULAW, ALAW: 80 G711 mu-law or A-law codes at 8kHz(80 bytes) */
+/* PCM16_16KHZ, PCM16_48KHZ: 160 or 480 samples 16 bits PCM upsampled by a 16 taps per phase polyphase */
+/*           filter(320 or 960 bytes). The filter delays the output by 8 samples at 8kHz(1ms): the output */
+/*           sample of index n*2(resp n*6) is the PCM16 output sample n-8, the memory is reset when the   */
+/*           output format is changed                                                                     */
+#define BCG729_OUTPUT_FORMAT_PCM16		0
+#define BCG729_OUTPUT_FORMAT_FLOAT		1
+#define BCG729_OUTPUT_FORMAT_ULAW		2
+#define BCG729_OUTPUT_FORMAT_ALAW		3
+#define BCG729_OUTPUT_FORMAT_PCM16_16KHZ	4
+#define BCG729_OUTPUT_FORMAT_PCM16_48KHZ	5
+
+/* Operational counters of a decoder channel, see bcg729GetDecoderStats. Frames are counted by their received type, */
+/* frames given to bcg729DecoderAdvance are not counted                                                              */
+typedef struct {
+	uint32_t framesNbr; /* frames decoded */
+	uint32_t activeFramesNbr; /* active voice frames received */
+	uint32_t SIDFramesNbr; /* SID frames received */
+	uint32_t untransmittedFramesNbr; /* noise frames not transmitted, no SID payload */
+	uint32_t erasedFramesNbr; /* erased frames, concealed */
+	uint32_t parityErrorsNbr; /* active frames whose P0 parity bit did not match P1, the pitch delay was concealed */
+	uint32_t LSPConversionFailuresNbr; /* RFC3389 comfort noise payloads whose LP to LSP conversion failed, the previous LSP were used */
+	uint32_t saturatedSamplesNbr; /* LP synthesis filter output samples saturated on 16 bits */
+} bcg729DecoderStats;
+
 /*****************************************************************************/
 /* initBcg729DecoderChannel : create context structure and initialise it     */
 /*    return value :                                                         */
@@ -68,4 +111,231 @@ BCG729_VISIBILITY void closeBcg729DecoderChannel(bcg729DecoderChannelContextStru
 /*                                                                           */
 /*****************************************************************************/
 BCG729_VISIBILITY void bcg729Decoder(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, int16_t signal[]);
+
+/*****************************************************************************/
+/* bcg729DecoderMultiChannel : decode one frame on each channel of a set,    */
+/*      the output of each channel is the bcg729Decoder one. LSP to LP       */
+/*      conversion of the channels is done at once to use the SIMD units     */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContexts : channelsNbr distinct channels        */
+/*      -(i) channelsNbr : number of channels                                */
+/*      -(i) bitStreams : channelsNbr frames payloads, as given to           */
+/*           bcg729Decoder, may be NULL for erased or untransmitted frames   */
+/*      -(i) bitStreamLength : channelsNbr payloads lengths in bytes         */
+/*      -(i) frameErasureFlag : channelsNbr flags: true, frame has been      */
+/*           erased                                                          */
+/*      -(i) SIDFrameFlag : channelsNbr flags: true, frame is a SID one      */
+/*      -(i) rfc3389PayloadFlag : true when CN payload follow rfc3389        */
+/*      -(o) signals : channelsNbr buffers of 80 samples (16 bits PCM)       */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729DecoderMultiChannel(bcg729DecoderChannelContextStruct *decoderChannelContexts[], uint16_t channelsNbr, const uint8_t *bitStreams[], const uint8_t bitStreamLength[], const uint8_t frameErasureFlag[], const uint8_t SIDFrameFlag[], uint8_t rfc3389PayloadFlag, int16_t *signals[]);
+
+/*****************************************************************************/
+/* bcg729SetDecoderMode : select the output stages used by the decoder       */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) mode : one of BCG729_DECODER_MODE_*, unknown values select      */
+/*           BCG729_DECODER_MODE_STANDARD                                    */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729SetDecoderMode(bcg729DecoderChannelContextStruct *decoderChannelContext, uint8_t mode);
+
+/*****************************************************************************/
+/* bcg729SetDecoderOutputFormat : select the output format written by       */
+/*      bcg729DecoderFormatted on this channel                               */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) format : one of BCG729_OUTPUT_FORMAT_*, unknown values select   */
+/*           BCG729_OUTPUT_FORMAT_PCM16                                      */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729SetDecoderOutputFormat(bcg729DecoderChannelContextStruct *decoderChannelContext, uint8_t format);
+
+/*****************************************************************************/
+/* bcg729DecoderFormatted : decode a frame as bcg729Decoder does and write   */
+/*      it in the output format of the channel(see                           */
+/*      bcg729SetDecoderOutputFormat): the conversion is done on each post   */
+/*      processed subframe, no intermediate 16 bits PCM frame is written     */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer          */
+/*      -(i) frameErased: flag: true, frame has been erased                  */
+/*      -(i) SIDFrameFlag: flag: true, frame is a SID one                    */
+/*      -(i) rfc3389PayloadFlag: true when CN payload follow rfc3389         */
+/*      -(o) output : a decoded frame in the channel output format, must     */
+/*           hold up to 960 bytes(BCG729_OUTPUT_FORMAT_PCM16_48KHZ)          */
+/*    return value : number of bytes written in output                       */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint16_t bcg729DecoderFormatted(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, void *output);
+
+/*****************************************************************************/
+/* bcg729LinearToG711 : compress 16 bits PCM to G711 codes as                */
+/*      bcg729DecoderFormatted does on ULAW and ALAW outputs, no channel is  */
+/*      needed                                                               */
+/*    parameters:                                                            */
+/*      -(i) signal : samplesNbr 16 bits PCM samples                         */
+/*      -(i) samplesNbr : number of samples to convert                       */
+/*      -(i) format : BCG729_OUTPUT_FORMAT_ULAW or BCG729_OUTPUT_FORMAT_ALAW */
+/*      -(o) codes : samplesNbr G711 mu-law or A-law codes                   */
+/*    return value : 0 on success, -1 if format is not a G711 one            */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY int bcg729LinearToG711(const int16_t signal[], uint32_t samplesNbr, uint8_t format, uint8_t codes[]);
+
+/*****************************************************************************/
+/* bcg729DecoderStrided : decode a frame as bcg729DecoderFormatted does and  */
+/*      write its samples interleaved with other channels ones(TDM           */
+/*      timeslots, multi channel playback buffers) directly in the           */
+/*      interleaved buffer, samples of the other channels are left           */
+/*      untouched. For a buffer of N interleaved channels, the channel c     */
+/*      output is the address of its first sample(buffer + c*sample size in */
+/*      bytes) with a stride of N                                            */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer          */
+/*      -(i) frameErased: flag: true, frame has been erased                  */
+/*      -(i) SIDFrameFlag: flag: true, frame is a SID one                    */
+/*      -(i) rfc3389PayloadFlag: true when CN payload follow rfc3389         */
+/*      -(o) output : first sample of the frame in the channel output format */
+/*      -(i) stride : distance in samples between two samples of the frame,  */
+/*           1 for contiguous samples, 0 is handled as 1                     */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729DecoderStrided(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, void *output, uint16_t stride);
+
+/*****************************************************************************/
+/* bcg729DecoderAdvance : update the decoder state with a frame without      */
+/*      producing any signal: LSP, pitch delay, gains and SID parameters are */
+/*      decoded so the channel stays in sync, excitation and synthesis       */
+/*      memories are reset. The first frames decoded after an advance are    */
+/*      not bit exact (the excitation history is rebuilt within a few frames)*/
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer          */
+/*      -(i) frameErased: flag: true, frame has been erased                  */
+/*      -(i) SIDFrameFlag: flag: true, frame is a SID one                    */
+/*      -(i) rfc3389PayloadFlag: true when CN payload follow rfc3389         */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729DecoderAdvance(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag);
+
+/*****************************************************************************/
+/* bcg729DecoderAdjustPlayout : decode a frame as bcg729Decoder and, if it   */
+/*      is a comfort noise frame(SID, untransmitted or erased during         */
+/*      silence), stretch or shrink its output by adjustment samples to      */
+/*      compensate clock drift or jitter buffer delay. Stretching decodes an */
+/*      extra untransmitted frame, shrinking removes samples, both with a    */
+/*      crossfade. Speech frames are output unchanged: retry on a later frame*/
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer          */
+/*      -(i) frameErased: flag: true, frame has been erased                  */
+/*      -(i) SIDFrameFlag: flag: true, frame is a SID one                    */
+/*      -(i) rfc3389PayloadFlag: true when CN payload follow rfc3389         */
+/*      -(i) adjustment : in samples, in [-80, 80], positive to stretch      */
+/*      -(o) signal : decoded signal(16 bits PCM), must hold 160 samples     */
+/*    return value : number of samples in signal, 80 + adjustment on comfort */
+/*           noise frames, 80 otherwise                                      */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint16_t bcg729DecoderAdjustPlayout(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, int16_t adjustment, int16_t signal[]);
+
+/*****************************************************************************/
+/* bcg729DecoderTimeScale : decode a frame as bcg729Decoder and play it      */
+/*      faster without changing its pitch (voicemail fast playback): whole   */
+/*      pitch periods, as decoded from the bitstream and refined by the post */
+/*      filter, are removed with a crossfade. The output is delayed by 286   */
+/*      samples and its length varies, 80*256/speed samples per frame on     */
+/*      average. Decoding with bcg729Decoder in between discards nothing but */
+/*      breaks the output continuity                                         */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer          */
+/*      -(i) frameErased: flag: true, frame has been erased                  */
+/*      -(i) SIDFrameFlag: flag: true, frame is a SID one                    */
+/*      -(i) rfc3389PayloadFlag: true when CN payload follow rfc3389         */
+/*      -(i) speed : playback speed in Q8, in [256, 512] (x1 to x2), may     */
+/*           change on every frame                                           */
+/*      -(o) signal : time scaled signal(16 bits PCM), must hold 80 samples  */
+/*    return value : number of samples in signal, in [0, 80]                 */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint16_t bcg729DecoderTimeScale(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, uint16_t speed, int16_t signal[]);
+
+/*****************************************************************************/
+/* bcg729DecoderTimeScaleFlush : output the samples still delayed by         */
+/*      bcg729DecoderTimeScale, call it until it returns 0 at end of stream  */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(o) signal : time scaled signal(16 bits PCM), must hold 80 samples  */
+/*    return value : number of samples in signal, 0 when all were output     */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint16_t bcg729DecoderTimeScaleFlush(bcg729DecoderChannelContextStruct *decoderChannelContext, int16_t signal[]);
+
+/*****************************************************************************/
+/* bcg729GetDecoderActivity : get the channel activity as estimated from the */
+/*      decoded gains of the frames given to bcg729Decoder or                */
+/*      bcg729DecoderAdvance                                                 */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(o) energydB : smoothed excitation energy in dB in Q8               */
+/*      -(o) voiceActivity : 1 if voice activity is detected, 0 otherwise    */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729GetDecoderActivity(bcg729DecoderChannelContextStruct *decoderChannelContext, int16_t *energydB, uint8_t *voiceActivity);
+
+/*****************************************************************************/
+/* bcg729SelectActiveSpeakers : select the loudest channels with voice       */
+/*      activity, channels fully decoded at previous frame are favored to    */
+/*      avoid switching between speakers of close levels. The selection uses */
+/*      the previous frames: call it before giving the current frame to      */
+/*      bcg729Decoder (selected channels) or bcg729DecoderAdvance (others)   */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContexts : channelsNbr channels contexts          */
+/*      -(i) channelsNbr : number of channels                                */
+/*      -(i) maxSpeakersNbr : maximum number of channels to select           */
+/*      -(o) selectedChannels : indexes of the selected channels, loudest    */
+/*           first, must hold maxSpeakersNbr values                          */
+/*    return value : number of selected channels                             */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint16_t bcg729SelectActiveSpeakers(bcg729DecoderChannelContextStruct *decoderChannelContexts[], uint16_t channelsNbr, uint16_t maxSpeakersNbr, uint16_t selectedChannels[]);
+
+/*****************************************************************************/
+/* bcg729GetEncoderHints : get the parameters of the last decoded frame to   */
+/*      be given to bcg729SetEncoderHints when the decoded signal is         */
+/*      re-encoded. Hints flags are null after erased, SID, untransmitted or */
+/*      advanced(see bcg729DecoderAdvance) frames                            */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(o) hints : the encoder hints                                       */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729GetEncoderHints(bcg729DecoderChannelContextStruct *decoderChannelContext, bcg729EncoderHints *hints);
+
+/*****************************************************************************/
+/* bcg729GetDecoderStats : get the operational counters of a channel, they   */
+/*      are updated on each decoded frame at the cost of a few increments    */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(o) stats : counters since the channel creation or the last reset   */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729GetDecoderStats(bcg729DecoderChannelContextStruct *decoderChannelContext, bcg729DecoderStats *stats);
+
+/*****************************************************************************/
+/* bcg729ResetDecoderStats : reset the operational counters of a channel     */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729ResetDecoderStats(bcg729DecoderChannelContextStruct *decoderChannelContext);
 #endif /* ifndef DECODER_H */
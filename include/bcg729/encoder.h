@@ -35,6 +35,45 @@ typedef struct bcg729EncoderChannelContextStruct_struct bcg729EncoderChannelCont
 	#define BCG729_VISIBILITY __attribute__ ((visibility ("default")))
 #endif
 
+/* Encoder hints flags */
+#define BCG729_ENCODER_HINT_LSP		0x01 /* L1 is valid */
+#define BCG729_ENCODER_HINT_PITCH	0x02 /* intPitchDelay is valid */
+
+/* Parameters of a decoded frame given to an encoder re-encoding the decoded signal (tandem), see bcg729GetEncoderHints */
+typedef struct {
+	uint8_t flags; /* combination of BCG729_ENCODER_HINT_*, 0 when no hint is available */
+	uint16_t L1; /* first stage vector of LSP quantizer (7 bits) */
+	int16_t intPitchDelay[2]; /* integer part of pitch delay for each subframe in [20, 143] */
+} bcg729EncoderHints;
+
+/* Operational counters of an encoder channel, see bcg729GetEncoderStats. Active and noise(SID and untransmitted) frames */
+/* give the VAD speech/noise ratio, all frames are active when VAD is disabled                                          */
+typedef struct {
+	uint32_t framesNbr; /* frames encoded */
+	uint32_t activeFramesNbr; /* active voice frames(10 bytes) */
+	uint32_t SIDFramesNbr; /* SID frames(2 bytes) */
+	uint32_t untransmittedFramesNbr; /* noise frames not transmitted(0 byte) */
+	uint32_t LSPConversionFailuresNbr; /* LP to LSP conversions which failed, the previous frame LSP were used */
+} bcg729EncoderStats;
+
+/* Input formats: select the samples read by bcg729EncoderFormatted, format can be changed on any frame */
+/* PCM16: 80 samples 16 bits PCM at 8kHz, the bcg729Encoder input(160 bytes) */
+/* FLOAT: 80 samples 32 bits float at 8kHz in [-1, 1[, scaled by 32768, rounded and saturated to 16 bits(320 bytes) */
+/* ULAW, ALAW: 80 G711 mu-law or A-law codes at 8kHz(80 bytes) */
+/* PCM16_16KHZ, PCM16_48KHZ, FLOAT_16KHZ, FLOAT_48KHZ: 160 or 480 samples 16 bits PCM or 32 bits float, decimated */
+/*           to 8kHz by a linear phase lowpass filter(-3dB at 3.7kHz) delaying the input by 8 samples at 8kHz(1ms), */
+/*           the filter memory is reset when the input format is changed                                          */
+/* PCM16, FLOAT(when the input samples are multiples of 1/32768), ULAW and ALAW encodings are bit exact with      */
+/* bcg729Encoder given the same 16 bits PCM samples                                                              */
+#define BCG729_INPUT_FORMAT_PCM16		0
+#define BCG729_INPUT_FORMAT_FLOAT		1
+#define BCG729_INPUT_FORMAT_ULAW		2
+#define BCG729_INPUT_FORMAT_ALAW		3
+#define BCG729_INPUT_FORMAT_PCM16_16KHZ	4
+#define BCG729_INPUT_FORMAT_PCM16_48KHZ	5
+#define BCG729_INPUT_FORMAT_FLOAT_16KHZ	6
+#define BCG729_INPUT_FORMAT_FLOAT_48KHZ	7
+
 /*****************************************************************************/
 /* initBcg729EncoderChannel : create context structure and initialise it     */
 /*    parameters:                                                            */
@@ -67,6 +106,108 @@ BCG729_VISIBILITY void closeBcg729EncoderChannel(bcg729EncoderChannelContextStru
 /*****************************************************************************/
 BCG729_VISIBILITY void bcg729Encoder(bcg729EncoderChannelContextStruct *encoderChannelContext, const int16_t inputFrame[], uint8_t bitStream[], uint8_t *bitStreamLength);
 
+/*****************************************************************************/
+/* bcg729SetEncoderInputFormat : select the input format read by             */
+/*      bcg729EncoderFormatted on this channel                               */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*      -(i) format : one of BCG729_INPUT_FORMAT_*, unknown values select    */
+/*           BCG729_INPUT_FORMAT_PCM16                                       */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729SetEncoderInputFormat(bcg729EncoderChannelContextStruct *encoderChannelContext, uint8_t format);
+
+/*****************************************************************************/
+/* bcg729EncoderFormatted : encode a frame given in the input format of the  */
+/*      channel(see bcg729SetEncoderInputFormat) as bcg729Encoder does: the  */
+/*      conversion and decimation are done in the input high pass filter     */
+/*      loop, no intermediate 8kHz 16 bits PCM frame is written              */
+/*    parameters:                                                            */
+/*      -(i) encoderChannelContext : context for this encoder channel        */
+/*      -(i) input : a frame (10ms) in the channel input format              */
+/*      -(o) bitStream : The 15 parameters for a frame on 80 bits            */
+/*           on 80 bits (5 16bits words) for voice frame, 4 on 2 byte for    */
+/*           noise frame, 0 for untransmitted frames                         */
+/*      -(o) bitStreamLength : actual length of output, may be 0, 2 or 10    */
+/*           if VAD/DTX is enabled                                           */
+/*    return value : number of bytes read from input                         */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint16_t bcg729EncoderFormatted(bcg729EncoderChannelContextStruct *encoderChannelContext, const void *input, uint8_t bitStream[], uint8_t *bitStreamLength);
+
+/*****************************************************************************/
+/* bcg729EncoderStrided : encode a frame of samples interleaved with other   */
+/*      channels ones(TDM timeslots, multi channel capture buffers), given   */
+/*      in the input format of the channel: samples are read directly from   */
+/*      the interleaved buffer, the output is the bcg729EncoderFormatted one */
+/*      on the same samples. For a buffer of N interleaved channels, the     */
+/*      channel c input is the address of its first sample(buffer + c*sample */
+/*      size in bytes) with a stride of N                                    */
+/*    parameters:                                                            */
+/*      -(i) encoderChannelContext : context for this encoder channel        */
+/*      -(i) input : first sample of the frame in the channel input format   */
+/*      -(i) stride : distance in samples between two samples of the frame, */
+/*           1 for contiguous samples, 0 is handled as 1                     */
+/*      -(o) bitStream : The 15 parameters for a frame on 80 bits            */
+/*           on 80 bits (5 16bits words) for voice frame, 4 on 2 byte for    */
+/*           noise frame, 0 for untransmitted frames                         */
+/*      -(o) bitStreamLength : actual length of output, may be 0, 2 or 10    */
+/*           if VAD/DTX is enabled                                           */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729EncoderStrided(bcg729EncoderChannelContextStruct *encoderChannelContext, const void *input, uint16_t stride, uint8_t bitStream[], uint8_t *bitStreamLength);
+
+/*****************************************************************************/
+/* bcg729EncoderStream : encode any number of samples, the samples not       */
+/*      filling a frame are kept in the context and encoded with the samples */
+/*      of the next call. Whole frames are encoded directly from the input   */
+/*      buffer. Output frames are concatenated in the bitStream buffer       */
+/*    parameters:                                                            */
+/*      -(i) encoderChannelContext : context for this encoder channel        */
+/*      -(i) input : 16 bits PCM samples                                     */
+/*      -(i) inputLength : number of samples in input                        */
+/*      -(o) bitStream : the encoded frames, each of them being 10, 2 or 0   */
+/*           bytes long, must hold 10*maxFramesNbr bytes                     */
+/*      -(o) bitStreamLength : length of each encoded frame, must hold       */
+/*           maxFramesNbr values                                             */
+/*      -(i) maxFramesNbr : maximum number of frames to encode, the input is */
+/*           fully consumed when it is at least                              */
+/*           (inputLength + 79)/80 (the context keeps less than 80 samples)  */
+/*      -(o) inputConsumed : number of input samples consumed, may be NULL   */
+/*    return value : the number of encoded frames                            */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint16_t bcg729EncoderStream(bcg729EncoderChannelContextStruct *encoderChannelContext, const int16_t input[], uint32_t inputLength, uint8_t bitStream[], uint8_t bitStreamLength[], uint16_t maxFramesNbr, uint32_t *inputConsumed);
+
+/*****************************************************************************/
+/* bcg729SetEncoderSilenceThreshold : digital silence (all zero frames after */
+/*      the input high pass filter) is always detected and encoded with a    */
+/*      reduced complexity while staying bit exact. When threshold is not    */
+/*      null, frames with all samples magnitude(after the high pass filter   */
+/*      which removes any constant component and scales the input by 1/2)    */
+/*      lower or equal to threshold are encoded as digital silence: this is  */
+/*      not bit exact anymore. Default is 0.                                 */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*      -(i) threshold : maximum magnitude in Q0, 0 keeps bit exactness      */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729SetEncoderSilenceThreshold(bcg729EncoderChannelContextStruct *encoderChannelContext, uint16_t threshold);
+
+/*****************************************************************************/
+/* bcg729SetEncoderHints : give the parameters of the decoded frame matching */
+/*      the next input frame when re-encoding a G729 decoded signal (tandem) */
+/*      The input signal must be frame aligned with the decoder output. The  */
+/*      hints narrow the open loop and closed loop pitch searches and the    */
+/*      first stage LSP quantizer search: the encoding is not bit exact      */
+/*      anymore. Hints apply to the next call to bcg729Encoder only.         */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*      -(i) hints : as given by bcg729GetEncoderHints, NULL for no hint     */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729SetEncoderHints(bcg729EncoderChannelContextStruct *encoderChannelContext, const bcg729EncoderHints *hints);
+
 /*****************************************************************************/
 /* bcg729GetRFC3389Payload : return the comfort noise payload according to   */
 /*                     RFC3389 for the last CN frame generated by encoder    */
@@ -78,4 +219,36 @@ BCG729_VISIBILITY void bcg729Encoder(bcg729EncoderChannelContextStruct *encoderC
 /*                                                                           */
 /*****************************************************************************/
 BCG729_VISIBILITY void bcg729GetRFC3389Payload(bcg729EncoderChannelContextStruct *encoderChannelContext, uint8_t payload[]);
+
+/*****************************************************************************/
+/* bcg729GetEncoderStats : get the operational counters of a channel, they   */
+/*      are updated on each encoded frame at the cost of a few increments    */
+/*    parameters:                                                            */
+/*      -(i) encoderChannelContext : context for this encoder channel        */
+/*      -(o) stats : counters since the channel creation or the last reset   */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729GetEncoderStats(bcg729EncoderChannelContextStruct *encoderChannelContext, bcg729EncoderStats *stats);
+
+/*****************************************************************************/
+/* bcg729ResetEncoderStats : reset the operational counters of a channel     */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729ResetEncoderStats(bcg729EncoderChannelContextStruct *encoderChannelContext);
+
+/*****************************************************************************/
+/* bcg729G711ToLinear : expand G711 codes to 16 bits PCM as                  */
+/*      bcg729EncoderFormatted does on ULAW and ALAW inputs, no channel is   */
+/*      needed                                                               */
+/*    parameters:                                                            */
+/*      -(i) codes : samplesNbr G711 mu-law or A-law codes                   */
+/*      -(i) samplesNbr : number of samples to convert                       */
+/*      -(i) format : BCG729_INPUT_FORMAT_ULAW or BCG729_INPUT_FORMAT_ALAW   */
+/*      -(o) signal : samplesNbr 16 bits PCM samples                         */
+/*    return value : 0 on success, -1 if format is not a G711 one            */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY int bcg729G711ToLinear(const uint8_t codes[], uint32_t samplesNbr, uint8_t format, int16_t signal[]);
 #endif /* ifndef ENCODER_H */
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef JITTERBUFFER_H
+#define JITTERBUFFER_H
+#include <stdint.h>
+#include "decoder.h"
+typedef struct bcg729JitterBufferStruct_struct bcg729JitterBufferStruct;
+
+/* The jitter buffer clock is the playout: each call to bcg729JitterBufferGet advances it by one frame(80 samples).    */
+/* Packets arrival time is the clock value when they are given to bcg729JitterBufferPut. The playout delay target is   */
+/* the 98th percentile of recent packets delay over the fastest one. It is reached by inserting or dropping frames     */
+/* during silence periods (SID and untransmitted frames), or by concealing a missing speech frame while waiting for it */
+
+/* Jitter buffer statistics, counters since buffer creation */
+typedef struct {
+	uint32_t receivedFramesNbr; /* frames given to bcg729JitterBufferPut and stored */
+	uint32_t lateFramesNbr; /* frames received after their playout time, discarded */
+	uint32_t duplicatedFramesNbr; /* frames received twice, discarded */
+	uint32_t reorderedPacketsNbr; /* packets received with a sequence number lower than a previous one */
+	uint32_t concealedFramesNbr; /* missing frames during speech periods, concealed by the decoder */
+	uint32_t insertedFramesNbr; /* comfort noise or concealed frames inserted to increase the playout delay */
+	uint32_t droppedFramesNbr; /* silence frames dropped to decrease the playout delay */
+	uint16_t targetDelay; /* in samples, playout delay over the fastest packet aimed by the buffer */
+	uint16_t currentDelay; /* in samples, current playout delay over the fastest packet */
+} bcg729JitterBufferStats;
+
+/*****************************************************************************/
+/* initBcg729JitterBuffer : create jitter buffer and initialise it           */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the decoder channel fed by the buffer,  */
+/*           still owned by the caller                                       */
+/*      -(i) minDelay : minimum playout delay, in frames                     */
+/*      -(i) maxDelay : maximum playout delay, in frames, up to 50           */
+/*    return value :                                                         */
+/*      - the jitter buffer, NULL if delays are invalid                      */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY bcg729JitterBufferStruct *initBcg729JitterBuffer(bcg729DecoderChannelContextStruct *decoderChannelContext, uint16_t minDelay, uint16_t maxDelay);
+
+/*****************************************************************************/
+/* closeBcg729JitterBuffer : free memory of jitter buffer                    */
+/*    parameters:                                                            */
+/*      -(i) jitterBuffer : the jitter buffer                                */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void closeBcg729JitterBuffer(bcg729JitterBufferStruct *jitterBuffer);
+
+/*****************************************************************************/
+/* bcg729JitterBufferPut : store the frames of a received RTP packet         */
+/*    parameters:                                                            */
+/*      -(i/o) jitterBuffer : the jitter buffer                              */
+/*      -(i) sequenceNumber : RTP sequence number                            */
+/*      -(i) timestamp : RTP timestamp(8kHz clock) of the first frame        */
+/*      -(i) payload : RTP payload(RFC3551 G729 payload)                     */
+/*      -(i) payloadLength : in bytes                                        */
+/*    return value : number of frames stored, late, duplicated and invalid   */
+/*           frames are discarded                                            */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint16_t bcg729JitterBufferPut(bcg729JitterBufferStruct *jitterBuffer, uint16_t sequenceNumber, uint32_t timestamp, const uint8_t payload[], uint16_t payloadLength);
+
+/*****************************************************************************/
+/* bcg729JitterBufferGet : decode the next frame to play, to be called every */
+/*      10 ms. Before the first packet is received, the output is silence    */
+/*    parameters:                                                            */
+/*      -(i/o) jitterBuffer : the jitter buffer                              */
+/*      -(o) signal : a decoded frame 80 samples (16 bits PCM)               */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729JitterBufferGet(bcg729JitterBufferStruct *jitterBuffer, int16_t signal[]);
+
+/*****************************************************************************/
+/* bcg729GetJitterBufferStats : get the jitter buffer statistics             */
+/*    parameters:                                                            */
+/*      -(i) jitterBuffer : the jitter buffer                                */
+/*      -(o) stats : the jitter buffer statistics                            */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729GetJitterBufferStats(bcg729JitterBufferStruct *jitterBuffer, bcg729JitterBufferStats *stats);
+#endif /* ifndef JITTERBUFFER_H */
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef RECORDING_H
+#define RECORDING_H
+#include <stdint.h>
+#include "decoder.h"
+#include "analyzer.h"
+typedef struct bcg729RecordingWriterStruct_struct bcg729RecordingWriterStruct;
+typedef struct bcg729RecordingReaderStruct_struct bcg729RecordingReaderStruct;
+
+/* Recording container, all values little endian:                                                                     */
+/*   header(32 bytes): "BCGR", version(16 bits), checkpoint interval in frames(16 bits), frames number, checkpoints    */
+/*       number, checkpoint size, frame types offset, checkpoints offset, frame payloads offset(32 bits each)         */
+/*   frame types: one BCG729_FRAME_TYPE_* byte per frame(ACTIVE, SID, UNTRANSMITTED or ERASED)                         */
+/*   checkpoints: every checkpoint interval frames from the first one, the frame payload offset(32 bits) and the      */
+/*       decoder state before decoding this frame                                                                     */
+/*   frame payloads: 10 bytes for active frames, 2 bytes for SID frames, none for untransmitted and erased frames     */
+/* The reader works directly on the container in memory, typically a read only mapping of the recording file: several */
+/* readers on the same recording decode disjoint segments in parallel                                                */
+
+/*****************************************************************************/
+/* initBcg729RecordingWriter : create a recording writer                     */
+/*    parameters:                                                            */
+/*      -(i) checkpointInterval : in frames, a decoder state checkpoint(844  */
+/*           bytes) is stored every checkpointInterval frames                */
+/*    return value :                                                         */
+/*      - the recording writer, NULL if checkpointInterval is 0              */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY bcg729RecordingWriterStruct *initBcg729RecordingWriter(uint16_t checkpointInterval);
+
+/*****************************************************************************/
+/* closeBcg729RecordingWriter : free memory of recording writer              */
+/*    parameters:                                                            */
+/*      -(i) recordingWriter : the recording writer                          */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void closeBcg729RecordingWriter(bcg729RecordingWriterStruct *recordingWriter);
+
+/*****************************************************************************/
+/* bcg729RecordingWriterAddFrame : append a frame to the recording, the      */
+/*      writer decodes it to get the checkpoints decoder state               */
+/*    parameters:                                                            */
+/*      -(i/o) recordingWriter : the recording writer                        */
+/*      -(i) bitStream : the frame payload                                   */
+/*      -(i) bitStreamLength : in bytes, 10 for active frames, 2 for SID     */
+/*           frames, 0 for untransmitted ones                                */
+/*      -(i) frameErasureFlag : flag: true, frame has been erased, no        */
+/*           payload is recorded                                             */
+/*    return value : frame type: BCG729_FRAME_TYPE_ACTIVE, SID,              */
+/*           UNTRANSMITTED, ERASED or INVALID(frame is not recorded)         */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint8_t bcg729RecordingWriterAddFrame(bcg729RecordingWriterStruct *recordingWriter, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag);
+
+/*****************************************************************************/
+/* bcg729GetRecordingSize : size of the recording container                  */
+/*    parameters:                                                            */
+/*      -(i) recordingWriter : the recording writer                          */
+/*    return value : size in bytes of the container holding all the frames  */
+/*           added so far                                                    */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint32_t bcg729GetRecordingSize(bcg729RecordingWriterStruct *recordingWriter);
+
+/*****************************************************************************/
+/* bcg729WriteRecording : write the recording container, frames can still be */
+/*      added after it to write a longer one                                 */
+/*    parameters:                                                            */
+/*      -(i) recordingWriter : the recording writer                          */
+/*      -(o) recording : the container, bcg729GetRecordingSize bytes         */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729WriteRecording(bcg729RecordingWriterStruct *recordingWriter, uint8_t recording[]);
+
+/*****************************************************************************/
+/* initBcg729RecordingReader : create a reader on a recording container,     */
+/*      positioned on the first frame                                        */
+/*    parameters:                                                            */
+/*      -(i) recording : the container, not copied: it must stay available   */
+/*           until the reader is closed                                      */
+/*      -(i) recordingSize : in bytes                                        */
+/*      -(i) decoderChannelContext : the decoder channel used to decode the  */
+/*           recording, still owned by the caller. Its state is replaced on  */
+/*           each seek, the decoder mode is kept                             */
+/*    return value :                                                         */
+/*      - the recording reader, NULL if the container header is invalid      */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY bcg729RecordingReaderStruct *initBcg729RecordingReader(const uint8_t recording[], uint32_t recordingSize, bcg729DecoderChannelContextStruct *decoderChannelContext);
+
+/*****************************************************************************/
+/* closeBcg729RecordingReader : free memory of recording reader              */
+/*    parameters:                                                            */
+/*      -(i) recordingReader : the recording reader                          */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void closeBcg729RecordingReader(bcg729RecordingReaderStruct *recordingReader);
+
+/*****************************************************************************/
+/* bcg729GetRecordingFramesNbr : number of frames in the recording           */
+/*    parameters:                                                            */
+/*      -(i) recordingReader : the recording reader                          */
+/*    return value : number of frames                                        */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint32_t bcg729GetRecordingFramesNbr(bcg729RecordingReaderStruct *recordingReader);
+
+/*****************************************************************************/
+/* bcg729RecordingSeek : position the reader on a frame. The decoder state   */
+/*      is restored from the closest previous checkpoint and the frames up   */
+/*      to the requested one decoded: output is bit exact with a decoding    */
+/*      from the beginning of the recording                                  */
+/*    parameters:                                                            */
+/*      -(i/o) recordingReader : the recording reader                        */
+/*      -(i) frameIndex : index of the next frame to read                    */
+/*    return value : index of the next frame to read, lower than frameIndex  */
+/*           if it is beyond the end or the container is truncated           */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint32_t bcg729RecordingSeek(bcg729RecordingReaderStruct *recordingReader, uint32_t frameIndex);
+
+/*****************************************************************************/
+/* bcg729RecordingRead : decode the next frames of the recording             */
+/*    parameters:                                                            */
+/*      -(i/o) recordingReader : the recording reader                        */
+/*      -(i) framesNbr : maximum number of frames to decode                  */
+/*      -(o) signal : decoded signal(16 bits PCM), 80 samples per frame      */
+/*    return value : number of frames decoded, lower than framesNbr at the   */
+/*           end of the recording                                            */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint32_t bcg729RecordingRead(bcg729RecordingReaderStruct *recordingReader, uint32_t framesNbr, int16_t signal[]);
+#endif /* ifndef RECORDING_H */
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef RTP_H
+#define RTP_H
+#include <stdint.h>
+#include "encoder.h"
+#include "decoder.h"
+
+/* RFC3551 G729 payload: any number of 10 bytes frames optionally followed by one 2 bytes Annex B SID frame */
+
+/*****************************************************************************/
+/* bcg729GetRTPPayloadFramesNbr : number of frames in a G729 RTP payload     */
+/*    parameters:                                                            */
+/*      -(i) payloadLength : in bytes                                        */
+/*    return value : number of frames(SID frame included), 0 if the payload  */
+/*           length is not a multiple of 10 bytes plus 0 or 2 bytes          */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint16_t bcg729GetRTPPayloadFramesNbr(uint16_t payloadLength);
+
+/*****************************************************************************/
+/* bcg729EncodeRTPPayload : encode frames directly in a RTP packet payload   */
+/*      The payload ends after a SID frame, or before an untransmitted frame */
+/*      following transmitted ones: untransmitted frames are not part of any */
+/*      payload and the caller shall advance the RTP timestamp accordingly   */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*      -(i) input : framesNbr frames of 80 16 bits PCM samples              */
+/*      -(i) framesNbr : maximum number of frames to put in the payload      */
+/*      -(o) packet : the payload is written from packet[headroom], must     */
+/*           hold headroom + 10*framesNbr bytes                              */
+/*      -(i) headroom : room left at the beginning of packet for the RTP     */
+/*           header, it is not modified                                      */
+/*      -(o) payloadFirstFrame : index in input of the first frame in the    */
+/*           payload: the payload timestamp is the one of input plus         */
+/*           80*payloadFirstFrame                                            */
+/*      -(o) framesConsumed : number of input frames encoded, the next call  */
+/*           shall start at input[80*framesConsumed]                         */
+/*    return value : the payload length in bytes, 0 if all consumed frames   */
+/*           are untransmitted                                               */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint16_t bcg729EncodeRTPPayload(bcg729EncoderChannelContextStruct *encoderChannelContext, const int16_t input[], uint16_t framesNbr, uint8_t packet[], uint16_t headroom, uint16_t *payloadFirstFrame, uint16_t *framesConsumed);
+
+/*****************************************************************************/
+/* bcg729DecodeRTPPayload : decode all the frames of a RTP payload directly  */
+/*      from the packet. Lost packets and untransmitted frames must be       */
+/*      given to bcg729Decoder (erased or untransmitted frames)              */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) payload : RTP packet payload                                    */
+/*      -(i) payloadLength : in bytes                                        */
+/*      -(o) signal : decoded frames, 80 samples (16 bits PCM) per frame,    */
+/*           must hold 80*bcg729GetRTPPayloadFramesNbr(payloadLength) values */
+/*    return value : number of decoded frames, 0 if payload length is        */
+/*           invalid(nothing is decoded)                                     */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint16_t bcg729DecodeRTPPayload(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t payload[], uint16_t payloadLength, int16_t signal[]);
+#endif /* ifndef RTP_H */
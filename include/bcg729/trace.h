@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef TRACE_H
+#define TRACE_H
+#include <stdint.h>
+#include "encoder.h"
+#include "decoder.h"
+typedef struct bcg729TraceWriterStruct_struct bcg729TraceWriterStruct;
+typedef struct bcg729TraceReaderStruct_struct bcg729TraceReaderStruct;
+
+/* Call traces: once a trace writer is attached to a channel, each bcg729Encoder, bcg729Decoder and                  */
+/* bcg729DecoderMultiChannel call on it is appended to the trace with its inputs and a digest of its outputs, so the  */
+/* traffic of a production system can be replayed on any build(see tools/replay.c). Untraced channels only pay a      */
+/* pointer test per frame.                                                                                           */
+/* Trace format, all values little endian: header(8 bytes): "BCGT", version(16 bits), 16 reserved bits, followed by  */
+/* records starting with their type(8 bits) and channel id(32 bits):                                                 */
+/*   ENCODER_OPEN: VAD enabled(8 bits), initial state flag(8 bits): set when the channel had not encoded any frame   */
+/*       out of the trace, the replay is bit exact only then                                                         */
+/*   DECODER_OPEN: the decoder state(840 bytes), decoder channels replay bit exact from any frame                    */
+/*   ENCODE: input frame(80 samples of 16 bits), silence threshold(16 bits), hints flags(8 bits) followed when not 0 */
+/*       by L1 and the 2 integer pitch delays(16 bits each), bitstream length(8 bits) and the bitstream              */
+/*   DECODE: flags(8 bits: erasure, SID, RFC3389, NULL bitstream, decoder mode on bits 4-5), bitstream length        */
+/*       (8 bits), the bitstream bytes read by the decoder(up to 11), checksum of the decoded frame(32 bits)         */
+/* A channel encoding or decoding out of the trace(formatted, strided or advance calls, frames decoded while the      */
+/* writer was detached) gets a new OPEN record on its next traced frame.                                             */
+/* A writer is not thread safe: channels sharing a writer must be used from the same thread.                         */
+#define BCG729_TRACE_END		0
+#define BCG729_TRACE_ENCODER_OPEN	1
+#define BCG729_TRACE_DECODER_OPEN	2
+#define BCG729_TRACE_ENCODE		3
+#define BCG729_TRACE_DECODE		4
+
+#define BCG729_TRACE_MAX_BITSTREAM_LENGTH 11 /* RFC3389 comfort noise payload: noise level and 10 reflection coefficients */
+
+/* receive the trace data, in order, each time the writer buffer is full or flushed */
+typedef void (*bcg729TraceOutput)(void *userData, const uint8_t data[], uint32_t length);
+
+/* a record read from a trace */
+typedef struct {
+	uint8_t type; /* one of BCG729_TRACE_* */
+	uint32_t channelId; /* given when the writer was attached to the channel */
+	uint8_t enableVAD; /* ENCODER_OPEN */
+	uint8_t initialStateFlag; /* ENCODER_OPEN: set when the replay is bit exact */
+	const uint8_t *decoderState; /* DECODER_OPEN: points in the trace */
+	int16_t inputFrame[80]; /* ENCODE */
+	uint16_t silenceThreshold; /* ENCODE */
+	bcg729EncoderHints hints; /* ENCODE: hints given for the frame, flags is 0 when there was none */
+	uint8_t decoderMode; /* DECODE: one of BCG729_DECODER_MODE_* */
+	uint8_t frameErasureFlag, SIDFrameFlag, rfc3389PayloadFlag; /* DECODE */
+	uint8_t nullBitStreamFlag; /* DECODE: set when the bitstream was NULL */
+	uint8_t bitStream[BCG729_TRACE_MAX_BITSTREAM_LENGTH]; /* ENCODE output, DECODE input */
+	uint8_t bitStreamLength; /* ENCODE output, DECODE input */
+	uint32_t signalChecksum; /* DECODE: bcg729TraceChecksum of the decoded frame */
+} bcg729TraceRecord;
+
+/*****************************************************************************/
+/* initBcg729TraceWriter : create a trace writer, the trace header is given  */
+/*      to output with the first records                                    */
+/*    parameters:                                                            */
+/*      -(i) output : receives the trace data                                */
+/*      -(i) userData : given to output                                      */
+/*    return value :                                                         */
+/*      - the trace writer                                                   */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY bcg729TraceWriterStruct *initBcg729TraceWriter(bcg729TraceOutput output, void *userData);
+
+/*****************************************************************************/
+/* closeBcg729TraceWriter : flush and free memory of trace writer, it must   */
+/*      be detached from all channels                                        */
+/*    parameters:                                                            */
+/*      -(i) traceWriter : the trace writer                                  */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void closeBcg729TraceWriter(bcg729TraceWriterStruct *traceWriter);
+
+/*****************************************************************************/
+/* bcg729FlushTraceWriter : give the buffered records to the output          */
+/*    parameters:                                                            */
+/*      -(i/o) traceWriter : the trace writer                                */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729FlushTraceWriter(bcg729TraceWriterStruct *traceWriter);
+
+/*****************************************************************************/
+/* bcg729SetEncoderTrace : attach a trace writer to an encoder channel,      */
+/*      attach it before the first frame for a bit exact replay              */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*      -(i) traceWriter : the trace writer, NULL to detach                  */
+/*      -(i) channelId : identifies the channel in the trace                 */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729SetEncoderTrace(bcg729EncoderChannelContextStruct *encoderChannelContext, bcg729TraceWriterStruct *traceWriter, uint32_t channelId);
+
+/*****************************************************************************/
+/* bcg729SetDecoderTrace : attach a trace writer to a decoder channel, the   */
+/*      channel state is traced so it can be attached on any frame           */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) traceWriter : the trace writer, NULL to detach                  */
+/*      -(i) channelId : identifies the channel in the trace                 */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729SetDecoderTrace(bcg729DecoderChannelContextStruct *decoderChannelContext, bcg729TraceWriterStruct *traceWriter, uint32_t channelId);
+
+/*****************************************************************************/
+/* initBcg729TraceReader : create a reader on a trace, positioned on its     */
+/*      first record                                                         */
+/*    parameters:                                                            */
+/*      -(i) trace : the trace, not copied: it must stay available until the */
+/*           reader is closed                                                */
+/*      -(i) traceSize : in bytes                                            */
+/*    return value :                                                         */
+/*      - the trace reader, NULL if the trace header is invalid              */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY bcg729TraceReaderStruct *initBcg729TraceReader(const uint8_t trace[], uint32_t traceSize);
+
+/*****************************************************************************/
+/* closeBcg729TraceReader : free memory of trace reader                      */
+/*    parameters:                                                            */
+/*      -(i) traceReader : the trace reader                                  */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void closeBcg729TraceReader(bcg729TraceReaderStruct *traceReader);
+
+/*****************************************************************************/
+/* bcg729TraceReaderNext : read the next record of the trace                 */
+/*    parameters:                                                            */
+/*      -(i/o) traceReader : the trace reader                                */
+/*      -(o) record : the record                                             */
+/*    return value : the record type, BCG729_TRACE_END at the end of the     */
+/*           trace or on a truncated or invalid record                       */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint8_t bcg729TraceReaderNext(bcg729TraceReaderStruct *traceReader, bcg729TraceRecord *record);
+
+/*****************************************************************************/
+/* initBcg729TracedEncoderChannel : create an encoder channel as traced by   */
+/*      an ENCODER_OPEN record                                               */
+/*    parameters:                                                            */
+/*      -(i) record : the ENCODER_OPEN record                                */
+/*    return value :                                                         */
+/*      - the encoder channel context data                                   */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY bcg729EncoderChannelContextStruct *initBcg729TracedEncoderChannel(const bcg729TraceRecord *record);
+
+/*****************************************************************************/
+/* initBcg729TracedDecoderChannel : create a decoder channel in the state    */
+/*      traced by a DECODER_OPEN record                                      */
+/*    parameters:                                                            */
+/*      -(i) record : the DECODER_OPEN record                                */
+/*    return value :                                                         */
+/*      - the decoder channel context data                                   */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY bcg729DecoderChannelContextStruct *initBcg729TracedDecoderChannel(const bcg729TraceRecord *record);
+
+/*****************************************************************************/
+/* bcg729TraceChecksum : checksum of a decoded frame as stored in DECODE     */
+/*      records                                                              */
+/*    parameters:                                                            */
+/*      -(i) signal : a decoded frame 80 samples (16 bits PCM)               */
+/*    return value : the checksum                                            */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint32_t bcg729TraceChecksum(const int16_t signal[]);
+#endif /* ifndef TRACE_H */
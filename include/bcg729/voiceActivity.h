@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef VOICEACTIVITY_H
+#define VOICEACTIVITY_H
+#include <stdint.h>
+#include "encoder.h"
+typedef struct bcg729VoiceActivityChannelContextStruct_struct bcg729VoiceActivityChannelContextStruct;
+
+/* Standalone G729 Annex B voice activity detection of any 8kHz 16 bits PCM stream(G711 or decoded Opus legs, recordings):  */
+/* only the encoder preProcessing, LP analysis and VAD are run, the decisions are the ones made by an encoder with VAD enabled */
+/* on the same input. The encoder tracks the previous frame LSP on SID frames from the noise LP analysis: the decisions       */
+/* may differ only if the LSP conversion fails on the frame following a SID one.                                              */
+
+/*****************************************************************************/
+/* initBcg729VoiceActivityChannel : create context structure and initialise  */
+/*    return value :                                                         */
+/*      - the voice activity detection channel context data                  */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY bcg729VoiceActivityChannelContextStruct *initBcg729VoiceActivityChannel(void);
+
+/*****************************************************************************/
+/* closeBcg729VoiceActivityChannel : free memory of context structure        */
+/*    parameters:                                                            */
+/*      -(i) voiceActivityChannelContext : the channel context data          */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void closeBcg729VoiceActivityChannel(bcg729VoiceActivityChannelContextStruct *voiceActivityChannelContext);
+
+/*****************************************************************************/
+/* bcg729DetectVoiceActivity : voice activity decision of a frame            */
+/*    parameters:                                                            */
+/*      -(i/o) voiceActivityChannelContext : the channel context data        */
+/*      -(i) inputFrame : 80 samples (16 bits PCM)                           */
+/*    return value : 1 for active voice frame, 0 for noise frame             */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY uint8_t bcg729DetectVoiceActivity(bcg729VoiceActivityChannelContextStruct *voiceActivityChannelContext, const int16_t inputFrame[]);
+
+/*****************************************************************************/
+/* bcg729DetectVoiceActivityMultiChannel : voice activity decision of the    */
+/*      current frame of several channels                                    */
+/*    parameters:                                                            */
+/*      -(i/o) voiceActivityChannelContexts : channelsNbr channels contexts  */
+/*      -(i) channelsNbr : number of channels                                */
+/*      -(i) inputFrames : channelsNbr frames of 80 samples (16 bits PCM)    */
+/*      -(o) voiceActivity : channelsNbr decisions, 1 for active voice       */
+/*           frame, 0 for noise frame                                        */
+/*                                                                           */
+/*****************************************************************************/
+BCG729_VISIBILITY void bcg729DetectVoiceActivityMultiChannel(bcg729VoiceActivityChannelContextStruct *voiceActivityChannelContexts[], uint16_t channelsNbr, const int16_t *inputFrames[], uint8_t voiceActivity[]);
+#endif /* ifndef VOICEACTIVITY_H */
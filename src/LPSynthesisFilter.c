@@ -29,11 +29,13 @@
 /*      -(i/o) recontructedSpeech: 50 values in Q0                           */
 /*             [-NB_LSP_COEFF, -1] of previous values as input               */
 /*             [0, L_SUBFRAME[ as output                                     */
+/*    return value : number of output values saturated on 16 bits            */
 /*                                                                           */
 /*****************************************************************************/
-void LPSynthesisFilter (word16_t *excitationVector, word16_t *LPCoefficients, word16_t *reconstructedSpeech)
+int LPSynthesisFilter (word16_t *excitationVector, word16_t *LPCoefficients, word16_t *reconstructedSpeech)
 {
 	int i;
+	int saturatedSamplesNbr = 0;
 	/* compute excitationVector[i] - Sum0-9(LPCoefficients[j]*reconstructedSpeech[i-j]) */
 	for (i=0; i<L_SUBFRAME; i++) {
 		word32_t acc = SSHL(excitationVector[i],12); /* acc get the first term of the sum, in Q12 (excitationVector is in Q0)*/
@@ -41,7 +43,11 @@ void LPSynthesisFilter (word16_t *excitationVector, word16_t *LPCoefficients, wo
 		for (j=0; j<NB_LSP_COEFF; j++) {
 			acc = MSU16_16(acc, LPCoefficients[j], reconstructedSpeech[i-j-1]);
 		}
-		reconstructedSpeech[i] = (word16_t)SATURATE(PSHR(acc, 12), MAXINT16); /* shift right acc to get it back in Q0 and check overflow on 16 bits */
+		acc = PSHR(acc, 12); /* shift right acc to get it back in Q0 */
+		if (acc > MAXINT16 || acc < -MAXINT16-1) { /* overflow on 16 bits */
+			saturatedSamplesNbr++;
+		}
+		reconstructedSpeech[i] = (word16_t)SATURATE(acc, MAXINT16);
 	}
-	return;
+	return saturatedSamplesNbr;
 }
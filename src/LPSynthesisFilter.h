@@ -26,7 +26,8 @@
 /*      -(i/o) recontructedSpeech: 50 values in Q0                           */
 /*             [-NB_LSP_COEFF, -1] of previous values as input               */
 /*             [0, L_SUBFRAME[ as output                                     */
+/*    return value : number of output values saturated on 16 bits            */
 /*                                                                           */
 /*****************************************************************************/
-void LPSynthesisFilter (word16_t *excitationVector, word16_t *LPCoefficients, word16_t *reconstructedSpeech);
+int LPSynthesisFilter (word16_t *excitationVector, word16_t *LPCoefficients, word16_t *reconstructedSpeech);
 #endif /* ifndef LPSYNTHESISFILTER_H */
@@ -35,6 +35,7 @@ void initLSPQuantization(bcg729EncoderChannelContextStruct *encoderChannelContex
 	for (i=0; i<MA_MAX_K; i++) {
 		memcpy(encoderChannelContext->previousqLSF[i], previousqLSFInit, NB_LSP_COEFF*sizeof(word16_t));
 	}
+	encoderChannelContext->L1HintsNbr = 0;
 	return;
 }
 /**********************************************************************************/
@@ -244,19 +245,19 @@ void noiseLSPQuantization(word16_t previousqLSF[MA_MAX_K][NB_LSP_COEFF], word16_
 }
 
 /*****************************************************************************/
-/* LSPQuantization : Convert LSP to LSF, Quantize LSF and find L parameters, */
-/*      qLSF->qLSP as described in spec A3.2.4                               */
+/* LSPQuantization : Quantize LSF and find L parameters, qLSF->qLSP as       */
+/*      described in spec A3.2.4                                             */
 /*    parameters:                                                            */
 /*      -(i/o) encoderChannelContext : the channel context data              */
-/*      -(i) LSPCoefficients : 10 LSP coefficients in Q15                    */
+/*      -(i) LSFCoefficients : 10 LSF coefficients in Q2.13 range [0, Pi[,   */
+/*           computed from the LSP by the encoder LP analysis                */
 /*      -(o) qLSPCoefficients : 10 qLSP coefficients in Q15                  */
 /*      -(o) parameters : 4 parameters L0, L1, L2, L3                        */
 /*                                                                           */
 /*****************************************************************************/
-void LSPQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext, word16_t LSPCoefficients[], word16_t qLSPCoefficients[], uint16_t parameters[])
+void LSPQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext, word16_t LSFCoefficients[], word16_t qLSPCoefficients[], uint16_t parameters[])
 {
 	int i,j;
-	word16_t LSF[NB_LSP_COEFF]; /* LSF coefficients in Q2.13 range [0, Pi[ */
 	uword16_t weights[NB_LSP_COEFF]; /* weights in Q11 */
 	word16_t weightsThreshold[NB_LSP_COEFF]; /* store in Q13 the threshold used to compute the weights */
 	int L0;
@@ -267,18 +268,13 @@ void LSPQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext, w
 	word16_t quantizerOutput[NB_LSP_COEFF];
 	word16_t qLSF[NB_LSP_COEFF];
 
-	/*** compute LSF in Q2.13 : lsf = arcos(lsp) range [0, Pi[ spec 3.2.4 eq18 ***/
-	for (i=0; i<NB_LSP_COEFF; i++)  {
-		LSF[i] = g729Acos_Q15Q13(LSPCoefficients[i]);
-	}
-
 	/*** compute the weights vector as in spec 3.2.4 eq22 ***/
-	weightsThreshold[0] = SUB16(LSF[1], OO4PIPLUS1_IN_Q13);
+	weightsThreshold[0] = SUB16(LSFCoefficients[1], OO4PIPLUS1_IN_Q13);
 	for (i=1; i<NB_LSP_COEFF-1; i++) {
-		weightsThreshold[i] = SUB16(SUB16(LSF[i+1], LSF[i-1]), ONE_IN_Q13);
+		weightsThreshold[i] = SUB16(SUB16(LSFCoefficients[i+1], LSFCoefficients[i-1]), ONE_IN_Q13);
 		
 	}
-	weightsThreshold[NB_LSP_COEFF-1] = SUB16(O92PIMINUS1_IN_Q13, LSF[NB_LSP_COEFF-2]);
+	weightsThreshold[NB_LSP_COEFF-1] = SUB16(O92PIMINUS1_IN_Q13, LSFCoefficients[NB_LSP_COEFF-2]);
 
 	for (i=0; i<NB_LSP_COEFF; i++) {
 		if (weightsThreshold[i]>0) {
@@ -298,7 +294,7 @@ void LSPQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext, w
 		word16_t quantizedVector[NB_LSP_COEFF]; /* in Q13, the current state of quantized vector */
 
 		for (i=0; i<NB_LSP_COEFF; i++) {
-			word32_t acc = SHL(LSF[i],15); /* acc in Q2.28 */
+			word32_t acc = SHL(LSFCoefficients[i],15); /* acc in Q2.28 */
 			for (j=0; j<MA_MAX_K; j++) {
 				acc = MSU16_16(acc, encoderChannelContext->previousqLSF[j][i], MAPredictor[L0][j][i]); /* previousqLSF in Q2.13 and MAPredictor in Q0.15-> acc in Q2.28 */
 			}
@@ -306,16 +302,35 @@ void LSPQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext, w
 		}
 
 		/* find closest match for predictionError (minimize mean square diff) in L1 codebook */
-		for (i=0; i<L1_RANGE; i++) {
-			word32_t acc = 0;
-			for (j=0; j<NB_LSP_COEFF; j++) {
-				word16_t difftargetVectorL1 = SATURATE(SUB32(targetVector[j], L1[i][j]), MAXINT16);
-				acc = MAC16_16(acc, difftargetVectorL1, difftargetVectorL1);
+		if (encoderChannelContext->L1HintsNbr > 0) { /* encoder hints: search only the closest vectors of the hinted ones */
+			int k,n;
+			for (k=0; k<encoderChannelContext->L1HintsNbr; k++) {
+				for (n=0; n<L1_HINT_NEIGHBOURS; n++) {
+					word32_t acc = 0;
+					i = L1Neighbours[encoderChannelContext->L1Hints[k]][n];
+					for (j=0; j<NB_LSP_COEFF; j++) {
+						word16_t difftargetVectorL1 = SATURATE(SUB32(targetVector[j], L1[i][j]), MAXINT16);
+						acc = MAC16_16(acc, difftargetVectorL1, difftargetVectorL1);
+					}
+
+					if (acc<meanSquareDiff) {
+						meanSquareDiff = acc;
+						L1index[L0] = i;
+					}
+				}
 			}
-
-			if (acc<meanSquareDiff) {
-				meanSquareDiff = acc;
-				L1index[L0] = i;
+		} else {
+			for (i=0; i<L1_RANGE; i++) {
+				word32_t acc = 0;
+				for (j=0; j<NB_LSP_COEFF; j++) {
+					word16_t difftargetVectorL1 = SATURATE(SUB32(targetVector[j], L1[i][j]), MAXINT16);
+					acc = MAC16_16(acc, difftargetVectorL1, difftargetVectorL1);
+				}
+
+				if (acc<meanSquareDiff) {
+					meanSquareDiff = acc;
+					L1index[L0] = i;
+				}
 			}
 		}
 		
@@ -21,16 +21,17 @@
 void initLSPQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext);
 
 /*****************************************************************************/
-/* LSPQuantization : Convert LSP to LSF, Quantize LSF and find L parameters, */
-/*      qLSF->qLSP as described in spec A3.2.4                               */
+/* LSPQuantization : Quantize LSF and find L parameters, qLSF->qLSP as       */
+/*      described in spec A3.2.4                                             */
 /*    parameters:                                                            */
 /*      -(i/o) encoderChannelContext : the channel context data              */
-/*      -(i) LSPCoefficients : 10 LSP coefficients in Q15                    */
+/*      -(i) LSFCoefficients : 10 LSF coefficients in Q2.13 range [0, Pi[,   */
+/*           computed from the LSP by the encoder LP analysis                */
 /*      -(i) qLSPCoefficients : 10 qLSP coefficients in Q15                  */
 /*      -(o) parameters : 4 parameters L0, L1, L2, L3                        */
 /*                                                                           */
 /*****************************************************************************/
-void LSPQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext, word16_t LSPCoefficients[], word16_t qLSPCoefficients[], uint16_t parameters[]);
+void LSPQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext, word16_t LSFCoefficients[], word16_t qLSPCoefficients[], uint16_t parameters[]);
 
 /**********************************************************************************/
 /* noiseLSPQuantization : Convert LSP to LSF, Quantize LSF and find L parameters, */
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdlib.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "basicOperationsMacros.h"
+#include "utils.h"
+#include "g729FixedPointMath.h"
+
+#include "activeSpeaker.h"
+
+/* 10*log10(2) in Q12 */
+#define TEN_LOG10_2_Q12 12330
+
+/* init function */
+void initActiveSpeakerDetection(bcg729DecoderChannelContextStruct *decoderChannelContext)
+{
+	decoderChannelContext->excitationEnergy = 0;
+	decoderChannelContext->smoothedEnergydB = 0;
+	decoderChannelContext->noiseFloordB = ACTIVE_SPEAKER_NOISE_FLOOR_INIT;
+	decoderChannelContext->activityHangover = 0;
+	decoderChannelContext->synthesisFlag = 1;
+}
+
+/*****************************************************************************/
+/* estimateExcitationEnergy : estimate the excitation energy of a subframe   */
+/*      from its decoded gains: E = Ga^2*E(-1) + Gc^2*Sum(c^2)/L_SUBFRAME    */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data, gains must  */
+/*             be the current subframe ones                                  */
+/*      -(i) fixedCodebookVector : 40 values in Q1.13                        */
+/*    return value : the excitation energy per sample in Q0                  */
+/*                                                                           */
+/*****************************************************************************/
+word32_t estimateExcitationEnergy(bcg729DecoderChannelContextStruct *decoderChannelContext, word16_t fixedCodebookVector[])
+{
+	int i;
+	word64_t fixedCodebookVectorEnergy = 0; /* in Q26 */
+	word64_t excitationEnergy;
+
+	for (i=0; i<L_SUBFRAME; i++) {
+		fixedCodebookVectorEnergy = ADD64(fixedCodebookVectorEnergy, MULT16_16(fixedCodebookVector[i], fixedCodebookVector[i]));
+	}
+	excitationEnergy = DIV64(SHR64(MULT32_32(MULT16_16(decoderChannelContext->fixedCodebookGain, decoderChannelContext->fixedCodebookGain), fixedCodebookVectorEnergy), 28), L_SUBFRAME); /* Gc in Q1 and c in Q13 -> Q28 */
+	excitationEnergy = ADD64(excitationEnergy, SHR64(MULT32_32(MULT16_16(decoderChannelContext->adaptativeCodebookGain, decoderChannelContext->adaptativeCodebookGain), decoderChannelContext->excitationEnergy), 28)); /* Ga in Q14 */
+	if (excitationEnergy>MAXINT32) {
+		excitationEnergy = MAXINT32;
+	}
+	decoderChannelContext->excitationEnergy = (word32_t)excitationEnergy;
+	return decoderChannelContext->excitationEnergy;
+}
+
+/*****************************************************************************/
+/* estimateComfortNoiseEnergy : excitation energy of a comfort noise frame   */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data, smoothed    */
+/*             SID gain must be the current frame one                        */
+/*    return value : the excitation energy per sample in Q0                  */
+/*                                                                           */
+/*****************************************************************************/
+word32_t estimateComfortNoiseEnergy(bcg729DecoderChannelContextStruct *decoderChannelContext)
+{
+	word16_t targetGain = decoderChannelContext->CNGChannelContext->smoothedSIDGain; /* in Q3 */
+
+	/* comfort noise excitation energy per sample is the square of target gain */
+	decoderChannelContext->excitationEnergy = SHR(MULT16_16(targetGain, targetGain), 6);
+	return decoderChannelContext->excitationEnergy;
+}
+
+/*****************************************************************************/
+/* updateActiveSpeakerDetection : update the channel energy and voice        */
+/*      activity estimates with the current frame                            */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) activeFrameFlag : false for SID and untransmitted frames        */
+/*      -(i) frameEnergy : frame excitation energy per sample in Q0          */
+/*    return value : frameEnergy in dB in Q8                                 */
+/*                                                                           */
+/*****************************************************************************/
+int16_t updateActiveSpeakerDetection(bcg729DecoderChannelContextStruct *decoderChannelContext, uint8_t activeFrameFlag, word32_t frameEnergy)
+{
+	word16_t energydB = 0;
+
+	if (frameEnergy>0) { /* log2(energy) in Q16 * 10*log10(2) in Q12 -> Q16, shift to Q8 */
+		energydB = (word16_t)PSHR(MULT16_32_Q12(TEN_LOG10_2_Q12, g729Log2_Q0Q16(frameEnergy)), 8);
+	}
+
+	/* smoothed energy: fast attack, slow release */
+	if (energydB > decoderChannelContext->smoothedEnergydB) {
+		decoderChannelContext->smoothedEnergydB = ADD16(decoderChannelContext->smoothedEnergydB, SHR(SUB16(energydB, decoderChannelContext->smoothedEnergydB), 1));
+	} else {
+		decoderChannelContext->smoothedEnergydB = SUB16(decoderChannelContext->smoothedEnergydB, SHR(SUB16(decoderChannelContext->smoothedEnergydB, energydB), 3));
+	}
+
+	if (activeFrameFlag) {
+		/* noise floor follows minimums and rises slowly */
+		if (energydB < decoderChannelContext->noiseFloordB) {
+			decoderChannelContext->noiseFloordB = energydB;
+		} else {
+			decoderChannelContext->noiseFloordB = ADD16(decoderChannelContext->noiseFloordB, ACTIVE_SPEAKER_NOISE_FLOOR_RISE);
+		}
+
+		if (energydB > ADD16(decoderChannelContext->noiseFloordB, ACTIVE_SPEAKER_THRESHOLD)) {
+			decoderChannelContext->activityHangover = ACTIVE_SPEAKER_HANGOVER;
+		} else if (decoderChannelContext->activityHangover > 0) {
+			decoderChannelContext->activityHangover--;
+		}
+	} else { /* the encoder VAD declared noise: comfort noise energy is the noise floor */
+		decoderChannelContext->noiseFloordB = energydB;
+		decoderChannelContext->activityHangover = 0;
+	}
+
+	return energydB;
+}
+
+/*****************************************************************************/
+/* bcg729GetDecoderActivity : see decoder.h                                  */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(o) energydB : smoothed excitation energy in dB in Q8               */
+/*      -(o) voiceActivity : 1 if voice activity is detected, 0 otherwise    */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729GetDecoderActivity(bcg729DecoderChannelContextStruct *decoderChannelContext, int16_t *energydB, uint8_t *voiceActivity)
+{
+	*energydB = decoderChannelContext->smoothedEnergydB;
+	*voiceActivity = (decoderChannelContext->activityHangover > 0)?1:0;
+}
+
+/*****************************************************************************/
+/* bcg729SelectActiveSpeakers : see decoder.h                                */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContexts : channelsNbr channels contexts          */
+/*      -(i) channelsNbr : number of channels                                */
+/*      -(i) maxSpeakersNbr : maximum number of channels to select           */
+/*      -(o) selectedChannels : indexes of the selected channels, loudest    */
+/*           first, must hold maxSpeakersNbr values                          */
+/*    return value : number of selected channels                             */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t bcg729SelectActiveSpeakers(bcg729DecoderChannelContextStruct *decoderChannelContexts[], uint16_t channelsNbr, uint16_t maxSpeakersNbr, uint16_t selectedChannels[])
+{
+	uint16_t i,j;
+	uint16_t selectedNbr = 0;
+
+	for (j=0; j<maxSpeakersNbr; j++) {
+		int32_t bestScore = MININT32;
+		int32_t bestIndex = -1;
+
+		for (i=0; i<channelsNbr; i++) {
+			bcg729DecoderChannelContextStruct *decoderChannelContext = decoderChannelContexts[i];
+			int32_t score;
+			uint16_t k;
+
+			if (decoderChannelContext == NULL || decoderChannelContext->activityHangover == 0) {
+				continue;
+			}
+			/* skip already selected channels */
+			for (k=0; k<selectedNbr && selectedChannels[k]!=i; k++);
+			if (k<selectedNbr) {
+				continue;
+			}
+
+			/* favor channels selected at previous frame to avoid switching between speakers of close levels */
+			score = decoderChannelContext->smoothedEnergydB;
+			if (decoderChannelContext->synthesisFlag) {
+				score += ACTIVE_SPEAKER_SELECTION_HYSTERESIS;
+			}
+			if (score > bestScore) {
+				bestScore = score;
+				bestIndex = i;
+			}
+		}
+
+		if (bestIndex < 0) { /* no more active channel */
+			break;
+		}
+		selectedChannels[selectedNbr++] = (uint16_t)bestIndex;
+	}
+
+	return selectedNbr;
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef ACTIVESPEAKER_H
+#define ACTIVESPEAKER_H
+/* init function */
+void initActiveSpeakerDetection(bcg729DecoderChannelContextStruct *decoderChannelContext);
+
+/*****************************************************************************/
+/* estimateExcitationEnergy : estimate the excitation energy of a subframe   */
+/*      from its decoded gains: E = Ga^2*E(-1) + Gc^2*Sum(c^2)/L_SUBFRAME    */
+/*      the adaptative codebook vector energy being approximated by the      */
+/*      previous subframe excitation energy                                  */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data, gains must  */
+/*             be the current subframe ones                                  */
+/*      -(i) fixedCodebookVector : 40 values in Q1.13                        */
+/*    return value : the excitation energy per sample in Q0                  */
+/*                                                                           */
+/*****************************************************************************/
+word32_t estimateExcitationEnergy(bcg729DecoderChannelContextStruct *decoderChannelContext, word16_t fixedCodebookVector[]);
+
+/*****************************************************************************/
+/* estimateComfortNoiseEnergy : excitation energy of a comfort noise frame   */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data, smoothed    */
+/*             SID gain must be the current frame one                        */
+/*    return value : the excitation energy per sample in Q0                  */
+/*                                                                           */
+/*****************************************************************************/
+word32_t estimateComfortNoiseEnergy(bcg729DecoderChannelContextStruct *decoderChannelContext);
+
+/*****************************************************************************/
+/* updateActiveSpeakerDetection : update the channel energy and voice        */
+/*      activity estimates with the current frame                            */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) activeFrameFlag : false for SID and untransmitted frames        */
+/*      -(i) frameEnergy : frame excitation energy per sample in Q0          */
+/*    return value : frameEnergy in dB in Q8                                 */
+/*                                                                           */
+/*****************************************************************************/
+int16_t updateActiveSpeakerDetection(bcg729DecoderChannelContextStruct *decoderChannelContext, uint8_t activeFrameFlag, word32_t frameEnergy);
+#endif /* ifndef ACTIVESPEAKER_H */
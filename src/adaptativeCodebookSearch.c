@@ -28,6 +28,7 @@
 
 /*** local functions ***/
 void generateAdaptativeCodebookVector(word16_t excitationVector[], int16_t intPitchDelay, int16_t fracPitchDelay);
+static void computePitchDelayCodeword(int16_t *intPitchDelayMin, int16_t *intPitchDelayMax, int16_t intPitchDelay, int16_t fracPitchDelay, uint16_t *pitchDelayCodeword, uint16_t subFrameIndex);
 
 /*****************************************************************************/
 /* adaptativeCodebookSearch: compute parameter P1 and P2 as in spec A.3.7    */
@@ -60,6 +61,15 @@ void adaptativeCodebookSearch(word16_t excitationVector[], int16_t *intPitchDela
 	word32_t backwardFilteredTargetSignal[L_SUBFRAME];
 	word32_t correlationMax = MININT32;
 
+	/* null target signal (digital silence): all correlations are null, the first tested delay with fractional part 0 would be selected */
+	if (isNullVector(targetSignal, L_SUBFRAME)) {
+		*intPitchDelay = *intPitchDelayMin;
+		*fracPitchDelay = 0;
+		generateAdaptativeCodebookVector(excitationVector, *intPitchDelay, 0);
+		computePitchDelayCodeword(intPitchDelayMin, intPitchDelayMax, *intPitchDelay, *fracPitchDelay, pitchDelayCodeword, subFrameIndex);
+		return;
+	}
+
 	/* compute the backward Filtered Target Signal as specified in A.3.7: correlation of target signal and impulse response */
 	correlateVectors(targetSignal, impulseResponse, backwardFilteredTargetSignal); /* targetSignal in Q0, impulseResponse in Q12 ->  backwardFilteredTargetSignal in Q12 */
 	
@@ -121,10 +131,26 @@ void adaptativeCodebookSearch(word16_t excitationVector[], int16_t *intPitchDela
 		}
 	}
 
-	/* compute the codeword and intPitchDelayMin/intPitchDelayMax if needed (first subframe only) */
+	computePitchDelayCodeword(intPitchDelayMin, intPitchDelayMax, *intPitchDelay, *fracPitchDelay, pitchDelayCodeword, subFrameIndex);
+}
+
+/*****************************************************************************/
+/* computePitchDelayCodeword : compute the codeword as in spec 3.7.2 and     */
+/*      intPitchDelayMin/intPitchDelayMax if needed (first subframe only)    */
+/*    parameters :                                                           */
+/*      -(i/o) intPitchDelayMin, intPitchDelayMax: boundaries for pitch      */
+/*                  delay search, updated during first subframe              */
+/*      -(i) intPitchDelay: the integer pitch delay                          */
+/*      -(i) fracPitchDelay: the fractionnal part of pitch delay             */
+/*      -(o) pitchDelayCodeword: P1 or P2 codeword as in spec 3.7.2          */
+/*      -(i) subFrameIndex: 0 for the first subframe, 40 for the second      */
+/*                                                                           */
+/*****************************************************************************/
+static void computePitchDelayCodeword(int16_t *intPitchDelayMin, int16_t *intPitchDelayMax, int16_t intPitchDelay, int16_t fracPitchDelay, uint16_t *pitchDelayCodeword, uint16_t subFrameIndex)
+{
 	if (subFrameIndex==0) { /* first subframe */
 		/* compute intPitchDelayMin/intPitchDelayMax as in spec A.3.7 */
-		*intPitchDelayMin = *intPitchDelay - 5;
+		*intPitchDelayMin = intPitchDelay - 5;
 		if (*intPitchDelayMin < 20) {
 			*intPitchDelayMin = 20;
 		}
@@ -135,14 +161,14 @@ void adaptativeCodebookSearch(word16_t excitationVector[], int16_t *intPitchDela
 		}
 
 		/* compute the codeword as in spec 3.7.2 */
-		if (*intPitchDelay<=85) {
-			*pitchDelayCodeword = 3*(*intPitchDelay) - 58 + *fracPitchDelay;
+		if (intPitchDelay<=85) {
+			*pitchDelayCodeword = 3*intPitchDelay - 58 + fracPitchDelay;
 		} else {
-			*pitchDelayCodeword = *intPitchDelay + 112;
+			*pitchDelayCodeword = intPitchDelay + 112;
 		}
 	} else { /* second subframe */
 		/* compute the codeword as in spec 3.7.2 */
-		*pitchDelayCodeword = 3*(*intPitchDelay-*intPitchDelayMin) + *fracPitchDelay +2;
+		*pitchDelayCodeword = 3*(intPitchDelay-*intPitchDelayMin) + fracPitchDelay +2;
 	}
 }
 
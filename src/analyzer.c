@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string.h>
+#include <stdlib.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "basicOperationsMacros.h"
+#include "utils.h"
+#include "g729FixedPointMath.h"
+
+#include "bcg729/analyzer.h"
+#include "decodeLSP.h"
+#include "decodeAdaptativeCodeVector.h"
+#include "decodeFixedCodeVector.h"
+#include "decodeGains.h"
+#include "cng.h"
+#include "activeSpeaker.h"
+#include "analyzer.h"
+
+/*****************************************************************************/
+/* bcg729UnpackFrame : extract the parameters of a frame, stateless          */
+/*    parameters:                                                            */
+/*      -(i) bitStream : the frame payload                                   */
+/*      -(i) bitStreamLength : in bytes, 10 for active frames, 2 for SID     */
+/*           frames, 0 for untransmitted ones                                */
+/*      -(o) parameters : the frame parameters                               */
+/*    return value : frame type: BCG729_FRAME_TYPE_ACTIVE, SID,              */
+/*           UNTRANSMITTED or INVALID(parameters are all set to 0)           */
+/*                                                                           */
+/*****************************************************************************/
+uint8_t bcg729UnpackFrame(const uint8_t bitStream[], uint8_t bitStreamLength, bcg729FrameParameters *parameters)
+{
+	uint16_t parametersArray[NB_PARAMETERS];
+
+	memset(parameters, 0, sizeof(bcg729FrameParameters));
+
+	switch (bitStreamLength) {
+		case 10:
+			parametersBitStream2Array(bitStream, parametersArray);
+			parameters->L0 = parametersArray[0];
+			parameters->L1 = parametersArray[1];
+			parameters->L2 = parametersArray[2];
+			parameters->L3 = parametersArray[3];
+			parameters->P1 = parametersArray[4];
+			parameters->P0 = parametersArray[5];
+			parameters->C1 = parametersArray[6];
+			parameters->S1 = parametersArray[7];
+			parameters->GA1 = parametersArray[8];
+			parameters->GB1 = parametersArray[9];
+			parameters->P2 = parametersArray[10];
+			parameters->C2 = parametersArray[11];
+			parameters->S2 = parametersArray[12];
+			parameters->GA2 = parametersArray[13];
+			parameters->GB2 = parametersArray[14];
+			return BCG729_FRAME_TYPE_ACTIVE;
+		case 2: /* SID frame as in spec B4.3 */
+			parameters->L0 = (bitStream[0]>>7)&0x01;
+			parameters->L1 = (bitStream[0]>>2)&0x1F;
+			parameters->L2 = ((bitStream[0]&0x03)<<2) | ((bitStream[1]>>6)&0x03);
+			parameters->gain = (bitStream[1]>>1)&0x1F;
+			return BCG729_FRAME_TYPE_SID;
+		case 0:
+			return BCG729_FRAME_TYPE_UNTRANSMITTED;
+		default:
+			return BCG729_FRAME_TYPE_INVALID;
+	}
+}
+
+/*****************************************************************************/
+/* bcg729UnpackFrames : extract the parameters of consecutive frames         */
+/*    parameters:                                                            */
+/*      -(i) bitStream : the frames payloads, concatenated                   */
+/*      -(i) bitStreamLength : in bytes, length of each frame payload        */
+/*      -(i) framesNbr : number of frames                                    */
+/*      -(o) parameters : framesNbr frames parameters                        */
+/*    return value : number of frames unpacked, stops on the first invalid   */
+/*           frame length                                                    */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t bcg729UnpackFrames(const uint8_t bitStream[], const uint8_t bitStreamLength[], uint16_t framesNbr, bcg729FrameParameters parameters[])
+{
+	uint16_t i;
+
+	for (i=0; i<framesNbr; i++) {
+		if (bitStreamLength[i] == 10) { /* most common case, unpacked from two words without intermediate array */
+			uint64_t word = ((uint64_t)bitStream[0]<<56) | ((uint64_t)bitStream[1]<<48) | ((uint64_t)bitStream[2]<<40) | ((uint64_t)bitStream[3]<<32) |
+					((uint64_t)bitStream[4]<<24) | ((uint64_t)bitStream[5]<<16) | ((uint64_t)bitStream[6]<<8) | (uint64_t)bitStream[7];
+			uint16_t lastWord = (uint16_t)((bitStream[8]<<8) | bitStream[9]);
+
+			parameters[i].L0 = (uint16_t)(word>>63);
+			parameters[i].L1 = (uint16_t)(word>>56)&0x7f;
+			parameters[i].L2 = (uint16_t)(word>>51)&0x1f;
+			parameters[i].L3 = (uint16_t)(word>>46)&0x1f;
+			parameters[i].P1 = (uint16_t)(word>>38)&0xff;
+			parameters[i].P0 = (uint16_t)(word>>37)&0x1;
+			parameters[i].C1 = (uint16_t)(word>>24)&0x1fff;
+			parameters[i].S1 = (uint16_t)(word>>20)&0xf;
+			parameters[i].GA1 = (uint16_t)(word>>17)&0x7;
+			parameters[i].GB1 = (uint16_t)(word>>13)&0xf;
+			parameters[i].P2 = (uint16_t)(word>>8)&0x1f;
+			parameters[i].C2 = (uint16_t)(((word&0xff)<<5) | (lastWord>>11));
+			parameters[i].S2 = (lastWord>>7)&0xf;
+			parameters[i].GA2 = (lastWord>>4)&0x7;
+			parameters[i].GB2 = lastWord&0xf;
+			parameters[i].gain = 0;
+		} else if (bcg729UnpackFrame(bitStream, bitStreamLength[i], &(parameters[i])) == BCG729_FRAME_TYPE_INVALID) {
+			break;
+		}
+		bitStream += bitStreamLength[i];
+	}
+
+	return i;
+}
+
+/*****************************************************************************/
+/* bcg729PackFrames : pack the parameters of consecutive frames, reverse     */
+/*      operation of bcg729UnpackFrames                                      */
+/*    parameters:                                                            */
+/*      -(i) parameters : framesNbr frames parameters                        */
+/*      -(i) bitStreamLength : in bytes, 10 for active frames, 2 for SID     */
+/*           frames, 0 for untransmitted ones                                */
+/*      -(i) framesNbr : number of frames                                    */
+/*      -(o) bitStream : the frames payloads, concatenated                   */
+/*    return value : number of frames packed, stops on the first invalid     */
+/*           frame length                                                    */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t bcg729PackFrames(const bcg729FrameParameters parameters[], const uint8_t bitStreamLength[], uint16_t framesNbr, uint8_t bitStream[])
+{
+	uint16_t i;
+
+	for (i=0; i<framesNbr; i++) {
+		const bcg729FrameParameters *frameParameters = &(parameters[i]);
+
+		if (bitStreamLength[i] == 10) { /* first 64 bits of the frame are assembled in a single word, the last 16 in another one */
+			uint64_t word = ((uint64_t)(frameParameters->L0&0x1)<<63) |
+					((uint64_t)(frameParameters->L1&0x7f)<<56) |
+					((uint64_t)(frameParameters->L2&0x1f)<<51) |
+					((uint64_t)(frameParameters->L3&0x1f)<<46) |
+					((uint64_t)(frameParameters->P1&0xff)<<38) |
+					((uint64_t)(frameParameters->P0&0x1)<<37) |
+					((uint64_t)(frameParameters->C1&0x1fff)<<24) |
+					((uint64_t)(frameParameters->S1&0xf)<<20) |
+					((uint64_t)(frameParameters->GA1&0x7)<<17) |
+					((uint64_t)(frameParameters->GB1&0xf)<<13) |
+					((uint64_t)(frameParameters->P2&0x1f)<<8) |
+					((uint64_t)(frameParameters->C2>>5)&0xff);
+			uint16_t lastWord = (uint16_t)(((frameParameters->C2&0x1f)<<11) |
+					((frameParameters->S2&0xf)<<7) |
+					((frameParameters->GA2&0x7)<<4) |
+					(frameParameters->GB2&0xf));
+
+			bitStream[0] = (uint8_t)(word>>56);
+			bitStream[1] = (uint8_t)(word>>48);
+			bitStream[2] = (uint8_t)(word>>40);
+			bitStream[3] = (uint8_t)(word>>32);
+			bitStream[4] = (uint8_t)(word>>24);
+			bitStream[5] = (uint8_t)(word>>16);
+			bitStream[6] = (uint8_t)(word>>8);
+			bitStream[7] = (uint8_t)word;
+			bitStream[8] = (uint8_t)(lastWord>>8);
+			bitStream[9] = (uint8_t)lastWord;
+		} else if (bitStreamLength[i] == 2) { /* SID frame as in spec B4.3 */
+			bitStream[0] = (uint8_t)(((frameParameters->L0&0x1)<<7) | ((frameParameters->L1&0x1f)<<2) | ((frameParameters->L2>>2)&0x3));
+			bitStream[1] = (uint8_t)(((frameParameters->L2&0x3)<<6) | ((frameParameters->gain&0x1f)<<1));
+		} else if (bitStreamLength[i] != 0) { /* invalid frame length */
+			break;
+		}
+		bitStream += bitStreamLength[i];
+	}
+
+	return i;
+}
+
+/*****************************************************************************/
+/* initBcg729AnalyzerChannel : create context structure and initialise it    */
+/*    return value :                                                         */
+/*      - the analyzer channel context data                                  */
+/*                                                                           */
+/*****************************************************************************/
+bcg729AnalyzerChannelContextStruct *initBcg729AnalyzerChannel(void)
+{
+	/* create the context structure */
+	bcg729AnalyzerChannelContextStruct *analyzerChannelContext = malloc(sizeof(bcg729AnalyzerChannelContextStruct));
+	memset(analyzerChannelContext, 0, sizeof(*analyzerChannelContext));
+
+	/* use a regular decoder context so the decoding states evolve exactly as in the decoder */
+	analyzerChannelContext->decoderChannelContext = initBcg729DecoderChannel();
+
+	return analyzerChannelContext;
+}
+
+/*****************************************************************************/
+/* closeBcg729AnalyzerChannel : free memory of context structure             */
+/*    parameters:                                                            */
+/*      -(i) analyzerChannelContext : the channel context data               */
+/*                                                                           */
+/*****************************************************************************/
+void closeBcg729AnalyzerChannel(bcg729AnalyzerChannelContextStruct *analyzerChannelContext)
+{
+	if (analyzerChannelContext) {
+		closeBcg729DecoderChannel(analyzerChannelContext->decoderChannelContext);
+		free(analyzerChannelContext);
+	}
+	return;
+}
+
+/*****************************************************************************/
+/* analyzeDecoderFrame : decode LSP, pitch delays and gains of a frame, and  */
+/*      estimate its energy, no signal is produced                           */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data, the         */
+/*             excitation and filters memories are not updated               */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i) bitStreamLength : in bytes, length of previous buffer           */
+/*      -(i) frameErasureFlag : flag: true, frame has been erased            */
+/*      -(i) SIDFrameFlag : flag: true, frame is a SID one                   */
+/*      -(i) rfc3389PayloadFlag : true when CN payload follow rfc3389        */
+/*      -(o) features : the frame features                                   */
+/*                                                                           */
+/*****************************************************************************/
+void analyzeDecoderFrame(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, bcg729FrameFeatures *features)
+{
+	int i;
+	uint16_t parameters[NB_PARAMETERS];
+	word16_t qLSP[NB_LSP_COEFF]; /* store the qLSP coefficients in Q0.15 */
+	int16_t intPitchDelay;
+	word16_t fixedCodebookVector[L_SUBFRAME]; /* the fixed Codebook Vector in Q1.13*/
+	word32_t frameEnergy = 0;
+	uint8_t parityErrorFlag;
+	int subframeIndex;
+	int parametersIndex = 4; /* this is used to select the right parameter according to the subframe currently computed, start pointing to P1 */
+
+	memset(features, 0, sizeof(bcg729FrameFeatures));
+
+	/* same parsing and frame type selection than bcg729Decoder */
+	if (bitStream!=NULL && SIDFrameFlag == 0) {
+		parametersBitStream2Array(bitStream, parameters);
+	} else {
+		for (i=0; i<NB_PARAMETERS; i++) {
+			parameters[i]=0;
+		}
+	}
+
+	if (frameErasureFlag) {
+		if (decoderChannelContext->previousFrameIsActiveFlag) {
+			SIDFrameFlag = 0;
+		} else {
+			SIDFrameFlag = 1;
+		}
+	}
+
+	if (SIDFrameFlag == 1) {
+		bcg729CNGChannelContextStruct *CNGChannelContext = decoderChannelContext->CNGChannelContext;
+
+		features->frameType = BCG729_FRAME_TYPE_SID;
+		decodeSIDParameters(CNGChannelContext, bitStream, bitStreamLength, decoderChannelContext->previousqLSP, decoderChannelContext->previousLCodeWord, rfc3389PayloadFlag);
+		memcpy(decoderChannelContext->previousqLSP, CNGChannelContext->qLSP, NB_LSP_COEFF*sizeof(word16_t));
+
+		/* target gain smoothing eq B.19, as in decodeSIDframe */
+		if (decoderChannelContext->previousFrameIsActiveFlag) {
+			CNGChannelContext->smoothedSIDGain = CNGChannelContext->receivedSIDGain;
+		} else {
+			CNGChannelContext->smoothedSIDGain = SUB16(CNGChannelContext->smoothedSIDGain, (CNGChannelContext->smoothedSIDGain>>3));
+			CNGChannelContext->smoothedSIDGain = ADD16(CNGChannelContext->smoothedSIDGain, (CNGChannelContext->receivedSIDGain>>3));
+		}
+		decoderChannelContext->previousFrameIsActiveFlag = 0;
+		decoderChannelContext->boundedAdaptativeCodebookGain = BOUNDED_PITCH_GAIN_MIN;
+
+		frameEnergy = estimateComfortNoiseEnergy(decoderChannelContext);
+	} else {
+		features->frameType = (frameErasureFlag)?BCG729_FRAME_TYPE_ERASED:BCG729_FRAME_TYPE_ACTIVE;
+		decoderChannelContext->previousFrameIsActiveFlag = 1;
+		decoderChannelContext->CNGpseudoRandomSeed = CNG_DTX_RANDOM_SEED_INIT; /* re-init the CNG pseudo random seed at each active frame spec B.4 */
+
+		/* decode LSP: the interpolation and LP conversion are not needed */
+		decodeLSP(decoderChannelContext, parameters, qLSP, frameErasureFlag);
+		memcpy(decoderChannelContext->previousqLSP, qLSP, NB_LSP_COEFF*sizeof(word16_t));
+
+		/* check the parity on the adaptativeCodebookIndexSubframe1(P1) with the received one (P0)*/
+		parityErrorFlag = (uint8_t)(computeParity(parameters[4]) ^ parameters[5]);
+
+		for (subframeIndex=0; subframeIndex<L_FRAME; subframeIndex+=L_SUBFRAME) {
+			int subframe = subframeIndex/L_SUBFRAME;
+			int16_t fracPitchDelay;
+
+			/* decode the pitch delay only, the adaptative codebook vector is not needed */
+			decodePitchDelay(decoderChannelContext, subframeIndex, parameters[parametersIndex], parityErrorFlag, frameErasureFlag, &intPitchDelay, &fracPitchDelay);
+			if (subframeIndex==0) { /* at first subframe we have P0 between P1 and C1 */
+				parametersIndex+=2;
+			} else {
+				parametersIndex++;
+			}
+
+			/* in case of frame erasure generate pseudoRandom signs and index as the decoder does */
+			if (frameErasureFlag) {
+				parameters[parametersIndex] = pseudoRandom(&(decoderChannelContext->pseudoRandomSeed))&(uint16_t)0x1fff;
+				parameters[parametersIndex+1] = pseudoRandom(&(decoderChannelContext->pseudoRandomSeed))&(uint16_t)0x000f;
+			}
+
+			/* the fixed codebook vector is needed by the gain predictor */
+			decodeFixedCodeVector(parameters[parametersIndex+1], parameters[parametersIndex], intPitchDelay, decoderChannelContext->boundedAdaptativeCodebookGain, fixedCodebookVector);
+			parametersIndex+=2;
+
+			decodeGains(decoderChannelContext, parameters[parametersIndex], parameters[parametersIndex+1], fixedCodebookVector, frameErasureFlag,
+					&(decoderChannelContext->adaptativeCodebookGain), &(decoderChannelContext->fixedCodebookGain));
+			parametersIndex+=2;
+
+			/* update bounded Adaptative Codebook Gain (in Q14) according to eq47 */
+			decoderChannelContext->boundedAdaptativeCodebookGain = decoderChannelContext->adaptativeCodebookGain;
+			if (decoderChannelContext->boundedAdaptativeCodebookGain>BOUNDED_PITCH_GAIN_MAX) {
+				decoderChannelContext->boundedAdaptativeCodebookGain = BOUNDED_PITCH_GAIN_MAX;
+			}
+			if (decoderChannelContext->boundedAdaptativeCodebookGain<BOUNDED_PITCH_GAIN_MIN) {
+				decoderChannelContext->boundedAdaptativeCodebookGain = BOUNDED_PITCH_GAIN_MIN;
+			}
+
+			frameEnergy = ADD32(frameEnergy, SHR(estimateExcitationEnergy(decoderChannelContext, fixedCodebookVector), 1)); /* mean of the two subframes */
+
+			features->intPitchDelay[subframe] = intPitchDelay;
+			features->fracPitchDelay[subframe] = fracPitchDelay;
+			features->adaptativeCodebookGain[subframe] = decoderChannelContext->adaptativeCodebookGain;
+			features->fixedCodebookGain[subframe] = decoderChannelContext->fixedCodebookGain;
+		}
+	}
+
+	/* LSP are in previousqLSP for both frame types, get LSF = acos(LSP) */
+	for (i=0; i<NB_LSP_COEFF; i++) {
+		features->LSP[i] = decoderChannelContext->previousqLSP[i];
+		features->LSF[i] = g729Acos_Q15Q13(decoderChannelContext->previousqLSP[i]);
+	}
+	features->energy = frameEnergy;
+	features->energydB = updateActiveSpeakerDetection(decoderChannelContext, (features->frameType!=BCG729_FRAME_TYPE_SID), frameEnergy);
+	features->voiceActivity = (decoderChannelContext->activityHangover > 0)?1:0;
+	decoderChannelContext->synthesisFlag = 0;
+	return;
+}
+
+/*****************************************************************************/
+/* bcg729AnalyzeFrame : decode LSP, pitch delays and gains of a frame, and   */
+/*      estimate its energy, no signal is produced                           */
+/*    parameters:                                                            */
+/*      -(i/o) analyzerChannelContext : the channel context data             */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i) bitStreamLength : in bytes, length of previous buffer           */
+/*      -(i) frameErasureFlag : flag: true, frame has been erased            */
+/*      -(i) SIDFrameFlag : flag: true, frame is a SID one                   */
+/*      -(i) rfc3389PayloadFlag : true when CN payload follow rfc3389        */
+/*      -(o) features : the frame features                                   */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729AnalyzeFrame(bcg729AnalyzerChannelContextStruct *analyzerChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, bcg729FrameFeatures *features)
+{
+	analyzeDecoderFrame(analyzerChannelContext->decoderChannelContext, bitStream, bitStreamLength, frameErasureFlag, SIDFrameFlag, rfc3389PayloadFlag, features);
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef PRIVATE_ANALYZER_H
+#define PRIVATE_ANALYZER_H
+
+/*****************************************************************************/
+/* analyzeDecoderFrame : decode LSP, pitch delays and gains of a frame, and  */
+/*      estimate its energy, no signal is produced                           */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data, the         */
+/*             excitation and filters memories are not updated               */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i) bitStreamLength : in bytes, length of previous buffer           */
+/*      -(i) frameErasureFlag : flag: true, frame has been erased            */
+/*      -(i) SIDFrameFlag : flag: true, frame is a SID one                   */
+/*      -(i) rfc3389PayloadFlag : true when CN payload follow rfc3389        */
+/*      -(o) features : the frame features                                   */
+/*                                                                           */
+/*****************************************************************************/
+void analyzeDecoderFrame(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, bcg729FrameFeatures *features);
+#endif /* ifndef PRIVATE_ANALYZER_H */
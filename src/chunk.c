@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdlib.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+
+#include "bcg729/chunk.h"
+
+/* frame lengths in bytes */
+#define FRAME_LENGTH 10
+#define SID_FRAME_LENGTH 2
+
+/*****************************************************************************/
+/* bcg729EncodeChunk : encode a chunk of a stream after a warm-up            */
+/*    parameters:                                                            */
+/*      -(i) input : warmUpFramesNbr + framesNbr frames of 80 samples        */
+/*      -(i) warmUpFramesNbr : number of frames encoded before the chunk     */
+/*      -(i) framesNbr : number of frames of the chunk                       */
+/*      -(i) enableVAD : flag set to 1: VAD/DTX is enabled                   */
+/*      -(o) bitStream : the encoded frames concatenated                     */
+/*      -(o) bitStreamLength : length of each encoded frame                  */
+/*    return value : length of bitStream in bytes                            */
+/*                                                                           */
+/*****************************************************************************/
+uint32_t bcg729EncodeChunk(const int16_t input[], uint32_t warmUpFramesNbr, uint32_t framesNbr, uint8_t enableVAD, uint8_t bitStream[], uint8_t bitStreamLength[])
+{
+	bcg729EncoderChannelContextStruct *encoderChannelContext = initBcg729EncoderChannel(enableVAD);
+	uint8_t warmUpBitStream[FRAME_LENGTH];
+	uint8_t warmUpBitStreamLength;
+	uint32_t bitStreamIndex = 0;
+	uint32_t i;
+
+	for (i=0; i<warmUpFramesNbr; i++) {
+		bcg729Encoder(encoderChannelContext, &(input[i*L_FRAME]), warmUpBitStream, &warmUpBitStreamLength);
+	}
+	input = &(input[warmUpFramesNbr*L_FRAME]);
+
+	for (i=0; i<framesNbr; i++) {
+		bcg729Encoder(encoderChannelContext, &(input[i*L_FRAME]), &(bitStream[bitStreamIndex]), &(bitStreamLength[i]));
+		bitStreamIndex += bitStreamLength[i];
+	}
+
+	closeBcg729EncoderChannel(encoderChannelContext);
+	return bitStreamIndex;
+}
+
+/*****************************************************************************/
+/* bcg729DecodeChunk : decode a chunk of a stream after a warm-up            */
+/*    parameters:                                                            */
+/*      -(i) bitStream : warmUpFramesNbr + framesNbr frames concatenated     */
+/*      -(i) bitStreamLength : length of each frame: 10, 2 or 0              */
+/*      -(i) warmUpFramesNbr : number of frames decoded before the chunk     */
+/*      -(i) framesNbr : number of frames of the chunk                       */
+/*      -(o) signal : decoded signal(16 bits PCM), 80 samples per frame      */
+/*    return value : number of frames decoded                                */
+/*                                                                           */
+/*****************************************************************************/
+uint32_t bcg729DecodeChunk(const uint8_t bitStream[], const uint8_t bitStreamLength[], uint32_t warmUpFramesNbr, uint32_t framesNbr, int16_t signal[])
+{
+	bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+	int16_t warmUpSignal[L_FRAME];
+	uint32_t bitStreamIndex = 0;
+	uint32_t i;
+
+	for (i=0; i<warmUpFramesNbr+framesNbr; i++) {
+		uint8_t length = bitStreamLength[i];
+		int16_t *output = (i<warmUpFramesNbr)?warmUpSignal:&(signal[(i-warmUpFramesNbr)*L_FRAME]);
+
+		if (length == FRAME_LENGTH) {
+			bcg729Decoder(decoderChannelContext, &(bitStream[bitStreamIndex]), FRAME_LENGTH, 0, 0, 0, output);
+		} else if (length == SID_FRAME_LENGTH) {
+			bcg729Decoder(decoderChannelContext, &(bitStream[bitStreamIndex]), SID_FRAME_LENGTH, 0, 1, 0, output);
+		} else if (length == 0) {
+			bcg729Decoder(decoderChannelContext, NULL, 0, 0, 1, 0, output);
+		} else {
+			break;
+		}
+		bitStreamIndex += length;
+	}
+
+	closeBcg729DecoderChannel(decoderChannelContext);
+	return (i<warmUpFramesNbr)?0:i-warmUpFramesNbr;
+}
@@ -46,6 +46,62 @@ bcg729CNGChannelContextStruct *initBcg729CNGChannel() {
 	return CNGChannelContext;
 }
 
+/*******************************************************************************************/
+/* generateComfortNoiseRandomSubframe : pseudo random draws of spec B4.4 for one subframe  */
+/*    parameters:                                                                          */
+/*      -(i/o): randomGeneratorSeed : used to get a pseudo random number, is updated       */
+/*      -(o): randomSubframe : pitch delay, pulses, Ga, unscaled gaussian excitation       */
+/*                                                                                         */
+/*******************************************************************************************/
+static void generateComfortNoiseRandomSubframe(uint16_t *randomGeneratorSeed, CNGRandomSubframe *randomSubframe) {
+	uint16_t randomNumberBuffer;
+	word32_t Eg = 0;
+	int i,j;
+
+	/* generate pseudo random pitch delay in range [40,103] for adaptative codebook */
+	randomNumberBuffer = pseudoRandom(randomGeneratorSeed); /* get 16 bits of pseudoRandom value*/
+	randomSubframe->fracPitchDelay = (int16_t)(randomNumberBuffer&0x0003)-1; /* fraction part of the pitch delay shall be -1, 0 or 1 */
+	if (randomSubframe->fracPitchDelay==2) randomSubframe->fracPitchDelay = 0;
+	randomNumberBuffer = randomNumberBuffer>>2; /* 14 random bits left */
+	randomSubframe->intPitchDelay = (randomNumberBuffer&0x003F) + 40; /* intPitchDelay in [40,103] */
+	randomNumberBuffer = randomNumberBuffer>>6; /* 8 random bits left */
+	/* generate pseudo random sign and position for fixed codebook */
+	randomSubframe->position[0] = (randomNumberBuffer&0x0007)*5;
+	randomNumberBuffer = randomNumberBuffer>>3; /* 5 random bits left */
+	randomSubframe->sign[0] = randomNumberBuffer&0x0001;
+	randomNumberBuffer = randomNumberBuffer>>1; /* 4 random bits left */
+	randomSubframe->position[1] = (randomNumberBuffer&0x0007)*5+1;
+	randomNumberBuffer = randomNumberBuffer>>3; /* 1 random bits left */
+	randomSubframe->sign[1] = randomNumberBuffer&0x0001;
+	randomNumberBuffer = pseudoRandom(randomGeneratorSeed); /* get 16 bits of pseudoRandom value*/
+	randomSubframe->position[2] = (randomNumberBuffer&0x0007)*5+2;
+	randomNumberBuffer = randomNumberBuffer>>3; /* 13 random bits left */
+	randomSubframe->sign[2] = randomNumberBuffer&0x0001;
+	randomNumberBuffer = randomNumberBuffer>>1; /* 12 random bits left */
+	randomSubframe->position[3] = (randomNumberBuffer&0x0001)+3; /*j+3*/
+	randomNumberBuffer = randomNumberBuffer>>1; /* 11 random bits left */
+	randomSubframe->position[3] += (randomNumberBuffer&0x0007)*5;
+	randomNumberBuffer = randomNumberBuffer>>3; /* 8 random bits left */
+	randomSubframe->sign[3] = randomNumberBuffer&0x0001;
+	/* randomly generate Ga : adaptative gain eqB.22: max is 0,5  */
+	randomSubframe->Ga = (pseudoRandom(randomGeneratorSeed)&0x1fff)<<1; /* get 16 bits of pseudoRandom value but make sure it is < 0.5 in Q15 */
+
+	/* generate gaussian random excitation : get generation algo from ITU code, no reference to this in the spec... 
+	 * Compute also the subframe energy(Sum [0..39] excitation^2) used to scale the sample to get an subframe average energy to targetGain/4 */
+	for (i=0; i<L_SUBFRAME; i++) {
+		word32_t tmpBuffer=0;
+		for (j=0; j<12; j++) {
+			tmpBuffer=ADD32(tmpBuffer, (word16_t)pseudoRandom(randomGeneratorSeed)); /* cast the unsigned 16 bits value to a signed one */
+		}
+		randomSubframe->gaussianRandomExcitation[i]=(word16_t)(SHR(tmpBuffer,7));
+		Eg = MAC16_16(Eg, randomSubframe->gaussianRandomExcitation[i], randomSubframe->gaussianRandomExcitation[i]);
+	}
+
+	/* compute coefficient = 1/2*sqrt(L_SUBFRAME/gaussianRandomExcitationSubframeEnergy) (always>0) - retrieved from ITU code, no mention of this in the spec */
+	/* comments in code say 1/4*sqrt() but code actually implement 1/2... */
+	randomSubframe->GgFactor = MULT16_32_Q15(GAUSSIAN_EXCITATION_COEFF_FACTOR, g729InvSqrt_Q0Q31(Eg)); /* multiplicand in Q1.13 and Q0.31 -> result in Q1.29 */
+}
+
 /*******************************************************************************************/
 /* computeComfortNoiseExcitationVector : as is spec B4.4 and B4.5                          */
 /*    parameters:                                                                          */
@@ -56,73 +112,42 @@ bcg729CNGChannelContextStruct *initBcg729CNGChannel() {
 /*                                                                                         */
 /*******************************************************************************************/
 void computeComfortNoiseExcitationVector(word16_t targetGain, uint16_t *randomGeneratorSeed, word16_t *excitationVector) {
-	int16_t fracPitchDelay,intPitchDelay;
-	uint16_t randomNumberBuffer;
 	uint8_t subframeIndex = 0;
-	int i,j;
+	int i;
+	CNGRandomSubframe generatedRandomSubframes[2]; /* used when the seed is not in the precomputed draws */
+	const CNGRandomSubframe *randomSubframes = generatedRandomSubframes;
+	int16_t precomputedIndex = CNGRandomDrawsIndex[(*randomGeneratorSeed)&CNG_RANDOM_CACHE_HASH_MASK];
 	/* shall we check targetGain is 0?? and set excitation vector[0,L_FRAME[ to 0 in this case?*/
 
+	/* get the random draws of this frame from the precomputed ones or generate them */
+	if (precomputedIndex>=0 && CNGRandomDrawsSeed[precomputedIndex] == *randomGeneratorSeed) {
+		randomSubframes = CNGRandomDraws[precomputedIndex];
+		*randomGeneratorSeed = CNGRandomDrawsNextSeed[precomputedIndex];
+	} else {
+		generateComfortNoiseRandomSubframe(randomGeneratorSeed, &(generatedRandomSubframes[0]));
+		generateComfortNoiseRandomSubframe(randomGeneratorSeed, &(generatedRandomSubframes[1]));
+	}
+
 	for (subframeIndex=0; subframeIndex<L_FRAME; subframeIndex+=L_SUBFRAME) { /* process 2 subframes */
+		const CNGRandomSubframe *randomSubframe = &(randomSubframes[subframeIndex/L_SUBFRAME]);
+		int16_t fracPitchDelay = randomSubframe->fracPitchDelay;
+		int16_t intPitchDelay = randomSubframe->intPitchDelay;
+		const word16_t *sign = randomSubframe->sign; /* sign of the impulses of fixed codebook excitation */
+		const word16_t *position = randomSubframe->position; /* positions of the impulses of fixed codebook excitation */
+		word16_t Ga = randomSubframe->Ga; /* gain to be applied to adaptative subframe excitation in Q0.15 */
 		word16_t gaussianRandomExcitation[L_SUBFRAME];
-		word32_t Eg = 0;
 		word32_t Gg = 0; /* gain to be applied to the randomly generated gaussian to reach a Eg of 1/4*L_SUBFRAME*targetGain(note this doesn't appears in spec, only in ITU code)*/
-		word16_t Ga = 0; /* gain to be applied to adaptative subframe excitation in Q0.15 */
 		word32_t Ea = 0;
 		word32_t Ei = 0; /* inter excitation : Sum[0..39] adaptativeExcitation*fixedExcitation, defined in eq B21*/
 		word32_t K = 0;
 		word32_t Gf = 0; /* gain to be applied to the fixed codebook excitation */
 		word32_t x2 = 0; /* second root of the 2nd degre equation solved to get Gf */
-		word16_t sign[4]; /* sign of the impulses of fixed codebook excitation */
-		word16_t position[4]; /* positions of the impulses of fixed codebook excitation */
 		uint8_t deltaScaleFactor=0;
 		word64_t delta;
 
-		/* generate pseudo random pitch delay in range [40,103] for adaptative codebook */
-		randomNumberBuffer = pseudoRandom(randomGeneratorSeed); /* get 16 bits of pseudoRandom value*/
-		fracPitchDelay = (int16_t)(randomNumberBuffer&0x0003)-1; /* fraction part of the pitch delay shall be -1, 0 or 1 */
-		if (fracPitchDelay==2) fracPitchDelay = 0;
-		randomNumberBuffer = randomNumberBuffer>>2; /* 14 random bits left */
-		intPitchDelay = (randomNumberBuffer&0x003F) + 40; /* intPitchDelay in [40,103] */
-		randomNumberBuffer = randomNumberBuffer>>6; /* 8 random bits left */
-		/* generate pseudo random sign and position for fixed codebook */
-		position[0] = (randomNumberBuffer&0x0007)*5;
-		randomNumberBuffer = randomNumberBuffer>>3; /* 5 random bits left */
-		sign[0] = randomNumberBuffer&0x0001;
-		randomNumberBuffer = randomNumberBuffer>>1; /* 4 random bits left */
-		position[1] = (randomNumberBuffer&0x0007)*5+1;
-		randomNumberBuffer = randomNumberBuffer>>3; /* 1 random bits left */
-		sign[1] = randomNumberBuffer&0x0001,
-		randomNumberBuffer = pseudoRandom(randomGeneratorSeed); /* get 16 bits of pseudoRandom value*/
-		position[2] = (randomNumberBuffer&0x0007)*5+2;
-		randomNumberBuffer = randomNumberBuffer>>3; /* 13 random bits left */
-		sign[2] = randomNumberBuffer&0x0001;
-		randomNumberBuffer = randomNumberBuffer>>1; /* 12 random bits left */
-		position[3] = (randomNumberBuffer&0x0001)+3; /*j+3*/
-		randomNumberBuffer = randomNumberBuffer>>1; /* 11 random bits left */
-		position[3] += (randomNumberBuffer&0x0007)*5;
-		randomNumberBuffer = randomNumberBuffer>>3; /* 8 random bits left */
-		sign[3] = randomNumberBuffer&0x0001;
-		randomNumberBuffer = randomNumberBuffer>>1; /* 7 random bits left */
-		/* randomly generate Ga : adaptative gain eqB.22: max is 0,5  */
-		Ga = (pseudoRandom(randomGeneratorSeed)&0x1fff)<<1; /* get 16 bits of pseudoRandom value but make sure it is < 0.5 in Q15 */
-
-
-
-		/* generate gaussian random excitation : get generation algo from ITU code, no reference to this in the spec... 
-		 * Compute also the subframe energy(Sum [0..39] excitation^2) and then scale the sample to get an subframe average energy to targetGain/4 */
-		for (i=0; i<L_SUBFRAME; i++) {
-			word32_t tmpBuffer=0;
-			for (j=0; j<12; j++) {
-				tmpBuffer=ADD32(tmpBuffer, (word16_t)pseudoRandom(randomGeneratorSeed)); /* cast the unsigned 16 bits value to a signed one */
-			}
-			gaussianRandomExcitation[i]=(word16_t)(SHR(tmpBuffer,7));
-			Eg = MAC16_16(Eg, gaussianRandomExcitation[i], gaussianRandomExcitation[i]);
-		}
-
-		/* compute coefficient = 1/2*sqrt(L_SUBFRAME/gaussianRandomExcitationSubframeEnergy)*targetGain (always>0) - retrieved from ITU code, no mention of this in the spec */
-    		/* comments in code say 1/4*sqrt() but code actually implement 1/2... */
-		Gg = MULT16_32_Q15(GAUSSIAN_EXCITATION_COEFF_FACTOR, g729InvSqrt_Q0Q31(Eg)); /* multiplicand in Q1.13 and Q0.31 -> result in Q1.29 */
-		Gg = MULT16_32_Q15(targetGain, Gg); /* multiplicand in Q3 and Q1.29 -> result in Q17 */
+		/* scale the gaussian excitation to get an subframe average energy to targetGain/4 */
+		memcpy(gaussianRandomExcitation, randomSubframe->gaussianRandomExcitation, L_SUBFRAME*sizeof(word16_t));
+		Gg = MULT16_32_Q15(targetGain, randomSubframe->GgFactor); /* multiplicand in Q3 and Q1.29 -> result in Q17 */
 
 		for (i=0; i<L_SUBFRAME; i++) {
 			/* operate on positive value only to avoid problem when shifting to 0 a negative one */
@@ -220,28 +245,21 @@ void computeComfortNoiseExcitationVector(word16_t targetGain, uint16_t *randomGe
 }
 
 /*******************************************************************************************/
-/* decodeSIDframe : as is spec B4.4 and B4.5                                               */
-/*    first check if we have a SID frame or a missing/untransmitted frame                  */
-/*    for SID frame get paremeters(gain and LSP)                                           */
-/*    Then generate excitation vector and update qLSP                                      */
+/* decodeSIDParameters : decode SID frame parameters as in spec B4.3 (or RFC3389 payload)  */
+/*    update received gain and qLSP in CNG context, nothing is done on NULL bitStream      */
 /*    parameters:                                                                          */
 /*      -(i/o):CNGChannelContext : context containing all informations needed for CNG      */
-/*      -(i): previousFrameIsActiveFlag: true if last decoded frame was an active one      */
 /*      -(i): bitStream: for SID frame contains received params as in spec B4.3,           */
 /*                       NULL for missing/untransmitted frame                              */
 /*      -(i): bitStreamLength : in bytes, length of previous buffer                        */
-/*      -(i/o): excitationVector in Q0, accessed in range [-L_PAST_EXCITATION,L_FRAME-1]   */
-/*                                                        [-154,79]                        */
-/*      -(o): LP: 20 LP coefficients in Q12                                                */
-/*      -(i/o): previousqLSP : previous quantised LSP in Q0.15 (NB_LSP_COEFF values)       */
-/*      -(i/o): pseudoRandomSeed : seed used in the pseudo random number generator         */
+/*      -(i): previousqLSP : previous quantised LSP in Q0.15 (NB_LSP_COEFF values)         */
 /*      -(i/o): previousLCodeWord: in Q2.13, buffer to store the last 4 frames codewords,  */
 /*              used to compute the current qLSF                                           */
+/*      -(i): rfc3389PayloadFlag : true when CN payload follow rfc3389                     */
 /*                                                                                         */
 /*******************************************************************************************/
-void decodeSIDframe(bcg729CNGChannelContextStruct *CNGChannelContext, uint8_t previousFrameIsActiveFlag, const uint8_t *bitStream, uint8_t bitStreamLength, word16_t *excitationVector, word16_t *previousqLSP, word16_t *LP, uint16_t *pseudoRandomSeed, word16_t previousLCodeWord[MA_MAX_K][NB_LSP_COEFF], uint8_t rfc3389PayloadFlag) {
+void decodeSIDParameters(bcg729CNGChannelContextStruct *CNGChannelContext, const uint8_t *bitStream, uint8_t bitStreamLength, word16_t *previousqLSP, word16_t previousLCodeWord[MA_MAX_K][NB_LSP_COEFF], uint8_t rfc3389PayloadFlag) {
 	int i;
-	word16_t interpolatedqLSP[NB_LSP_COEFF]; /* interpolated qLSP in Q0.15 */
 	/* if this is a SID frame, decode received parameters */
 	if (bitStream!=NULL) {
 		if (rfc3389PayloadFlag) {
@@ -310,6 +328,7 @@ void decodeSIDframe(bcg729CNGChannelContextStruct *CNGChannelContext, uint8_t pr
 			if (!LP2LSPConversion(LPCoefficientsQ12, CNGChannelContext->qLSP)) {
 				/* unable to find the 10 roots repeat previous LSP */
 				memcpy(CNGChannelContext->qLSP, previousqLSP, NB_LSP_COEFF*sizeof(word16_t));
+				CNGChannelContext->LSPConversionFailuresNbr++;
 			}
 		} else { /* regular G729 SID payload on 2 bytes */
 			word16_t currentqLSF[NB_LSP_COEFF]; /* buffer to the current qLSF in Q2.13 */
@@ -334,6 +353,33 @@ void decodeSIDframe(bcg729CNGChannelContextStruct *CNGChannelContext, uint8_t pr
 			}
 		}
 	} /* Note: Itu implementation have information to sort missing and untransmitted packets and perform reconstruction of missed SID packet when it detects it, we cannot differentiate lost vs untransmitted packet so we don't do it */
+}
+
+/*******************************************************************************************/
+/* decodeSIDframe : as is spec B4.4 and B4.5                                               */
+/*    first check if we have a SID frame or a missing/untransmitted frame                  */
+/*    for SID frame get paremeters(gain and LSP)                                           */
+/*    Then generate excitation vector and update qLSP                                      */
+/*    parameters:                                                                          */
+/*      -(i/o):CNGChannelContext : context containing all informations needed for CNG      */
+/*      -(i): previousFrameIsActiveFlag: true if last decoded frame was an active one      */
+/*      -(i): bitStream: for SID frame contains received params as in spec B4.3,           */
+/*                       NULL for missing/untransmitted frame                              */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer                        */
+/*      -(i/o): excitationVector in Q0, accessed in range [-L_PAST_EXCITATION,L_FRAME-1]   */
+/*                                                        [-154,79]                        */
+/*      -(o): LP: 20 LP coefficients in Q12                                                */
+/*      -(i/o): previousqLSP : previous quantised LSP in Q0.15 (NB_LSP_COEFF values)       */
+/*      -(i/o): pseudoRandomSeed : seed used in the pseudo random number generator         */
+/*      -(i/o): previousLCodeWord: in Q2.13, buffer to store the last 4 frames codewords,  */
+/*              used to compute the current qLSF                                           */
+/*                                                                                         */
+/*******************************************************************************************/
+void decodeSIDframe(bcg729CNGChannelContextStruct *CNGChannelContext, uint8_t previousFrameIsActiveFlag, const uint8_t *bitStream, uint8_t bitStreamLength, word16_t *excitationVector, word16_t *previousqLSP, word16_t *LP, uint16_t *pseudoRandomSeed, word16_t previousLCodeWord[MA_MAX_K][NB_LSP_COEFF], uint8_t rfc3389PayloadFlag) {
+	int i;
+	word16_t interpolatedqLSP[NB_LSP_COEFF]; /* interpolated qLSP in Q0.15 */
+	/* if this is a SID frame, decode received parameters */
+	decodeSIDParameters(CNGChannelContext, bitStream, bitStreamLength, previousqLSP, previousLCodeWord, rfc3389PayloadFlag);
 
 	/* compute the LP coefficients */
 	interpolateqLSP(previousqLSP, CNGChannelContext->qLSP, interpolatedqLSP);
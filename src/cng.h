@@ -29,6 +29,22 @@
 bcg729CNGChannelContextStruct *initBcg729CNGChannel();
 
 void computeComfortNoiseExcitationVector(word16_t targetGain, uint16_t *randomGeneratorSeed, word16_t *excitationVector);
+/*******************************************************************************************/
+/* decodeSIDParameters : decode SID frame parameters as in spec B4.3 (or RFC3389 payload)  */
+/*    update received gain and qLSP in CNG context, nothing is done on NULL bitStream      */
+/*    parameters:                                                                          */
+/*      -(i/o):CNGChannelContext : context containing all informations needed for CNG      */
+/*      -(i): bitStream: for SID frame contains received params as in spec B4.3,           */
+/*                       NULL for missing/untransmitted frame                              */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer                        */
+/*      -(i): previousqLSP : previous quantised LSP in Q0.15 (NB_LSP_COEFF values)         */
+/*      -(i/o): previousLCodeWord: in Q2.13, buffer to store the last 4 frames codewords,  */
+/*              used to compute the current qLSF                                           */
+/*      -(i): rfc3389PayloadFlag : true when CN payload follow rfc3389                     */
+/*                                                                                         */
+/*******************************************************************************************/
+void decodeSIDParameters(bcg729CNGChannelContextStruct *CNGChannelContext, const uint8_t *bitStream, uint8_t bitStreamLength, word16_t *previousqLSP, word16_t previousLCodeWord[MA_MAX_K][NB_LSP_COEFF], uint8_t rfc3389PayloadFlag);
+
 /*******************************************************************************************/
 /* decodeSIDframe : as is spec B4.4 and B4.5                                               */
 /*    first check if we have a SID frame or a missing/untransmitted frame                  */
@@ -19,6 +19,7 @@
 
 #include "typedef.h"
 #include "codecParameters.h"
+#include "codebooks.h"
 
 /*** codebooks for quantization of the LSP coefficient - doc: 3.2.4 ***/
 word16_t L1[L1_RANGE][NB_LSP_COEFF] = { /* The first stage is a 10-dimensional VQ using codebook L1 with 128 entries (7 bits) */
@@ -153,6 +154,139 @@ word16_t L1[L1_RANGE][NB_LSP_COEFF] = { /* The first stage is a 10-dimensional V
 	{ 1721,  2577,  5553,  7195,  8651, 10686, 15069, 16953, 18703, 19929}
 };
 
+/* for each L1 codebook vector, indexes of its L1_HINT_NEIGHBOURS closest vectors(itself first) by squared euclidean distance, */
+/* used to search around the L1 hints */
+const uint8_t L1Neighbours[L1_RANGE][L1_HINT_NEIGHBOURS] = {
+	{0, 89, 32, 96, 72, 66, 16, 122},
+	{1, 11, 15, 3, 47, 99, 97, 69},
+	{2, 104, 34, 66, 74, 17, 10, 98},
+	{3, 15, 107, 99, 97, 1, 5, 11},
+	{4, 40, 125, 56, 98, 32, 122, 96},
+	{5, 73, 97, 3, 65, 8, 17, 27},
+	{6, 57, 61, 44, 23, 7, 12, 42},
+	{7, 39, 63, 57, 51, 46, 6, 43},
+	{8, 27, 10, 65, 13, 17, 76, 42},
+	{9, 31, 47, 43, 37, 109, 41, 53},
+	{10, 34, 8, 25, 26, 74, 27, 19},
+	{11, 35, 33, 15, 47, 105, 1, 37},
+	{12, 44, 54, 42, 49, 6, 23, 40},
+	{13, 45, 35, 17, 38, 8, 34, 27},
+	{14, 62, 46, 44, 19, 59, 23, 22},
+	{15, 3, 69, 63, 11, 107, 33, 1},
+	{16, 88, 24, 122, 0, 64, 90, 56},
+	{17, 40, 105, 98, 121, 13, 8, 110},
+	{18, 114, 54, 50, 58, 82, 22, 44},
+	{19, 25, 26, 44, 14, 58, 29, 50},
+	{20, 92, 52, 86, 28, 124, 68, 82},
+	{21, 126, 100, 108, 53, 68, 77, 114},
+	{22, 54, 83, 85, 30, 86, 23, 18},
+	{23, 29, 43, 22, 54, 126, 6, 70},
+	{24, 58, 122, 72, 18, 16, 26, 106},
+	{25, 19, 50, 108, 75, 44, 10, 106},
+	{26, 19, 10, 58, 44, 74, 18, 72},
+	{27, 8, 10, 110, 25, 13, 38, 75},
+	{28, 30, 20, 92, 90, 52, 122, 86},
+	{29, 23, 43, 75, 25, 31, 45, 19},
+	{30, 28, 58, 83, 22, 62, 93, 60},
+	{31, 43, 109, 29, 9, 23, 126, 7},
+	{32, 89, 96, 48, 40, 121, 106, 36},
+	{33, 11, 73, 77, 38, 69, 15, 37},
+	{34, 10, 42, 13, 25, 104, 2, 8},
+	{35, 11, 13, 43, 45, 105, 38, 33},
+	{36, 127, 124, 53, 52, 32, 125, 93},
+	{37, 69, 102, 101, 63, 61, 11, 33},
+	{38, 33, 13, 35, 105, 73, 77, 39},
+	{39, 7, 57, 46, 37, 38, 79, 63},
+	{40, 121, 32, 44, 4, 17, 104, 12},
+	{41, 37, 55, 71, 9, 39, 119, 6},
+	{42, 45, 44, 25, 12, 34, 6, 8},
+	{43, 29, 31, 45, 23, 35, 7, 57},
+	{44, 58, 40, 12, 19, 25, 6, 42},
+	{45, 42, 43, 13, 29, 25, 35, 75},
+	{46, 14, 7, 57, 78, 39, 40, 62},
+	{47, 11, 63, 9, 1, 111, 37, 109},
+	{48, 96, 124, 32, 120, 56, 89, 18},
+	{49, 70, 76, 102, 77, 55, 57, 12},
+	{50, 25, 18, 108, 58, 106, 114, 44},
+	{51, 102, 62, 115, 127, 63, 7, 103},
+	{52, 20, 68, 54, 124, 56, 92, 60},
+	{53, 126, 21, 36, 55, 52, 102, 103},
+	{54, 22, 52, 18, 70, 23, 12, 114},
+	{55, 102, 49, 53, 70, 54, 103, 61},
+	{56, 122, 52, 4, 48, 96, 60, 32},
+	{57, 6, 110, 7, 76, 61, 39, 44},
+	{58, 44, 24, 18, 93, 106, 50, 30},
+	{59, 78, 87, 14, 62, 83, 79, 123},
+	{60, 62, 93, 52, 30, 54, 56, 126},
+	{61, 6, 57, 102, 60, 37, 4, 49},
+	{62, 60, 93, 51, 14, 30, 95, 127},
+	{63, 111, 7, 51, 15, 47, 69, 37},
+	{64, 120, 16, 88, 0, 112, 48, 82},
+	{65, 76, 8, 81, 73, 89, 66, 5},
+	{66, 89, 2, 48, 50, 96, 65, 0},
+	{67, 95, 115, 127, 78, 123, 110, 70},
+	{68, 117, 52, 94, 124, 81, 100, 92},
+	{69, 102, 15, 111, 101, 51, 37, 33},
+	{70, 49, 102, 103, 115, 54, 51, 55},
+	{71, 119, 79, 51, 87, 95, 59, 111},
+	{72, 24, 74, 26, 0, 90, 104, 16},
+	{73, 33, 77, 110, 5, 38, 65, 76},
+	{74, 72, 10, 104, 26, 2, 34, 89},
+	{75, 25, 29, 107, 79, 123, 7, 45},
+	{76, 49, 78, 110, 77, 65, 81, 113},
+	{77, 76, 110, 49, 33, 73, 21, 69},
+	{78, 110, 76, 67, 123, 91, 59, 46},
+	{79, 111, 71, 75, 7, 59, 31, 95},
+	{80, 112, 88, 84, 64, 82, 120, 16},
+	{81, 68, 76, 113, 114, 86, 65, 50},
+	{82, 120, 86, 90, 114, 112, 18, 92},
+	{83, 22, 30, 59, 87, 62, 95, 28},
+	{84, 116, 112, 86, 20, 88, 82, 92},
+	{85, 118, 115, 22, 86, 95, 94, 68},
+	{86, 116, 82, 68, 20, 85, 22, 92},
+	{87, 95, 119, 59, 22, 83, 23, 30},
+	{88, 92, 82, 90, 120, 20, 16, 84},
+	{89, 32, 0, 48, 66, 96, 104, 106},
+	{90, 82, 28, 48, 92, 88, 18, 86},
+	{91, 123, 78, 58, 50, 106, 76, 89},
+	{92, 124, 20, 120, 68, 88, 52, 28},
+	{93, 125, 126, 94, 58, 127, 62, 106},
+	{94, 68, 93, 124, 125, 115, 127, 50},
+	{95, 67, 127, 115, 87, 62, 85, 94},
+	{96, 48, 32, 121, 124, 56, 120, 89},
+	{97, 113, 101, 99, 98, 5, 3, 100},
+	{98, 125, 106, 17, 107, 4, 108, 93},
+	{99, 97, 3, 107, 113, 69, 127, 108},
+	{100, 113, 68, 21, 124, 117, 114, 125},
+	{101, 102, 69, 125, 97, 37, 100, 77},
+	{102, 125, 70, 101, 51, 49, 69, 103},
+	{103, 115, 102, 70, 51, 53, 95, 111},
+	{104, 40, 89, 32, 2, 74, 44, 12},
+	{105, 17, 35, 57, 98, 11, 38, 125},
+	{106, 98, 58, 93, 50, 25, 44, 122},
+	{107, 127, 125, 98, 93, 3, 123, 108},
+	{108, 50, 25, 21, 98, 127, 125, 93},
+	{109, 31, 111, 69, 108, 21, 127, 103},
+	{110, 78, 76, 77, 57, 127, 123, 108},
+	{111, 63, 69, 79, 109, 95, 103, 31},
+	{112, 120, 82, 84, 116, 88, 80, 92},
+	{113, 100, 68, 76, 97, 81, 125, 21},
+	{114, 18, 82, 117, 68, 50, 54, 48},
+	{115, 67, 95, 85, 103, 51, 70, 94},
+	{116, 86, 117, 84, 68, 20, 112, 92},
+	{117, 68, 116, 114, 100, 86, 52, 113},
+	{118, 85, 20, 52, 86, 22, 54, 119},
+	{119, 87, 71, 70, 118, 103, 55, 23},
+	{120, 82, 92, 112, 48, 96, 124, 114},
+	{121, 40, 96, 17, 32, 36, 4, 89},
+	{122, 24, 56, 58, 93, 106, 28, 32},
+	{123, 93, 91, 67, 78, 107, 110, 127},
+	{124, 92, 68, 48, 52, 96, 36, 20},
+	{125, 93, 102, 98, 127, 4, 94, 107},
+	{126, 53, 93, 21, 23, 31, 60, 62},
+	{127, 107, 67, 95, 36, 93, 125, 51}
+};
+
 word16_t L2L3[L2_RANGE][NB_LSP_COEFF] = { /* The second stage is a 10-bit VQ splitted in L2(first 5 values of a vector) and L3(last five value in each vector) containing 32 entries (5 bits). */
 /* Q0.13 but max value<0.5 so fitting actually on 12+1(sign) bits */
 	{ -435,  -815,  -742,  1033,  -518,   582, -1201,   829,    86,   385},
@@ -352,3 +486,1618 @@ word16_t SIDGainCodebook[32] = {
 /* Low Band Filter FIR for VAD in Q15 */
 word16_t lowBandFilter[NB_LSP_COEFF+3] = {7869, 7011, 4838, 2299, 321, -660, -782, -484, -164, 3, 39, 21, 4};
 
+
+/* comfort noise random draws of spec B4.4 for the first CNG_RANDOM_CACHE_FRAMES frames following a reset of the seed to */
+/* CNG_DTX_RANDOM_SEED_INIT, as computed by generateComfortNoiseRandomSubframe */
+const uint16_t CNGRandomDrawsSeed[CNG_RANDOM_CACHE_FRAMES] = {
+11111, 5273, 12987, 2637, 39887, 33729, 6819, 38133, 9015, 4585, 59787, 36509, 24991, 24337, 16243, 38725,
+63239, 2873, 48219, 20205, 33647, 46689, 67, 21909, 42711, 137, 43819, 19261, 319, 35249, 23827, 53221,
+12967, 61913, 46587, 33677, 56079, 55553, 21987, 1589, 39543, 57129, 56523, 63453, 4319, 42065, 60083, 63621,
+56903, 51321, 8091, 43053, 41647, 60321, 7043, 42709, 65047, 44489, 32363, 38013, 36991, 44785, 59475, 4389,
+63975, 36633, 63803, 48333, 55887, 60993, 20771, 14197, 53687, 27753, 36875, 8477, 32799, 43409, 22003, 6597,
+34183, 17849, 17115, 49517, 33263, 57569, 63171, 47125, 5463, 6921, 4523, 40381, 57279, 37937, 13203, 4709,
+33063, 60505, 64635, 46605, 39311, 50049, 3171, 10421, 51447, 47529, 843, 2653, 44895, 28369, 33075, 64261,
+60615, 33529, 9755, 39597, 8495, 38433, 37379, 35157, 60567, 18505, 25835, 26365, 61183, 14705, 16083, 54181,
+51303, 2457, 49083, 28493, 6351, 22721, 34723, 55797, 32823, 50921, 13963, 45981, 40607, 62481, 27763, 40005,
+5127, 32825, 51547, 13293, 32879, 2913, 60739, 6805, 33751, 13705, 30763, 61501, 48703, 40625, 2579, 21733,
+53159, 59097, 17147, 59533, 22543, 44545, 49891, 19253, 63351, 37929, 10699, 7389, 19935, 14673, 6067, 64901,
+64327, 15737, 11419, 36141, 40879, 16545, 2179, 27605, 56087, 58057, 19307, 14717, 19839, 50161, 38227, 38437,
+38631, 33817, 34363, 8653, 22351, 49985, 48675, 31861, 11959, 8553, 56587, 17949, 48415, 16017, 33523, 7877,
+41607, 47801, 20443, 42605, 32495, 13793, 58307, 32021, 62039, 20489, 57003, 17085, 40127, 43313, 57491, 38757,
+7719, 57689, 35195, 6925, 5775, 39041, 31075, 28085, 9719, 28329, 20555, 12125, 60511, 977, 44595, 5,
+2503, 63481, 13083, 32685, 7727, 60193, 32515, 20053, 51607, 32073, 12779, 3069, 44031, 20081, 60371, 22693
+};
+
+const uint16_t CNGRandomDrawsNextSeed[CNG_RANDOM_CACHE_FRAMES] = {
+5273, 12987, 2637, 39887, 33729, 6819, 38133, 9015, 4585, 59787, 36509, 24991, 24337, 16243, 38725, 63239,
+2873, 48219, 20205, 33647, 46689, 67, 21909, 42711, 137, 43819, 19261, 319, 35249, 23827, 53221, 12967,
+61913, 46587, 33677, 56079, 55553, 21987, 1589, 39543, 57129, 56523, 63453, 4319, 42065, 60083, 63621, 56903,
+51321, 8091, 43053, 41647, 60321, 7043, 42709, 65047, 44489, 32363, 38013, 36991, 44785, 59475, 4389, 63975,
+36633, 63803, 48333, 55887, 60993, 20771, 14197, 53687, 27753, 36875, 8477, 32799, 43409, 22003, 6597, 34183,
+17849, 17115, 49517, 33263, 57569, 63171, 47125, 5463, 6921, 4523, 40381, 57279, 37937, 13203, 4709, 33063,
+60505, 64635, 46605, 39311, 50049, 3171, 10421, 51447, 47529, 843, 2653, 44895, 28369, 33075, 64261, 60615,
+33529, 9755, 39597, 8495, 38433, 37379, 35157, 60567, 18505, 25835, 26365, 61183, 14705, 16083, 54181, 51303,
+2457, 49083, 28493, 6351, 22721, 34723, 55797, 32823, 50921, 13963, 45981, 40607, 62481, 27763, 40005, 5127,
+32825, 51547, 13293, 32879, 2913, 60739, 6805, 33751, 13705, 30763, 61501, 48703, 40625, 2579, 21733, 53159,
+59097, 17147, 59533, 22543, 44545, 49891, 19253, 63351, 37929, 10699, 7389, 19935, 14673, 6067, 64901, 64327,
+15737, 11419, 36141, 40879, 16545, 2179, 27605, 56087, 58057, 19307, 14717, 19839, 50161, 38227, 38437, 38631,
+33817, 34363, 8653, 22351, 49985, 48675, 31861, 11959, 8553, 56587, 17949, 48415, 16017, 33523, 7877, 41607,
+47801, 20443, 42605, 32495, 13793, 58307, 32021, 62039, 20489, 57003, 17085, 40127, 43313, 57491, 38757, 7719,
+57689, 35195, 6925, 5775, 39041, 31075, 28085, 9719, 28329, 20555, 12125, 60511, 977, 44595, 5, 2503,
+63481, 13083, 32685, 7727, 60193, 32515, 20053, 51607, 32073, 12779, 3069, 44031, 20081, 60371, 22693, 25959
+};
+
+const int16_t CNGRandomDrawsIndex[CNG_RANDOM_CACHE_HASH_MASK+1] = {
+-1, 165, -1, 118, -1, 239, -1, 144, -1, 217, -1, 74, -1, 99, -1, 164,
+-1, 141, -1, 158, -1, 87, -1, 56, -1, 193, -1, 114, -1, 203, -1, 76,
+-1, 117, -1, 198, -1, 191, -1, 224, -1, 169, -1, 154, -1, 51, -1, 244,
+-1, 93, -1, 238, -1, 39, -1, 136, -1, 145, -1, 194, -1, 155, -1, 156,
+-1, 69, -1, 22, -1, 143, -1, 48, -1, 121, -1, 234, -1, 3, -1, 68,
+-1, 45, -1, 62, -1, 247, -1, 216, -1, 97, -1, 18, -1, 107, -1, 236,
+-1, 21, -1, 102, -1, 95, -1, 128, -1, 73, -1, 58, -1, 211, -1, 148,
+-1, 253, -1, 142, -1, 199, -1, 40, -1, 49, -1, 98, -1, 59, -1, 60,
+-1, 229, -1, 182, -1, 47, -1, 208, -1, 25, -1, 138, -1, 163, -1, 228,
+-1, 205, -1, 222, -1, 151, -1, 120, -1, 1, -1, 178, -1, 11, -1, 140,
+-1, 181, -1, 6, -1, 255, -1, 32, -1, 233, -1, 218, -1, 115, -1, 52,
+-1, 157, -1, 46, -1, 103, -1, 200, -1, 209, -1, 2, -1, 219, -1, 220,
+-1, 133, -1, 86, -1, 207, -1, 112, -1, 185, -1, 42, -1, 67, -1, 132,
+-1, 109, -1, 126, -1, 55, -1, 24, -1, 161, -1, 82, -1, 171, -1, 44,
+-1, 85, -1, 166, -1, 159, -1, 192, -1, 137, -1, 122, -1, 19, -1, 212,
+-1, 61, -1, 206, -1, 7, -1, 104, -1, 113, -1, 162, -1, 123, -1, 124,
+-1, 37, -1, 246, -1, 111, -1, 16, -1, 89, -1, 202, -1, 227, -1, 36,
+-1, 13, -1, 30, -1, 215, -1, 184, -1, 65, -1, 242, -1, 75, -1, 204,
+-1, 245, -1, 70, -1, 63, -1, 96, -1, 41, -1, 26, -1, 179, -1, 116,
+-1, 221, -1, 110, -1, 167, -1, 8, -1, 17, -1, 66, -1, 27, -1, 28,
+-1, 197, -1, 150, -1, 15, -1, 176, -1, 249, -1, 106, -1, 131, -1, 196,
+-1, 173, -1, 190, -1, 119, -1, 88, -1, 225, -1, 146, -1, 235, -1, 108,
+-1, 149, -1, 230, -1, 223, -1, 0, -1, 201, -1, 186, -1, 83, -1, 20,
+-1, 125, -1, 14, -1, 71, -1, 168, -1, 177, -1, 226, -1, 187, -1, 188,
+-1, 101, -1, 54, -1, 175, -1, 80, -1, 153, -1, 10, -1, 35, -1, 100,
+-1, 77, -1, 94, -1, 23, -1, 248, -1, 129, -1, 50, -1, 139, -1, 12,
+-1, 53, -1, 134, -1, 127, -1, 160, -1, 105, -1, 90, -1, 243, -1, 180,
+-1, 29, -1, 174, -1, 231, -1, 72, -1, 81, -1, 130, -1, 91, -1, 92,
+-1, 5, -1, 214, -1, 79, -1, 240, -1, 57, -1, 170, -1, 195, -1, 4,
+-1, 237, -1, 254, -1, 183, -1, 152, -1, 33, -1, 210, -1, 43, -1, 172,
+-1, 213, -1, 38, -1, 31, -1, 64, -1, 9, -1, 250, -1, 147, -1, 84,
+-1, 189, -1, 78, -1, 135, -1, 232, -1, 241, -1, 34, -1, 251, -1, 252
+};
+
+const CNGRandomSubframe CNGRandomDraws[CNG_RANDOM_CACHE_FRAMES][2] = {
+/* fracPitchDelay, intPitchDelay, sign, position, Ga in Q0.15, GgFactor in Q1.29, gaussianRandomExcitation in Q0 */
+	{{-1, 45, {1, 0, 1, 0}, {0, 11, 27, 4}, 7588, 507451,
+		{86, -609, 391, 173, -80, -718, -47, 559, 235, 676, -4, -110, 5, -521, -506, -300, 256, -727, -527, -9,
+		 -38, 60, -69, -263, 661, -722, -154, 1500, 303, -511, -272, -866, 938, 179, 91, 833, 4, -698, 933, -573}},
+	 {0, 64, {1, 1, 0, 0}, {15, 36, 2, 38}, 3826, 512111,
+		{225, 547, -292, -470, 302, 264, 728, -578, -294, 332, 1589, -845, 487, 241, 241, 775, 83, -523, -242, 188,
+		 -992, 602, 650, -48, 332, 542, -153, 581, -39, 323, 931, 25, -59, -569, -192, -178, -238, -596, 60, 482}}},
+	{{1, 47, {0, 1, 1, 1}, {20, 1, 37, 4}, 1240, 614446,
+		{-57, -821, 254, -1, 365, -278, 21, -371, -12, -536, 11, 1020, -166, 455, -798, 74, -95, 133, 152, -647,
+		 199, -476, -209, -633, -306, -350, -859, 118, 436, -511, -260, 68, 379, 63, 50, 755, 33, -674, 585, -383}},
+	 {0, 85, {1, 0, 1, 1}, {35, 26, 12, 23}, 3382, 479112,
+		{1140, 589, 364, -527, -516, -83, -220, 1154, -27, 878, -707, -1166, 557, -626, 437, -317, -810, 15, 654, 115,
+		 -34, -273, -570, -380, -185, -464, 863, -268, 271, 464, -169, -571, 312, -47, -592, -779, -64, 49, 616, 646}}},
+	{{-1, 62, {1, 0, 0, 0}, {20, 1, 7, 24}, 13164, 424982,
+		{259, -1109, -623, 852, 406, 757, -493, 911, 1032, -480, 630, 937, -421, -214, 184, -92, -883, -491, -293, 382,
+		 -864, 735, 221, -1223, -878, 394, 192, 723, 101, -1004, 130, -434, 535, 127, 549, -88, -86, 201, 935, 739}},
+	 {0, 101, {0, 0, 0, 1}, {35, 1, 22, 18}, 11866, 513096,
+		{-937, -304, -546, -350, 572, 460, 626, -690, -128, -471, 103, 347, 549, -539, 443, 199, 41, 1282, -400, 404,
+		 -114, -642, 644, -576, 1106, -677, 505, 333, 119, 151, -307, -455, -517, -204, -254, -378, -800, -208, 150, -462}}},
+	{{1, 56, {1, 1, 0, 0}, {15, 6, 17, 39}, 9824, 481777,
+		{-497, 770, -829, -271, -722, 281, 1105, -392, -212, 15, 192, -290, 523, 486, -1010, 37, -55, -356, 1085, 75,
+		 -408, 51, 331, 338, 486, 169, 1338, 312, -443, 512, -1016, -1, 387, -970, -73, -91, -94, -691, -443, 44}},
+	 {0, 82, {0, 1, 1, 0}, {0, 21, 32, 38}, 13150, 618413,
+		{993, -320, -251, 208, 577, 376, 150, -71, -254, 657, -890, -255, -478, 9, 215, -342, -93, 482, 391, -334,
+		 387, -486, 152, -229, 452, 179, 8, -29, 100, -1109, -39, 780, -155, -252, 9, -364, 709, 188, -358, -387}}},
+	{{-1, 63, {0, 0, 0, 0}, {35, 26, 27, 33}, 12980, 475670,
+		{-49, -395, 248, 506, 25, -9, -461, -148, 68, -166, -179, -321, -434, 156, 72, 1009, -455, -65, -1246, 772,
+		 -509, -319, 477, -1034, 942, 420, -393, 201, -200, 102, 242, -133, -1885, 777, -692, -498, -531, -117, -121, 128}},
+	 {0, 58, {0, 1, 1, 0}, {10, 6, 2, 28}, 5442, 530029,
+		{-828, 402, -490, -144, 1216, 806, -62, -588, -483, 539, -305, 345, 217, 111, 315, -419, -266, -476, -760, 194,
+		 -910, -200, 52, 646, -177, 429, 705, -597, -629, -127, 685, 47, -216, 182, -518, 20, -476, -182, -858, 344}}},
+	{{1, 49, {0, 0, 0, 0}, {15, 26, 37, 23}, 1384, 494392,
+		{-250, 903, -395, -654, -483, -491, -260, -400, -493, -636, -414, 79, -278, -46, 1193, 781, 160, -255, -561, 172,
+		 311, -753, 470, -214, 173, 1022, -324, -375, 772, -52, 131, 711, 1082, 635, 297, 486, 81, 521, 688, 484}},
+	 {0, 63, {0, 1, 0, 1}, {5, 31, 12, 4}, 1286, 563919,
+		{-492, 537, 420, 213, -1076, 170, -115, -362, 485, -102, 469, -330, 605, 235, 126, -201, -202, 667, -122, -1001,
+		 -914, -340, -273, -168, -505, 284, -329, -264, -1, 1005, -288, 761, -424, -227, 360, -679, 272, -338, -431, 26}}},
+	{{-1, 48, {1, 0, 1, 0}, {25, 11, 7, 29}, 9084, 452869,
+		{345, 156, 94, 317, -549, -809, 208, -1432, 574, -783, 803, -654, 640, 748, 341, 1117, -349, -314, 360, 807,
+		 165, -383, -1190, -558, 648, -485, -211, 604, -950, -106, 223, -313, 493, -272, -910, 273, -145, 43, -28, 316}},
+	 {0, 63, {1, 1, 1, 0}, {30, 1, 22, 28}, 11178, 552692,
+		{838, -630, 164, -588, -38, 566, -24, -495, -49, 67, 653, -563, 291, 431, 145, 234, 984, 636, -10, 358,
+		 492, -856, -326, 835, -159, 53, -289, -897, -459, -223, -925, -228, -406, -146, -696, -232, -2, -230, 396, 117}}},
+	{{1, 90, {1, 1, 1, 1}, {35, 11, 17, 34}, 10736, 462006,
+		{75, 505, -74, -735, 473, -128, -588, 23, 584, 486, -365, 494, 406, -211, 81, -348, -571, 339, 240, 571,
+		 723, 602, -402, -847, -830, -448, 205, 1032, -112, 263, -1013, 62, -193, 685, 554, -683, 973, -1228, 808, 843}},
+	 {0, 92, {0, 0, 0, 1}, {25, 6, 32, 39}, 10798, 499171,
+		{301, -392, -151, 1056, 702, -671, -470, -199, 174, -343, -694, -847, -769, 82, -821, 138, -593, 602, 683, -318,
+		 192, 195, 748, -677, 48, 395, -116, -429, -511, -332, -371, -84, -463, -452, 493, 356, -830, 1061, -594, 381}}},
+	{{-1, 81, {0, 0, 1, 0}, {5, 36, 27, 18}, 3524, 512277,
+		{64, -830, 609, 447, 379, -460, 1164, -222, 149, -633, -362, 100, -624, -327, 129, 391, 106, -52, 75, -375,
+		 -219, 190, 1014, -148, 447, -623, -128, 1070, 570, 67, 747, -815, -364, -298, -459, -1197, 207, 328, 352, -74}},
+	 {0, 52, {0, 1, 0, 1}, {0, 16, 2, 19}, 6546, 661545,
+		{-258, -552, -344, 654, -342, 540, 517, -125, 439, -63, -319, -41, -477, -315, 222, -628, -528, 810, -422, -352,
+		 -228, -274, 311, 277, 425, -493, -141, 745, -107, 151, -240, 30, 226, 636, 524, 690, -114, -64, 105, 167}}},
+	{{1, 51, {0, 0, 1, 0}, {25, 36, 37, 38}, 7160, 538153,
+		{381, 506, -475, -1123, 4, -264, 539, 780, 362, 215, 242, 346, 433, -619, -344, 137, 215, -204, -705, -361,
+		 -290, -1102, -331, -634, 964, -239, 268, -172, -629, 335, -446, 515, -463, 622, 89, -111, -584, 620, 335, 0}},
+	 {0, 41, {0, 0, 1, 1}, {10, 36, 12, 24}, 2774, 554839,
+		{-692, -1027, 628, 210, 309, 446, -371, 450, -643, 478, 261, -237, 550, 607, -1058, 707, 302, 319, -234, -300,
+		 -361, 128, -337, -188, -417, 32, 679, -491, 136, 545, 256, 837, 272, 129, -72, 726, -519, -190, -303, -314}}},
+	{{-1, 98, {1, 1, 0, 1}, {0, 21, 7, 38}, 14732, 714748,
+		{-1242, -123, -605, 31, 408, -336, -1018, 57, 491, 442, -440, -460, 29, 165, 107, 14, 48, -145, 621, -55,
+		 34, 26, 80, -157, -11, -348, -494, 222, -89, -241, -75, -456, -198, -167, 311, -141, -340, -124, 154, 141}},
+	 {0, 89, {1, 0, 0, 0}, {15, 31, 22, 39}, 1786, 542333,
+		{780, -100, 322, 286, 592, 505, -201, -213, -779, 437, 139, -873, -263, -302, -192, 356, 94, 846, -172, -112,
+		 -222, 811, 201, 285, 327, -409, -99, 9, 203, -1276, -46, 86, 944, 768, 870, 2, -12, 605, -421, 271}}},
+	{{1, 60, {0, 0, 0, 1}, {35, 11, 17, 33}, 9088, 552824,
+		{-962, -727, 353, -376, -452, -993, -48, 238, -229, 502, 286, 53, 217, 684, -179, -421, 1400, 67, -421, -158,
+		 -266, 697, 74, 840, 341, 528, -232, 15, -365, -442, -313, -587, 690, -163, 341, 60, -80, -173, 196, -94}},
+	 {0, 102, {1, 1, 1, 1}, {5, 21, 32, 39}, 3838, 498385,
+		{145, 200, 230, 265, 338, -543, 726, 81, 1138, -167, 295, -518, -13, -206, -553, 2, -557, -1174, -792, -405,
+		 -492, 515, 88, -1229, -332, 763, -983, 92, 949, -428, 89, 484, -235, 12, 234, 461, 214, 549, -38, 533}}},
+	{{-1, 99, {0, 1, 0, 1}, {30, 6, 27, 4}, 11988, 565425,
+		{-343, -121, -317, 252, 724, 234, -35, 591, 734, 556, -296, 385, -311, 335, 434, 148, -365, 81, -403, 390,
+		 -450, 308, -1273, 89, -568, -10, 898, 267, 307, -359, -36, -98, 637, -229, 1047, -496, 424, -130, 561, -413}},
+	 {0, 46, {0, 1, 1, 1}, {25, 36, 2, 9}, 7138, 558255,
+		{144, -10, 402, -892, -531, 235, -353, -471, 169, -705, 267, -211, -314, 244, 216, -110, 66, 8, 1028, -170,
+		 -225, 125, 145, -389, -677, -431, -899, 255, 760, -122, -54, 740, -12, 1050, 630, 40, -943, -497, 131, -307}}},
+	{{1, 53, {1, 0, 0, 0}, {10, 1, 37, 14}, 2184, 452606,
+		{557, 805, -1268, -640, -477, 660, -910, 351, 762, 738, -839, 29, -336, 17, -33, -68, 839, -993, 998, -966,
+		 189, -242, -308, 409, -236, 220, 147, 471, 74, -117, -199, 246, 97, -231, -832, 756, 343, -1144, 294, 467}},
+	 {0, 83, {0, 1, 0, 1}, {5, 16, 12, 8}, 7846, 525524,
+		{284, 762, -803, -282, 309, -22, 293, 262, 429, 827, 462, -121, -890, -1301, 214, 103, -1090, 252, -961, 424,
+		 -681, -148, 7, 328, 335, -451, -464, -183, -600, 365, 184, -87, -416, 254, 417, 106, -135, -786, 233, -118}}},
+	{{-1, 84, {1, 1, 1, 0}, {35, 36, 7, 3}, 13724, 652311,
+		{-149, 359, 96, -264, 974, -639, 179, 2, 16, 380, 229, 237, 563, 342, -776, -73, 53, -239, -278, 98,
+		 24, 171, 701, -276, -38, -474, -401, 343, -131, -128, -1022, -95, 255, -837, -140, -52, 610, -555, 199, -42}},
+	 {0, 51, {0, 0, 1, 0}, {0, 21, 22, 9}, 74, 548360,
+		{682, 6, 184, -31, 671, 19, -675, 413, -525, -129, 353, -326, -856, -436, 198, 822, 188, -392, 394, 787,
+		 49, 517, -593, 591, -251, -783, 307, 236, 826, -194, 536, -280, 206, 746, -932, 69, 451, -521, 1, 257}}},
+	{{1, 94, {0, 0, 1, 0}, {5, 11, 17, 28}, 4880, 488865,
+		{233, 912, -316, -473, 856, -10, 419, 510, -346, -707, -159, -1356, -299, 355, 0, 75, -541, 106, -130, 193,
+		 -46, -432, -547, 24, 160, -233, 283, 590, -433, -835, -1222, 869, 733, 836, 568, 347, -436, -342, 535, -462}},
+	 {0, 48, {1, 0, 0, 1}, {25, 36, 32, 3}, 8654, 567687,
+		{-754, 1201, -390, 137, 254, 505, -102, -511, -689, 418, -229, 474, -1, 938, 251, -494, -752, 19, -196, 171,
+		 -384, -805, -36, 419, 81, -508, 221, 252, -383, -116, 61, -332, 274, 373, 510, -819, -510, -67, 542, 325}}},
+	{{-1, 53, {0, 1, 1, 0}, {35, 31, 27, 29}, 5604, 580939,
+		{11, -60, 796, -334, -219, -745, 294, 500, -480, 73, 273, -233, -262, 860, -293, 25, -587, 78, 134, -260,
+		 591, -735, 16, -66, 714, -45, 891, -415, -220, -922, -315, -285, 351, 728, -16, -186, 377, 811, -262, 392}},
+	 {0, 40, {0, 0, 0, 0}, {5, 1, 2, 3}, 7218, 562475,
+		{634, 236, -555, 83, -121, -367, -367, 679, -13, -107, 1198, 92, 448, -6, -470, 368, -276, -578, 263, -27,
+		 1401, -285, -189, -71, -667, -665, 224, -274, 690, -180, -36, 898, -162, 144, 57, -137, -661, 309, -11, -309}}},
+	{{1, 55, {0, 0, 1, 0}, {10, 16, 37, 29}, 2840, 590676,
+		{20, -1016, 555, 28, 378, -25, 258, 618, 449, 677, 184, 409, 231, 580, 847, 423, -274, 706, 197, -362,
+		 468, 33, -228, -412, -101, -929, 82, -237, 577, 382, -407, 161, 968, 380, -161, -240, 46, 91, -202, -418}},
+	 {0, 61, {0, 0, 1, 1}, {0, 21, 12, 28}, 118, 505989,
+		{-379, 526, -35, -494, -307, 558, -427, 867, 886, 687, 302, -237, 638, 399, -922, -220, -537, 720, -1, 404,
+		 -81, 624, 503, 101, -40, 113, 80, 405, -416, 721, -1272, -1242, -183, 402, -479, -234, 145, 178, 409, -153}}},
+	{{-1, 70, {0, 1, 0, 1}, {5, 36, 7, 9}, 6060, 531522,
+		{-728, -192, -106, 201, 379, 586, 472, 196, 429, -203, -517, -866, -64, -1, -3, 1113, -590, 170, 480, -525,
+		 -123, -716, 418, -146, 823, 415, 325, 712, 202, -23, -313, 3, -452, -1004, 554, 285, 911, 30, -660, 536}},
+	 {0, 77, {1, 1, 0, 0}, {15, 11, 22, 23}, 6042, 437908,
+		{-224, 457, 519, -261, 453, -123, -677, 615, -55, 162, 528, 308, -1234, -226, 36, -160, -526, -1285, -615, 749,
+		 535, 55, 1133, 473, -101, -300, 162, 38, 640, -304, 1078, -1070, 196, -1491, -213, -289, 105, 233, 895, -693}}},
+	{{1, 64, {1, 1, 0, 0}, {35, 16, 17, 24}, 14496, 482942,
+		{-692, -465, 224, 1278, 43, 518, 46, 69, -23, 188, -419, 107, -376, -941, 363, 370, -506, -311, 346, -168,
+		 613, 544, -472, -481, 419, 86, 471, -571, -1086, -147, -923, 76, 1216, -157, -556, -590, 159, 570, -990, -519}},
+	 {0, 58, {1, 1, 1, 1}, {35, 21, 32, 3}, 8862, 485982,
+		{930, -207, -218, 417, -830, 1193, -137, -694, -957, 130, 39, -174, -477, -838, -200, -69, -412, -173, 680, -381,
+		 -252, 587, -391, -596, 5, -604, 169, 308, 357, -164, 314, 285, 294, -1163, 554, 869, -186, -19, -645, -1010}}},
+	{{-1, 71, {0, 1, 0, 1}, {10, 1, 27, 18}, 756, 529629,
+		{356, 634, 109, 479, -146, -68, 360, -751, 345, 223, 66, 548, 291, -31, 253, 790, -306, -316, -617, 489,
+		 600, 902, 18, -357, -61, 41, -404, 302, 269, 683, -857, 928, 1080, -754, 705, 499, -702, -176, 188, 37}},
+	 {0, 98, {0, 0, 1, 1}, {15, 36, 2, 33}, 6786, 556396,
+		{-67, -1093, -401, 761, 633, 15, -293, 509, -362, -572, 168, 98, -494, 216, -556, 550, -273, -1203, 609, -181,
+		 -213, 289, 77, -49, 200, -426, 410, -76, -60, -278, -442, -776, 545, 735, 83, 413, -35, 563, 447, -607}}},
+	{{1, 57, {1, 0, 0, 0}, {25, 1, 37, 8}, 9128, 496357,
+		{-461, -92, -382, 623, 266, -14, 201, -211, 704, -735, -17, 204, 343, -721, -10, 330, 205, 30, -292, 681,
+		 292, -532, 163, -281, -422, -1381, 329, 518, 625, 41, -304, 516, 871, 664, 1334, -285, 318, 998, 637, -351}},
+	 {0, 103, {1, 1, 0, 1}, {25, 16, 12, 9}, 12358, 525511,
+		{645, 570, -395, -170, 253, 395, 286, 471, -42, 315, 550, 183, -754, 332, 911, 504, -857, -68, 855, 408,
+		 -353, -371, -640, -103, 760, 445, 520, -7, -80, 334, -1295, -326, 713, -194, 57, 474, 577, -113, -542, 347}}},
+	{{-1, 56, {1, 1, 1, 1}, {30, 16, 7, 14}, 8124, 604749,
+		{-162, 529, 579, 146, -96, 12, 117, -131, 451, 486, 136, 71, -59, -607, 1146, -270, -88, -197, 589, 380,
+		 362, -1354, -1, -25, 269, 16, -110, -975, 143, -693, 260, 92, -14, 101, 87, -410, -204, -672, 393, 81}},
+	 {0, 103, {1, 0, 1, 1}, {25, 21, 22, 33}, 3306, 478316,
+		{-657, 483, -467, 365, 707, -177, -463, 138, -648, 540, -106, -762, -628, 1096, 90, -797, 769, 469, 127, -481,
+		 -555, 705, 3, 700, 10, 270, -280, 696, 414, -326, 812, -491, 147, -57, -1327, 209, -281, 563, -555, 750}}},
+	{{1, 98, {1, 0, 1, 1}, {35, 6, 17, 19}, 5168, 641213,
+		{616, -506, -333, 14, 438, 333, 113, 196, -539, 371, -240, 91, 243, 634, -370, -303, 226, 608, -275, 552,
+		 432, -217, 43, 94, -161, -307, -950, 373, -531, 340, 328, 875, -676, 186, -217, 66, -598, -255, -27, -520}},
+	 {0, 68, {0, 0, 0, 0}, {0, 31, 32, 4}, 4462, 511854,
+		{334, -183, -22, -175, 415, 754, 363, 810, -433, 1274, -693, -670, -160, 355, -116, -5, 208, -981, 44, 243,
+		 161, -172, 301, 76, -303, -292, -371, -508, -158, -827, 590, 1053, 594, -243, -402, -875, 419, -586, 751, -146}}},
+	{{-1, 89, {1, 1, 1, 1}, {0, 1, 27, 3}, 13828, 528521,
+		{437, 167, -586, -124, 176, -39, -95, -345, -118, 236, 363, -87, -443, 990, -1258, 140, 223, -335, 672, -690,
+		 346, 867, -501, -15, -76, -522, -171, 115, -17, -1432, 640, -298, 521, 187, -118, -232, -1020, 237, 117, -197}},
+	 {0, 92, {1, 1, 0, 0}, {25, 31, 2, 24}, 5842, 452727,
+		{-169, 353, 609, 887, -573, -411, 126, 812, -112, 1226, 1018, 64, 700, 654, 215, 181, -183, 1459, -237, -375,
+		 -203, 55, 176, -578, 642, 540, 940, 594, -210, 352, 521, 71, 315, 1029, 453, -613, 679, 9, -798, 80}}},
+	{{1, 59, {1, 1, 1, 0}, {15, 16, 37, 23}, 4664, 472961,
+		{-118, 247, 786, -134, -47, 1461, 1224, 1193, 759, -172, -161, 183, -770, 466, 725, 422, 996, -719, -212, -140,
+		 -85, 367, 610, 547, 81, -370, 121, 433, -1064, 652, 367, 32, 62, -149, 326, 366, -123, -215, -4, 413}},
+	 {0, 81, {1, 1, 1, 1}, {10, 21, 12, 29}, 11798, 398212,
+		{-483, -898, -1115, -589, 710, 767, 638, 1379, -50, -33, 438, -652, -201, 288, -177, -1052, 1279, -320, 839, 181,
+		 296, -319, -96, -1051, -80, -1247, -936, -650, 665, -1054, -143, -666, 481, -766, -279, -585, -118, -381, 194, -409}}},
+	{{-1, 42, {0, 1, 0, 0}, {30, 1, 7, 23}, 3532, 521827,
+		{779, -294, -152, -172, 317, -1083, 395, 302, -176, -369, 397, -279, 322, 826, -656, 131, 789, -60, 818, -2,
+		 -1337, 47, -811, 344, -422, 633, -937, 659, -52, 164, -70, -595, -225, 174, -260, -344, 81, -359, 31, 386}},
+	 {0, 65, {0, 1, 0, 0}, {35, 21, 22, 4}, 8250, 433370,
+		{149, -683, 43, 55, -359, -398, 224, -252, -2, 750, 756, -208, -1342, 203, 105, 701, 743, 7, -195, 937,
+		 1131, 164, -654, -522, -1200, -352, -762, 930, 916, -515, -1029, -849, -199, -327, -433, -741, 61, -298, 4, 744}}},
+	{{1, 68, {0, 0, 0, 1}, {15, 31, 17, 18}, 9664, 564142,
+		{827, -1002, -706, 597, -263, -308, 365, -389, -104, 99, 123, -126, -234, -295, 618, -152, -139, 48, -200, 47,
+		 -845, -410, 231, -555, -302, 381, -139, -420, -48, 371, 228, -574, 431, -438, -1230, 521, -403, 0, 609, -721}},
+	 {0, 78, {0, 1, 1, 0}, {0, 26, 32, 4}, 11838, 565235,
+		{-238, 505, -569, -358, 147, 466, 119, 162, 115, 10, 904, -245, -332, 675, -264, -45, -684, -101, 201, -772,
+		 597, 756, 761, -892, -587, -340, -630, 109, -650, 197, 634, -843, -106, 317, 459, 350, 23, 22, 379, 102}}},
+	{{-1, 43, {1, 0, 0, 1}, {10, 6, 27, 29}, 12052, 579660,
+		{-2, -180, -8, 161, -23, 111, 210, 436, 947, -655, -115, -346, -162, -428, 39, -135, -280, -234, -350, -981,
+		 -941, -71, -260, -322, -99, 59, 311, -1232, 200, 670, -687, 387, 466, -288, 332, -75, -323, 259, -218, 968}},
+	 {0, 86, {1, 0, 1, 0}, {30, 1, 2, 14}, 4386, 500659,
+		{-951, -289, 683, -307, 102, -364, 632, 306, -542, -600, -92, -266, 703, 541, 561, -485, 763, 1009, 541, 159,
+		 664, -218, -150, 1156, -108, -70, 534, -1080, -15, -81, 35, -403, -83, -253, -113, -399, -310, -72, 604, -1066}}},
+	{{1, 61, {1, 0, 0, 1}, {20, 26, 37, 39}, 5832, 616557,
+		{-230, -254, -295, -963, -304, 49, -513, -548, -665, -449, 518, 90, 221, -722, 236, 441, 308, 252, -333, 503,
+		 -918, 939, 345, 278, -383, -199, 224, 276, 375, -600, -186, -13, -178, -266, -371, -591, 4, -219, -333, 80}},
+	 {0, 59, {0, 0, 0, 1}, {30, 1, 12, 13}, 14822, 519829,
+		{1101, -37, -402, 551, 806, -117, -138, 775, 94, -100, -801, -440, -9, -500, 679, -24, -17, 221, 720, 489,
+		 584, 13, 344, 585, 256, -610, 65, 266, 25, -114, 905, 554, 913, -1057, 306, -85, 874, 143, -198, -117}}},
+	{{-1, 92, {1, 0, 1, 0}, {0, 31, 7, 28}, 8668, 532398,
+		{304, -868, -1019, 525, -173, -394, 24, 215, -683, -975, 522, -638, 312, -53, 477, -500, 250, -186, -113, -393,
+		 157, 160, -734, 193, 543, -37, -364, 236, -638, -267, 487, 246, -316, -16, -231, 1249, 487, -822, 556, 171}},
+	 {0, 91, {0, 1, 1, 1}, {35, 16, 22, 14}, 4490, 572138,
+		{-621, -737, -255, 90, 72, -20, 102, 726, 92, -488, 298, 179, 977, -91, -177, 495, 165, 145, 723, -884,
+		 218, 222, 440, 136, 622, 138, -4, -1051, -157, 407, -95, 673, -1097, 3, -347, -322, -148, -560, 266, 58}}},
+	{{1, 102, {1, 1, 1, 0}, {5, 11, 17, 13}, 11600, 489194,
+		{-314, 349, -127, -812, -779, -125, -480, 107, -509, -374, -98, 225, -14, 624, 509, 56, -832, -201, -709, -402,
+		 623, -291, 858, -123, 765, -668, 600, -133, -916, 714, 1079, -942, -326, 273, 245, 8, -23, -969, 660, -353}},
+	 {0, 88, {1, 1, 0, 1}, {35, 16, 32, 8}, 14606, 469212,
+		{-529, -958, -581, -902, 671, 586, 411, 690, -592, 691, -36, -693, -736, -133, -900, 67, -783, -348, -1155, 412,
+		 289, 44, 733, -684, -1102, 21, 670, -147, 162, 93, 190, 485, 499, 262, -193, -322, -93, -498, 543, -522}}},
+	{{-1, 61, {0, 0, 1, 1}, {30, 26, 27, 14}, 11812, 495149,
+		{-704, 361, 49, -457, -998, 1148, -5, -711, 725, -146, 422, 28, -1169, 577, 304, -290, -22, 755, 667, -639,
+		 68, -122, 997, 515, 127, 504, 272, 614, 153, 75, 26, 168, 148, -387, 261, 715, -402, 656, -49, -819}},
+	 {0, 80, {0, 0, 0, 1}, {30, 36, 2, 8}, 2418, 528638,
+		{-621, 309, -434, -4, 864, -102, -566, -240, -372, -162, -345, -635, 793, 131, 739, -167, -763, -249, -384, 142,
+		 594, 236, 892, -222, 766, 1072, 473, 279, -245, 213, -107, -405, -905, 217, 178, 288, -700, -450, -210, -716}}},
+	{{1, 63, {0, 0, 1, 0}, {0, 6, 37, 14}, 12632, 501327,
+		{481, 709, -296, -71, -249, -412, 367, 455, 1294, -798, -283, 182, -12, 1089, -708, -380, -69, 639, -910, -205,
+		 609, -98, 137, 193, -24, -100, -641, 304, 78, -389, -682, 126, -107, 569, 524, 173, -1093, 216, 931, 443}},
+	 {0, 101, {0, 0, 1, 1}, {0, 6, 12, 33}, 5046, 561986,
+		{22, -177, -50, -1101, 286, -977, 262, -60, 135, 880, -353, 52, 79, 272, 151, -763, 120, -239, -272, 565,
+		 768, 369, 936, -58, 489, -462, -319, -74, -207, 338, -455, 7, 218, 723, 18, 695, 738, 179, 586, 456}}},
+	{{-1, 78, {0, 1, 0, 1}, {30, 1, 7, 34}, 7148, 619062,
+		{-307, -427, -229, -66, -288, -225, -227, 377, 210, -54, 256, 787, 165, 84, 706, 142, 599, 191, 613, -24,
+		 -534, -759, -25, -221, 348, 820, -182, 61, 687, -194, -372, -200, 993, 297, -593, 18, -268, 243, -847, -307}},
+	 {0, 53, {1, 1, 0, 1}, {35, 16, 22, 28}, 8410, 432026,
+		{-663, 1090, -80, -1836, 206, -322, -60, -256, -110, -357, -199, 1165, -585, -553, -499, -135, 315, 628, 66, 454,
+		 -480, 624, -42, 370, -1436, -563, 715, 639, 521, 137, 287, 235, 269, -1370, -300, 696, -142, 34, -24, -28}}},
+	{{1, 72, {0, 0, 0, 0}, {15, 6, 17, 9}, 10976, 543974,
+		{9, -292, -387, -373, -856, -909, -117, -622, 550, -279, 378, -136, 133, 576, 72, 63, 963, 118, 1527, 485,
+		 482, -115, 133, 108, 224, -125, -524, -46, -321, 90, -446, 25, 381, 16, -143, -705, -228, -857, 383, -698}},
+	 {0, 98, {1, 1, 1, 1}, {25, 21, 32, 8}, 12766, 541831,
+		{739, -222, 199, 498, 707, 346, -40, 91, -252, 499, 840, -221, 932, -277, 281, 76, 165, 580, -695, 468,
+		 -507, 508, -550, 445, 454, 533, -310, 5, 998, 141, 1051, -338, 103, -154, 459, 438, 839, -354, -36, -225}}},
+	{{-1, 79, {1, 0, 0, 0}, {25, 26, 27, 3}, 13108, 462923,
+		{-391, -513, -158, -188, -1469, -767, 541, 566, -18, -540, 695, 265, -648, -346, 818, -581, -285, 329, 908, -946,
+		 -979, -565, -569, 192, -168, 46, -31, 275, -926, 112, -548, -187, -1203, -365, 438, -168, -489, -363, 369, -182}},
+	 {0, 74, {0, 1, 1, 0}, {25, 21, 2, 38}, 16322, 459515,
+		{566, 356, -440, 1026, 434, -392, -140, -570, -1393, -275, 513, -277, 1227, -319, 493, -145, -408, -10, -198, 340,
+		 -156, 138, -26, -360, 449, 127, 499, 317, -1667, 467, 863, 833, -358, 648, 44, -346, 790, 156, -424, -150}}},
+	{{1, 65, {0, 1, 0, 1}, {35, 36, 37, 33}, 8680, 486117,
+		{224, -191, 15, -276, -137, 335, 22, -662, 749, -962, -260, -311, -188, 524, -317, -1273, -902, -837, -151, -474,
+		 -367, -439, 240, 1060, 391, 696, -170, 259, -162, 518, 1693, 193, 20, 53, -317, -160, -85, -189, -566, -290}},
+	 {0, 79, {1, 1, 0, 1}, {10, 1, 12, 14}, 15238, 592602,
+		{-394, -37, 198, -1193, 430, -532, 559, 152, 839, 604, -521, 56, -705, 301, 32, 57, 408, 605, -344, -359,
+		 80, -18, 401, 346, -663, -34, -295, 122, 225, 47, -382, -517, -838, -801, 138, -37, -270, -528, 243, 28}}},
+	{{-1, 64, {1, 1, 1, 1}, {35, 36, 7, 39}, 15356, 591435,
+		{227, -250, 424, 359, -795, -319, -102, -494, -312, 91, -659, 156, 138, 470, 287, -249, -979, -208, -334, -687,
+		 -81, 619, 548, 380, 274, 901, 375, -122, 84, -896, -343, 369, -137, -678, -68, -197, 633, -491, -338, -282}},
+	 {0, 79, {1, 0, 1, 0}, {25, 36, 22, 38}, 3626, 605589,
+		{792, 444, -202, 166, 300, -536, -6, 131, -351, 885, 31, -65, 885, 97, 419, -420, -86, 174, 136, -424,
+		 -194, 90, -308, -587, 51, -665, -399, 625, 135, -557, 373, 142, -452, 416, -38, -1014, 848, -308, -98, -281}}},
+	{{1, 42, {0, 1, 1, 1}, {0, 21, 17, 4}, 7792, 436137,
+		{5, 403, 816, 123, -749, 666, 686, -271, -766, -384, -243, 72, -48, 839, 75, 1150, -129, -275, 1130, -107,
+		 -499, 372, 360, -117, 892, -806, -185, 98, -1078, -735, 517, 536, -1287, -441, -92, 687, -761, 590, 34, -987}},
+	 {0, 44, {1, 1, 0, 0}, {15, 6, 32, 9}, 6318, 563989,
+		{-273, 922, -21, 1026, -512, 3, -980, 155, 368, 203, -308, 403, 833, 500, -563, 236, -143, 380, 813, -348,
+		 2, -155, -274, 701, 242, -83, 270, -715, 67, -426, -113, 1038, -13, -162, -401, -186, -508, -313, -80, 223}}},
+	{{-1, 97, {1, 0, 1, 1}, {35, 21, 27, 28}, 15940, 586393,
+		{170, 524, -885, 713, 357, -258, 54, -596, -1025, -559, -64, 110, 122, 643, -213, 273, 724, 278, -907, -109,
+		 -753, 392, -96, 502, 297, 475, -342, 56, -220, 13, 405, -421, 254, -480, 95, 93, 697, 18, 266, -448}},
+	 {0, 68, {1, 1, 0, 1}, {15, 6, 2, 29}, 13330, 601114,
+		{304, 106, -614, -32, 92, 1070, 119, -427, 745, -173, -333, 41, -299, -41, 592, 862, 34, -68, -180, -526,
+		 206, 1280, -87, 487, -293, -91, 869, -197, -441, -87, 130, -528, -236, 270, 254, 4, -192, 466, 219, 377}}},
+	{{1, 67, {0, 0, 1, 0}, {5, 16, 37, 8}, 10360, 538529,
+		{791, -140, -129, 727, 286, -526, 245, -1082, 516, -175, 332, -620, -565, -625, -894, 67, 113, 174, 153, -559,
+		 -520, 172, -625, -960, 606, 395, -666, -114, -603, -183, 28, -67, -565, -536, -589, -309, -302, -154, -471, -326}},
+	 {0, 57, {0, 0, 1, 1}, {15, 6, 12, 34}, 12630, 496872,
+		{1134, 639, 86, 20, 471, 960, -529, 132, 415, -672, -537, -171, 456, 353, 64, -891, 592, 449, 760, 22,
+		 825, -382, 529, 6, 129, -94, 393, -937, 42, -733, 354, -249, 562, -253, -102, 1048, 667, -700, 51, -120}}},
+	{{-1, 50, {0, 1, 0, 1}, {15, 36, 7, 8}, 524, 566664,
+		{112, -81, 173, 9, -414, -422, 144, -93, 53, 228, 594, 798, -1049, 335, 501, 120, -646, -103, -137, 435,
+		 -276, -572, -806, -307, 63, -50, 540, -56, 881, 441, 319, -862, -380, 387, 577, 861, -138, 814, 292, -9}},
+	 {0, 41, {0, 1, 0, 1}, {15, 6, 22, 9}, 6522, 530483,
+		{-98, 142, -364, -304, 98, -917, 521, 93, 135, 935, -291, -1207, 523, -444, 274, 406, 240, -448, -346, 322,
+		 -204, -1123, 411, 1103, 217, 89, -17, -325, -35, -906, 420, -376, 578, -14, -328, -588, 6, 207, 301, 577}}},
+	{{1, 76, {1, 1, 0, 1}, {35, 21, 17, 3}, 2048, 522291,
+		{-72, -381, 155, -606, -202, -263, 138, 392, 405, 80, -168, -945, 723, 134, -761, -11, 754, 413, -1131, 1148,
+		 -528, 403, -252, 482, -561, 106, -686, 41, 141, 544, 129, -177, 556, 183, 1167, 342, -342, -467, 382, 60}},
+	 {0, 54, {0, 1, 1, 0}, {35, 21, 32, 9}, 11646, 469713,
+		{275, 682, -472, 427, -172, -701, -104, -397, 1012, 59, -151, -100, 245, 404, -103, 804, -427, -180, 42, -243,
+		 534, -667, 282, 341, 54, -547, -405, 1022, -841, -330, 27, 1286, -1129, -530, 556, 1135, 216, -121, -868, 567}}},
+	{{-1, 51, {1, 0, 0, 0}, {25, 21, 27, 14}, 3924, 529913,
+		{211, -367, -851, -570, 638, 372, 839, -359, 8, 54, -574, 331, -141, 729, 28, -546, -323, 859, -425, 592,
+		 -24, 446, -399, 163, 242, -512, -404, 213, -1059, 547, 582, 232, -857, 37, -511, 218, -686, 520, -613, -339}},
+	 {0, 62, {1, 1, 1, 1}, {0, 6, 2, 19}, 9826, 447029,
+		{-126, -184, -188, -362, 95, 957, 465, 443, 155, -111, -1091, 63, -456, 1222, -246, -988, 308, -678, 438, -664,
+		 1425, 335, 451, 525, 333, -349, -1233, -495, 618, -168, -4, -650, 742, -148, 1064, 570, -317, -287, -75, 95}}},
+	{{1, 69, {1, 1, 0, 1}, {30, 26, 37, 24}, 1288, 510218,
+		{903, 607, -474, -902, -771, 334, 268, -551, 852, -228, -1325, -489, -374, -53, -647, 310, 161, -167, -256, -204,
+		 407, -568, 358, 19, 366, 278, 173, 977, 36, 325, -813, 112, 443, -429, -38, -530, 49, -958, -64, 77}},
+	 {0, 99, {1, 0, 0, 1}, {10, 21, 12, 18}, 13606, 658189,
+		{254, 60, -129, -792, -361, -340, 327, -376, 143, -131, 368, 1161, 232, -339, -520, -279, -96, 62, -287, -598,
+		 185, -466, -471, -310, 49, 127, 466, -437, -502, -721, 474, 43, -446, -448, -445, -404, 219, -80, -245, 268}}},
+	{{-1, 100, {0, 1, 1, 1}, {5, 1, 7, 13}, 11804, 487139,
+		{629, -175, 298, 162, -424, -277, -259, -212, 26, 1126, -337, -105, -67, -64, 66, -31, -705, -261, -76, -500,
+		 -350, -491, 775, 1046, -28, 272, -1991, -511, -761, -22, 332, -53, 9, 165, -962, 374, -276, 319, 785, -256}},
+	 {0, 67, {1, 1, 1, 0}, {35, 6, 22, 19}, 714, 553079,
+		{-1028, -72, 202, 595, 369, 325, 239, -625, 69, 561, 627, 44, -390, -386, 344, 40, 14, -470, 412, -123,
+		 771, 311, -191, 577, -169, 419, -955, -418, -756, 368, 682, -38, 32, -868, 110, 183, 661, 297, 915, 243}}},
+	{{1, 46, {0, 0, 1, 1}, {10, 31, 17, 38}, 10128, 485519,
+		{35, -854, -578, -767, 18, 144, 541, -424, 736, -169, -677, 142, -881, 253, -646, 933, -227, -124, 120, 411,
+		 -372, -790, -425, 626, 218, 305, 277, -984, 521, -1449, 180, 703, 23, 94, 306, -459, -250, 836, -367, 140}},
+	 {0, 64, {0, 1, 0, 1}, {10, 36, 32, 13}, 12366, 535593,
+		{-432, -173, 124, -21, -576, 539, 284, 227, 401, -188, 541, 60, 449, -308, 893, 500, 82, -331, 318, 525,
+		 -1214, 253, 862, 133, 659, -602, -545, 350, 579, 174, 191, -874, 84, 1047, 0, -465, 196, 479, 416, 551}}},
+	{{-1, 69, {0, 0, 1, 1}, {25, 36, 27, 39}, 9828, 504190,
+		{1013, 142, -314, -196, -369, -159, -432, 510, 266, 19, -581, 161, 356, 166, 773, -221, -97, 280, 560, 390,
+		 441, -149, -198, 456, 948, 413, 549, 491, 1422, -80, -273, -531, -183, -606, -102, 464, -285, 885, -988, 914}},
+	 {0, 56, {1, 0, 0, 0}, {20, 26, 2, 13}, 5810, 427255,
+		{1068, -258, 71, 293, -327, 35, 1155, 761, 1189, -857, 544, -978, -526, 652, -228, 1218, -866, -48, -135, 183,
+		 1195, -395, -715, -1013, 23, 121, 82, 192, 740, 478, -306, 212, -240, -350, 171, -439, 669, 711, -25, -739}}},
+	{{1, 71, {1, 0, 1, 1}, {30, 6, 37, 39}, 14232, 549996,
+		{-210, -254, 261, 726, 532, 97, -164, -348, -37, 1183, -366, -173, 641, -578, -343, -287, 8, -68, -609, -688,
+		 -402, -357, 886, 1182, 437, -935, 44, -307, -37, -264, -61, -37, -286, 630, -455, -54, -312, -299, -112, 664}},
+	 {0, 77, {0, 1, 1, 1}, {5, 26, 12, 38}, 1782, 554694,
+		{295, 16, 319, 212, -273, 432, -201, -91, -744, 433, 912, -811, -96, 17, 72, 102, 137, -814, 353, -426,
+		 -47, -526, 217, -857, 378, -141, -846, 343, 386, 851, -278, -408, -21, 404, -125, -1064, -333, 52, -901, 425}}},
+	{{-1, 86, {1, 1, 0, 0}, {15, 21, 7, 19}, 44, 571785,
+		{-14, 234, -480, -461, -571, 372, -30, -594, -137, -545, -123, -248, 266, -983, 263, 579, 124, 84, -406, -163,
+		 -561, 606, 428, -424, 769, 1097, -305, -206, -492, 19, -559, -19, -250, 446, -332, -889, -39, -184, 374, 770}},
+	 {0, 93, {0, 0, 0, 0}, {10, 21, 22, 33}, 2586, 563400,
+		{-206, 59, 217, 45, -681, 375, -83, 281, 219, 20, -30, 358, 448, -1008, -138, 274, 516, -659, 107, 31,
+		 -599, 553, -833, 139, -339, 1094, 116, -936, 274, -62, 392, -124, 214, -865, -3, 1041, -5, -293, -559, -3}}},
+	{{1, 80, {0, 1, 0, 1}, {35, 6, 17, 34}, 15648, 534917,
+		{70, -247, 410, -104, 165, 96, 104, 95, -1053, 150, 23, -507, -510, -595, -859, -372, -768, -93, 20, 1010,
+		 223, 122, -414, -967, -1123, -464, -623, -161, 316, -313, 415, -154, -70, 573, 654, -436, 281, 660, 604, 19}},
+	 {0, 74, {1, 1, 1, 1}, {20, 16, 32, 13}, 8478, 484046,
+		{932, -877, -536, -573, 68, -117, -583, 748, 325, 740, -23, -396, -347, -868, 122, -419, 102, 181, -662, -347,
+		 -1402, 301, 187, -178, 263, 1030, -405, 86, -25, 318, 124, -577, -216, 727, 236, 391, -312, -817, -67, -1104}}},
+	{{-1, 87, {1, 1, 0, 0}, {0, 31, 27, 28}, 884, 489143,
+		{-754, 260, 471, 1065, 664, 454, 82, -805, -509, -407, 684, -658, -691, 235, 231, 480, 120, -178, -255, 51,
+		 386, -624, -772, 101, 621, -589, 1238, 120, -201, -587, 145, 106, -30, 408, 1067, -963, 108, 346, -90, -529}},
+	 {0, 50, {0, 1, 1, 0}, {35, 1, 2, 3}, 1282, 503399,
+		{47, 141, -95, -373, -405, 609, -115, 271, 8, -106, 218, 1268, -252, 554, 390, 56, -671, 543, -621, -291,
+		 -739, -141, 255, -287, -454, 552, -52, 70, -1354, 60, 504, -758, -365, -1103, 901, 815, -561, 133, 113, -333}}},
+	{{1, 73, {0, 0, 0, 1}, {5, 6, 37, 18}, 40, 453397,
+		{781, 606, -1252, -791, 868, 44, 739, 295, -358, -293, -119, -442, 689, -407, -240, 68, -89, 728, -138, -221,
+		 382, 1062, 189, 225, 52, -427, -285, 384, -53, 867, -22, 766, 577, 1362, -48, 349, -616, 1056, 151, -869}},
+	 {0, 55, {0, 0, 0, 1}, {35, 21, 12, 19}, 9926, 449372,
+		{-25, 252, 663, 216, 991, 461, 704, -295, -968, 765, 328, 313, 752, -370, 561, -518, 521, -386, 377, 282,
+		 -1151, -817, 290, -357, -678, 383, 298, 635, -1134, 144, -109, 700, 43, 1024, -421, 860, -221, -559, 900, 93}}},
+	{{-1, 72, {0, 1, 1, 0}, {0, 36, 7, 24}, 14396, 605170,
+		{-24, 891, -371, -68, -86, -266, 575, 39, -179, -432, 466, 625, 719, -117, -700, -356, -462, 165, 663, 166,
+		 372, -608, -55, 145, -361, -390, -292, 603, -103, 309, 462, -506, 124, 463, 161, 912, -194, 586, -685, 251}},
+	 {0, 55, {1, 0, 1, 0}, {25, 6, 22, 3}, 12138, 557220,
+		{-447, -235, 447, 351, -235, 1, -189, -4, 330, 78, 552, -8, -290, -518, -404, 341, -45, -249, 17, 17,
+		 39, -141, -747, 46, -36, 832, -1158, 426, -272, 620, -194, -1401, 357, 761, 99, -829, 825, -283, -281, 96}}},
+	{{1, 50, {0, 1, 1, 0}, {0, 6, 17, 29}, 2224, 547005,
+		{290, 672, 301, -408, 1008, -153, 107, 670, -97, -755, -374, 437, 45, 404, -632, 427, -100, 762, -665, 130,
+		 -534, -1215, -475, 56, -231, -409, -572, -305, -217, 622, -446, 69, -490, 340, -95, -356, -540, -229, 479, -558}},
+	 {0, 84, {0, 1, 0, 0}, {25, 21, 32, 14}, 16366, 619547,
+		{-1008, -149, -148, 51, -543, -364, 109, -628, 17, 28, -563, 324, 162, -507, -114, -163, 402, 77, -82, 469,
+		 -285, 246, -977, 174, 659, -514, -241, -26, 1188, -665, -432, 383, -236, -209, 496, -137, -27, -168, -15, -48}}},
+	{{-1, 41, {0, 1, 1, 0}, {35, 21, 27, 13}, 9860, 618565,
+		{287, 753, -800, -114, -102, -93, 75, 49, -524, 54, -619, -333, 47, -344, 704, -746, 73, 251, -566, -168,
+		 68, -211, 181, 379, 30, 320, -129, -643, -39, 818, 42, -160, -653, -763, 692, 290, 238, -329, -737, -315}},
+	 {0, 44, {1, 1, 0, 0}, {5, 16, 2, 34}, 12626, 516126,
+		{137, 243, 595, 457, 629, 375, -528, 254, -1086, -164, -276, 914, 110, 160, -183, -633, -389, -699, -763, -293,
+		 487, -1207, 34, -112, 180, 174, -354, 420, 736, -654, 123, -743, 109, -617, 439, 1005, 345, 283, 84, 34}}},
+	{{1, 75, {0, 1, 1, 1}, {35, 26, 37, 33}, 7864, 562496,
+		{36, -143, 876, -76, 491, -81, -350, -413, 145, 1230, -839, -15, 536, 204, 431, -416, -898, -85, -122, 430,
+		 453, -663, 60, -35, -533, -1016, -45, 747, -270, -122, 73, 218, 216, -27, -96, 424, 415, 291, 470, -681}},
+	 {0, 97, {1, 0, 1, 1}, {15, 21, 12, 39}, 5270, 508452,
+		{-449, -512, -889, -11, -408, 1, 736, -731, -272, 97, -616, 182, -551, 802, -1359, 678, 289, 578, 41, 759,
+		 202, 451, 514, -89, -302, -93, -454, 184, 315, -28, -301, 1064, -1021, -380, -53, 505, 300, 389, -220, 41}}},
+	{{-1, 58, {0, 0, 0, 1}, {0, 6, 7, 33}, 5708, 620825,
+		{-171, 516, -142, 62, 263, -913, 277, -104, 154, 185, 663, 211, 12, 228, -518, 493, 351, -274, -196, 744,
+		 145, 217, 95, 962, 420, 163, -159, 125, 150, -434, 580, -233, 361, 984, -250, -110, 539, -701, 425, -532}},
+	 {0, 81, {1, 1, 0, 0}, {30, 21, 22, 14}, 12986, 493168,
+		{-473, -185, 125, -791, -1109, -540, -334, 310, -880, 480, 70, -286, 724, 317, -197, -17, -391, -1031, 399, -421,
+		 -643, 534, -188, 40, -30, -1134, 88, 340, -602, 111, 717, 481, 203, 171, -351, 461, -689, -440, -42, -1254}}},
+	{{1, 84, {1, 0, 0, 0}, {15, 31, 17, 28}, 2624, 490482,
+		{-587, 112, -648, 111, -781, -346, -217, -1003, 274, -579, -1099, 156, 528, -77, -220, -510, -529, 138, 370, 73,
+		 -339, 64, 673, -657, -948, -297, 175, -650, -310, -947, -610, -420, -471, -348, 364, 1059, 103, 474, -485, -823}},
+	 {0, 94, {1, 1, 1, 0}, {25, 11, 32, 14}, 3262, 688536,
+		{-364, -805, 521, -452, 405, 52, -455, -60, 245, -20, 202, -83, -330, 5, -70, 501, 214, 125, 267, 1182,
+		 -169, 342, 187, 422, -457, 654, -308, -241, -136, 39, 316, -297, 280, 31, 13, 768, -231, -392, -195, 392}}},
+	{{-1, 59, {0, 0, 0, 0}, {0, 16, 27, 39}, 3988, 669531,
+		{-728, -170, 226, 107, -365, -7, -196, 254, 989, 123, -649, -144, 264, 734, -623, 451, -494, -224, 396, -11,
+		 -259, 323, -154, 8, -57, -187, 289, 506, 114, -216, 187, -563, 764, -278, 54, 383, -153, 141, -112, 786}},
+	 {0, 102, {0, 1, 1, 0}, {5, 6, 2, 24}, 7074, 444455,
+		{-453, 305, 349, -1569, -552, -922, -342, 964, -300, -262, -170, 264, -207, -273, -1181, 429, -275, 67, 207, -591,
+		 10, -264, -100, 278, 646, 780, -56, -38, 611, 641, -171, -1, -609, -683, -959, 899, 1084, -118, 142, 1128}}},
+	{{1, 77, {0, 1, 0, 1}, {0, 6, 37, 9}, 4936, 525962,
+		{372, 316, -1293, -457, 170, 491, -615, -170, 193, -647, 288, -684, 439, 488, -122, 563, -114, 1334, 205, 497,
+		 68, -155, -269, 656, -37, 627, 506, 1038, 81, 98, 480, 109, -88, 304, -345, -85, 990, 223, 77, -54}},
+	 {0, 75, {1, 0, 0, 1}, {35, 36, 12, 23}, 4198, 589926,
+		{-209, 29, 16, -727, -632, 333, 152, -119, -448, 1246, -127, 74, -167, 718, -823, -150, -815, 287, -398, -277,
+		 170, -49, 122, -821, -286, -288, 227, -244, -645, -432, 427, -84, -397, -479, 724, 173, -52, 81, -420, -499}}},
+	{{-1, 44, {1, 0, 1, 1}, {15, 21, 7, 38}, 6748, 495135,
+		{314, 390, -561, -329, 1245, -288, -158, 769, 607, 27, 724, 300, 450, 309, 39, -202, -764, 560, 345, 289,
+		 551, 778, -916, -277, 297, -59, -162, -362, -500, 95, 49, 544, 718, -806, 739, 395, -655, -204, 886, -811}},
+	 {0, 43, {0, 1, 1, 1}, {35, 36, 22, 24}, 5130, 545061,
+		{-27, -47, 19, 972, 26, 30, -264, 456, 430, -54, -708, -731, -349, 727, 225, -31, -777, -701, -539, 510,
+		 172, 272, -438, 378, 960, -452, 1038, -425, 53, 713, 307, 659, 9, -331, -73, 560, 318, 514, 412, 300}}},
+	{{1, 54, {1, 0, 1, 1}, {10, 21, 17, 23}, 464, 455759,
+		{256, -137, 891, 174, -337, -739, -102, -59, -707, -92, -360, -69, 172, 266, 631, -878, -774, 337, 309, -440,
+		 -471, -905, 724, 1759, 55, -386, -686, 85, 806, 868, -335, 1196, 756, -213, -273, -30, 419, -47, -498, -7}},
+	 {0, 40, {0, 0, 0, 1}, {25, 6, 32, 18}, 1934, 580594,
+		{-463, -540, 189, -292, 609, -148, 541, -364, -1294, 1365, -34, -851, -30, -99, -2, -219, -205, 70, -385, -2,
+		 -285, -178, 351, -202, -268, -841, 160, 207, 356, 127, -448, -313, -459, -344, 577, -224, -155, -208, 161, 472}}},
+	{{-1, 77, {0, 0, 1, 0}, {20, 21, 27, 24}, 16036, 462137,
+		{554, 307, -293, 961, 1156, -58, 549, 67, 703, 1080, 336, 678, 217, 651, -934, 232, 212, -323, -187, 267,
+		 174, 720, 527, -243, 617, 706, 186, 752, -509, -363, -700, -334, -642, 1095, 431, 597, 216, 986, -7, -41}},
+	 {0, 96, {0, 1, 0, 1}, {5, 16, 2, 18}, 1010, 583926,
+		{69, -441, 448, -50, -110, 44, -836, 98, 62, -144, -231, -937, -437, 533, 213, -1109, -73, 537, -14, 96,
+		 -380, -130, 622, 628, -848, 578, 587, 489, 61, 103, -121, 701, -215, -21, 548, -270, 374, 720, 32, -378}}},
+	{{1, 79, {1, 0, 1, 1}, {20, 26, 37, 24}, 7640, 501661,
+		{-5, 191, -334, -653, 161, -1058, -823, 257, 552, -36, 959, 368, 142, 187, -618, 190, -43, -391, -948, 237,
+		 -1029, 280, -541, -5, -254, 662, -423, -534, 232, 245, -80, 184, -593, 563, 486, 1127, 341, 82, -771, -779}},
+	 {0, 53, {0, 1, 1, 0}, {10, 1, 12, 3}, 6710, 651262,
+		{-72, 81, 48, -139, 576, -335, 232, 262, -727, -142, 1, 246, 113, -366, 377, -185, 26, 19, 1362, -9,
+		 34, 499, -630, 264, 139, 52, 547, 120, 339, -300, 283, -439, -388, 469, -396, -391, -508, -203, 556, -758}}},
+	{{-1, 94, {0, 1, 0, 1}, {0, 21, 7, 4}, 1132, 520600,
+		{151, -257, -347, -472, -470, 329, 551, -669, 412, 372, 906, -387, -273, 382, 204, -136, -479, -151, -17, 82,
+		 -716, -717, -1295, -243, 38, -1314, 468, 423, -263, -920, 150, -478, -597, -45, 313, 124, -450, -739, -69, 183}},
+	 {0, 69, {0, 0, 0, 1}, {30, 16, 22, 38}, 4954, 596295,
+		{-389, -588, 386, -250, 864, 432, -234, -334, 420, 781, 523, -65, 841, -55, 95, -469, 77, -538, -492, -8,
+		 -334, 354, -216, 292, 118, 63, -99, -79, 923, 123, 369, 925, 31, 536, -346, -278, 516, 276, -710, 406}}},
+	{{1, 88, {1, 0, 0, 1}, {15, 21, 17, 19}, 12128, 531118,
+		{-509, -330, -457, 37, 546, -51, -315, -852, -224, -61, 52, -494, 255, 666, -1406, 89, -579, 80, -79, -129,
+		 860, -281, -65, 390, 474, -419, -338, 108, -199, -332, 124, -1485, -137, -22, -213, 217, 150, 1, -327, 1120}},
+	 {0, 50, {1, 1, 1, 1}, {15, 6, 32, 18}, 12382, 621535,
+		{-27, -124, -375, -236, 325, -196, -230, -771, 262, 341, -502, -187, -730, 461, -165, -530, -601, -346, -245, 246,
+		 135, 478, -740, 95, 456, -649, -116, 551, -664, -145, 605, -432, -151, -568, 397, 216, 969, 128, -226, -63}}},
+	{{-1, 95, {0, 0, 0, 1}, {15, 11, 27, 13}, 13236, 496468,
+		{-221, -119, -564, 142, 109, -1013, 7, -256, -104, -402, 545, 339, -350, -336, 540, 901, -115, -301, -1546, 920,
+		 599, 213, 433, 394, -766, 696, -181, -675, 396, 122, 198, -753, 503, 541, 32, -350, 65, 927, -165, 532}},
+	 {0, 90, {1, 1, 1, 1}, {0, 16, 2, 8}, 10818, 524718,
+		{424, -202, 634, 660, -348, -566, 294, -552, 257, 447, -205, 125, 1213, -749, 671, 129, 474, 456, 876, -26,
+		 -938, -36, -104, 170, -973, -175, 293, 207, -657, -475, 529, 83, 12, -422, 94, -200, 8, -530, 1034, -132}}},
+	{{1, 81, {1, 0, 0, 1}, {15, 26, 37, 3}, 15976, 539369,
+		{186, -261, -87, 102, 209, 137, -1232, -412, 455, 248, -1130, -189, -610, -442, -291, 257, -428, 117, 259, 416,
+		 -533, 387, 522, -226, -415, -142, 496, 381, 952, 576, -329, -837, -18, -17, 93, 730, 773, -387, -796, -40}},
+	 {0, 95, {0, 1, 0, 1}, {15, 36, 12, 24}, 12806, 443989,
+		{-296, 413, -24, -551, -624, 814, -303, 666, -343, -226, -999, -70, -479, 367, 450, -197, 506, 31, -54, -229,
+		 50, -208, -973, -164, -309, 1184, 251, -4, -573, -911, 548, 253, 284, 673, -596, 1629, 212, -206, 405, 1566}}},
+	{{-1, 80, {0, 1, 1, 1}, {5, 6, 7, 9}, 5244, 515315,
+		{-915, 368, -270, -623, -17, -853, 100, -68, -174, 453, -585, -1082, -364, 704, 745, -79, -585, -102, -516, 379,
+		 185, 85, 750, -218, 412, 239, 961, -336, -930, -150, 115, -485, 257, 964, -250, -155, -637, -1, -136, 656}},
+	 {0, 95, {1, 0, 1, 1}, {20, 11, 22, 8}, 12458, 515099,
+		{-278, -18, 456, 408, 638, 410, 12, 245, -1165, 679, -79, 433, -569, 787, 181, 462, -132, 224, -1254, -182,
+		 -368, 12, 222, -985, -763, 153, 3, -925, -295, 133, -889, -512, 526, 466, 108, -260, -350, 638, -80, -167}}},
+	{{1, 58, {0, 1, 1, 0}, {0, 6, 17, 14}, 4848, 550304,
+		{447, -211, -342, -43, -435, 436, 936, -565, -68, 282, -121, 1186, 10, 865, 581, 88, -199, -377, -28, 239,
+		 -697, -370, 98, 101, -970, -652, 449, -324, 516, 315, -513, 498, 691, -31, 286, -503, 65, 360, -740, -257}},
+	 {0, 60, {0, 1, 0, 0}, {0, 31, 32, 19}, 1838, 586125,
+		{177, 188, -915, 484, -190, 677, -466, -3, 50, 237, -434, 117, 899, -618, 207, -178, -205, -866, 431, 646,
+		 -188, 7, -272, 31, 948, -561, -368, -489, 645, -8, 145, 112, -75, 128, -783, 296, 326, -663, -78, -447}}},
+	{{-1, 49, {1, 1, 1, 0}, {30, 31, 27, 38}, 11972, 507275,
+		{-748, 342, 693, -45, 335, -1080, 480, -458, -663, 27, 234, 120, 356, -435, 469, 155, -706, 96, 159, -867,
+		 249, -430, -1206, -384, 147, 37, -556, -958, 526, -41, -449, 485, 872, 362, 137, -665, -349, 732, -332, 202}},
+	 {0, 84, {0, 0, 0, 1}, {30, 21, 2, 39}, 3730, 536745,
+		{-670, 764, 140, -718, -498, -448, -279, -217, -997, 229, 677, 123, -121, 745, -62, -720, -428, 590, 62, -188,
+		 128, -238, 27, -327, -499, -201, 343, -627, -263, 699, -524, -62, -1210, -96, -528, -170, -782, -28, -691, 75}}},
+	{{1, 83, {1, 1, 1, 1}, {25, 11, 37, 18}, 13560, 554605,
+		{177, 750, 729, 17, 56, -276, -49, 128, -354, -53, -90, 462, 485, 393, -420, -3, 11, 552, 499, 779,
+		 786, 422, 617, 762, 248, 5, 960, -568, 447, 323, 502, -137, -667, -670, 269, -507, 1004, 96, -253, 372}},
+	 {0, 73, {0, 0, 1, 0}, {20, 36, 12, 4}, 6102, 547670,
+		{-112, 257, 56, 342, 121, 450, -1199, -698, -575, -286, -311, -617, 362, 99, -350, -441, 882, -445, 730, -168,
+		 -37, 132, -653, 200, -349, -220, 107, -359, 972, -475, 964, -311, -684, -635, -644, -166, -195, -186, -107, 74}}},
+	{{-1, 66, {1, 1, 0, 0}, {25, 26, 7, 18}, 2700, 625805,
+		{954, 473, 951, -13, -212, 4, 794, -243, 127, -498, -932, 8, 433, -519, 383, -798, 196, -61, -383, 413,
+		 -74, -658, -156, 55, -375, 248, 550, 178, -197, 99, -311, -244, 462, -83, -181, 327, -448, 216, -82, -159}},
+	 {0, 57, {1, 0, 0, 1}, {10, 36, 22, 19}, 11258, 519461,
+		{48, 896, -26, 130, 1140, 733, -805, 911, -487, -103, 303, 507, -227, -74, -796, -1080, -126, -718, -8, -268,
+		 -698, -497, -403, -127, -405, 587, 65, -147, 239, 488, -650, -326, 724, -284, -502, 358, 24, 321, -1, 371}}},
+	{{1, 92, {0, 0, 0, 0}, {35, 16, 17, 13}, 11392, 475126,
+		{306, -547, 469, -836, 48, 467, 324, 546, 1039, -342, -1134, -407, -819, 608, 705, -113, 620, -777, -817, 406,
+		 234, 621, -66, 124, -439, 196, 908, 579, -377, -6, 59, 745, 422, -495, -55, -400, -92, -249, -968, -810}},
+	 {0, 70, {0, 1, 1, 0}, {20, 1, 32, 19}, 3070, 597413,
+		{-107, 140, -662, 77, 342, 165, 90, -363, 374, 797, -597, 318, -9, -10, -165, -442, -297, -210, -148, -593,
+		 -488, 199, 476, -649, 952, -321, -339, 416, -71, 280, -35, 552, -487, 976, 366, 273, -294, -791, -674, -423}}},
+	{{-1, 67, {0, 1, 0, 1}, {15, 21, 27, 24}, 12244, 513612,
+		{-259, 411, 151, 144, 552, -514, 177, -285, 306, 64, 684, -235, 29, 99, 134, 808, 231, 613, -447, -230,
+		 -622, 72, -1061, -275, -484, 1034, -170, -353, -377, -595, 176, 50, 209, 815, -21, -604, 1276, 146, -1275, 247}},
+	 {0, 78, {1, 1, 1, 1}, {15, 36, 2, 29}, 12514, 545479,
+		{-396, 154, -778, -344, 209, 143, -765, 333, -371, 483, -401, 337, 426, -872, 828, 182, 38, -340, -152, 378,
+		 515, 545, 245, 927, -705, 245, -31, 291, 476, 298, -466, -1016, -40, 190, 474, 1100, -203, 435, 231, -15}}},
+	{{1, 85, {0, 0, 0, 0}, {10, 36, 37, 34}, 392, 575447,
+		{-287, -615, 832, -652, -41, -504, -602, -429, -594, -170, -787, 529, 100, -123, 275, -848, -5, 147, 538, -466,
+		 113, 130, 0, -371, -56, 336, 711, -53, -1026, -257, 621, -22, 277, 909, -268, -280, 267, 252, -422, 199}},
+	 {0, 51, {0, 1, 0, 1}, {20, 11, 12, 28}, 2982, 509300,
+		{736, -642, 545, 746, -7, -146, -151, -502, -143, -65, -238, -629, 330, 111, -230, 363, 386, 384, 387, 428,
+		 539, -272, 587, -436, 275, -831, -140, -179, -1428, 241, -772, 173, 548, -638, -795, 622, 573, -398, -723, 654}}},
+	{{-1, 52, {0, 1, 1, 0}, {20, 21, 7, 23}, 9884, 664258,
+		{-641, 315, -12, 76, 226, 85, 327, -426, 548, 336, -391, 65, -697, -470, 396, 11, 73, -795, 126, -586,
+		 -724, 383, 337, -192, -530, 506, 3, 683, 145, 84, 150, 501, 275, 143, 264, -736, -138, 169, 347, -470}},
+	 {0, 83, {1, 1, 1, 0}, {30, 16, 22, 29}, 1354, 537025,
+		{-690, -150, 220, -315, 1091, 119, -383, -127, 151, 1251, -123, 414, -436, 176, -22, -230, -672, -36, -594, 503,
+		 981, 617, 723, -461, 425, 85, 343, -560, -802, -94, -196, -308, -654, -434, -384, -215, 359, 603, -219, 229}}},
+	{{1, 62, {0, 0, 1, 1}, {10, 31, 17, 8}, 15376, 592693,
+		{349, 452, -840, 987, 716, -214, -361, -334, 282, 881, 341, 104, 585, 151, 244, -257, -937, -354, -142, 117,
+		 326, -124, 209, -308, -236, 331, 271, -510, 451, -15, 558, 25, -175, -136, 1068, 271, 448, -34, 267, -282}},
+	 {0, 80, {0, 0, 0, 1}, {35, 11, 32, 23}, 16078, 544120,
+		{-622, -11, -898, 333, -894, -963, -866, -571, 467, 230, -737, -866, 387, -530, 511, 470, 404, -681, -192, 367,
+		 4, 287, 224, 359, 213, 328, 225, -64, -507, 464, -191, 120, 406, 697, 2, 401, 390, 513, 290, -247}}},
+	{{-1, 85, {0, 1, 1, 1}, {15, 21, 27, 9}, 14052, 647630,
+		{-33, 344, 624, -570, -7, -85, -134, 8, -12, -547, 101, -981, -562, 1008, 303, 557, -119, -542, -38, 528,
+		 291, 437, 100, -46, 158, 359, 207, -139, -8, 250, 281, -777, -717, 108, -188, -422, 77, -65, -178, -612}},
+	 {0, 72, {0, 0, 0, 0}, {35, 36, 2, 23}, 4402, 479841,
+		{-34, 272, 185, -521, 491, 437, 117, -181, -169, 441, -110, -512, -988, -738, 14, 532, 80, -542, 1515, -119,
+		 989, 519, 807, -931, -823, -117, -572, 658, 790, -400, -576, -474, 194, -332, -227, 283, 463, 601, -551, -145}}},
+	{{1, 87, {1, 1, 1, 1}, {10, 21, 37, 9}, 9240, 477538,
+		{72, -516, -33, 912, -338, 219, -586, 222, -523, 153, -404, 269, -485, 824, 3, 539, -222, 182, 121, 10,
+		 -248, -1259, 464, 1240, -1073, -429, 518, 647, 885, -398, -227, -235, -4, 368, 787, -380, 866, 335, 490, -814}},
+	 {0, 93, {0, 0, 1, 0}, {10, 11, 12, 8}, 3446, 545710,
+		{-1079, 18, 161, -1130, 273, -1230, 537, -25, -326, -333, -14, 151, 194, -877, 42, -88, -725, 724, 195, -744,
+		 -13, 372, 443, -279, -228, 117, -236, -231, 676, -43, -308, 426, 653, -618, -283, 154, 213, -74, 349, 491}}},
+	{{-1, 102, {0, 0, 0, 1}, {25, 31, 7, 29}, 10412, 621441,
+		{188, -364, -342, 413, -497, -354, -20, 664, -703, 649, 783, -654, -428, -429, 17, 45, 326, -1026, -268, 199,
+		 -487, -632, -74, 322, -309, 243, 89, 412, 350, 61, 219, 471, 464, -664, -194, -15, 35, 114, -640, -20}},
+	 {0, 45, {1, 1, 0, 1}, {10, 6, 22, 3}, 15514, 458020,
+		{-700, 173, 427, 863, -791, 361, 511, 459, 493, -634, 436, 408, -430, -766, 200, 708, 22, 991, -195, -175,
+		 827, -485, -239, 317, -577, 440, 70, 138, -92, 1204, -806, 310, 232, 273, 719, 323, -1139, -307, -989, -849}}},
+	{{1, 96, {1, 0, 0, 1}, {35, 11, 17, 4}, 416, 551554,
+		{320, 483, -428, 50, -225, 186, -350, 121, -547, -400, -47, 415, -644, 263, 991, -90, -1030, -899, 206, 652,
+		 857, 212, 668, -429, -617, 1034, -181, -263, -330, 545, 217, 128, 180, 279, -184, -794, -109, 238, 150, 45}},
+	 {0, 90, {1, 0, 1, 1}, {5, 31, 32, 23}, 8094, 609628,
+		{422, -11, -342, -27, -570, -403, 507, -370, -441, -186, 427, -106, -217, 126, 444, -257, -408, -489, 556, -825,
+		 520, 1039, -771, -272, -503, 104, 557, 376, 105, -224, 446, -415, -214, -455, 430, -87, 586, -79, -1, -686}}},
+	{{-1, 103, {1, 0, 0, 1}, {30, 1, 27, 38}, 1012, 527224,
+		{696, -114, 321, -909, 450, -48, -196, 677, -851, -13, -234, 696, -137, 1013, -303, -342, -478, -552, -405, 125,
+		 684, -102, -26, 559, 791, -195, 320, -62, 865, -321, -389, 308, -628, -478, 405, 135, 406, -156, 1168, -71}},
+	 {0, 66, {1, 0, 1, 0}, {10, 26, 2, 13}, 12162, 624700,
+		{161, -161, -301, -483, 93, -333, 575, 545, 378, -152, -244, -122, -1034, -132, 312, 74, 467, -271, 709, -401,
+		 271, 453, -79, -525, -84, -6, -2, 216, -600, -626, 426, 284, 261, 131, 183, 705, -63, 1239, 291, -59}}},
+	{{1, 89, {0, 1, 0, 0}, {25, 26, 37, 28}, 7336, 549013,
+		{487, 280, 1462, -669, 958, 102, 253, -223, 116, -363, -221, -64, -1013, -93, 42, 318, 129, -110, 16, 925,
+		 472, 96, -297, 219, 14, -497, 125, -262, -219, 157, -252, -8, -229, 12, 106, 983, 1010, 602, 177, -363}},
+	 {0, 71, {0, 1, 0, 1}, {0, 6, 12, 29}, 7494, 475978,
+		{841, -578, -839, 90, 193, 15, 1122, -549, 666, 191, 106, 443, 210, -48, 211, -516, 363, -704, -613, -868,
+		 611, -239, -828, -99, 444, 321, 76, -259, -1164, -46, 565, 702, 397, 194, 637, -290, 517, 19, -730, -1185}}},
+	{{-1, 88, {0, 1, 1, 1}, {10, 31, 7, 34}, 4284, 549685,
+		{114, -283, 727, 230, -76, -32, 9, -303, 215, -838, 284, 667, 473, 373, 526, 70, 700, -1009, 225, -48,
+		 -642, -374, 403, 827, 545, -796, 38, 133, 163, 799, 664, -592, 262, -199, -277, -326, 328, 308, 797, -603}},
+	 {0, 71, {1, 1, 1, 0}, {20, 11, 22, 13}, 4586, 456891,
+		{-749, 583, -175, -687, -665, -1357, 597, 366, 284, 1152, 186, 234, 48, -84, 126, -57, 165, 1081, -1117, 3,
+		 -391, -987, 39, -96, -82, 882, -500, 156, -958, 30, 848, 761, 55, 43, -11, -331, 907, -105, -519, -46}}},
+	{{1, 66, {0, 1, 1, 1}, {0, 21, 17, 39}, 15664, 525941,
+		{-548, -710, 423, 194, -470, 385, 101, 120, 345, -345, 4, -241, 359, 686, -382, -1403, -426, -620, -31, 732,
+		 36, -165, -481, 18, 723, -1023, -194, -471, 609, -632, 316, 287, -304, 494, -485, -778, -482, 309, -39, -596}},
+	 {0, 100, {1, 1, 0, 0}, {10, 31, 32, 24}, 11886, 555075,
+		{-302, -627, 238, -235, -477, 566, -657, -18, 467, 318, -433, -730, -540, 167, 400, 191, 84, 111, 304, 183,
+		 -731, 152, 817, 272, -427, -224, -623, -1080, 998, 9, 594, -287, -42, 337, -142, -423, 551, -262, 755, 562}}},
+	{{-1, 57, {0, 1, 1, 1}, {25, 21, 27, 23}, 5892, 533590,
+		{137, -197, 522, -104, 132, -659, 245, 443, 606, 384, -65, -67, -487, 370, 106, -96, 435, -187, 244, 1378,
+		 -210, -265, 1375, -763, -376, 138, -599, 647, -573, -516, -44, 490, 733, -689, 478, -212, -40, -383, -55, -433}},
+	 {0, 60, {0, 0, 0, 1}, {20, 21, 2, 4}, 3026, 479146,
+		{-69, 133, -443, 539, -1241, 137, -158, -304, 500, -18, 478, 228, -992, 690, -69, -423, -83, -297, -777, 301,
+		 665, 91, 916, -670, 1254, 320, -112, -1290, 146, -636, 237, 491, 415, -215, -87, 63, 11, 45, -570, 1012}}},
+	{{1, 91, {0, 1, 1, 1}, {15, 16, 37, 3}, 11064, 508004,
+		{-834, 491, -58, -18, 5, -87, 636, 29, 43, 72, 19, -725, -718, -58, 137, 282, -232, 549, -32, 1000,
+		 991, 867, -490, 407, 1413, 386, -211, 37, 1036, -384, -221, -108, 370, 95, 1018, -30, 441, 285, 432, -239}},
+	 {0, 49, {1, 1, 1, 0}, {25, 1, 12, 9}, 15126, 445688,
+		{-415, 898, 873, -457, -502, 771, 322, -281, 18, -797, -134, -8, 1147, 292, 531, -664, 835, -1084, -757, 825,
+		 -404, 709, -412, 361, 500, -475, 540, -518, -35, 998, 53, 234, -475, 518, 173, -453, 1230, -377, 390, -21}}},
+	{{-1, 74, {1, 0, 0, 1}, {10, 26, 7, 3}, 7884, 616373,
+		{-609, 302, 380, -216, -303, 793, 159, 1026, -1052, -285, -607, 189, 214, -370, -380, -169, -599, 24, 326, -46,
+		 91, 387, -535, -468, -274, 205, 107, 103, -160, -520, 718, 129, -77, -254, -240, 124, -27, 493, -717, -426}},
+	 {0, 97, {0, 1, 0, 0}, {25, 6, 22, 24}, 1338, 664821,
+		{953, -199, 207, -101, 189, 342, -380, -664, 290, 722, 408, 148, 230, -81, 13, 289, 11, 1003, -543, 269,
+		 -369, -632, -234, 90, 116, 132, -86, 262, -72, 225, -97, 275, 93, 157, -269, 639, -927, 442, -88, -180}}},
+	{{1, 100, {0, 0, 0, 1}, {15, 16, 17, 38}, 11968, 521131,
+		{1071, -310, -590, -375, 749, 640, -287, 431, 140, -233, 751, -586, -246, -883, -34, 156, 105, 228, 428, 99,
+		 -345, 538, 91, -1271, -58, -463, -23, 144, 452, -217, 88, -266, 675, 766, 422, 61, 609, 436, -555, -925}},
+	 {0, 46, {1, 0, 1, 0}, {15, 21, 32, 24}, 11070, 652026,
+		{534, -67, 75, -34, -361, -362, -5, 230, 375, -50, -500, 79, 184, -665, -388, -489, -424, 351, 845, 576,
+		 89, -584, -387, -312, 185, 112, 14, -79, 378, 393, -1026, 249, 154, 257, -945, 162, 539, -294, 255, 170}}},
+	{{-1, 75, {0, 0, 0, 0}, {30, 1, 27, 9}, 12308, 493464,
+		{-430, -160, -564, 53, -195, 899, -90, -440, 1031, -123, -159, -454, -334, -152, 251, 13, -1220, 298, -394, 447,
+		 423, 205, -560, -686, -527, 79, 779, -828, 28, 946, 549, 23, -474, 244, -224, 841, 529, 1047, 506, 604}},
+	 {0, 54, {0, 1, 1, 0}, {25, 26, 2, 34}, 9762, 450334,
+		{557, 387, 527, -271, 842, 568, -292, -426, 454, -436, -760, 794, 419, 449, 661, 319, 735, 149, -127, 707,
+		 892, 202, -50, 424, -136, -418, -134, -20, 213, -173, 647, -111, 401, 1447, 1267, 661, 942, -676, 704, -774}}},
+	{{1, 93, {0, 1, 0, 0}, {20, 1, 37, 19}, 4040, 520638,
+		{462, -138, 781, 1073, 132, -603, -205, 208, 27, 691, 1082, -434, -367, 162, 32, -339, -24, 368, 231, -21,
+		 542, -225, 141, 10, 309, -83, 276, -760, -213, -1252, -390, -281, 514, 874, 705, 933, -72, 153, -25, -700}},
+	 {0, 91, {1, 1, 0, 1}, {0, 16, 12, 33}, 9958, 560966,
+		{17, 95, -590, 555, -22, 783, -70, 523, 34, -480, -477, -436, -837, -1136, -789, 236, -77, -1183, -492, 493,
+		 -244, -623, -612, -179, -316, 34, -123, 270, -291, -238, -51, 302, -171, -925, 118, 431, 46, 19, -130, 143}}},
+	{{-1, 60, {1, 1, 1, 1}, {25, 31, 7, 8}, 4828, 604112,
+		{324, -400, 409, -159, 615, 842, 172, -1237, -151, -507, 414, -810, 588, -865, 113, 96, 270, 282, -221, -53,
+		 -591, -140, -74, -235, -461, 431, 40, 64, -362, -55, -389, -182, -296, -60, 173, 53, 251, 926, -320, -257}},
+	 {0, 59, {0, 1, 1, 1}, {30, 36, 22, 34}, 5770, 466643,
+		{-457, 131, 293, 830, 492, -432, 906, 1210, 256, -132, -690, -1129, -651, -503, 115, 979, -183, -523, -1289, -144,
+		 -386, -190, -804, 108, -238, -18, 32, 1225, 263, -517, -315, -379, 91, -153, 201, -606, 272, 564, -466, 30}}},
+	{{1, 70, {1, 1, 1, 0}, {10, 11, 17, 33}, 5712, 597328,
+		{-198, 401, -139, 136, -407, 183, -236, -737, -393, 190, -622, -363, 358, -92, -271, -276, 308, 363, -209, 34,
+		 -29, -1519, 78, 57, -143, 920, -948, -209, -32, 510, -725, -250, 302, 325, -279, 444, 349, -149, 392, -173}},
+	 {0, 56, {1, 0, 0, 1}, {10, 11, 32, 28}, 5646, 540758,
+		{115, -122, -65, -194, -477, 142, -353, 118, 564, 1015, -32, -1009, -348, -577, -128, -1017, 373, 488, -127, -928,
+		 677, 112, 993, -232, -458, 345, 674, -463, 38, 161, -62, 425, -393, 586, 323, 386, 295, -430, -733, -70}}},
+	{{-1, 93, {0, 1, 1, 1}, {10, 36, 27, 34}, 3876, 548781,
+		{-236, -259, -123, -693, 238, -240, -433, -691, -855, -254, -262, -208, -445, 725, -1148, -270, 958, 135, -529, 661,
+		 -232, 538, -455, 23, 83, -116, 612, -134, -659, 223, 110, -324, 104, 17, 601, -33, -702, -732, 35, 737}},
+	 {0, 48, {1, 1, 0, 1}, {25, 11, 2, 28}, 15986, 492368,
+		{759, -167, -206, 416, 964, 1214, -82, 436, -16, -126, 907, 297, -131, 423, -825, -3, 105, -213, -156, 50,
+		 -330, -496, -160, -570, 98, 596, -835, -325, -145, -519, -135, -1265, -37, -259, 406, -828, -1112, -158, 786, -40}}},
+	{{1, 95, {1, 0, 1, 0}, {0, 31, 37, 34}, 2648, 534488,
+		{-1003, 185, 140, 301, 571, -168, 547, -965, 322, 726, 665, -470, -728, 309, -16, 760, -529, -397, 38, 167,
+		 -107, -366, -707, -203, -484, -112, 307, 676, 386, -145, 10, 754, 457, -467, 448, 545, 239, -564, -937, 47}},
+	 {0, 69, {0, 1, 1, 0}, {15, 16, 12, 13}, 8374, 534501,
+		{-678, 339, 658, -201, 354, 307, 714, 584, -53, 372, 867, -72, -365, 20, 91, -119, -68, 789, 948, 441,
+		 -700, 629, -148, 586, 301, -458, 389, -198, 373, -938, -1027, 651, -482, 215, -298, -453, -218, -585, 14, 76}}},
+	{{-1, 46, {1, 1, 0, 0}, {15, 16, 7, 14}, 11500, 628508,
+		{97, 425, -465, 658, -652, -141, -207, -179, 102, -226, 20, 487, 313, -344, 214, -926, -533, 531, 377, -324,
+		 126, -163, 507, 759, -272, 136, 94, -751, -189, -1134, 160, 268, -139, 125, 195, 742, -120, -185, 197, 161}},
+	 {0, 85, {1, 0, 0, 0}, {25, 31, 22, 8}, 1498, 554876,
+		{397, -218, 340, 312, -14, 674, 104, -924, 438, 383, 221, 753, 219, -69, -847, -291, 351, -168, 486, -470,
+		 -700, 84, -390, -298, -888, 689, 111, -285, 301, 109, -573, -945, -719, 394, -904, -228, -362, 6, 140, 328}}},
+	{{1, 40, {0, 0, 0, 0}, {20, 21, 17, 29}, 13280, 448353,
+		{-3, 1168, -15, -577, -612, -729, -513, 454, 538, 157, 238, 172, -135, -268, 1212, -1421, 439, 554, -149, -743,
+		 214, 577, 249, -352, -300, 311, -152, -762, -77, -1266, -330, -435, 369, 452, 741, 115, 528, 347, -525, -1158}},
+	 {0, 66, {1, 0, 1, 1}, {0, 11, 32, 28}, 11998, 534677,
+		{-281, -1050, 75, -458, -569, -738, -420, 415, 264, 183, 204, -1177, -344, 687, -99, -112, 169, 264, 717, 536,
+		 265, -576, 94, -255, -566, 217, -434, 73, -278, 81, 159, -526, -405, 1066, -689, -6, 75, 98, 608, -925}}},
+	{{-1, 47, {1, 1, 0, 0}, {10, 11, 27, 23}, 13364, 614051,
+		{-51, 275, 54, -40, 663, 277, 497, -54, -702, 760, 907, -99, 460, 186, 774, 335, 55, 93, -416, 738,
+		 -383, -33, 411, 596, -340, 322, -331, -89, -842, 132, -80, 729, 161, -601, -374, -20, -405, -343, -187, -290}},
+	 {0, 42, {1, 0, 1, 1}, {20, 31, 2, 18}, 5314, 481726,
+		{282, 776, -340, -730, -106, -228, 216, -22, 371, 657, -411, 1039, 1199, 357, 849, -109, -180, -102, -98, -1416,
+		 328, 302, 330, -324, -1371, 35, -425, 97, 865, 119, -317, -155, -130, 44, 144, 970, 250, -192, -580, -114}}},
+	{{1, 97, {1, 0, 0, 0}, {35, 36, 37, 13}, 6888, 527532,
+		{660, -331, -189, -544, 555, -1085, 586, -162, 673, -78, 48, -67, -8, -384, 247, -261, 46, -977, -355, 794,
+		 325, 189, -220, 24, -197, 556, 650, -9, -494, 634, -1327, -331, -56, -599, -9, 596, 95, 439, -514, 722}},
+	 {0, 47, {1, 0, 0, 1}, {25, 6, 12, 34}, 10374, 443215,
+		{-198, 351, -246, -421, -142, -912, 1395, 156, 11, 992, 59, 828, 259, -1103, -156, 61, 1116, -1055, -276, 413,
+		 532, 114, 725, 862, 45, 354, 797, -642, -347, 691, -1082, -1, -130, 99, -306, -289, 694, 116, 567, 544}}},
+	{{-1, 96, {0, 1, 1, 0}, {15, 31, 7, 19}, 11516, 602122,
+		{-9, 474, 60, 443, 761, 149, 302, -154, -1060, -209, 1, 240, 670, -86, 179, 603, -191, -508, 326, -91,
+		 451, -449, -72, 208, 38, -423, -501, -38, -408, 596, -963, -827, 139, 46, -432, -113, -371, -535, 578, 570}},
+	 {0, 47, {1, 1, 1, 1}, {20, 6, 22, 18}, 4906, 479010,
+		{-836, 32, -422, 138, 464, -180, 542, -153, 69, 473, 323, -605, -999, -59, 455, 832, 846, -238, 428, 60,
+		 -1054, -578, 752, 153, 471, -565, 405, -427, -725, 311, -1127, -142, -1056, 4, -770, -18, 500, -464, 450, -565}}},
+	{{1, 74, {0, 0, 1, 1}, {0, 11, 17, 24}, 1904, 576466,
+		{377, 199, 548, 815, 391, 718, 1186, 165, 118, -76, 513, -260, 580, -645, -449, 50, -781, 33, 350, 73,
+		 129, -600, -164, -193, -784, 14, 59, -234, 62, -171, -7, 972, 621, 379, 152, -157, -133, 642, 534, -39}},
+	 {0, 76, {0, 1, 0, 0}, {25, 31, 32, 29}, 13742, 552861,
+		{115, -34, 239, 454, 132, -185, 48, -161, 244, -241, -560, 855, 965, -200, -47, 944, 245, 448, 561, 104,
+		 -378, 169, 242, 897, -394, 497, 18, -263, -825, -102, -109, -814, -1161, -606, 883, 266, 136, 11, -76, -93}}},
+	{{-1, 65, {1, 0, 1, 0}, {20, 21, 27, 8}, 8004, 428069,
+		{-642, 1184, -801, -291, 313, 658, -630, -832, -813, -411, 532, -894, 590, -489, 127, -475, -88, -86, -311, -1113,
+		 -285, -228, 244, -246, -515, -401, 766, -948, 1272, -95, 233, 879, 466, -844, -333, -399, -883, -602, 606, 340}},
+	 {0, 100, {0, 1, 0, 0}, {5, 16, 2, 9}, 10514, 540038,
+		{-108, 398, 382, -380, -64, -942, 859, -7, -179, -393, 151, 205, -455, 1019, 308, -766, -378, 736, 816, 150,
+		 50, 292, 141, -117, 831, -311, -695, 479, -85, -563, 358, -620, 888, -462, -286, 168, 164, -522, -577, -227}}},
+	{{1, 99, {1, 1, 1, 0}, {5, 31, 37, 28}, 376, 506914,
+		{587, 104, -973, -1205, -1198, -26, -343, -198, -712, 581, 0, 1032, 511, -125, 566, -73, 421, 930, 333, 581,
+		 44, -352, -189, -76, -110, -385, -998, 2, -39, -195, -560, -207, 255, 220, 103, 319, 774, -166, -547, 46}},
+	 {0, 89, {0, 1, 1, 0}, {25, 6, 12, 14}, 15958, 707894,
+		{178, -125, 26, 152, 795, -60, -333, 8, -29, 612, -85, -39, -244, -155, -252, 9, 148, -315, 188, -870,
+		 -899, -378, -299, -118, -315, 166, 333, -293, -146, 295, 38, -373, 118, 7, -674, -356, -33, -184, -777, 780}}},
+	{{-1, 82, {0, 1, 0, 1}, {35, 1, 7, 28}, 4876, 513381,
+		{-252, 515, -319, -547, -10, -1106, -604, 119, 201, 824, 102, 754, 379, 1187, -247, -180, -498, -531, 395, -121,
+		 -896, -232, -18, 417, -301, 34, -464, 924, 261, 269, 83, 374, -232, -1065, 597, -207, 266, 642, 568, -309}},
+	 {0, 73, {0, 0, 0, 1}, {5, 11, 22, 29}, 15994, 531630,
+		{706, 626, -712, 52, 134, 335, -83, -1343, 427, -117, -639, -339, -465, -216, 694, 506, -492, 36, -182, 166,
+		 -168, 129, -705, 179, 509, -451, -365, 31, 1, 346, 1352, -788, -154, 470, 348, -232, -470, -589, -303, 165}}},
+	{{1, 44, {0, 0, 0, 1}, {0, 31, 17, 23}, 4352, 547363,
+		{172, 311, 783, 470, -214, 685, -2, -324, 137, 260, 460, 131, 199, -454, -389, -215, -1050, 81, 1033, -848,
+		 -1052, -185, 120, -234, 195, 286, -570, -419, 129, 980, 501, -381, -224, -149, 259, -630, 670, -31, -270, 368}},
+	 {0, 86, {0, 0, 1, 0}, {5, 1, 32, 29}, 10878, 491915,
+		{535, 110, -340, -273, 856, 519, 284, -841, 248, -1, -19, 736, -263, 600, -227, -664, -167, -240, 174, 593,
+		 26, 41, -866, -103, -710, -95, 239, 322, 699, -646, 415, -182, 1179, -1102, 176, -1101, -804, -437, 32, 635}}},
+	{{-1, 83, {1, 1, 0, 0}, {5, 36, 27, 34}, 4180, 600667,
+		{295, 165, -383, 1370, -558, -376, 27, -211, -420, 74, 406, 223, 1223, -531, -272, 114, -239, 367, -469, 484,
+		 -196, -302, 325, 311, 326, -492, 64, 105, 305, -201, -742, -132, 763, 569, -43, 110, 166, -228, 111, -191}},
+	 {0, 94, {1, 0, 1, 1}, {30, 6, 2, 39}, 15202, 518666,
+		{-154, -20, 1192, 698, -701, 353, -971, 223, 639, 565, 289, 99, -228, 106, 878, -696, -232, -2, 282, -628,
+		 -395, 755, -473, -207, 817, 839, -365, 565, 334, 252, -416, 666, 202, -496, -116, -418, -89, 133, 25, -637}}},
+	{{1, 101, {0, 1, 0, 0}, {30, 21, 37, 4}, 15880, 485844,
+		{-453, -813, -422, 110, 689, -318, 64, -307, -504, -112, -1273, 523, 574, -193, -339, -982, -171, -51, 308, -728,
+		 -181, -708, -358, -249, -478, -118, -287, -59, 1496, 185, 7, -156, 1135, 199, -498, 482, -27, -586, -780, 321}},
+	 {0, 67, {1, 1, 0, 1}, {25, 16, 12, 38}, 8742, 516426,
+		{706, 192, -829, -276, 1371, 48, -117, 1420, 83, 1, 180, 141, -596, 561, 60, -531, -668, 194, -475, 942,
+		 -643, -78, 621, 974, -523, 259, -234, -433, 206, 179, 30, -209, -506, 196, -121, 112, -97, 308, 335, 16}}},
+	{{-1, 68, {0, 1, 1, 1}, {30, 21, 7, 33}, 7964, 482700,
+		{137, 293, 190, -522, 364, -577, 401, 384, -466, -1478, 67, -789, 209, 660, 214, 565, 339, 207, -184, -672,
+		 -74, 1257, 411, 106, 504, -284, 973, -1195, 539, -322, -32, 31, -483, 121, -46, -310, 1024, 19, -603, -172}},
+	 {0, 99, {1, 1, 1, 0}, {25, 6, 22, 39}, 1994, 542395,
+		{-352, 284, 238, 311, -235, -599, 531, -141, -1303, 405, 663, 784, -482, 226, 124, -500, -846, 398, -64, 617,
+		 -345, -101, -923, 37, 507, -249, 617, -190, 176, -556, 462, -578, 196, -512, 146, 411, 57, 397, -841, 215}}},
+	{{1, 78, {0, 0, 1, 0}, {10, 11, 17, 18}, 4240, 512400,
+		{-361, -290, -78, 181, 902, -1084, 785, -244, 340, -117, 335, -446, 3, -463, -402, 601, -111, 952, -916, 847,
+		 0, 1054, 843, -218, -690, 357, -247, 988, -131, 395, -88, -141, -373, -366, -218, 489, 122, 120, -123, 320}},
+	 {0, 96, {1, 0, 0, 1}, {20, 6, 32, 33}, 3406, 558733,
+		{212, 151, 640, -337, -188, 95, 32, -345, 21, 136, 33, 256, -187, -240, 129, -72, -810, 505, 322, -303,
+		 -314, -191, 1122, 585, 279, -790, -541, 546, -57, 242, -1597, 90, 728, 347, 516, 243, -440, 35, -348, 491}}},
+	{{-1, 101, {0, 1, 1, 0}, {5, 26, 27, 19}, 1892, 545991,
+		{-55, 546, 26, -944, 867, -523, 164, 530, 222, -89, 271, -75, 56, -710, -167, -713, 371, 684, 388, -870,
+		 141, -513, -114, -548, 392, -719, -135, 255, -414, 68, -701, 1, 285, 822, 238, 740, -73, -503, -904, -90}},
+	 {0, 88, {0, 0, 0, 0}, {10, 26, 2, 33}, 2994, 444671,
+		{400, 290, -213, -311, -739, 327, -409, 413, 1033, 715, 772, -46, 86, -1104, -768, 358, 2, -12, -419, 91,
+		 -241, 1433, 281, 175, -133, 157, -714, 612, 840, 258, -334, -1160, -396, 198, 399, -531, 769, -1045, -1077, -63}}},
+	{{1, 103, {0, 0, 1, 0}, {30, 16, 37, 19}, 4248, 507938,
+		{-158, -1290, 185, 1098, -696, -171, 16, 280, -497, -365, 582, 199, 437, 178, 861, -171, 572, -592, -173, 708,
+		 -606, -113, -470, 274, -1047, 77, -32, -447, 783, -532, -393, -945, -234, 106, -19, -194, 508, -55, 580, 268}},
+	 {0, 45, {0, 0, 1, 0}, {20, 16, 12, 18}, 5110, 600766,
+		{107, -492, -509, 88, 307, -332, -773, 41, 92, -1099, 84, -423, -28, 789, 12, -790, -563, -298, 549, -38,
+		 -1003, -266, -355, -213, 190, -137, 374, 219, -570, 599, 174, -276, -209, -104, -441, -164, 247, 824, 63, 45}}},
+	{{-1, 54, {0, 1, 0, 0}, {0, 21, 7, 39}, 4396, 474948,
+		{-634, 574, -716, 263, -423, -56, -522, -638, -757, 819, 665, 476, 414, -1411, -741, -1001, 16, -88, 382, 49,
+		 99, -334, -576, 44, 149, 413, -29, -1018, -344, -409, 997, 449, 666, -238, -56, -165, 109, 924, 394, -298}},
+	 {0, 61, {0, 1, 0, 1}, {5, 16, 22, 13}, 12058, 541202,
+		{-170, -225, 125, -367, 123, 347, -431, 637, 767, -264, 390, 458, -284, -524, 26, -906, -472, 1105, 527, -381,
+		 -307, -499, -157, 495, 721, 810, 24, 700, -458, -602, -980, 232, -262, 387, -95, 117, 287, 191, -395, -671}}},
+	{{1, 48, {1, 1, 0, 0}, {0, 1, 17, 14}, 1568, 445875,
+		{570, -835, 270, 716, -615, 276, 220, 147, -553, -950, 395, 313, 246, 609, -1255, 704, -780, -1193, 1416, -218,
+		 467, -210, -298, 109, 401, -540, 773, -365, 48, -133, -1005, 410, -82, 497, 2, 384, 13, 840, -304, 583}},
+	 {0, 42, {0, 1, 1, 1}, {35, 26, 32, 33}, 7710, 557306,
+		{-88, 343, 364, 519, -184, 335, 61, -464, -183, 424, 365, 696, -599, 96, -258, -95, 618, 377, -274, -279,
+		 394, 753, -705, 146, 1291, -310, -17, 1178, 235, -254, -256, 259, -724, -101, 112, 459, 460, -877, 65, 244}}},
+	{{-1, 55, {0, 1, 0, 1}, {25, 36, 27, 8}, 1140, 483728,
+		{610, 24, 171, 189, 236, 474, 38, 1135, -681, -131, 384, 1026, 417, 255, 699, 884, 460, -414, -43, -313,
+		 -42, -604, -304, -7, 961, -313, 426, 1292, 395, -55, -411, 510, 310, 172, 767, 721, 704, -658, 378, -637}},
+	 {0, 82, {1, 1, 1, 0}, {25, 31, 2, 23}, 6658, 629148,
+		{275, 49, 517, -81, -433, 261, -271, 819, 236, -710, -706, 24, -280, 206, -278, 1116, 69, -61, 503, 1,
+		 -767, 23, 99, 261, 286, 460, -464, -150, -358, -288, 860, 302, 375, 341, -535, 83, 435, 297, -43, -297}}},
+	{{1, 41, {1, 0, 0, 1}, {10, 26, 37, 38}, 14632, 559175,
+		{193, -558, -432, -35, -488, 160, -745, -741, -434, 591, 1213, 826, -667, -291, -188, 56, -677, 76, 170, -489,
+		 562, -358, -271, -299, -24, -55, 535, 628, -385, 471, 542, -270, -11, 198, -764, 81, 76, 148, 715, -369}},
+	 {0, 87, {1, 1, 0, 1}, {5, 6, 12, 39}, 5062, 570483,
+		{-341, -384, 731, -548, -93, 81, 4, -291, -260, 129, -1140, 61, 180, -238, -651, -2, 1229, 2, -67, 30,
+		 -187, 339, -922, -865, 30, -253, -146, -641, 342, 276, -297, -832, -273, -124, 159, -416, -793, 85, -312, 97}}},
+	{{-1, 40, {0, 1, 1, 1}, {25, 6, 7, 4}, 10556, 510775,
+		{-260, -945, 1313, 16, -66, -310, -45, -645, 97, 292, 102, 709, 739, 863, -808, -528, 326, -647, -213, -262,
+		 392, -140, -675, -27, -597, 334, 368, 1199, -595, 265, 354, -166, -112, -349, 309, -28, 338, -482, 743, 79}},
+	 {0, 87, {1, 1, 1, 0}, {15, 36, 22, 23}, 13418, 629215,
+		{-539, -647, 227, 323, -71, -667, 359, -288, 238, -334, -180, -36, 386, 350, -880, 57, 375, 363, -203, -11,
+		 -309, -297, 825, -238, -128, -92, -354, -114, -620, 464, -158, 363, 265, 349, -121, -345, -1059, 585, -245, -700}}},
+	{{1, 82, {0, 1, 1, 1}, {0, 16, 17, 9}, 12720, 488709,
+		{150, -1068, -991, -228, -412, -101, 1119, 82, 275, -447, -642, -919, -351, -1080, -132, -161, 272, 46, 91, -202,
+		 606, 373, -487, -20, 1165, 411, 184, 899, -101, -350, -458, -1031, 394, -376, 149, 336, 600, 335, -45, -122}},
+	 {0, 52, {0, 1, 0, 0}, {0, 26, 32, 34}, 7406, 473483,
+		{-1132, -81, -400, -521, 613, -40, -399, -944, -1131, 608, -303, 776, 294, 329, -110, 33, 278, 145, -846, -103,
+		 359, 570, 563, -142, -489, -446, -1005, -86, -216, 171, 596, 1091, 152, 883, -780, -197, -919, 156, -11, -364}}},
+	{{-1, 73, {0, 1, 1, 0}, {15, 1, 27, 33}, 1924, 492994,
+		{-13, 389, 308, -94, 366, -201, -97, 325, -312, -822, -535, 711, 3, 572, 532, -470, -227, -113, 30, 364,
+		 24, 1217, -503, -369, 242, -44, -45, -1135, -83, 198, -642, 628, -953, 921, 264, -714, 194, 75, 1139, 985}},
+	 {0, 76, {1, 1, 0, 1}, {35, 1, 2, 14}, 9810, 557133,
+		{237, 23, 567, -403, -39, -101, -300, -862, -474, 128, 208, -458, -46, 196, 45, -725, -289, 105, -279, -641,
+		 -693, 365, 774, -204, -232, 466, -894, 1096, 580, -106, -1185, 189, 209, 699, 411, -367, 189, -193, -200, -58}}},
+	{{1, 43, {0, 0, 1, 0}, {0, 26, 37, 13}, 14264, 490449,
+		{-168, -411, 32, 40, 31, 419, 86, -41, 965, 450, -147, 101, 76, -832, 355, -44, 1458, -353, 570, 546,
+		 1017, 349, 496, -175, 799, -260, -377, -161, -218, 890, 509, 590, 524, 729, 596, -996, -45, 791, 394, 203}},
+	 {0, 65, {1, 1, 1, 0}, {30, 1, 12, 19}, 8598, 478513,
+		{131, 260, -437, 121, 428, -507, 420, -343, -1228, 357, -164, -710, -227, 294, 885, -470, -667, 326, 493, 379,
+		 526, -57, 198, 811, -1258, 1191, -2, -708, 639, -24, -617, 428, 71, -120, 399, 637, -912, -119, 488, 429}}},
+	{{-1, 90, {0, 0, 0, 0}, {20, 31, 7, 13}, 10060, 723879,
+		{-23, -424, -634, 18, 155, -61, 41, 620, -210, -243, -341, 679, -608, -456, 270, 193, -13, 322, -176, 188,
+		 37, 557, 883, -362, 568, -265, -139, 81, -470, -94, 344, 491, -515, 44, 282, -154, 431, 151, 189, -320}},
+	 {0, 49, {1, 0, 0, 0}, {25, 6, 22, 34}, 6074, 511086,
+		{-181, -725, 289, 77, -49, -312, 86, -102, -76, -572, 234, 70, 248, -479, -289, 83, -99, 989, -1485, -65,
+		 929, -262, -280, 140, 262, -650, 252, -328, 970, -173, 113, 581, 1007, -881, 837, 305, -141, -724, -134, 382}}},
+	{{1, 52, {1, 1, 0, 1}, {20, 16, 17, 8}, 4928, 475872,
+		{169, -220, -20, 163, 743, -422, 155, -695, -1018, -911, -471, 208, 4, -665, -360, -714, 739, 318, -538, -387,
+		 -351, 1012, -1003, 163, -704, 395, -733, 426, -834, -511, 274, -112, -739, -168, -32, -937, 603, -114, -625, 509}},
+	 {0, 62, {1, 1, 1, 0}, {0, 11, 32, 34}, 2494, 537354,
+		{-616, 159, -371, 384, 409, -264, -67, 520, -519, -80, -690, 753, -326, 201, -194, 569, 474, -959, -113, 482,
+		 -677, 1050, -449, 490, -709, 82, -176, 83, 380, 235, -832, 283, 28, -1053, 657, 68, -227, -196, -319, -564}}},
+	{{-1, 91, {1, 1, 0, 1}, {20, 6, 27, 19}, 4244, 502329,
+		{-132, 362, 182, -1025, 487, 269, -1008, 402, 49, -369, -181, 772, 92, 498, -923, 87, 102, 820, -160, -631,
+		 -943, 87, 570, 156, 27, -679, -267, -114, -58, 572, 399, 609, 848, -258, -502, 275, -837, -607, 100, 934}},
+	 {0, 70, {1, 1, 1, 1}, {0, 26, 2, 4}, 12450, 578730,
+		{31, 469, -831, -509, -324, -1014, -242, -280, -328, -610, 186, -212, 533, -365, -57, 721, -303, 231, -461, -43,
+		 -786, 156, 1024, 58, 618, -80, 300, -2, 327, 37, 441, 291, 387, -519, -603, -89, 800, 302, -270, 396}}},
+	{{1, 45, {1, 0, 0, 1}, {5, 16, 37, 29}, 3144, 611755,
+		{40, -80, 295, -469, -418, -673, 717, 74, -139, -19, -172, -184, -1173, 348, 186, 295, -446, -86, 257, -27,
+		 -8, -295, 1063, -124, 143, 743, -466, 2, -507, -554, -748, -159, 92, 420, -293, -609, -110, -429, 385, -322}},
+	 {0, 43, {0, 1, 0, 0}, {10, 16, 12, 3}, 15718, 618235,
+		{243, -351, -172, 301, 588, 209, 220, 653, 516, 354, 197, 78, -483, -430, -243, 110, 661, -605, 950, -785,
+		 -146, -173, 190, 463, 166, -156, 39, -240, 1087, -44, -17, -336, 55, -347, 24, 177, 144, 469, 672, -751}}},
+	{{-1, 76, {1, 0, 1, 0}, {35, 21, 7, 18}, 2908, 486241,
+		{846, -678, 355, 523, -527, -76, 502, 853, 115, -529, 1128, 128, 726, 9, -325, 394, -232, 4, 237, 117,
+		 315, 478, -256, 319, -195, 409, -270, -534, -224, -205, -315, -1420, -286, -338, -393, 223, -379, 520, -1014, 1321}},
+	 {0, 75, {0, 1, 1, 0}, {25, 16, 22, 4}, 6410, 584801,
+		{137, 309, -457, -848, -66, -382, 28, -596, -430, 814, -160, -503, -441, -197, 5, -571, 411, 167, 521, 738,
+		 -432, 372, -146, -162, -412, -96, -974, -709, -551, -211, -425, 119, -339, -487, -549, -748, -286, -410, -320, 272}}},
+	{{1, 86, {1, 1, 1, 0}, {10, 21, 17, 3}, 10960, 489188,
+		{-140, -85, -657, -414, 35, -431, 654, 121, -591, 984, -372, -1169, -480, 62, -149, -186, -1170, -635, -727, -4,
+		 -611, 427, 456, 403, 683, -334, -698, -1015, -358, -360, 421, -160, 360, -673, 227, -618, 791, -251, 258, -339}},
+	 {0, 72, {1, 1, 0, 1}, {35, 36, 32, 38}, 9358, 515983,
+		{181, -216, 705, -96, 485, -80, 1313, 88, 374, 153, 482, -655, 870, -31, -766, -279, 439, -118, 131, -318,
+		 615, -622, 1123, 250, -648, -5, 164, -109, -792, 195, -188, 139, 185, -532, -443, 996, 233, 372, -603, -612}}},
+	{{-1, 45, {0, 0, 1, 1}, {5, 31, 27, 4}, 8100, 541743,
+		{1022, 199, -465, 213, -168, -422, 121, 87, 147, -52, 164, -70, -83, 287, 174, 252, -344, 593, -359, 31,
+		 -126, 356, 99, 289, 61, 86, 14, -508, -297, 809, -616, -1850, 338, -1061, 259, 361, -596, 622, -435, -21}},
+	 {0, 64, {1, 0, 0, 1}, {0, 31, 2, 38}, 14578, 511792,
+		{-87, -917, 164, -142, -522, 336, -352, -250, -94, -620, 509, 507, 1199, -199, 185, 79, 795, 61, 214, -508,
+		 -792, -862, 594, 792, 20, 614, 303, 909, 161, -117, -1173, -671, 653, 15, -248, -362, -38, -12, 4, -214}}},
+	{{1, 47, {0, 0, 1, 0}, {25, 16, 37, 4}, 14040, 576428,
+		{559, 179, 102, 231, 981, 722, -131, 373, 92, -560, 883, -284, 962, 431, 586, 818, 9, 109, 512, -415,
+		 303, 12, 151, 111, 310, 650, -499, 350, 28, -23, -412, -724, -29, 39, -102, -37, 649, 326, 433, -663}},
+	 {0, 85, {0, 1, 1, 0}, {20, 11, 12, 23}, 10038, 571274,
+		{764, -427, -268, -775, 132, -587, 172, -118, -403, 886, -827, -390, -331, -106, -195, -565, -162, 23, 22, -133,
+		 -922, 759, 334, -116, -49, -456, 231, -516, 407, -552, -289, 205, 960, -39, 312, 509, 72, 569, 496, 398}}},
+	{{-1, 62, {0, 0, 0, 1}, {25, 36, 7, 24}, 5484, 440539,
+		{555, 83, -71, -772, 190, -99, 1083, -201, 816, -312, -866, 849, -125, -558, 224, -692, -75, 189, -253, 1318,
+		 -568, 391, 773, -799, -70, 562, -792, 123, 397, -836, 1194, 502, 319, -217, -435, 336, 722, -655, -561, -885}},
+	 {0, 101, {0, 0, 0, 0}, {20, 31, 22, 18}, 14426, 510565,
+		{159, 152, 294, -150, -892, -620, 442, 22, 456, -527, 431, 547, 109, 941, -765, -113, 625, 714, 952, -420,
+		 -42, -186, 460, 136, 666, 803, -191, 533, 191, 607, 21, 257, -957, -260, 74, -690, -728, 248, -546, 762}}},
+	{{1, 56, {1, 1, 0, 1}, {20, 36, 17, 39}, 14432, 395769,
+		{-9, 618, -597, -679, -234, 641, -199, -800, -748, -137, 1960, 326, -13, -690, -266, 653, 433, 516, 293, 1203,
+		 592, -1125, 563, -70, 462, -1007, 34, -96, -979, -152, 240, 103, 363, -98, 159, -499, -118, 1205, -723, -1388}},
+	 {0, 82, {0, 0, 1, 1}, {25, 36, 32, 38}, 11614, 543896,
+		{489, -440, 13, -168, -439, 256, -98, -447, -246, 25, 398, -631, 42, -623, 479, -206, 427, -662, -369, -198,
+		 -117, 418, -96, -93, -52, -453, 272, 619, 108, 307, 225, 916, 877, 140, 273, -228, 1741, 68, 930, 261}}},
+	{{-1, 63, {0, 1, 0, 1}, {0, 36, 27, 33}, 13492, 542649,
+		{631, -355, -352, 290, -319, -481, 475, 660, 236, 386, 245, 487, 246, 708, 496, -231, -799, -25, -310, -980,
+		 683, 233, 901, 286, 1110, -564, 543, -15, -544, 142, 154, 163, -181, -207, -268, -202, -363, 435, -721, -600}},
+	 {0, 58, {1, 1, 1, 1}, {35, 26, 2, 28}, 16194, 579942,
+		{140, 730, -802, -72, 136, 110, -374, -4, -27, 355, 407, -95, 161, 439, 515, 165, 190, -148, 464, 266,
+		 -454, 640, -260, 206, 791, -267, 393, -13, -685, 713, -139, -905, -272, -514, -830, 92, 492, 658, 878, 416}}},
+	{{1, 49, {0, 0, 0, 1}, {20, 31, 37, 23}, 14184, 579813,
+		{-402, 111, 221, -166, -123, -1283, 356, -936, -133, 108, -310, -457, 82, 186, -239, -267, 8, -23, 567, -364,
+		 159, 503, 574, 786, 533, -1306, -220, -399, -404, 180, 235, -337, 418, -157, -111, 462, -583, -271, 280, -52}},
+	 {0, 63, {0, 0, 0, 0}, {30, 1, 12, 4}, 7942, 578940,
+		{-100, -223, 44, 221, -172, 946, 533, 158, -147, 162, 93, -322, 485, -13, 262, 319, 190, -93, 14, -993,
+		 502, 436, -1161, -160, -625, 1060, -705, -256, -121, -267, -152, -255, -544, 549, -16, -159, 152, 438, 729, -478}}},
+	{{-1, 48, {0, 1, 1, 1}, {30, 36, 7, 29}, 1404, 497890,
+		{897, 68, -634, -27, 3, -385, -8, -240, -410, -1383, -437, -998, -344, 660, 125, -763, -309, -402, 144, -1073,
+		 205, 41, 130, -390, -336, -573, -427, 260, 114, -706, 7, 367, 1045, -360, 410, -71, 407, 979, -244, 484}},
+	 {0, 63, {1, 1, 1, 1}, {15, 21, 22, 28}, 13738, 573808,
+		{654, -430, -276, -644, 802, -1282, 48, -39, -233, 267, -299, 405, 107, 119, 217, 178, -224, 836, 574, 814,
+		 308, -144, -254, 267, 169, -771, 807, 71, -643, -535, 171, 228, -78, 54, -624, -288, -186, -30, -556, 61}}},
+	{{1, 90, {0, 0, 1, 0}, {0, 36, 17, 34}, 15344, 500817,
+		{307, -415, -610, 137, -831, -24, -100, 895, -208, 78, 123, 854, -386, -107, -455, -500, -339, 955, -1832, -93,
+		 -69, -318, 598, -487, 426, -344, 693, -144, 120, -145, -13, -90, 39, -747, 18, -323, -331, 412, -752, 691}},
+	 {0, 92, {1, 1, 0, 0}, {10, 11, 32, 39}, 9262, 598609,
+		{-459, 256, -655, -600, -570, -23, 50, 705, -74, -207, -686, 1081, -505, -294, -301, 530, -841, 226, 179, 74,
+		 -568, -181, 756, 227, 312, 19, -108, -37, -247, -708, -363, 308, -711, -316, -11, -276, 458, -339, -74, 261}}},
+	{{-1, 81, {1, 0, 1, 1}, {10, 31, 27, 18}, 4036, 534771,
+		{-536, 490, 1289, -25, -221, -1188, 308, 330, 573, 175, 318, 140, -200, -31, -727, 431, 530, -268, -269, 177,
+		 205, 486, -354, -108, 359, 1209, -472, 86, 482, 363, 403, 249, -452, -514, 221, -645, 631, 624, 8, -34}},
+	 {0, 52, {1, 1, 0, 0}, {25, 26, 2, 19}, 914, 609309,
+		{454, 32, 112, 470, 370, 1124, -51, -821, -385, 9, 137, -737, -277, 269, 166, 212, -840, 370, 34, -24,
+		 -28, -202, -257, 93, -399, 91, 827, 49, 93, -801, 216, -154, 426, -316, -556, 506, -426, -504, -463, -529}}},
+	{{1, 51, {0, 1, 1, 1}, {30, 31, 37, 38}, 3576, 518519,
+		{-539, -542, 397, 133, -404, 224, 387, -524, 466, 191, 90, 66, -487, 381, 16, 881, 831, 284, -857, -129,
+		 -186, -102, 1053, 110, 556, -775, -908, 572, -525, 311, -598, -789, 153, 598, 449, -391, 32, -940, -329, -280}},
+	 {0, 41, {0, 0, 1, 0}, {35, 36, 12, 24}, 9430, 431543,
+		{-556, 517, -4, -38, 445, -58, -491, 202, 5, -538, -883, 27, 686, 103, 358, -53, -1098, -185, 670, 476,
+		 799, -888, 1079, 1100, -281, 552, 559, -227, -240, 41, 136, -947, -616, -375, 832, -1058, 641, 330, -1447, -562}}},
+	{{-1, 98, {0, 1, 0, 0}, {5, 36, 7, 38}, 7052, 513809,
+		{78, 557, 459, -57, -832, -168, 46, 481, 275, 98, 112, 476, -187, 1357, 147, -1098, -168, -489, -363, 369,
+		 842, 194, -392, -245, -227, -180, 570, 134, -305, 439, -35, 480, 1122, -511, 351, -229, -556, 556, -318, 1077}},
+	 {0, 89, {1, 1, 0, 1}, {0, 1, 22, 39}, 4346, 523927,
+		{340, -156, 650, -26, 152, -575, -385, -525, -195, 381, -1069, -673, -191, 154, -888, -468, 678, -746, -356, -424,
+		 362, 755, 17, -539, -113, 559, -283, 209, 787, -1332, 282, -226, -8, 712, 174, -310, 60, 37, 419, 471}}},
+	{{1, 60, {1, 0, 0, 0}, {0, 21, 17, 33}, 13696, 529099,
+		{1062, 657, 73, -272, 36, -121, -328, -170, -765, 862, -506, -867, -831, 532, -459, 707, -160, -85, 323, 458,
+		 222, 33, 306, -592, 829, -1160, 0, -393, 123, -82, -81, -483, 666, 197, 61, 164, -616, 187, -84, 522}},
+	 {0, 102, {1, 0, 1, 0}, {30, 16, 32, 39}, 2302, 561979,
+		{153, 80, -18, -111, -1190, 361, 990, -295, -390, -287, 47, 642, -5, -326, 223, -374, -37, 242, 496, -269,
+		 28, -629, 352, -69, -324, -381, -207, -284, -67, 476, 865, -404, -227, -1132, 498, -427, -290, 429, -798, 669}}},
+	{{-1, 99, {1, 1, 0, 0}, {35, 31, 27, 4}, 12500, 565523,
+		{337, -81, 107, 36, -132, 274, -635, -649, -122, -940, 128, -343, -143, -649, -166, -580, 315, -391, 21, 1198,
+		 742, -164, -849, -127, 624, -482, 298, 51, 475, 193, -636, -314, -219, -701, -65, -712, -432, 422, 473, -117}},
+	 {0, 46, {0, 0, 1, 0}, {10, 1, 2, 9}, 1506, 527232,
+		{88, 318, -422, -308, -75, 563, -153, 113, 113, -377, -45, -651, -370, 60, -608, -38, 1034, -688, -308, -610,
+		 -793, -59, -167, -829, -733, -103, -187, -185, 192, 1230, 658, 300, -580, -670, 318, 624, -999, 343, -181, 277}}},
+	{{1, 53, {1, 1, 0, 1}, {15, 26, 37, 14}, 14984, 473305,
+		{917, -499, -140, 872, -117, 380, 1242, 839, 98, 458, 801, 5, 536, 761, 71, -92, 175, 775, 78, -990,
+		 37, -10, -716, 897, -388, 452, -261, 447, 434, 115, -95, -290, 457, 1, -728, -1316, -321, 112, -626, -69}},
+	 {0, 83, {0, 1, 0, 0}, {30, 6, 12, 8}, 14502, 526377,
+		{164, -510, 357, 238, 189, 242, -83, 270, -203, -445, 86, -113, -498, -13, -162, 623, -186, 516, 199, -592,
+		 -801, 116, -1393, 336, -297, 325, -328, 337, 816, 629, 832, -79, -536, 518, 553, 114, -255, -1034, -655, 914}}},
+	{{-1, 84, {1, 1, 1, 1}, {0, 1, 7, 3}, 6044, 703996,
+		{-109, 271, -632, -96, -10, -215, -37, 170, -456, -220, 13, -107, 91, 254, 32, 607, -419, 185, -494, -246,
+		 576, 83, -539, -108, 2, 462, -105, -1, 421, 296, 298, 1097, 295, 99, 156, 628, -886, -131, 495, 126}},
+	 {0, 51, {1, 0, 1, 1}, {25, 16, 22, 9}, 2634, 489364,
+		{-14, -306, -1280, -87, -537, -293, -603, -667, -197, -441, -87, -382, 496, 276, -242, -258, 516, -192, -558, 731,
+		 -135, -819, -9, 535, 589, -583, 891, 180, -382, 518, -416, -848, 534, 434, 164, 1037, 267, -321, -951, -823}}},
+	{{1, 94, {0, 1, 1, 1}, {10, 11, 17, 28}, 9488, 509292,
+		{465, 504, 172, 399, 64, -930, -117, 358, 398, 421, -183, 28, -579, 971, 488, 435, -309, -302, 870, 553,
+		 -326, -328, -571, 384, -632, -641, -765, -586, -201, -731, 290, -819, 965, 428, -480, 195, 308, 786, -513, -102}},
+	 {0, 48, {0, 1, 0, 0}, {10, 26, 32, 3}, 7118, 599163,
+		{534, -199, -382, -495, 6, -895, -606, -119, 87, 554, -221, -158, 263, -462, 771, -102, -488, 155, 836, 51,
+		 -120, 867, -28, 299, -679, -372, -283, -380, -119, 20, 69, 60, 26, -3, 6, -427, 266, 1093, -474, 717}}},
+	{{-1, 53, {0, 1, 1, 1}, {0, 11, 27, 29}, 6116, 566131,
+		{-77, 236, 964, 218, 205, 63, -562, -484, -56, -655, -583, -193, 1186, 132, -1149, 65, -675, -138, 302, -220,
+		 503, 585, -328, 486, 114, -261, 35, -375, -308, -114, -659, -245, 775, -512, -360, -146, -223, 83, 418, 432}},
+	 {0, 40, {1, 1, 0, 1}, {30, 31, 2, 3}, 1586, 562212,
+		{-702, 308, 413, -101, 79, -295, 89, 495, 699, -35, 1142, -92, -376, 66, 498, 184, 436, -506, -817, -211,
+		 65, 299, 779, 257, 557, -81, 680, 54, -646, -108, -92, 202, 38, -808, -511, -321, -973, -131, -579, 531}}},
+	{{1, 55, {0, 0, 1, 1}, {15, 31, 37, 29}, 15640, 611022,
+		{-388, 496, -621, -252, 482, -49, -406, 338, 41, 653, -480, -383, 335, 556, 183, -881, -682, 682, 45, 382,
+		 572, -503, 132, -180, 515, 71, -70, 507, 169, -666, 465, 393, 560, -668, -313, -8, 150, -445, -354, -186}},
+	 {0, 61, {0, 0, 1, 0}, {25, 1, 12, 28}, 6774, 604035,
+		{269, 22, 357, 282, 341, 54, 989, 619, -514, 183, 182, 27, -762, -105, -18, -1492, 111, -808, 391, 156,
+		 -457, -904, 383, 365, 96, -391, -40, -355, 232, 217, 144, 46, -47, 410, -87, 30, 281, -326, -223, 111}}},
+	{{-1, 70, {1, 1, 0, 0}, {10, 26, 7, 9}, 14764, 704375,
+		{-432, -24, -66, 113, -349, 242, -512, -404, -299, 477, 35, -442, -280, 679, 37, 513, 218, 338, 8, 923,
+		 173, -36, -54, -746, 95, 71, -659, -400, -14, -367, 239, 427, 356, 188, -430, 197, 695, 198, 404, -64}},
+	 {0, 77, {1, 1, 0, 1}, {0, 1, 22, 23}, 8602, 495394,
+		{360, -623, 335, -61, -1011, -179, 163, 1327, 529, 618, -168, -4, 886, -282, -148, -984, -454, 195, -287, -587,
+		 -929, -1, -75, 161, 483, 156, -22, 238, 712, -360, -130, 1178, 268, -523, -397, -89, 689, 177, 711, 531}}},
+	{{1, 64, {0, 1, 0, 1}, {0, 11, 17, 24}, 2720, 490393,
+		{308, -105, -56, -666, -493, 366, -746, 685, -47, 36, -187, 211, 112, -69, -429, 474, -18, 561, 66, 448,
+		 -947, 904, 272, 1159, -117, -66, -321, 45, -86, -811, -179, -332, -1368, -821, -324, -486, 647, -94, -1270, 97}},
+	 {0, 58, {0, 0, 1, 0}, {20, 1, 32, 3}, 7326, 633571,
+		{-86, -327, 558, 553, -310, -463, 639, -46, 75, 522, 303, -38, 555, 66, 64, 67, -404, -293, 432, 779,
+		 268, -45, 385, 564, 525, -212, 433, -68, 365, 228, 66, -91, -210, -259, 306, -531, 334, -1163, 131, -874}}},
+	{{-1, 71, {1, 1, 0, 0}, {15, 6, 27, 18}, 1268, 589692,
+		{1036, 162, 533, -249, -490, 484, -240, 569, 1, 775, -22, 332, -53, 521, -347, 62, -138, 236, -705, -751,
+		 256, -82, -582, 451, -917, 81, 20, -426, 437, 211, -433, 200, 224, 822, -407, 283, -22, -136, -412, -691}},
+	 {0, 98, {0, 0, 1, 0}, {0, 21, 2, 33}, 1154, 461941,
+		{-123, -765, 311, 833, -447, 855, -93, 581, 606, 780, -656, -342, -550, 32, 156, 622, 695, -1387, -727, -109,
+		 755, -919, 277, 535, 656, -610, 98, -516, -116, 50, 270, 832, -1047, 551, -741, -27, -91, -133, 135, -23}}},
+	{{1, 57, {1, 1, 0, 1}, {30, 6, 37, 8}, 5544, 470808,
+		{411, 140, 746, -425, 114, 218, -207, 277, -984, 9, 1111, -332, -833, 23, 1118, 306, 565, -762, -188, 145,
+		 140, 212, 267, 207, 962, 387, -79, -1042, -1063, 273, -200, -1044, 207, -640, 414, -821, 166, -306, 229, 649}},
+	 {0, 103, {0, 0, 0, 0}, {10, 31, 12, 9}, 2630, 566207,
+		{-1523, 834, -771, -674, 645, 147, -90, -545, 350, 67, 174, -321, 150, -428, 23, 0, 559, -316, -33, 928,
+		 -473, -107, 8, -95, 640, 197, 144, 513, 312, -426, -135, -318, 81, -442, 193, -30, 457, 663, -406, -157}}},
+	{{-1, 56, {0, 0, 1, 0}, {35, 1, 7, 14}, 444, 597105,
+		{-634, -71, -149, 314, -568, -588, 413, -475, -533, -626, 432, 239, -19, -183, 418, 410, -48, 227, 373, 548,
+		 -110, -418, 295, -369, -203, -72, -326, -807, -329, 243, 1068, -252, 26, 13, 895, 270, 348, -760, 689, -263}},
+	 {0, 103, {1, 0, 1, 0}, {10, 1, 22, 33}, 5866, 535969,
+		{-841, 683, 629, -203, 523, 535, 121, 82, 192, -796, -34, 206, -300, 272, 162, 171, 1097, -355, -313, 487,
+		 285, 393, 587, -380, -686, -554, -1232, -384, 742, -126, -140, -547, 475, -369, 281, -359, 47, -773, 29, 182}}},
+	{{1, 98, {0, 0, 1, 0}, {0, 31, 17, 19}, 9776, 526399,
+		{-176, 622, 155, -650, -866, -587, 1113, 556, 717, 475, -264, -573, 475, -286, 118, -455, 970, -312, 213, -112,
+		 664, -113, -493, -570, 583, -203, 50, 221, 725, 444, -720, -301, -444, -222, 271, -86, -878, -151, 461, -160}},
+	 {0, 68, {0, 0, 0, 1}, {25, 36, 32, 4}, 2926, 620984,
+		{86, -47, 498, -807, -345, -134, -141, 690, 343, -126, -685, -278, 104, 491, 404, -125, -40, 691, -460, 123,
+		 -1111, 476, 309, -44, -39, 356, -363, -116, 618, -179, 86, -603, -166, 405, -394, 541, -853, 62, 247, 246}}},
+	{{-1, 89, {0, 0, 1, 0}, {5, 1, 27, 3}, 14340, 513820,
+		{861, 463, -418, -596, -424, -767, 73, 719, 306, 20, 19, 465, 493, 262, -66, 692, 135, -551, -184, -138,
+		 -254, -373, 691, 25, -164, 1310, -3, 667, -105, -624, 296, -258, -591, 483, 50, 1344, -596, 21, -227, -669}},
+	 {0, 92, {1, 1, 0, 1}, {10, 6, 2, 24}, 210, 525954,
+		{-481, 937, -471, 703, -373, 685, 70, -396, 1112, -750, -62, -120, 388, -810, 159, -3, -1007, 507, 219, 465,
+		 -3, 127, 632, 262, 842, 100, 372, 410, 502, 936, 465, -113, 515, 77, -115, 227, 367, -431, -342, -104}}},
+	{{1, 59, {1, 1, 1, 1}, {20, 11, 37, 23}, 1080, 533636,
+		{-1038, 735, 122, -414, 569, 413, 48, 913, -161, -196, 199, -97, -154, -70, -451, -370, 588, -231, -364, -420,
+		 531, -169, 970, 779, 697, 118, -31, 665, 64, -908, 215, -760, 678, -173, 686, 86, 493, 273, 356, -379}},
+	 {0, 81, {1, 0, 1, 0}, {35, 21, 12, 29}, 2070, 503390,
+		{165, 134, -211, 187, -178, -761, -1530, 619, 86, -537, -194, 124, -65, 296, 215, -788, -121, 200, 207, 445,
+		 432, 201, 296, 749, -456, -727, -544, -386, 289, -22, 1273, -914, 105, 778, -399, -321, -494, 139, 74, 879}}},
+	{{-1, 42, {1, 0, 0, 1}, {35, 11, 7, 23}, 12236, 511109,
+		{563, 386, 400, 252, -411, 109, -77, -810, -904, 823, 437, 657, -406, -30, 408, -469, 573, 620, -166, 422,
+		 -529, -297, 253, 256, -126, 801, 127, -965, -268, -180, -30, -683, -953, -682, 804, 80, 377, 833, 583, -214}},
+	 {0, 65, {0, 0, 0, 1}, {20, 31, 22, 4}, 10810, 536448,
+		{-291, 285, -141, 255, 737, -454, -472, -52, -1466, 182, -452, 504, 266, 147, -79, -635, -721, 463, 1157, 113,
+		 691, -404, 186, 190, -104, -408, 78, -406, -548, 453, 323, -649, -127, 129, -105, 483, 645, -354, -692, 432}}},
+	{{1, 68, {0, 0, 0, 0}, {20, 1, 17, 18}, 14272, 442350,
+		{803, -130, -986, -835, -287, -972, 597, 739, -128, -565, -157, 490, -770, -447, -686, 976, -163, -104, 544, -873,
+		 1179, -562, -561, -963, 186, 229, -419, -316, -1096, 219, -52, -470, -105, 434, -486, 113, 597, -664, -695, -105}},
+	 {0, 78, {0, 1, 1, 1}, {25, 21, 32, 4}, 10302, 473232,
+		{-230, 897, 207, -222, 155, 346, -129, 298, -901, 914, 656, -109, -324, -469, -1536, 603, 348, 291, 465, -124,
+		 -419, 636, -1023, 780, -67, 52, 658, 245, -130, 589, 386, -195, -98, -827, 723, 486, 1055, -98, -381, -274}}},
+	{{-1, 43, {0, 1, 0, 0}, {15, 36, 27, 29}, 12564, 538155,
+		{166, -140, 416, -55, 145, 151, 1146, 220, -421, 921, 309, -1074, 6, 124, 463, -351, -1136, -194, 586, 851,
+		 -261, -31, 164, -26, -443, 99, -289, -424, 368, -826, 761, -341, -902, 264, -268, 221, -155, 299, 206, -272}},
+	 {0, 86, {1, 1, 1, 1}, {15, 6, 2, 14}, 15138, 595755,
+		{529, 39, -141, -235, 46, -1060, -192, 890, -86, 752, -404, 830, 647, -155, -775, -413, 195, -711, 741, 231,
+		 96, 110, 50, 204, -676, 258, 222, 16, -583, 247, 235, 181, -139, 75, 599, 185, -366, -256, -220, -482}}},
+	{{1, 61, {1, 1, 0, 0}, {25, 11, 37, 39}, 2248, 474692,
+		{-894, 490, 833, -475, 56, 281, 615, 964, 719, 807, 110, 578, 581, 22, -172, 929, 156, -28, -229, -33,
+		 466, 659, 449, -258, 489, 545, -184, -772, 735, 656, 430, -549, -330, 990, 245, -103, -660, -499, -229, 1080}},
+	 {0, 59, {1, 0, 0, 0}, {15, 31, 12, 13}, 5094, 513030,
+		{-43, 227, -266, 559, -338, -1389, 510, 783, -26, -348, 871, 80, -129, -236, 303, -528, 887, 485, 344, -527,
+		 464, -235, -32, 593, 136, 166, 201, -238, -607, 1174, 17, 50, -231, 231, 442, 435, -1294, -105, -62, 403}}},
+	{{-1, 92, {0, 0, 1, 1}, {5, 36, 7, 28}, 988, 588083,
+		{-680, 68, -723, -331, -133, 30, -192, 383, 381, -551, -206, 42, -672, 371, 261, -332, 290, -274, 183, 799,
+		 -315, -440, 74, -663, 583, -125, -580, -620, 938, 157, -753, 926, 236, -104, -447, -119, 527, 114, 340, 339}},
+	 {0, 91, {0, 0, 1, 0}, {20, 16, 22, 14}, 7050, 579071,
+		{219, -537, 841, 34, 400, 180, -338, 158, -92, -1312, 370, 123, 281, -403, 407, 439, -531, -167, 283, 84,
+		 546, -90, 512, -944, 438, -174, 68, 429, 683, -417, -535, 105, 767, -309, 749, 134, 180, -360, 338, 2}}},
+	{{1, 102, {1, 1, 1, 1}, {10, 11, 17, 13}, 16208, 483901,
+		{-594, -1083, 1385, -964, 477, 491, 520, -557, 235, 242, -634, -439, -806, 216, -27, 416, -88, -97, -221, 470,
+		 855, 325, 834, -275, 997, -564, -960, 227, 340, -206, 31, -70, -606, -135, 221, 368, -303, 159, 124, -505}},
+	 {0, 88, {0, 1, 0, 0}, {20, 6, 32, 8}, 13070, 568351,
+		{-777, -310, -573, 2, -89, 722, 931, 58, -328, -197, -540, 211, -472, 515, 132, 459, -7, -724, -123, 292,
+		 41, -332, -283, 220, 186, 157, 166, -779, 938, -795, -314, 365, -261, 910, -697, 70, 683, -362, 39, -130}}},
+	{{-1, 61, {1, 1, 1, 0}, {35, 1, 27, 14}, 12324, 498641,
+		{-280, 145, -295, -417, -574, -92, 163, 865, -387, 150, -434, -956, 279, -151, -40, -250, 402, 539, 835, -599,
+		 -20, 174, 653, 43, 1063, 800, 440, 654, 577, 371, 194, -304, 1596, -603, -83, -269, 22, -72, -393, 757}},
+	 {0, 80, {0, 1, 0, 0}, {15, 31, 2, 8}, 13170, 439800,
+		{603, 893, 22, 836, 40, -30, 402, 1112, -172, 934, -401, 205, -543, -309, 171, 161, -51, 847, 72, -42,
+		 1306, 1332, 836, 1130, -570, 120, -95, -417, 467, 797, 349, 947, -705, -223, -390, 104, 524, 646, 246, 124}}},
+	{{1, 63, {0, 1, 1, 1}, {5, 21, 37, 14}, 9048, 489586,
+		{-439, 685, 64, -863, 879, 76, -297, 175, 374, 202, 77, 414, -420, 41, 164, -660, -989, -921, -550, 539,
+		 713, 902, 1009, 425, -432, 388, -281, -488, 182, 99, -834, 870, -3, 545, 372, 405, -477, -320, -757, -349}},
+	 {0, 101, {0, 0, 1, 0}, {25, 26, 12, 33}, 11702, 440199,
+		{-1378, -1193, 342, 187, -1114, -457, 142, 204, -1265, -136, -473, -196, -297, 280, -481, 525, -256, -231, 120, 317,
+		 -1144, 377, 304, -306, -399, 570, -439, 702, 441, -678, 449, 783, -158, 731, -102, -1089, -150, -837, 466, -304}}},
+	{{-1, 78, {1, 1, 0, 0}, {35, 31, 7, 34}, 15852, 493610,
+		{-11, 253, -189, 358, 520, -569, -187, -735, 506, -910, 296, -325, 461, -260, 234, 54, -641, -153, 141, -624,
+		 -238, 433, -497, 203, 644, 476, -142, -1051, -41, 486, 692, 736, -247, -47, 983, 954, 28, -613, -295, -1419}},
+	 {0, 53, {1, 0, 0, 0}, {20, 6, 22, 28}, 10970, 462100,
+		{-591, -502, 1272, 412, -234, -1402, -756, 456, -1062, -413, -383, -171, -1, -97, 1365, 577, -637, -964, 394, 142,
+		 -408, 56, -226, 58, 172, -107, 19, -185, -431, 593, 103, -589, 341, -402, 28, -640, -582, 490, -720, -340}}},
+	{{1, 72, {0, 0, 0, 1}, {20, 36, 17, 9}, 15584, 480727,
+		{-15, -444, -155, 243, 144, -37, 115, 506, -1522, -431, 98, -544, 1133, -600, -720, 167, 427, -546, -289, 77,
+		 458, -267, 365, 212, -312, 1259, -292, -454, 679, -62, -214, -895, 357, -136, -423, 423, 772, 527, -921, -594}},
+	 {0, 98, {0, 1, 1, 0}, {10, 1, 32, 8}, 11230, 621087,
+		{-277, -342, -561, 122, 203, 226, -800, 227, 268, 379, 592, -597, 428, 115, 33, 212, -339, -52, 593, -420,
+		 525, -124, 738, 581, -562, -99, -46, -371, -530, 21, -221, -202, 111, -786, -813, -962, -177, 38, -284, -89}}},
+	{{-1, 79, {0, 1, 0, 1}, {30, 36, 27, 3}, 13620, 487948,
+		{289, -473, -1270, 1132, 235, -727, 965, -162, 150, 12, 95, 49, -480, 206, 730, -797, -117, 369, -204, -138,
+		 -299, 1011, -145, -536, -512, 86, -119, 571, 266, 664, -124, 621, 1013, 699, -162, 640, -321, 189, 793, 114}},
+	 {0, 74, {0, 0, 1, 1}, {10, 6, 2, 38}, 10690, 606141,
+		{-2, 172, -752, 74, -134, -64, 60, -498, -425, 53, -311, -205, 147, 9, -843, -73, -464, -194, -1022, -100,
+		 -212, -46, -850, -800, -119, 455, 187, -123, -699, 283, 551, 393, 98, -48, 244, -786, 734, 484, 288, -590}}},
+	{{1, 65, {1, 0, 0, 0}, {0, 1, 37, 33}, 5096, 521191,
+		{584, -471, 1143, -812, -289, 55, 126, -174, -427, -218, -668, -335, -340, 244, 299, 751, -30, -93, 465, 1038,
+		 -519, -207, 856, 12, 239, -1120, -66, -277, -314, 750, -251, 169, -132, 797, 811, 328, 275, 43, 562, 198}},
+	 {0, 79, {1, 1, 0, 0}, {35, 11, 12, 14}, 5510, 577201,
+		{-514, 227, 334, -161, 310, 756, 695, 160, -305, 356, 127, 64, 199, 53, 168, 65, -736, -1179, 816, -351,
+		 -40, -266, 25, -670, -783, 742, -671, 130, 105, 311, -246, 3, 66, -537, -238, -29, 634, -776, -133, 548}}},
+	{{-1, 64, {1, 1, 1, 0}, {0, 21, 7, 39}, 7676, 607925,
+		{267, -338, -304, -497, 269, 617, -830, 186, -272, 515, 1173, -188, -334, 382, -441, -593, -427, -296, -38, -7,
+		 -41, 19, 844, 36, -198, 301, 159, 558, 124, 40, 465, 25, -97, 770, -796, 483, 161, 445, -42, 398}},
+	 {0, 79, {1, 1, 1, 1}, {10, 16, 22, 38}, 6186, 514853,
+		{96, 132, -1154, 110, 116, 176, 66, -949, -23, -451, 103, -633, 189, -215, -21, 36, 242, -138, -816, -992,
+		 134, -734, 276, -643, -133, 47, 185, 57, 463, 667, -67, -938, -124, -920, -478, 978, -360, 916, -26, 687}}},
+	{{1, 42, {0, 1, 1, 0}, {5, 1, 17, 4}, 12400, 459593,
+		{-787, 1019, -744, -29, 507, 258, -874, 89, 490, 232, -267, -80, -328, 431, -461, -538, -921, -683, -942, 765,
+		 757, 476, 336, -269, 612, -190, -721, -566, -334, -631, -19, -640, -543, -849, 396, 23, -17, 694, -502, -1139}},
+	 {0, 44, {0, 0, 0, 1}, {0, 16, 32, 9}, 4782, 494984,
+		{503, 34, -525, 906, -248, 651, 564, 35, 120, -173, -300, -229, -439, 636, -555, -396, 121, 4, -203, -980,
+		 1290, -19, -778, 581, -6, 53, 278, -1347, 843, 222, -105, -106, 763, 486, -393, -306, 268, 847, 440, 103}}},
+	{{-1, 97, {1, 0, 1, 0}, {0, 21, 27, 28}, 68, 494667,
+		{82, 820, 819, 241, -243, -474, 734, -44, -89, 249, 616, -874, 1058, -85, -557, -711, 124, -450, 285, 955,
+		 -329, -336, -440, -482, -303, -253, -686, 1120, 204, 309, 61, -893, -346, -184, 263, 645, 97, 826, -78, 616}},
+	 {0, 68, {1, 1, 0, 0}, {0, 21, 2, 29}, 7698, 515020,
+		{1016, 690, -158, -216, 292, 118, -961, -99, -79, 411, -389, -655, -611, 31, -488, 678, 746, -508, -236, -198,
+		 -106, 328, 369, 1327, -605, -531, 301, 131, 783, -527, -438, -200, 476, -682, -314, 844, 8, 26, 163, -319}}},
+	{{1, 67, {0, 1, 1, 1}, {10, 11, 37, 8}, 6776, 583334,
+		{-129, -164, 231, -65, -634, -550, 93, 686, 108, -199, 180, -388, 563, 375, 490, -213, 217, -362, -1023, 185,
+		 -928, 148, 247, 296, 710, -653, 206, 118, 525, -207, -636, 165, -461, -48, 795, 435, 314, 846, 401, 418}},
+	 {0, 57, {1, 0, 1, 0}, {0, 6, 12, 34}, 2902, 550459,
+		{-778, 135, -546, 796, -417, -568, 375, 396, 39, 872, 367, 605, 592, 361, -56, -115, -296, -567, 128, -226,
+		 -63, -374, 409, 270, -247, 426, 785, -161, 178, 811, 234, 527, 186, 779, -222, -736, -733, 332, -581, 656}}},
+	{{-1, 50, {1, 0, 0, 0}, {20, 6, 7, 8}, 9228, 478600,
+		{408, 87, 213, 433, -630, 258, -328, 331, -163, -116, 122, -314, 271, -521, -483, -480, 1186, -447, -1633, 347,
+		 -492, 108, -254, -395, -153, -394, 1092, -144, -871, -415, -153, 586, 428, 43, 617, -763, 670, -42, 332, -1121}},
+	 {0, 41, {0, 1, 0, 0}, {0, 16, 22, 9}, 9082, 465739,
+		{-26, 598, 476, 920, -342, 563, 337, -731, -817, 367, 549, 17, -429, 524, -422, -418, -200, -504, -18, -1014,
+		 -644, -155, -797, 791, -735, 545, -201, 387, 549, 62, -276, 1360, 138, 1466, 512, 124, 78, 151, 117, 265}}},
+	{{1, 76, {0, 1, 0, 0}, {0, 36, 17, 3}, 6656, 571876,
+		{-608, -533, -125, 10, 286, -415, 370, -16, -131, -584, -448, -329, -325, 494, -1041, 605, -294, 261, 637, 740,
+		 -40, 251, -20, -438, 951, 466, 58, 657, 117, -120, 361, -73, 532, -481, 375, -578, 658, -619, 614, 164}},
+	 {0, 54, {1, 0, 1, 1}, {20, 16, 32, 9}, 10110, 470790,
+		{283, 50, 304, 563, 348, 1227, -864, 251, -4, 451, 625, 36, 253, 284, -351, -596, -419, -300, -206, -1131,
+		 -994, 749, 546, -35, -450, 357, 371, -378, -321, 574, -733, -114, 415, 886, -1228, -777, -800, -241, -92, 191}}},
+	{{-1, 51, {0, 1, 0, 1}, {30, 11, 27, 14}, 4436, 512804,
+		{-133, 185, 85, -786, 294, -612, -273, -1087, -336, 606, -150, -909, -485, 769, -60, 262, 357, -125, 1023, 376,
+		 -368, -538, -487, -1077, -614, 552, 20, 1021, -379, 587, -18, -496, -177, 77, 425, -510, -6, 48, -189, 469}},
+	 {0, 62, {0, 1, 1, 0}, {25, 11, 2, 19}, 4194, 408510,
+		{330, 656, -500, -1314, 551, 1285, 153, 3, 611, 217, -379, 647, 512, -1010, -46, 108, -260, 162, -386, -80,
+		 345, 151, -885, 1109, -1259, -21, -521, 89, 562, -352, -1340, -1090, -850, 180, -784, -382, -373, 553, 637, 679}}},
+	{{1, 69, {1, 1, 0, 0}, {35, 11, 37, 24}, 14088, 531493,
+		{239, 327, -370, 610, 613, 1078, 372, -63, 188, -508, -197, -513, 498, -1357, -31, -226, 9, 65, -1176, 284,
+		 -257, 688, -50, 1019, 214, -514, 277, -583, 396, 45, -197, 600, 291, -197, -446, -42, 409, 298, 40, -459}},
+	 {0, 99, {1, 0, 0, 0}, {35, 11, 12, 18}, 3878, 604802,
+		{-378, -188, 7, -272, 31, -76, -561, -880, -489, -379, -8, -367, 112, 437, -384, 241, -216, 326, 361, -1102,
+		 65, -202, -335, -302, -71, -633, 90, 83, 402, 567, -414, -973, -54, -696, -309, -396, 611, 696, 403, 276}}},
+	{{-1, 100, {1, 0, 1, 0}, {10, 1, 7, 13}, 4124, 629895,
+		{1181, -263, 82, -182, -384, -365, 37, -556, 66, -498, 471, 63, -539, -152, 362, 649, 359, -349, 220, 180,
+		 -310, -67, 47, -322, 1036, 184, -159, 681, 303, 402, -396, -397, 561, 77, -666, 30, -236, -281, -455, -88}},
+	 {0, 67, {1, 1, 1, 1}, {20, 6, 22, 19}, 3274, 528661,
+		{-188, 128, 786, -485, -327, 13, 311, -681, 909, -775, -325, 500, -62, -186, -608, 496, 342, 754, -28, -691,
+		 587, 511, -119, -503, -353, -405, 141, 38, 596, 56, 1266, -94, -152, 868, -330, -385, 477, 497, -37, 699}}},
+	{{1, 46, {0, 1, 1, 0}, {15, 31, 17, 38}, 14736, 558791,
+		{-245, -750, -90, -919, -774, 760, 5, -1088, -56, -65, 323, -522, 375, -155, -670, -243, 1029, -20, 608, -253,
+		 -140, -686, 63, 474, -62, -103, 253, 912, 241, -321, 156, 39, 255, 710, -230, -99, -18, -84, 633, -12}},
+	 {0, 64, {0, 0, 0, 0}, {35, 21, 32, 13}, 10830, 527916,
+		{344, -549, -380, 371, -312, -349, 804, 107, 153, -1076, 37, -572, -311, 340, -123, 380, 346, -707, 838, 405,
+		 -438, -123, -666, -1011, -613, 46, 487, -282, 843, -202, 199, 542, 348, -865, 8, -585, 460, -409, 424, 431}}},
+	{{-1, 69, {1, 0, 1, 0}, {30, 11, 27, 39}, 10340, 572760,
+		{-99, -74, -146, -156, 567, -375, -264, 38, -334, 827, 99, 201, -244, -50, -83, 331, -185, -448, -296, 430,
+		 865, 147, -542, 1008, -164, -315, -307, 19, -202, 728, 919, 21, -271, -310, -446, 504, 1163, -355, 716, -582}},
+	 {0, 56, {1, 0, 0, 1}, {5, 21, 2, 13}, 178, 495826,
+		{244, 838, -497, -403, -127, 619, -949, 65, 365, -273, -24, 374, 698, -300, 740, 522, -154, 24, 833, -1,
+		 -653, 189, -771, 339, -289, 705, -998, -504, -596, -986, 150, 28, 472, 234, -909, -111, -155, -753, -593, 613}}},
+	{{1, 71, {1, 0, 1, 0}, {35, 21, 37, 39}, 10648, 553401,
+		{-618, -278, -403, -578, 124, 73, -316, -628, -445, -377, -518, -453, 233, -602, 17, 969, 624, -92, 263, 568,
+		 726, -381, 222, 390, -995, -447, -108, 437, 579, -288, -725, 707, 330, 606, 417, 690, -208, 189, 248, -128}},
+	 {0, 77, {0, 1, 1, 0}, {30, 6, 12, 38}, 8438, 580557,
+		{431, 536, -825, -36, -137, -584, 191, 685, -608, -71, 1304, -35, 40, 25, -560, 366, -239, 218, -279, -162,
+		 -423, -6, 97, -81, 514, 379, 570, -929, 522, 347, 114, -656, 115, -100, 267, -288, -709, -452, -509, 177}}},
+	{{-1, 86, {0, 1, 0, 1}, {20, 16, 7, 19}, 8748, 548345,
+		{282, 402, 72, 475, 237, 540, -1014, 342, 159, 647, 429, 176, 50, 721, -209, -21, -92, -260, -366, 261,
+		 -777, 262, -44, 512, 553, -271, -777, 218, -196, 187, 505, -107, -466, -410, 732, -465, -767, -16, 1438, 170}},
+	 {0, 93, {1, 0, 0, 1}, {35, 6, 22, 33}, 5146, 586485,
+		{-134, 3, -479, -267, -97, 319, -267, 481, -221, -548, -726, 558, 520, -40, 190, -38, -436, 309, -589, -281,
+		 -15, -15, 519, 339, 245, -498, -580, 288, 346, -630, -304, 1100, 286, -921, 837, -295, 67, 163, 281, -827}}},
+	{{1, 80, {1, 0, 0, 0}, {0, 36, 17, 34}, 3872, 533622,
+		{46, -399, 130, 0, 1165, -568, 336, -313, 971, 1022, 255, -915, -22, 277, 397, 244, 232, -245, 252, 90,
+		 -825, -30, -182, 673, 389, -616, 121, 455, 292, 47, 647, -562, -94, -91, -138, 692, -767, -4, 836, -389}},
+	 {0, 74, {0, 1, 1, 0}, {5, 36, 32, 13}, 6942, 503741,
+		{-84, -485, 752, -949, 76, 275, 193, -652, -179, 620, 753, 252, -339, -988, 898, 229, -402, -963, -398, 813,
+		 142, 693, -61, -42, 271, -626, 371, -290, 495, 198, -636, -441, 816, -417, 1012, 15, 208, -425, 197, 56}}},
+	{{-1, 87, {0, 0, 0, 1}, {5, 1, 27, 28}, 1396, 511626,
+		{-586, -212, -129, -687, 832, 494, -518, -509, 171, -367, 84, -362, -11, -237, -369, -248, -224, -138, -343, -165,
+		 1066, 440, 676, -115, -235, -1061, 126, -96, 991, -35, -967, -110, -374, 448, -557, 1381, 276, 386, 334, 279}},
+	 {0, 50, {0, 0, 1, 1}, {20, 26, 2, 3}, 12034, 469673,
+		{-1033, -1067, 105, 211, 51, -599, 85, -169, 976, 734, 418, -196, -308, -142, 78, 640, 809, -665, -933, -731,
+		 229, 699, -569, 809, -510, -1168, -364, -370, -386, -636, 704, -174, 91, -263, -435, 375, -617, 461, 313, 251}}},
+	{{1, 73, {0, 1, 0, 0}, {10, 11, 37, 18}, 12840, 543922,
+		{117, 838, 388, 209, -308, -236, 843, -1265, 514, -573, -15, -466, -487, 337, -648, 556, -241, -64, -1058, -245,
+		 -282, 270, -219, 201, -100, 317, 843, 360, -205, -437, -430, -282, 425, -454, -456, 325, -768, -248, -257, -381}},
+	 {0, 55, {1, 1, 0, 0}, {20, 31, 12, 19}, 198, 547755,
+		{879, 4, -737, -288, -665, 213, 328, -799, -64, -507, -560, 321, -392, 406, -327, 514, -111, 390, 1, -222,
+		 -247, -41, -598, 163, 1250, -377, -78, -381, 282, -104, 27, -828, -77, -248, -285, -668, -341, 729, 1036, 101}}},
+	{{-1, 72, {1, 0, 1, 1}, {5, 16, 7, 24}, 6716, 554439,
+		{-496, -1245, -1099, 100, -46, 158, 359, -305, -139, -520, -262, 281, -265, 819, -404, -700, -422, 589, 447, 334,
+		 412, 328, -783, 313, 191, 546, 516, -765, -63, 221, -266, 174, -348, 375, -55, 568, 358, -14, 635, -93}},
+	 {0, 55, {1, 1, 1, 1}, {10, 26, 22, 3}, 14698, 518223,
+		{-119, -547, -505, -729, 605, 713, -117, -60, -878, 278, 112, 960, 38, 194, 1204, -227, -741, -561, -423, -39,
+		 -145, 571, -163, 502, -220, -504, -62, -654, 56, -716, 902, 79, -339, 449, 171, -373, -895, -83, 303, 552}}},
+	{{1, 50, {0, 1, 1, 1}, {5, 26, 17, 29}, 6832, 562000,
+		{10, -248, -235, -48, -1320, 975, 83, 6, 135, -139, 114, -227, 277, 508, -144, -749, 132, -158, -177, -534,
+		 722, 425, 13, 416, 1, 207, 428, 55, 15, 726, 554, -83, -258, 444, 393, -1020, 204, 899, -57, 826}},
+	 {0, 84, {1, 1, 0, 1}, {10, 26, 32, 14}, 14830, 558508,
+		{-232, -13, -140, 443, 233, -228, -395, 276, 1305, -860, -43, 716, -86, 141, 918, 741, 154, -299, -74, -163,
+		 -533, -130, 567, 54, -101, -378, 279, 366, -84, 1007, -424, -249, 540, 439, 504, 255, -275, -32, 505, 856}}},
+	{{-1, 41, {0, 0, 1, 1}, {0, 21, 27, 13}, 10372, 449464,
+		{199, 1049, 904, 438, -190, 203, -781, 89, -612, -162, 61, 219, 471, -560, 1384, 830, -15, 35, 114, -128,
+		 -20, 1109, 861, 931, -570, 104, -985, -91, 385, 90, 722, -632, -229, 45, 348, 842, -362, -545, -1081, 237}},
+	 {0, 44, {0, 0, 0, 1}, {30, 31, 2, 34}, 6994, 551706,
+		{337, -709, 539, 785, -195, 447, -72, -442, -374, 420, 180, 218, 310, -280, -239, -305, -189, 397, 717, 547,
+		 175, -111, -534, 216, 892, -266, -410, 748, -600, -70, -445, 97, -203, -545, -641, -715, 33, 867, 1052, 362}}},
+	{{1, 75, {1, 1, 1, 0}, {0, 21, 37, 33}, 4280, 665447,
+		{-372, -679, 212, -356, -429, 407, -502, 331, -263, 182, -479, -295, 128, 180, 279, 328, 230, 403, -274, 150,
+		 45, -175, -92, -315, 83, 1008, -709, -45, -166, -146, 433, -62, -704, 461, -760, 144, -505, 267, -706, 63}},
+	 {0, 97, {0, 1, 1, 0}, {0, 26, 12, 39}, 11926, 548985,
+		{199, -504, -497, 1277, 240, 9, 104, -467, 376, -407, -736, -578, 97, -726, 57, -82, 425, -438, -591, -513,
+		 338, -53, -630, -337, -166, -85, -574, 448, -1085, 492, 603, -208, 139, -372, -173, -255, 436, 397, -340, 817}}},
+	{{-1, 58, {1, 1, 0, 0}, {5, 16, 7, 33}, 14412, 554002,
+		{1149, -340, -614, -26, -465, -233, -195, 320, -62, -671, -321, -389, 308, -116, 1570, -107, -377, 406, -156, -368,
+		 441, -127, 135, 362, -308, 331, 393, 37, -578, -266, 108, 703, -879, 128, 302, -710, 323, -533, -47, -108}},
+	 {0, 81, {1, 0, 0, 1}, {15, 31, 22, 14}, 15546, 493119,
+		{623, -753, -59, -79, -13, 428, -6, -2, -808, 424, 910, -86, -740, -251, -381, 183, -319, 449, 215, -221,
+		 453, -34, 140, -1296, 42, 346, -608, -484, -530, -969, -491, -855, 275, 115, 1001, 149, -105, -496, -738, -1054}}},
+	{{1, 84, {1, 0, 0, 1}, {20, 1, 17, 28}, 7232, 514249,
+		{-1123, -552, 96, 215, 219, 14, 15, -387, 762, 293, -355, 772, 504, 283, 524, 618, -553, -526, -934, 177,
+		 149, -600, 393, 471, 564, 63, -105, -546, -846, -75, -378, 196, 17, -500, -428, -1397, 591, -190, 259, 305}},
+	 {0, 94, {0, 1, 1, 1}, {10, 11, 32, 14}, 1726, 487149,
+		{668, -413, 273, 196, 413, -580, -703, 76, 765, 884, -46, -459, -834, -627, -318, -387, 222, 517, 1043, 294,
+		 863, -290, -573, -466, -449, 534, -556, -617, -128, 431, 580, -161, 288, -601, 277, 392, -735, -1024, 581, 528}}},
+	{{-1, 59, {1, 0, 0, 1}, {5, 1, 27, 39}, 4500, 528016,
+		{-48, 382, 138, -109, -197, -479, 740, 38, 645, 163, -737, 152, 432, -250, -1223, 235, 186, -184, -204, -739,
+		 933, -149, 270, -208, 111, 365, 1225, -222, 282, 336, 99, -779, 932, -750, -546, -345, -497, 181, -200, -454}},
+	 {0, 102, {1, 0, 1, 1}, {30, 6, 2, 24}, 1442, 507040,
+		{515, -391, 37, -985, -96, 430, -654, -500, -356, 1090, 30, -688, 249, -457, 555, 1013, 181, -1141, -617, 1017,
+		 -46, 576, 100, -162, -434, 84, -368, 546, -469, -55, 29, 71, 359, 157, -247, 459, 1028, 210, -170, 176}}},
+	{{1, 77, {0, 1, 0, 0}, {5, 31, 37, 9}, 1352, 497537,
+		{-292, 36, -165, 543, 530, 211, 513, 830, 1065, 97, 392, -196, 287, 208, -530, 27, 246, 542, 309, 985,
+		 428, 589, -165, -904, 835, 347, 98, 1014, -583, 330, -440, 597, -240, 24, 271, -1133, -698, 455, -331, -590}},
+	 {0, 75, {0, 1, 0, 0}, {20, 31, 12, 23}, 10854, 486511,
+		{183, 805, 152, -1231, 272, 85, 800, 401, 456, -538, 1033, -942, 737, 470, -687, 370, 601, -473, 250, -269,
+		 -462, 727, 258, -301, -406, 488, 363, 788, -253, -680, 51, -588, -5, 809, 348, 181, -684, -167, 228, -491}}},
+	{{-1, 44, {0, 0, 1, 0}, {20, 26, 7, 38}, 15452, 680700,
+		{-670, 302, 247, -673, 773, 648, -374, 425, 135, 451, 508, -44, -22, -291, 335, -546, -212, 472, 129, -55,
+		 79, -334, -108, 403, 337, 365, 134, -194, -972, 7, 345, -312, -266, 130, 11, 51, -103, -804, 158, -131}},
+	 {0, 43, {0, 0, 1, 0}, {20, 36, 22, 24}, 7690, 464253,
+		{-211, -359, -421, -108, 1378, -1306, -704, 912, 246, -366, -124, 237, -533, 415, -215, 425, 575, 11, 45, 966,
+		 -524, 472, 658, -190, -760, -252, 86, 31, 381, -623, 379, 91, 849, -643, -1, -520, -1402, -310, -28, -268}}},
+	{{1, 54, {1, 0, 1, 0}, {15, 21, 17, 23}, 5072, 572714,
+		{-536, -545, -669, 534, 919, -1147, -126, -211, 37, 12, -384, -221, -108, -142, 95, -1030, -30, -71, -227, -592,
+		 -239, 223, -836, 71, 287, -794, 314, -67, -498, -52, 153, 20, 476, -109, 215, -182, 139, -967, 502, 353}},
+	 {0, 40, {1, 1, 0, 0}, {10, 31, 32, 18}, 398, 574123,
+		{-199, 108, -315, 1124, -663, -524, 549, -484, 506, -35, -26, 53, -278, 37, -506, 685, 571, -818, 135, -122,
+		 -533, 470, -153, -322, -4, -705, -344, 87, -404, 775, -952, 79, 317, -720, 73, 168, -403, 440, 169, -160}}},
+	{{-1, 77, {1, 0, 1, 1}, {25, 36, 27, 24}, 164, 504629,
+		{466, -421, -125, -23, 1068, -274, -819, -917, 103, 864, 504, -306, -383, -589, -254, 272, 124, 485, 493, 819,
+		 86, -520, 183, -715, -495, -22, 866, 280, -85, -67, -532, -806, -730, -657, -425, 637, -896, -254, 161, -1}},
+	 {0, 96, {1, 0, 0, 0}, {30, 6, 2, 18}, 11762, 618775,
+		{-243, 143, 392, 278, -422, -396, -380, -86, -250, 952, 225, 415, 275, 93, 157, 243, -385, 1121, -70, 424,
+		 -180, -570, -458, 444, 888, -374, 19, 305, 261, 175, -177, -1019, -15, 51, 492, 58, -450, -232, -24, -562}}},
+	{{1, 79, {1, 0, 1, 0}, {25, 1, 37, 24}, 4056, 560782,
+		{-413, 167, 26, 91, -247, 454, 49, -23, 144, -60, 295, 88, 758, 163, -258, -602, -451, -927, -76, -43,
+		 99, 768, -1205, -285, 362, -386, -63, -302, 336, -1315, 792, 416, 535, 27, 846, 335, 445, 58, 101, -35}},
+	 {0, 53, {0, 1, 1, 1}, {35, 21, 12, 3}, 13366, 745831,
+		{64, -423, -72, 637, -312, 185, 112, -498, -79, -134, 393, 510, 249, -358, 257, 79, 162, 27, 218, 255,
+		 -854, -5, -238, 528, 275, 572, -85, 384, -37, -292, 163, 337, -252, -35, 508, 385, 140, 317, 948, 18}}},
+	{{-1, 94, {1, 0, 0, 0}, {5, 11, 7, 4}, 9836, 531125,
+		{-65, -89, 205, 464, -686, 497, 79, -245, 1220, -484, -78, 549, -489, 38, -268, -224, -183, 17, -1001, -1030,
+		 -420, -37, 281, -843, 334, -122, -4, 335, 545, -240, 190, -566, -813, 123, -159, -988, 870, -571, -29, 95}},
+	 {0, 69, {0, 1, 0, 0}, {15, 6, 22, 38}, 7514, 503960,
+		{-829, 380, -310, -50, 424, 376, 606, -134, -20, -299, 851, -889, -111, -623, -1113, -269, 149, -1106, 348, -832,
+		 -262, -214, -912, -20, -322, -1017, 229, 121, -29, 67, -839, -411, 103, 480, -18, -78, 76, 220, -382, -930}}},
+	{{1, 88, {1, 1, 0, 0}, {20, 11, 17, 19}, 352, 553052,
+		{-21, -482, 287, -883, -1014, -715, -83, -748, 264, 299, 796, 122, 231, -510, -1174, -319, -603, 440, -359, -25,
+		 324, -433, -345, 494, -62, 453, -106, -300, -223, 28, 356, 155, 351, 338, 1043, -191, 126, 361, 417, -312}},
+	 {0, 50, {0, 0, 1, 0}, {0, 26, 32, 18}, 10846, 590303,
+		{-19, -244, -623, 412, -179, 708, -990, 901, -754, 733, 786, -563, -210, -171, 99, -394, -81, 46, 19, -130,
+		 -369, -154, 548, 743, -48, -257, -364, 175, 880, -777, 357, -296, -143, 336, 149, -160, -47, 8, 38, 73}}},
+	{{-1, 95, {1, 1, 0, 0}, {20, 16, 27, 13}, 13748, 567043,
+		{-53, 433, 372, -586, 789, -461, -81, 552, 64, 150, -55, 123, 330, -296, -60, -339, 53, 251, -1634, -320,
+		 -769, -259, 857, -334, -86, -288, 243, -379, -460, -862, 110, 55, 159, 69, -568, -54, -279, -57, 259, 828}},
+	 {0, 90, {0, 0, 1, 0}, {25, 1, 2, 8}, 5186, 516554,
+		{368, 126, -190, 732, 108, 274, -530, -480, -823, -249, 1019, 197, 645, 91, 871, 713, -94, -1264, -460, 558,
+		 30, -220, -416, 242, -517, 153, -531, 279, 311, -147, 729, 155, 980, 418, 294, 384, -560, -202, 722, -60}}},
+	{{1, 81, {1, 0, 0, 0}, {20, 31, 37, 3}, 12392, 575624,
+		{546, 483, 1041, 78, 57, 369, -616, 588, 303, -32, -514, 811, 262, -210, 837, -279, -68, -163, -661, -632,
+		 339, 107, 114, -250, 969, 90, 88, -155, 288, -728, -225, -861, 342, -297, -315, 194, 109, -155, -692, -64}},
+	 {0, 95, {1, 0, 0, 0}, {0, 6, 12, 24}, 3078, 533603,
+		{96, -347, 112, -1055, 280, 54, -167, -862, 561, 550, -351, -62, -87, 119, -950, 323, 386, -729, 82, 803,
+		 -70, 56, 699, 356, 83, 936, 387, 4, 331, 377, -340, -763, 676, 425, 52, 613, 604, -966, 29, 38}}},
+	{{-1, 80, {1, 0, 1, 0}, {10, 26, 7, 9}, 13948, 534217,
+		{-875, 792, -998, -455, 535, 83, 396, 100, -134, 877, -289, -402, 188, 104, -495, 89, -33, 322, 804, 35,
+		 225, -515, 534, 462, -60, -873, -791, -168, 646, 274, -101, -829, -727, -148, 46, 525, -85, -89, 160, 824}},
+	 {0, 95, {1, 0, 1, 0}, {5, 31, 22, 8}, 15018, 487869,
+		{50, 182, -496, 352, 1478, 98, 84, 189, -325, 367, -7, 377, 1295, -37, 253, -106, 196, 424, 354, -238,
+		 -552, -300, -218, -529, 77, -671, 75, 43, 545, 333, -817, -568, 342, 154, -332, -828, -534, 838, 1528, 289}}},
+	{{1, 58, {0, 0, 1, 1}, {5, 26, 17, 14}, 9456, 479765,
+		{-857, -619, 658, 829, 309, 28, 1424, 307, -348, -126, -145, 522, -270, -567, 45, -576, -479, 239, -52, 599,
+		 -465, 758, -438, -1075, 1310, -36, -1111, 36, -276, 419, -537, -166, -101, 73, -250, -143, -215, 464, -252, -409}},
+	 {0, 60, {0, 0, 0, 1}, {25, 36, 32, 19}, 302, 504991,
+		{-583, 324, -395, 876, -438, -211, 54, -1147, 314, 373, -426, -3, 139, 30, 215, 214, 571, -218, 951, 1038,
+		 76, 143, 248, 935, 700, 599, 664, -97, 909, -896, 153, -8, -323, -248, 761, 176, 590, 497, -70, 457}}},
+	{{-1, 49, {0, 1, 1, 1}, {35, 31, 27, 38}, 12484, 537462,
+		{700, 126, 349, -1029, 247, -784, -376, 94, 785, 323, 914, 672, -244, 373, -387, 195, -282, 392, -185, 197,
+		 -351, -646, -14, 168, 59, -691, -900, -406, 950, -257, -793, 13, 272, 146, -207, -113, 75, 516, 348, -782}},
+	 {0, 84, {0, 0, 0, 0}, {15, 36, 2, 39}, 14482, 595429,
+		{554, 836, 84, 122, -298, 648, 177, -401, 227, 301, 109, 451, 79, 305, -118, 120, 284, -362, -1018, 140,
+		 -696, -678, -29, 513, 213, 895, 287, 213, -63, -253, -68, -246, 14, -1048, -72, -866, 442, -468, -235, -109}}},
+	{{1, 83, {1, 0, 1, 0}, {30, 6, 37, 18}, 9976, 604801,
+		{281, -298, -447, 249, 160, 212, -713, 360, 262, 435, 1294, 182, -435, -655, -572, -283, 115, 16, -165, 499,
+		 -134, 398, -47, -542, -160, -19, 296, 176, -473, 299, -162, 95, -51, 1354, 117, -275, 596, -440, 107, 92}},
+	 {0, 73, {1, 0, 1, 1}, {5, 36, 12, 4}, 12758, 503386,
+		{-488, 265, 960, 94, -255, 458, -807, 78, 73, -278, -431, -865, 498, -405, -470, 335, -518, 75, -414, -928,
+		 611, 652, -773, 464, 299, 812, -525, -95, 596, 45, -180, -559, -36, -115, 260, -926, -571, -1202, -227, -174}}},
+	{{-1, 66, {0, 0, 0, 1}, {30, 1, 7, 18}, 11404, 595848,
+		{-286, 129, -33, -101, -940, 172, -190, -331, -601, 694, -380, -592, -807, 161, 423, -374, -532, 107, 169, 837,
+		 222, 22, -628, 479, 945, 416, 78, 602, 99, -245, -271, 180, -778, -427, -141, -273, 360, -128, 470, -247}},
+	 {0, 57, {0, 1, 0, 0}, {35, 6, 22, 19}, 13818, 515646,
+		{632, -184, -210, 330, 700, 677, 547, 599, 97, -671, 119, 195, -155, -130, 556, -368, -566, -262, -192, 956,
+		 -114, -553, -587, -439, 179, 19, -631, 53, 823, -1616, 190, -638, 284, -340, 338, 558, -416, 265, 327, 571}}},
+	{{1, 92, {1, 0, 0, 1}, {0, 26, 17, 13}, 16000, 559609,
+		{-1254, 325, -323, -220, 24, -709, -980, 138, -9, 18, 122, 209, -331, 456, 425, -9, -428, 95, -585, 510,
+		 -302, -43, -858, 228, 49, -468, 116, -853, 623, -158, -733, -687, -114, -135, 177, 216, 396, -913, 288, 318}},
+	 {0, 70, {1, 1, 1, 1}, {5, 36, 32, 19}, 1534, 447624,
+		{-611, 20, 114, -811, -162, 557, 354, -739, -130, 677, -333, 1478, -1, -642, -413, -306, 223, -842, 116, 55,
+		 -992, 79, -284, -1, -64, 71, 437, -472, -63, 672, 741, -336, 33, -1704, 1142, 409, 226, 625, 102, -799}}},
+	{{-1, 67, {1, 0, 0, 0}, {20, 6, 27, 24}, 12756, 457538,
+		{933, -573, -449, 952, -304, -474, 89, 523, 474, -408, -428, 573, 1221, -885, 558, 592, -113, 653, 489, -446,
+		 -454, 112, -637, 533, 196, 50, 254, 967, -721, 469, 88, 858, 377, 855, -109, -820, -92, -326, 173, -993}},
+	 {0, 78, {1, 0, 1, 0}, {0, 1, 2, 29}, 6882, 556117,
+		{60, 482, 446, -1296, 153, -41, 459, -619, 85, 299, -201, -103, -654, 992, 4, 254, -530, -12, 48, 450,
+		 -53, -1175, -67, -25, 263, -963, -343, -149, -604, -398, 246, -432, 416, 6, 162, -364, 253, 763, -81, -455}}},
+	{{1, 85, {0, 0, 0, 1}, {15, 21, 37, 34}, 13192, 527657,
+		{585, -383, 936, 860, 319, -272, -1010, 59, -234, 574, 853, 505, -564, -915, -133, -360, 355, -133, -382, -490,
+		 473, -150, 616, -395, -208, -968, -209, -77, 358, -25, 213, 466, 125, -395, -164, 208, -397, -1052, 194, -337}},
+	 {0, 51, {1, 1, 0, 0}, {5, 1, 12, 28}, 9638, 517505,
+		{616, 646, -343, -782, -639, 630, 497, 530, -263, 711, 922, -109, 210, 887, 418, -653, 266, -376, -501, -76,
+		 -605, -8, -301, 84, 155, -567, -1028, -171, 500, 1017, -124, -843, -84, -374, 365, 118, 453, 378, -75, 150}}},
+	{{-1, 52, {1, 0, 1, 1}, {25, 21, 7, 23}, 2204, 514089,
+		{935, 739, -740, -780, -246, -3, 111, 254, 1100, -776, -95, -279, -145, -46, 692, -333, 113, 141, 422, 606,
+		 340, 295, 121, -1048, 534, -94, 299, -173, 697, -4, 446, 157, -197, -969, -464, -56, -98, 81, -893, -814}},
+	 {0, 83, {1, 1, 1, 1}, {15, 16, 22, 29}, 3914, 535114,
+		{150, -462, -732, 141, -117, -705, -311, 329, 479, -85, -51, -154, 404, -648, 562, 226, -344, -348, -10, -577,
+		 797, 817, -741, -5, 241, 285, 927, -104, 1062, 618, -124, 148, -838, 278, 200, -783, -337, 291, -147, -851}}},
+	{{1, 62, {0, 1, 1, 0}, {15, 31, 17, 8}, 3600, 655196,
+		{-443, 44, 672, -189, -76, -110, 639, 538, 2, -39, -195, 464, -207, -769, -292, 103, 319, -762, 346, -35,
+		 558, -532, 185, 52, -4, -77, -265, 874, -341, 89, 22, -639, -455, 480, 532, -393, 168, -442, 243, 590}},
+	 {0, 80, {1, 0, 0, 0}, {20, 36, 32, 23}, 14542, 543598,
+		{-358, -387, 134, 213, -118, 197, 166, -179, -293, 366, -217, 38, -373, -394, 7, -674, 156, 991, -184, 247,
+		 -1268, 935, -792, -785, 477, -48, 233, 328, -243, 88, 329, -512, 158, -191, -1014, 281, -370, -887, -726, 145}}},
+	{{-1, 85, {1, 0, 1, 0}, {20, 36, 27, 9}, 14564, 516224,
+		{-121, 128, -744, -530, 417, -301, 546, 1072, 412, -763, -243, 83, -138, 280, 471, -427, 305, 266, -382, -968,
+		 -309, -291, -244, -1030, 582, 655, -137, -99, 928, 34, -1087, -225, 731, -108, -20, 130, -523, 231, -522, -572}},
+	 {0, 72, {0, 0, 0, 1}, {20, 31, 2, 23}, 15154, 574950,
+		{-858, 344, 129, -193, 179, -515, 61, -877, -481, -511, -166, -696, -276, -154, -42, -164, 792, 554, 435, -303,
+		 -347, 79, 239, -603, 401, -45, 396, 474, -34, -328, 392, -146, 394, 764, 741, 611, 663, 161, 929, 183}}},
+	{{1, 87, {1, 1, 1, 0}, {15, 36, 37, 9}, 5656, 524581,
+		{688, 484, -185, 632, 278, 195, -738, -58, -931, 129, -44, 501, 131, 288, 363, -253, 394, 158, -31, 242,
+		 368, -1283, -712, -576, 55, -453, -658, 367, -35, -422, -379, 1021, -412, 856, -389, -148, 458, -713, 338, -582}},
+	 {0, 93, {0, 1, 1, 1}, {35, 31, 12, 8}, 10102, 501644,
+		{-431, 26, 41, 670, -103, 826, -607, -785, -190, -1349, 378, -609, 330, -357, 434, 688, 435, 1244, 75, -480,
+		 123, 892, -189, -15, -604, -899, 156, 33, -212, 477, -940, 178, -235, -98, 109, -94, -675, -66, 229, -269}}},
+	{{-1, 102, {1, 0, 0, 0}, {30, 21, 7, 29}, 2732, 489654,
+		{-28, 316, 722, -699, 823, -698, -492, 576, 105, -207, -201, -230, 892, -261, 57, -43, 622, 166, 284, 1135,
+		 321, -464, 990, -790, -13, 411, 129, -188, 134, -795, -1277, -129, -776, 16, -154, -615, -693, -230, -88, -620}},
+	 {0, 45, {0, 0, 0, 0}, {35, 36, 22, 3}, 1690, 462218,
+		{396, 117, -269, 1063, -207, -1231, 327, 147, 53, -178, 252, 96, 154, 202, 16, 396, -418, 423, -891, 25,
+		 387, 483, 601, 1029, -505, -1152, -626, -686, 492, 1148, -478, 510, -720, -807, 535, 523, 469, -363, 363, -649}}},
+	{{1, 96, {0, 0, 0, 0}, {0, 6, 17, 4}, 5024, 524056,
+		{808, 843, 316, -358, -249, 546, 906, -287, -59, -552, 185, -505, -156, -913, -1337, 14, -30, -539, -74, 244,
+		 321, 60, -124, 187, 895, -654, 51, 353, -354, -119, -63, -280, -356, -385, -464, -690, 379, 598, -642, 661}},
+	 {0, 90, {1, 1, 1, 0}, {30, 6, 32, 23}, 6558, 565401,
+		{-594, 381, -78, -403, 462, 501, 259, -234, 1103, -306, 179, -482, -721, 6, -828, -121, 112, 415, 308, 335,
+		 -496, 407, -507, 376, 17, 496, -203, 0, 113, 168, 710, 233, 818, -575, -330, -463, 82, -1223, -249, -38}}},
+	{{-1, 103, {0, 0, 0, 0}, {35, 11, 27, 38}, 1524, 603004,
+		{352, -74, -791, -101, -406, -8, 228, -51, 1365, -485, 190, -32, 31, -483, 121, -558, 202, -512, -493, 421,
+		 -172, -574, 398, -681, 447, -155, 232, 234, -503, 743, 35, 92, -460, 74, 317, 431, 574, 396, 568, -287}},
+	 {0, 66, {0, 0, 1, 1}, {35, 11, 2, 13}, 6530, 521116,
+		{105, 167, -101, 1125, -475, -1029, 263, -407, 322, 176, 980, -50, 446, 196, 512, -366, -613, 569, -627, 183,
+		 -297, -755, -391, -965, -140, -702, 710, 288, -144, 214, -910, -156, 205, 459, -641, 265, 393, 31, -533, 13}}},
+	{{1, 89, {0, 0, 0, 1}, {30, 31, 37, 28}, 3752, 582873,
+		{335, 0, 30, -1205, 294, 334, 357, 265, -36, 381, -629, 424, 371, -373, 146, 806, -1047, 634, 632, 389,
+		 -192, -184, -705, 195, -138, -265, -795, 226, 141, -123, 364, 480, 131, 756, 210, 447, -166, 322, -231, 125}},
+	 {0, 71, {0, 0, 0, 0}, {25, 16, 12, 29}, 14150, 559038,
+		{-303, -314, -703, -926, 73, -745, 746, -29, -990, -57, 242, 451, -422, -296, 347, -508, 243, 72, 35, 164,
+		 491, 25, -180, 421, 324, -439, 212, -763, -772, 730, -323, 198, -747, -54, -251, -794, 397, 283, -82, -665}}},
+	{{-1, 88, {1, 0, 1, 0}, {15, 11, 7, 34}, 12988, 543465,
+		{154, 141, 511, 398, 476, -120, 817, 377, -257, 98, -956, 323, 1, -227, -202, -274, -284, -73, 9, 1144,
+		 -90, -462, 187, -29, 1097, 140, 334, -723, 203, 199, -64, -936, -210, -287, 531, 866, 880, 220, -443, 589}},
+	 {0, 71, {1, 0, 1, 1}, {5, 31, 22, 13}, 7146, 565935,
+		{-421, 271, -615, -743, -337, -133, -355, -714, -412, -184, -254, 690, 376, 116, 198, 399, 493, -767, 1003, 459,
+		 -63, -275, -401, 360, 758, 570, 84, 612, -118, 230, -104, -831, -641, -269, 573, 125, -301, 607, -447, -102}}},
+	{{1, 66, {0, 0, 1, 0}, {5, 1, 17, 39}, 3888, 559819,
+		{196, -94, -113, 42, 274, 489, 77, -32, 65, 271, 1004, 119, 79, -234, 106, -531, -194, -516, -55, -956,
+		 -756, -1085, -505, 378, 443, -919, -730, 401, -695, 496, 804, 135, -584, 86, 3, 94, 262, 413, 449, 276}},
+	 {0, 100, {1, 1, 0, 1}, {35, 36, 32, 24}, 10350, 679930,
+		{-38, 533, -266, -867, 299, 190, 375, 374, 219, 454, 599, 174, 236, 303, -104, 71, 348, 247, -200, 63,
+		 -467, 288, -199, 152, -675, -88, -615, -688, 750, 657, 90, 105, -290, -39, 378, -31, 815, -126, 251, -70}}},
+	{{-1, 57, {1, 0, 1, 0}, {30, 16, 27, 23}, 6404, 532450,
+		{561, -413, 178, 448, 44, -363, -611, -29, 6, -344, -409, -539, -63, -358, 274, -56, 347, 109, -612, 394,
+		 726, 31, -505, 301, 48, -78, -431, -849, -661, -220, 636, 18, -379, 1143, 134, 852, 896, 425, -911, -905}},
+	 {0, 60, {0, 1, 0, 0}, {5, 36, 2, 4}, 13778, 535385,
+		{131, -307, 525, 867, -529, -815, -726, 536, -324, 54, 422, 556, -280, -262, -125, -95, -395, 287, 703, -395,
+		 353, -861, 348, -342, -82, -120, 344, -450, 346, 460, 181, -205, 103, 369, -143, -121, -1325, 629, 910, -708}}},
+	{{1, 91, {0, 1, 1, 0}, {20, 11, 37, 3}, 7480, 484101,
+		{294, 467, 302, 1238, -915, -111, -28, -251, 659, 48, 379, 1043, 410, -82, -1039, -1022, 384, 13, -1208, 208,
+		 -953, 331, -130, -385, -19, -150, 149, 269, -908, 104, -373, -388, 474, 71, -670, 202, 545, 261, -232, -519}},
+	 {0, 49, {0, 0, 1, 1}, {10, 6, 12, 9}, 5398, 565822,
+		{233, -118, 241, 319, -366, -245, 1226, -529, 154, -277, 258, 256, 259, 300, 411, 112, -53, -564, 659, -447,
+		 -780, 205, 492, -399, 636, 557, -604, -254, -411, -18, -67, 498, -1363, 14, 53, -701, -170, -369, 270, -269}}},
+	{{-1, 74, {0, 0, 0, 0}, {15, 1, 7, 3}, 204, 552524,
+		{199, -42, 932, 208, -7, -63, 711, -86, -756, 395, -55, 101, -514, -202, -340, -769, 209, 704, 366, -646,
+		 387, 555, 529, 468, -490, 373, 147, -497, -376, 160, 758, 41, 731, -86, -200, 1060, -755, -363, 347, -514}},
+	 {0, 97, {0, 0, 0, 1}, {10, 16, 22, 24}, 3898, 493704,
+		{1, 257, 23, 611, 261, -226, 460, 48, 362, 666, 224, -1188, -210, -1161, -683, 489, 83, -77, -215, -43,
+		 215, -176, 94, -734, -324, 76, 242, -562, 0, 1193, -281, -1061, -859, 101, 1083, 839, 169, 386, -272, -492}}},
+	{{1, 100, {0, 1, 0, 0}, {20, 26, 17, 38}, 192, 652986,
+		{535, -462, -358, 753, 213, -24, -55, 535, -396, 127, -553, 30, 242, -11, 198, 772, 81, -436, -364, -309,
+		 -369, 386, -189, -655, -82, 409, -303, -264, 428, 143, -192, -162, -373, 102, -370, 165, 1097, -740, -323, -309}},
+	 {0, 46, {0, 0, 1, 1}, {0, 21, 32, 24}, 9534, 552293,
+		{542, 325, 339, -410, 671, 30, -253, -658, -129, 342, -236, 215, 192, 239, -636, 671, -416, 743, -939, 200,
+		 97, -192, 389, -688, 193, -520, 790, 57, 898, -239, -250, -639, -350, -375, -169, 810, 35, -414, 519, 818}}},
+	{{-1, 75, {1, 1, 0, 1}, {35, 26, 27, 9}, 12820, 578466,
+		{-262, 392, 372, 349, -539, -85, 334, -656, -849, 941, 265, -158, 858, 400, 675, -203, -28, -174, -482, -281,
+		 79, 245, 888, 122, 153, -393, -333, -1044, 196, -38, 461, 319, -306, 796, -312, 113, 185, 63, -606, -124}},
+	 {0, 54, {0, 0, 1, 1}, {10, 31, 2, 34}, 4130, 580297,
+		{-11, -309, 215, -711, 274, 384, -92, 158, 398, 404, 464, 354, 363, 777, -163, 391, 679, 989, -439, 779,
+		 324, 18, 150, -16, -192, -602, 66, -972, 157, -357, 335, 473, -167, -273, 955, 733, -138, -348, 392, -190}}},
+	{{1, 93, {0, 1, 0, 1}, {25, 26, 37, 19}, 456, 469180,
+		{-202, -418, -139, 25, 492, -883, -101, 184, -125, 411, 1186, 566, 1017, -630, 136, 661, -688, -424, -177, 467,
+		 -122, 1031, -779, 1010, 157, 149, 380, 240, -365, 516, -798, 719, -662, -942, -727, 397, -224, -639, 79, 300}},
+	 {0, 91, {1, 0, 0, 0}, {25, 6, 12, 33}, 230, 613334,
+		{409, -153, -454, -973, 370, 23, 578, 531, 426, 296, 171, 84, 67, -872, -653, 244, -197, 617, 156, -11,
+		 148, -359, 36, -171, -436, 298, 525, 278, 613, 538, 85, 310, -803, 363, -258, -585, -74, 283, 518, 663}}},
+	{{-1, 60, {0, 1, 1, 0}, {30, 36, 7, 8}, 13532, 487628,
+		{-660, 536, -319, 521, 655, -270, 468, -557, -111, -83, 198, 382, 116, 583, -1127, -760, 822, -318, -437, -909,
+		 -1063, 284, 734, -67, 1115, 343, 336, -280, 190, -143, 419, -14, 768, -660, -43, -803, -733, -186, -24, -89}},
+	 {0, 59, {0, 0, 1, 0}, {15, 36, 22, 34}, 8330, 519756,
+		{895, -693, -147, -762, 308, 792, 466, 642, -440, 68, -106, 863, -323, -303, -325, -613, -367, 189, 319, -712,
+		 454, 10, 292, 564, -422, -330, 104, 145, 591, -317, -1267, -435, -605, 47, 785, -150, 88, -772, 118, 486}}},
+	{{1, 70, {1, 1, 1, 1}, {15, 11, 17, 33}, 10320, 564645,
+		{-990, -519, 349, -16, -175, -225, 252, 647, 351, -730, -1158, -3, 78, 12, -807, -428, -484, -45, -233, -118,
+		 203, -391, 54, 417, 89, -512, -460, -873, 200, 614, 275, 110, 22, 429, 209, -732, 69, 979, -144, -325}},
+	 {0, 56, {1, 1, 0, 0}, {35, 36, 32, 28}, 4110, 497476,
+		{-645, -1010, -57, 710, -213, 790, -345, -2, 316, -385, -24, 407, -84, 583, 392, 399, -387, 624, -119, -24,
+		 -595, 248, 489, 672, 318, -31, -342, -71, 302, -215, -54, 817, -641, 722, 1355, -246, -465, 1242, -725, -190}}},
+	{{-1, 93, {1, 0, 1, 0}, {15, 11, 27, 34}, 4388, 527068,
+		{188, 37, 45, -1165, 150, 56, 759, -139, 81, 42, -94, -680, -21, 509, -468, -230, 358, -593, 663, -1347,
+		 192, -190, -287, 575, -5, 180, 268, -606, 277, 7, -234, -284, 16, -1223, 769, 519, 234, 588, -309, 777}},
+	 {0, 48, {1, 0, 0, 0}, {10, 6, 2, 28}, 10354, 541177,
+		{447, -607, -262, -280, -372, 262, 374, 252, 184, -566, 851, -399, -443, -17, 655, -699, 305, -141, 300, -134,
+		 -130, 600, 296, -242, 298, -356, -379, -1021, 55, 65, 321, 87, 163, 325, 862, 1036, 624, -86, 218, 1312}}},
+	{{1, 95, {1, 0, 1, 1}, {5, 6, 37, 34}, 15448, 464247,
+		{637, -351, -12, 1045, -349, -192, -117, 803, -86, 702, 1, 274, 400, 285, -168, -544, 1111, 603, -626, -113,
+		 509, 634, -347, 29, -892, -136, 155, 908, 490, 343, -654, 986, -1487, -491, 808, -247, 343, -76, 447, 279}},
+	 {0, 69, {1, 1, 1, 1}, {0, 36, 12, 13}, 15030, 540083,
+		{-542, 347, -486, 575, 490, 315, 82, -176, 83, 380, -277, 1216, -229, 28, 483, -879, 580, 285, -196, -319,
+		 972, 125, 756, -1198, -75, -450, 269, 66, -515, -418, -123, -621, 166, 223, 94, -189, 430, -577, -106, -684}}},
+	{{-1, 46, {0, 0, 0, 1}, {20, 11, 7, 14}, 3820, 582898,
+		{393, 81, 87, 58, -356, 539, 345, -267, -114, 454, -964, 399, 97, -688, -770, 1034, -237, 187, -95, 612,
+		 -90, 5, -989, 671, 536, 304, 134, 185, 107, 58, 200, 180, 669, -219, 235, -370, -848, -17, -275, 585}},
+	 {0, 85, {1, 1, 0, 1}, {10, 21, 22, 8}, 4058, 648330,
+		{-555, 750, 156, 0, 58, -406, 432, 300, -2, -185, 37, -71, -221, 387, -7, 933, -89, -736, -210, 754,
+		 396, 28, 450, -98, -304, 633, -585, -85, -651, 53, -245, 279, 377, 338, -64, -28, 222, -50, -1068, 16}}},
+	{{1, 40, {0, 1, 0, 1}, {25, 11, 17, 29}, 1504, 554336,
+		{-27, -520, 729, 39, -124, -369, 231, 1070, 514, 5, -42, 1300, -159, -932, -604, 731, -97, -110, 83, -639,
+		 -322, 425, -31, 264, 188, -353, 80, -146, -613, -394, -610, -331, 345, 812, 461, 219, -520, -317, -293, -30}},
+	 {0, 66, {1, 1, 1, 0}, {25, 26, 32, 28}, 10462, 557035,
+		{751, -146, 339, 190, -561, 166, 356, 39, -240, -961, -44, 495, 176, 567, -347, 24, -335, -368, -43, -352,
+		 785, -184, -154, 905, -46, -415, -170, -303, -270, 473, -89, -1414, 627, -590, 599, 130, 83, -534, -664, -277}}},
+	{{-1, 47, {0, 0, 0, 1}, {15, 21, 27, 23}, 13876, 492753,
+		{117, -197, -34, -256, 831, 829, -103, -782, 490, 288, 307, 709, 1140, 226, 686, 631, 223, 645, -504, 1034,
+		 297, 7, -701, 380, -172, -662, 605, 719, 350, 684, 344, 513, 329, -49, 562, 788, 275, -303, 749, 6}},
+	 {0, 42, {1, 1, 1, 0}, {5, 16, 2, 18}, 16066, 473191,
+		{-798, 80, -140, -146, 862, 100, -96, 1074, 1339, 1497, 301, 599, -393, 173, -999, 475, 276, 738, 1126, -320,
+		 -240, -394, 18, 260, 621, 875, -225, -343, 297, -65, -117, -83, 326, -140, 344, 530, -318, 136, 132, -42}}},
+	{{1, 97, {0, 1, 0, 1}, {0, 6, 37, 13}, 3304, 444190,
+		{-4, 413, -1109, -56, -1133, -341, 178, 326, 1033, 1178, 152, -91, 352, -664, -161, 227, -106, -745, 773, -254,
+		 685, 421, 396, 0, -349, -748, -270, -1057, -1158, -670, 313, -355, -720, -879, 607, -452, -569, -353, -410, -326}},
+	 {0, 47, {0, 0, 0, 0}, {10, 21, 12, 34}, 646, 525818,
+		{194, -409, 914, -925, -262, 376, -5, -348, -621, 744, -317, -188, 139, -327, 492, 581, -540, 745, -140, 421,
+		 924, -134, -1187, -154, -587, 618, -603, 390, -979, 443, 78, 7, 262, -149, -170, -281, -450, -132, 191, -472}}},
+	{{-1, 96, {1, 1, 1, 1}, {20, 11, 7, 19}, 3836, 482694,
+		{31, 386, -156, -413, -223, 61, -426, 14, 4, 215, -215, 408, 710, -174, -549, -253, -151, 428, 622, 589,
+		 -533, 999, 1248, 376, -434, -511, -1229, -382, -880, 508, 869, -147, -845, -1066, -136, -457, -331, -623, 362, -286}},
+	 {0, 47, {1, 1, 1, 0}, {5, 26, 22, 18}, 7466, 553672,
+		{4, 744, 1186, -430, -744, 532, -922, 303, -115, -351, -117, -149, 865, -371, 15, -248, 150, -38, -12, 4,
+		 -214, 134, -712, -415, 287, -877, -547, 541, 115, -513, -31, 314, 296, -308, -186, -74, -1220, 248, 10, -109}}},
+	{{1, 74, {0, 1, 1, 0}, {5, 31, 17, 24}, 6512, 514349,
+		{609, -721, -500, 151, 111, -714, 138, 525, 350, -484, 489, 612, 300, -29, -473, 410, -37, -375, -186, -591,
+		 361, -496, 324, 679, 984, -394, -989, -386, -218, -67, -1055, 308, 341, -29, -896, 715, 99, 746, -2, -703}},
+	 {0, 76, {1, 0, 0, 1}, {10, 36, 32, 29}, 12206, 582681,
+		{379, 102, 247, -690, 396, -49, 56, -281, 508, 407, 984, -289, -307, -576, -39, -200, -515, 72, -455, -16,
+		 -114, -719, -774, -759, -130, -391, 26, -383, 463, -990, -101, 602, 127, -470, 891, -366, 400, -365, -68, 299}}},
+	{{-1, 65, {0, 0, 1, 1}, {25, 21, 27, 8}, 8516, 491447,
+		{-218, 968, -633, -763, 737, -70, 50, -280, 123, 397, 188, -1366, -10, -193, 807, 589, 336, -302, 369, 975,
+		 1163, 68, 412, -206, -91, 919, 422, -396, 672, -823, -111, -105, -134, -36, -165, -359, -459, 206, -762, -132}},
+	 {0, 100, {1, 1, 0, 1}, {30, 26, 2, 9}, 4882, 484771,
+		{604, -1066, -186, -52, -376, -870, -221, -191, -491, -321, -417, -1003, 257, 579, 252, -950, 334, 296, 248, 478,
+		 -262, 364, -939, 723, 519, 785, -751, -729, 627, 21, 814, -804, -448, 122, 170, -16, -660, -450, -121, -411}}},
+	{{1, 99, {1, 0, 1, 1}, {10, 26, 37, 28}, 13176, 465138,
+		{-333, 80, 1435, -461, -70, 462, 1041, 34, -608, 1069, 360, -272, -921, -149, -98, -865, 525, 394, -331, 301,
+		 660, 648, 683, -356, 506, 615, 386, -790, 65, 293, -200, 25, 871, 708, 463, -473, 366, -190, 837, 278}},
+	 {0, 89, {1, 1, 1, 1}, {10, 6, 12, 14}, 6230, 629725,
+		{-198, -117, 418, -608, -1117, -52, 571, -240, -405, 108, -205, -799, -108, -147, 140, -239, 284, -307, 580, -606,
+		 -251, 142, -419, 146, -179, 174, 213, 483, -522, 303, -1106, -109, 254, 527, -282, -92, 103, 336, 639, 20}}},
+	{{-1, 82, {0, 1, 0, 0}, {0, 16, 7, 28}, 13580, 573303,
+		{556, 171, -791, -635, -738, 86, 460, -481, -15, 480, 654, -358, 163, 331, 305, 244, -202, 661, -77, 303,
+		 424, -64, -490, 329, 507, 202, 600, 324, -467, -587, -389, 286, 64, 639, -899, -295, 50, -726, 96, -909}},
+	 {0, 73, {1, 0, 0, 0}, {30, 16, 22, 29}, 2170, 491783,
+		{266, 58, -384, 252, 206, -1257, -267, -631, -13, -173, -311, -651, 119, 240, -2, 194, 1116, -20, -878, -658,
+		 -608, -439, 647, 379, 69, 517, -37, -281, 73, 802, -1392, 436, 942, -610, -348, -32, 626, 379, -487, -147}}},
+	{{1, 44, {0, 1, 0, 0}, {5, 1, 17, 23}, 8960, 469623,
+		{660, -353, -521, -450, -750, -1003, 230, 804, 113, 1132, -844, 747, 175, -606, -669, -111, -1074, -71, -271, -744,
+		 -564, -337, 352, 382, 171, 134, -1362, -315, 617, -196, 221, 235, 264, 723, 491, -14, -378, -183, -38, -552}},
+	 {0, 86, {0, 0, 1, 1}, {30, 36, 32, 29}, 9342, 578801,
+		{543, -522, -588, 375, -160, -113, -988, 831, 256, -633, 245, -152, 257, 480, -987, -16, 353, 152, -74, 217,
+		 546, 433, -90, -479, 834, 809, -9, 458, 195, 770, 167, -46, 163, -198, 440, -453, 228, 467, 296, -253}}},
+	{{-1, 83, {0, 0, 0, 1}, {10, 26, 27, 34}, 4692, 449951,
+		{-49, -819, -471, 130, 122, -336, 963, 85, -764, -398, -194, 7, -657, -491, 664, 410, 441, -105, -1069, 268,
+		 -540, 250, 237, 95, 1006, -452, 1000, 913, 473, 863, -318, 164, -93, -415, -1155, 406, 334, 324, -489, -1431}},
+	 {0, 94, {1, 0, 1, 0}, {15, 11, 2, 39}, 9570, 561598,
+		{-210, -716, 368, 770, -245, 169, -259, -729, 583, 381, 1001, -341, -284, -78, 54, 912, -288, -186, -542, 468,
+		 -963, 571, -273, 377, 249, 143, -165, 125, -746, 580, -216, -286, -878, -168, 596, 166, 367, -51, -287, -53}}},
+	{{1, 101, {0, 1, 0, 1}, {35, 6, 37, 4}, 12296, 430030,
+		{931, 443, -318, -426, 1049, -1622, 168, -843, 368, -392, 367, 499, -90, 39, 277, 18, 189, -331, -100, -240,
+		 -845, 1060, 258, 239, 906, 114, 841, -83, -704, -95, -401, 1356, -1065, -81, 118, 458, 333, 670, 860, 297}},
+	 {0, 67, {0, 1, 0, 0}, {10, 11, 12, 38}, 15398, 607759,
+		{586, 456, -181, -780, 227, -200, 19, -620, -37, -247, 316, 149, 308, 825, 196, -11, 748, -54, 685, 438,
+		 261, 186, -267, -1066, -131, 11, 414, 599, 86, -69, 678, -201, -626, 460, 15, 632, -729, 60, -41, 24}}},
+	{{-1, 68, {1, 0, 1, 0}, {35, 21, 7, 33}, 284, 468989,
+		{-847, -307, -538, 670, -108, -1177, -327, 40, 86, -542, -149, -109, -775, 1084, -2, -803, -133, -393, 112, 520,
+		 -34, 657, -317, 274, 32, 652, -779, -1027, 67, 614, 776, 711, -443, 545, 250, -1166, -472, 443, 205, 508}},
+	 {0, 99, {1, 1, 1, 1}, {10, 6, 22, 39}, 4554, 529640,
+		{-24, -28, -202, -257, -419, -399, -421, -1221, 49, -931, 735, -296, 358, -86, -316, 468, -6, 598, 1032, 49,
+		 1007, 1123, 173, -19, -189, 463, 177, 266, -520, -356, 22, -634, 12, 200, 218, -157, -639, 85, -257, -865}}},
+	{{1, 78, {0, 1, 1, 1}, {15, 11, 17, 18}, 8848, 562889,
+		{383, -698, 410, -483, 622, 44, 761, 628, 60, -13, -201, 426, 747, 153, 598, -63, 121, 32, 596, 183,
+		 -280, 134, -205, 142, -458, -51, 753, 836, -411, -13, 912, 219, 883, 250, 270, -687, 354, 224, 877, -344}},
+	 {0, 96, {0, 0, 0, 0}, {5, 36, 32, 33}, 1870, 458288,
+		{-36, -225, 136, -457, -948, 231, -984, -977, 285, 272, 553, -888, 1101, -104, -375, -704, 990, -383, -694, 601,
+		 462, -567, -918, -559, -481, 370, -533, 426, -305, -134, -565, -30, -32, -541, -1012, -389, -176, 683, -340, -653}}},
+	{{-1, 101, {1, 1, 1, 1}, {10, 1, 27, 19}, 2404, 503763,
+		{369, -182, 194, 632, -245, 797, 844, -454, -378, -817, -585, -547, -32, 98, 1025, -161, 283, 468, -468, -318,
+		 -459, 807, -458, 4, -208, 89, 33, -217, 1034, 364, -1045, -471, 709, 1118, -106, 268, 351, -207, 288, 462}},
+	 {0, 88, {1, 0, 0, 1}, {35, 16, 2, 33}, 13746, 505035,
+		{-424, -150, -269, 17, -27, -113, -465, 741, 209, -749, 716, -742, -226, -520, -312, 686, -310, -964, -987, -1117,
+		 -41, -543, -287, -521, 579, 229, 766, 428, 16, 330, 122, 192, 1340, 270, 343, 309, -567, 51, -109, -247}}},
+	{{1, 103, {0, 0, 1, 1}, {35, 31, 37, 19}, 664, 654722,
+		{-566, -290, -479, -206, -80, -707, 376, -512, 631, 123, 430, 431, 29, -358, -315, 61, 164, -104, 187, 940,
+		 -502, -137, -110, -6, 593, 53, -184, -215, -137, -44, -33, 311, -642, 82, -683, -986, -412, -79, -84, -524}},
+	 {0, 45, {1, 1, 1, 1}, {5, 36, 12, 18}, 11766, 569241,
+		{243, 28, -117, -160, 443, 188, -381, -207, -284, -579, -548, -159, 108, -227, 404, -14, 597, -290, -595, -286,
+		 -867, -770, 37, 563, 838, -129, 766, 483, 1102, -417, 54, -524, -585, 416, -49, -924, -129, -192, 455, -203}}},
+	{{-1, 54, {1, 1, 0, 1}, {5, 11, 7, 39}, 13100, 564815,
+		{-338, -282, 860, 687, -127, 112, 542, -726, 51, -37, -319, 900, 198, 293, -189, 959, 312, -432, -90, -39,
+		 395, -166, -1048, 468, -67, -955, 11, -594, -48, 271, 525, -151, -62, -70, -16, -253, 405, -956, 434, 126}},
+	 {0, 61, {1, 1, 0, 0}, {30, 1, 22, 13}, 14618, 503158,
+		{-98, -281, -59, -167, 1219, 803, -1127, 325, 839, -320, -306, -878, -212, -68, 354, 318, 112, 1049, 343, -181,
+		 789, -43, -341, 183, 281, 242, 352, -124, -386, -146, -652, -592, -190, 843, -791, -707, -153, 135, -579, 553}}},
+	{{1, 48, {1, 0, 0, 1}, {5, 31, 17, 14}, 6176, 544710,
+		{34, -987, -522, 820, 385, 1148, -572, 251, -1089, -78, 115, 417, 222, -55, 513, 296, 220, -321, -400, 910,
+		 443, 150, -578, 213, -135, 332, 493, -261, 536, -285, -773, 2, -106, 345, 234, -24, -11, -848, -72, -337}},
+	 {0, 42, {1, 0, 1, 0}, {20, 1, 32, 33}, 6174, 509826,
+		{-80, 223, 116, 1167, -1200, 727, -187, 184, -175, -208, -907, -704, -79, -24, 6, 553, 114, -255, 1014, -143,
+		 -622, 121, -441, -230, 275, 82, 247, 1314, -781, 138, 8, -117, 308, -733, 376, 83, -556, 539, 329, 380}}},
+	{{-1, 55, {1, 0, 0, 0}, {30, 1, 27, 8}, 1652, 585885,
+		{266, -448, 83, -27, -108, -510, -50, 919, 511, -91, 296, -214, -439, 295, -413, 156, 116, 1162, 381, -529,
+		 126, -564, 120, 801, 105, 239, 338, -460, 563, 497, -499, -218, -34, 212, -345, -519, 872, -618, -222, 683}},
+	 {0, 82, {1, 1, 1, 1}, {10, 16, 2, 23}, 1026, 527060,
+		{219, 377, 717, 503, -489, 77, 441, -133, 180, -382, -506, 96, 176, -490, -590, -348, -1011, -245, 191, 585,
+		 -311, -161, -213, -179, -282, -1260, 248, 946, -414, -472, -988, -138, 319, 157, -847, -357, -645, -399, 157, -737}}},
+	{{1, 41, {1, 1, 0, 0}, {15, 31, 37, 38}, 11048, 467989,
+		{-471, -326, 696, 965, 384, -120, 383, 771, -74, -201, 805, -734, -307, -571, 428, 544, 195, -716, -238, 1023,
+		 410, -126, 1369, -323, 336, 177, 127, -420, 487, -321, -378, -806, 349, -594, 876, -455, -76, 892, 819, -393}},
+	 {0, 87, {1, 0, 0, 0}, {30, 16, 12, 39}, 11718, 528570,
+		{51, -120, -157, -28, 299, -167, -372, -283, -380, 393, 20, 69, 572, 538, -515, 6, 597, -246, -443, 550,
+		 -819, 603, 238, -345, -1626, 11, -522, 391, 222, 540, 351, 712, 119, -372, -729, 104, 1135, 349, 336, 617}}},
+	{{-1, 40, {1, 1, 1, 0}, {30, 26, 7, 4}, 2876, 473613,
+		{292, -9, -439, 184, -538, 114, -261, -989, 649, -308, 398, 877, -245, -761, 0, -360, 366, 289, 595, -606,
+		 -592, 796, -379, -1395, 467, 758, 664, -169, -43, 177, -374, -1022, 440, 75, 605, -372, -134, -1082, 15, 759}},
+	 {0, 87, {1, 1, 1, 1}, {0, 16, 22, 23}, 15978, 450540,
+		{301, 577, -213, -245, -255, 45, -81, -344, -458, 378, 404, 420, -310, -986, 1240, -511, -321, 51, -131, 957,
+		 -1005, 927, -639, 730, -312, 620, -794, 342, -804, -360, 426, 307, 593, -475, 463, 111, 1317, 785, -173, -756}}},
+	{{1, 82, {0, 1, 1, 0}, {5, 36, 17, 9}, 944, 672884,
+		{382, 60, 521, 132, -180, 515, -441, -582, -5, -343, 870, -47, 393, -464, 356, 199, -8, 662, -445, 158,
+		 -186, -35, 1, -172, 373, 3, 160, -277, -381, 266, 30, -671, 114, 752, -387, -328, -192, 951, 443, 238}},
+	 {0, 52, {0, 1, 0, 1}, {25, 31, 32, 34}, 5870, 538029,
+		{-868, 567, 120, -129, -659, -928, 633, 472, 669, 232, -295, -368, 46, -47, -102, 425, 542, -231, -838, 801,
+		 -401, 194, 571, 250, -225, 202, 27, -206, -464, -205, -932, 459, 928, -5, -772, 195, -655, 292, -515, 28}}},
+	{{-1, 73, {1, 1, 1, 1}, {20, 36, 27, 33}, 2436, 482821,
+		{-613, -339, -36, -566, 278, -417, 71, 365, 624, 498, 145, 239, -597, -668, -324, 594, 197, -329, -314, -620,
+		 448, -535, 689, 695, 666, 764, 123, -71, -1195, -530, 550, -356, -17, -319, 432, -674, 1642, 371, 283, -511}},
+	 {0, 76, {1, 0, 0, 0}, {20, 16, 2, 14}, 4178, 471631,
+		{-75, 95, 511, 437, 161, -541, -1380, 490, 238, -312, 664, -130, -870, -756, -523, 115, -1113, 177, 689, -313,
+		 -493, -75, 718, -900, -32, 538, 74, 400, 268, 990, -217, 517, -615, -253, 867, -551, -123, -633, 256, -754}}},
+	{{1, 43, {0, 0, 1, 1}, {5, 21, 37, 13}, 10680, 654840,
+		{-64, 77, -120, 272, -377, -629, -578, -321, 45, -86, 213, 333, 180, 680, 203, 188, -486, -377, -94, 266,
+		 -415, -699, -168, 57, -633, -284, -529, 71, 910, -158, -667, -714, 116, 193, -68, -764, -453, -257, -270, 435}},
+	 {0, 65, {0, 0, 1, 1}, {15, 6, 12, 19}, 15254, 477296,
+		{-245, 268, 467, -127, 52, 13, 300, -591, -68, -659, 228, 578, -91, 302, -259, -206, 493, -690, -139, -381,
+		 150, -561, -434, -973, 926, 687, 390, 580, -1785, -528, -1249, 180, 207, 400, -233, 389, -776, -623, 368, 181}}},
+	{{-1, 90, {1, 0, 0, 1}, {25, 1, 7, 13}, 2380, 500555,
+		{785, -256, -1106, -70, -573, 1131, 81, 532, 598, -587, -301, 591, 712, 224, -202, -407, -229, -22, -136, 100,
+		 333, -299, 411, 574, -160, 415, 413, -7, -686, 74, -1152, -109, 805, 724, -190, -754, -297, -193, 741, 616}},
+	 {0, 49, {1, 1, 0, 1}, {10, 16, 22, 34}, 8634, 371185,
+		{915, 243, 617, -747, -489, -880, -98, -414, 1020, -628, 562, 270, -704, 489, -1497, 795, -1051, 421, 379, -377,
+		 -23, 706, 48, -684, -1202, 830, 68, 384, 530, -1253, 441, -755, -969, 1623, -371, 505, -69, -780, 194, 582}}},
+	{{1, 52, {1, 0, 0, 0}, {25, 26, 17, 8}, 9536, 568698,
+		{-367, 140, -300, -245, 207, -574, -125, 433, -18, 473, 273, -200, 1004, -305, 384, -98, 715, 166, 718, -283,
+		 137, 348, -771, -245, 808, 243, 523, -494, 166, -151, -6, 504, 261, -320, -312, 703, 579, -778, 119, 1125}},
+	 {0, 62, {1, 1, 1, 1}, {25, 6, 32, 34}, 958, 575458,
+		{416, 551, 917, 8, -95, -384, -315, -368, 1, 312, 598, -135, -318, 81, 70, 193, 482, -55, 151, 106,
+		 867, -94, 839, -398, -189, 474, 1112, 219, 388, 627, 968, 419, -476, -149, -103, -308, -731, 196, -55, 596}}},
+	{{-1, 91, {0, 0, 0, 0}, {25, 36, 27, 19}, 4756, 464770,
+		{-988, 914, 1118, 295, 143, -203, -72, 186, 1241, 695, 755, -468, 260, -486, -499, 383, -242, 860, -248, -335,
+		 249, -385, 994, -60, -829, -639, 157, -330, 110, 100, 823, 393, -520, 806, -78, -965, 355, -55, 524, 206}},
+	 {0, 70, {0, 0, 1, 0}, {25, 31, 2, 4}, 6818, 506476,
+		{-25, -739, -119, -437, 132, 850, 470, 304, 128, -794, -126, 884, 477, -549, 655, -231, -359, -465, -261, -483,
+		 182, -540, -824, -382, 562, 1272, 1012, -954, -241, -147, 129, -661, -181, 321, -403, 495, -280, -394, -70, -44}}},
+	{{1, 45, {1, 1, 0, 0}, {10, 1, 37, 29}, 15944, 553173,
+		{-112, 664, 399, 19, 454, 71, -203, 562, -291, -299, -580, 304, 723, -444, 290, -241, -598, 658, -151, -563,
+		 352, -63, -369, -148, -9, -1073, 150, -22, -147, -322, -132, 1353, -60, -372, 323, -121, 250, -1221, -535, -346}},
+	 {0, 43, {0, 0, 0, 1}, {35, 6, 12, 3}, 5990, 556823,
+		{-901, 425, -548, 309, -44, -551, -668, 149, -116, -406, -179, -426, -91, -166, -107, -394, -483, 1195, 62, -265,
+		 -266, 91, -698, -41, 558, 108, 687, 792, 455, -804, -393, 184, -577, -83, -352, 185, 24, -803, 296, -743}}},
+	{{-1, 76, {1, 0, 1, 1}, {0, 26, 7, 18}, 11612, 552052,
+		{374, 770, 651, -333, 537, -164, -738, 509, -357, -105, 912, -216, -258, 433, 483, -462, -704, 428, 533, -227,
+		 -669, 390, -472, 487, -667, -191, 26, 658, 328, -805, -19, 284, 266, 86, -97, -633, -339, 944, -206, -47}},
+	 {0, 75, {0, 0, 1, 1}, {10, 16, 22, 4}, 8970, 467882,
+		{-559, -3, 127, -904, 262, 330, 100, 372, 410, -522, -600, -559, 399, -509, -435, -115, -797, -1169, -431, -342,
+		 -104, 1084, 438, 294, -596, -920, -902, -253, -735, -523, 159, 63, -11, 225, -477, 732, 554, -722, 264, 1240}}},
+	{{1, 86, {1, 1, 1, 1}, {15, 21, 17, 3}, 15568, 499484,
+		{604, 19, 855, -566, -245, -839, 118, -543, -359, 576, 628, 215, 776, -346, -173, -1362, 86, -531, -239, 356,
+		 133, -493, -1104, -773, 403, -230, 814, 369, 386, -256, -115, 200, 80, -569, -309, 766, 511, 365, -278, -491}},
+	 {0, 72, {0, 1, 0, 0}, {20, 26, 32, 38}, 7822, 525737,
+		{-67, -1104, -311, 296, 237, 1080, 809, -32, 638, -735, -534, -775, 622, -407, -758, 113, 191, 530, 139, 74,
+		 -145, 26, 107, -382, -896, -381, 684, 283, 496, 331, -180, -493, -63, 116, 77, 364, 1009, -516, -83, 292}}}
+};
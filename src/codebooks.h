@@ -24,6 +24,7 @@
 
 /*** codebooks for quantization of the LSP coefficient - doc: 3.2.4 ***/
 extern word16_t L1[L1_RANGE][NB_LSP_COEFF]; /* The first stage is a 10-dimensional VQ using codebook L1 with 128 entries (7 bits). in Q2.13 */
+extern const uint8_t L1Neighbours[L1_RANGE][L1_HINT_NEIGHBOURS]; /* for each L1 codebook vector, indexes of its L1_HINT_NEIGHBOURS closest vectors, itself first */
 extern word16_t L2L3[L2_RANGE][NB_LSP_COEFF]; /* Doc : The second stage is a 10-bit VQ splitted in L2(first 5 values of a vector) and L3(last five value in each vector) containing 32 entries (5 bits). in Q0.13 but max value < 0.5 so fits in 13 bits. */
 
 extern word16_t MAPredictor[L0_RANGE][MA_MAX_K][NB_LSP_COEFF]; /* the MA predictor coefficients in Q0.15 but max value < 0.5 so it fits on 15 bits */
@@ -56,4 +57,21 @@ extern word16_t lowBandFilter[NB_LSP_COEFF+3];
 /* codebook for LP Analysis */
 extern word16_t wlp[L_LP_ANALYSIS_WINDOW];
 extern word16_t wlag[NB_LSP_COEFF+3];
+
+/* random draws of a comfort noise subframe: they depend only on the pseudo random generator seed */
+typedef struct {
+	int16_t fracPitchDelay;
+	int16_t intPitchDelay;
+	word16_t sign[4]; /* sign of the impulses of fixed codebook excitation */
+	word16_t position[4]; /* positions of the impulses of fixed codebook excitation */
+	word16_t Ga; /* gain to be applied to adaptative subframe excitation in Q0.15 */
+	word32_t GgFactor; /* 1/2*sqrt(L_SUBFRAME/gaussianRandomExcitationSubframeEnergy) in Q1.29, to be multiplied by target gain */
+	word16_t gaussianRandomExcitation[L_SUBFRAME]; /* unscaled gaussian excitation in Q0 */
+} CNGRandomSubframe;
+
+/* comfort noise random draws of the first CNG_RANDOM_CACHE_FRAMES frames following a seed reset */
+extern const uint16_t CNGRandomDrawsSeed[CNG_RANDOM_CACHE_FRAMES]; /* seed at the beginning of the frame */
+extern const uint16_t CNGRandomDrawsNextSeed[CNG_RANDOM_CACHE_FRAMES]; /* seed at the end of the frame */
+extern const int16_t CNGRandomDrawsIndex[CNG_RANDOM_CACHE_HASH_MASK+1]; /* frame index accessed by the 9 LSB of the seed, -1 if not precomputed */
+extern const CNGRandomSubframe CNGRandomDraws[CNG_RANDOM_CACHE_FRAMES][2];
 #endif /* ifndef CODEBOOKS_H */
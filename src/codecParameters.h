@@ -68,6 +68,12 @@
 #define BOUNDED_PITCH_GAIN_MIN 3277
 #define BOUNDED_PITCH_GAIN_MAX 13107
 
+/* gain quantization: number of GA x GB candidates preselected, spec 3.9.2 */
+#define GAIN_QUANTIZATION_CANDIDATES_NBR 32
+
+/* multi channel decoding: number of channels processed at once by the LSP to LP conversion */
+#define MULTI_CHANNEL_LANES 16
+
 /* post filters values defined in 4.2.2 in Q15 pow 1 to 10 */
 #define GAMMA_N1 18022
 #define GAMMA_N2 9912
@@ -116,6 +122,11 @@
 #define GAUSSIAN_EXCITATION_COEFF_FACTOR 25905
 /* 0.75 in Q15 */
 #define COEFF_K 24576
+/* the pseudo random seed is reset to CNG_DTX_RANDOM_SEED_INIT on each active frame, so every channel walks the same sequence during */
+/* the first frames of a silence period: the draws of the first CNG_RANDOM_CACHE_FRAMES frames are precomputed in codebooks.c */
+#define CNG_RANDOM_CACHE_FRAMES 256
+/* the seed is a 16 bits LCG and each frame draws 966 values: the 9 LSB of the frame starting seeds have a period of 256 frames, use them as perfect hash */
+#define CNG_RANDOM_CACHE_HASH_MASK 0x01FF
 
 /*** VAD ***/
 #define LOG2_240_Q16 518186
@@ -132,5 +143,57 @@
 #define THRESHOLD1_IN_Q20 1260661
 #define CNG_DTX_RANDOM_SEED_INIT 11111
 
+/*** active speaker detection ***/
+/* all values in dB in Q8 */
+#define ACTIVE_SPEAKER_NOISE_FLOOR_INIT 7680 /* 30 dB */
+#define ACTIVE_SPEAKER_NOISE_FLOOR_RISE 13 /* 0.05 dB per frame */
+#define ACTIVE_SPEAKER_THRESHOLD 2304 /* 9 dB over noise floor */
+#define ACTIVE_SPEAKER_HANGOVER 20 /* in frames */
+#define ACTIVE_SPEAKER_SELECTION_HYSTERESIS 768 /* 3 dB bonus for channels selected at previous frame */
+
+/*** encoder hints ***/
+#define L1_HINT_NEIGHBOURS 8 /* number of L1 codebook vectors searched around each hinted one */
+#define OPEN_LOOP_PITCH_HINT_RANGE 3 /* open loop pitch search in [hint-3, hint+3] */
+#define CLOSED_LOOP_PITCH_HINT_RANGE 1 /* second subframe closed loop pitch search in [hint-1, hint+1] */
+
+/*** RTP payload frame lengths in bytes ***/
+#define RTP_FRAME_LENGTH 10
+#define RTP_SID_FRAME_LENGTH 2
+
+/*** jitter buffer ***/
+#define JITTER_BUFFER_SLOTS_NBR 64 /* frames stored, 640 ms */
+#define JITTER_BUFFER_MAXIMUM_DELAY 50 /* in frames, leaves room for frames arriving ahead of the playout delay */
+#define JITTER_BUFFER_EMPTY_SLOT 0xFF
+#define JITTER_BUFFER_TRANSIT_WINDOW 256 /* in packets, the fastest packet transit is tracked over one or two windows */
+#define JITTER_BUFFER_HISTOGRAM_FORGET 32637 /* 0.996 in Q15: delay histogram forgetting factor applied on each packet */
+#define JITTER_BUFFER_QUANTILE 32113 /* 0.98 in Q15: target delay is the delay of 98% of the packets */
+#define JITTER_BUFFER_HYSTERESIS L_FRAME /* in samples, frames are dropped when delay exceeds target by more than this */
+
+/*** time scaling ***/
+#define TIME_SCALE_RESERVE (2*MAXIMUM_INT_PITCH_DELAY) /* in samples, output is delayed by this to hold two pitch periods */
+#define TIME_SCALE_SPEED_MIN 256 /* 1 in Q8 */
+#define TIME_SCALE_SPEED_MAX 512 /* 2 in Q8 */
+
+/*** encoder input formats ***/
+#define DECIMATION_16KHZ_TAPS 33 /* linear phase decimation filters: 16 input samples delay at 16kHz */
+#define DECIMATION_48KHZ_TAPS 97 /* 48 input samples delay at 48kHz */
+
+/*** decoder output formats ***/
+#define UPSAMPLING_TAPS_PER_PHASE 16 /* polyphase upsampling filter length on the 8kHz signal */
+#define UPSAMPLING_PHASES 6 /* phases of the polyphase filter: 48kHz output, 16kHz output uses one phase out of three */
+
+/*** recording container ***/
+#define DECODER_STATE_SIZE 840 /* in bytes, 420 words serialized by saveDecoderState */
+#define RECORDING_HEADER_SIZE 32
+#define RECORDING_VERSION 1
+#define RECORDING_CHECKPOINT_SIZE (4+DECODER_STATE_SIZE) /* frame payload offset and decoder state */
+#define RECORDING_FRAMES_ALLOCATION 1024 /* writer buffers grow by this number of frames */
+
+/*** call trace ***/
+#define TRACE_HEADER_SIZE 8
+#define TRACE_VERSION 1
+#define TRACE_RECORD_HEADER_SIZE 5 /* record type and channel id */
+#define TRACE_BUFFER_SIZE 16384 /* records are given to the trace output by blocks of at most this size */
+#define TRACE_RECORD_MAXIMUM_SIZE (TRACE_RECORD_HEADER_SIZE+DECODER_STATE_SIZE) /* DECODER_OPEN record */
 
 #endif /* ifndef CODECPARAMETERS_H */
@@ -80,7 +80,7 @@ void computeAdaptativeCodebookVector(word16_t *excitationVector, int16_t fracPit
 }
 
 /*****************************************************************************/
-/* decodeAdaptativeCodeVector : as in spec 4.1.3                             */
+/* decodePitchDelay : pitch delay decoding part of spec 4.1.3                */
 /*    parameters:                                                            */
 /*      -(i/o) decoderChannelContext : the channel context data              */
 /*      -(i) subFrameIndex : 0 or 40 for subframe 1 or subframe 2            */
@@ -90,24 +90,19 @@ void computeAdaptativeCodebookVector(word16_t *excitationVector, int16_t fracPit
 /*      -(i/o) intPitchDelay : the integer part of Pitch Delay. Computed from*/
 /*             P1 on subframe 1. On Subframe 2, contains the intPitchDelay   */
 /*             computed on Subframe 1.                                       */
-/*      -(i/o) excitationVector : in Q0 excitation accessed from             */
-/*             [-MAXIMUM_INT_PITCH_DELAY(143), -1] as input                  */
-/*             and [0, L_SUBFRAME[ as output to store the adaptative         */
-/*             codebook vector                                               */
+/*      -(o) fracPitchDelay : the fractionnal part of Pitch Delay in -1,0,1  */
 /*                                                                           */
 /*****************************************************************************/
-void decodeAdaptativeCodeVector(bcg729DecoderChannelContextStruct *decoderChannelContext, int subFrameIndex, uint16_t adaptativeCodebookIndex, uint8_t parityFlag, uint8_t frameErasureFlag,
-				int16_t *intPitchDelay, word16_t *excitationVector)
+void decodePitchDelay(bcg729DecoderChannelContextStruct *decoderChannelContext, int subFrameIndex, uint16_t adaptativeCodebookIndex, uint8_t parityFlag, uint8_t frameErasureFlag,
+				int16_t *intPitchDelay, int16_t *fracPitchDelay)
 {
-	int16_t fracPitchDelay;
-
 	/*** Compute the Pitch Delay from the Codebook index ***/
 	/* fracPitchDelay is computed in the range -1,0,1 */
 	if (subFrameIndex == 0 ) { /* first subframe */
 		if (parityFlag|frameErasureFlag) { /* there is an error (either parity or frame erased) */
 			*intPitchDelay = decoderChannelContext->previousIntPitchDelay; /* set the integer part of Pitch Delay to the last second subframe Pitch Delay computed spec: 4.1.2 */
 			/* Note: unable to find anything regarding this part in the spec, just copied it from the ITU source code */
-			fracPitchDelay = 0;
+			*fracPitchDelay = 0;
 			decoderChannelContext->previousIntPitchDelay++;
 			if (decoderChannelContext->previousIntPitchDelay>MAXIMUM_INT_PITCH_DELAY) decoderChannelContext->previousIntPitchDelay=MAXIMUM_INT_PITCH_DELAY;
 		} else { /* parity and frameErasure flags are off, do the normal computation (doc 4.1.3) */
@@ -115,10 +110,10 @@ void decodeAdaptativeCodeVector(bcg729DecoderChannelContextStruct *decoderChanne
 				/* *intPitchDelay = (P1 + 2 )/ 3 + 19 */
 				*intPitchDelay = ADD16(MULT16_16_Q15(ADD16(adaptativeCodebookIndex,2), 10923), 19); /* MULT in Q15: 1/3 in Q15: 10923 */
 				/* fracPitchDelay = P1 − 3*intPitchDelay  + 58 : fracPitchDelay in -1, 0, 1 */
-				fracPitchDelay = ADD16(SUB16(adaptativeCodebookIndex, MULT16_16(*intPitchDelay, 3)), 58);
+				*fracPitchDelay = ADD16(SUB16(adaptativeCodebookIndex, MULT16_16(*intPitchDelay, 3)), 58);
 			} else {/* adaptativeCodebookIndex>= 197 */
 				*intPitchDelay = SUB16(adaptativeCodebookIndex, 112);
-				fracPitchDelay = 0;
+				*fracPitchDelay = 0;
 			}
 
 			/* backup the intPitchDelay */
@@ -128,7 +123,7 @@ void decodeAdaptativeCodeVector(bcg729DecoderChannelContextStruct *decoderChanne
 		if (frameErasureFlag) { /* there is an error : frame erased, in case of parity error, it has been taken in account at first subframe */
 			/* unable to find anything regarding this part in the spec, just copied it from the ITU source code */
 			*intPitchDelay = decoderChannelContext->previousIntPitchDelay;
-			fracPitchDelay = 0;
+			*fracPitchDelay = 0;
 			decoderChannelContext->previousIntPitchDelay++;
 			if (decoderChannelContext->previousIntPitchDelay>MAXIMUM_INT_PITCH_DELAY) decoderChannelContext->previousIntPitchDelay=MAXIMUM_INT_PITCH_DELAY;
 		} else { /* frameErasure flags are off, do the normal computation (doc 4.1.3) */
@@ -142,7 +137,7 @@ void decodeAdaptativeCodeVector(bcg729DecoderChannelContextStruct *decoderChanne
 			/* intPitchDelay = (P2 + 2 )/ 3 − 1 */
 			*intPitchDelay = SUB16(MULT16_16_Q15(ADD16(adaptativeCodebookIndex, 2), 10923), 1);
  			/* fracPitchDelay = P2 − 2 − 3((P 2 + 2 )/ 3 − 1) */
-			fracPitchDelay = SUB16(SUB16(adaptativeCodebookIndex, MULT16_16(*intPitchDelay, 3)), 2);
+			*fracPitchDelay = SUB16(SUB16(adaptativeCodebookIndex, MULT16_16(*intPitchDelay, 3)), 2);
 			/* *intPitchDelay = (P2 + 2 )/ 3 − 1 + tMin */
 			*intPitchDelay = ADD16(*intPitchDelay,tMin);
 
@@ -150,6 +145,31 @@ void decodeAdaptativeCodeVector(bcg729DecoderChannelContextStruct *decoderChanne
 			decoderChannelContext->previousIntPitchDelay = *intPitchDelay;
 		}
 	}
+}
+
+/*****************************************************************************/
+/* decodeAdaptativeCodeVector : as in spec 4.1.3                             */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) subFrameIndex : 0 or 40 for subframe 1 or subframe 2            */
+/*      -(i) adaptativeCodebookIndex : parameter P1 or P2                    */
+/*      -(i) parityFlag : based on P1 parity flag : set if parity error      */
+/*      -(i) frameErasureFlag : set in case of frame erasure                 */
+/*      -(i/o) intPitchDelay : the integer part of Pitch Delay. Computed from*/
+/*             P1 on subframe 1. On Subframe 2, contains the intPitchDelay   */
+/*             computed on Subframe 1.                                       */
+/*      -(i/o) excitationVector : in Q0 excitation accessed from             */
+/*             [-MAXIMUM_INT_PITCH_DELAY(143), -1] as input                  */
+/*             and [0, L_SUBFRAME[ as output to store the adaptative         */
+/*             codebook vector                                               */
+/*                                                                           */
+/*****************************************************************************/
+void decodeAdaptativeCodeVector(bcg729DecoderChannelContextStruct *decoderChannelContext, int subFrameIndex, uint16_t adaptativeCodebookIndex, uint8_t parityFlag, uint8_t frameErasureFlag,
+				int16_t *intPitchDelay, word16_t *excitationVector)
+{
+	int16_t fracPitchDelay;
+
+	decodePitchDelay(decoderChannelContext, subFrameIndex, adaptativeCodebookIndex, parityFlag, frameErasureFlag, intPitchDelay, &fracPitchDelay);
 
 	/* compute the adaptative codebook vector using the pitch delay we just get and the past excitation vector */
 	computeAdaptativeCodebookVector(excitationVector, fracPitchDelay, *intPitchDelay); 
@@ -34,6 +34,23 @@ void initDecodeAdaptativeCodeVector(bcg729DecoderChannelContextStruct *decoderCh
 /*****************************************************************************/
 void computeAdaptativeCodebookVector(word16_t *excitationVector, int16_t fracPitchDelay, int16_t intPitchDelay);
 
+/*****************************************************************************/
+/* decodePitchDelay : pitch delay decoding part of spec 4.1.3                */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) subFrameIndex : 0 or 40 for subframe 1 or subframe 2            */
+/*      -(i) adaptativeCodebookIndex : parameter P1 or P2                    */
+/*      -(i) parityFlag : based on P1 parity flag : set if parity error      */
+/*      -(i) frameErasureFlag : set in case of frame erasure                 */
+/*      -(i/o) intPitchDelay : the integer part of Pitch Delay. Computed from*/
+/*             P1 on subframe 1. On Subframe 2, contains the intPitchDelay   */
+/*             computed on Subframe 1.                                       */
+/*      -(o) fracPitchDelay : the fractionnal part of Pitch Delay in -1,0,1  */
+/*                                                                           */
+/*****************************************************************************/
+void decodePitchDelay(bcg729DecoderChannelContextStruct *decoderChannelContext, int subFrameIndex, uint16_t adaptativeCodebookIndex, uint8_t parityFlag, uint8_t frameErasureFlag,
+				int16_t *intPitchDelay, int16_t *fracPitchDelay);
+
 /*****************************************************************************/
 /* decodeAdaptativeCodeVector : as in spec 4.1.3                             */
 /*    parameters:                                                            */
@@ -28,6 +28,7 @@
 #include "decodeLSP.h"
 #include "interpolateqLSP.h"
 #include "qLSP2LP.h"
+#include "multiChannelLSP.h"
 #include "decodeAdaptativeCodeVector.h"
 #include "decodeFixedCodeVector.h"
 #include "decodeGains.h"
@@ -35,10 +36,51 @@
 #include "postFilter.h"
 #include "postProcessing.h"
 #include "cng.h"
+#include "activeSpeaker.h"
+#include "analyzer.h"
+#include "trace.h"
 
 /* buffers allocation */
 static const word16_t previousqLSPInitialValues[NB_LSP_COEFF] = {30000, 26000, 21000, 15000, 8000, 0, -8000,-15000,-21000,-26000}; /* in Q0.15 the initials values for the previous qLSP buffer */
 
+/*****************************************************************************/
+/* decodeOutputStage : postFilter and postProcessing of one subframe         */
+/*      according to the decoder mode selected on this channel               */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) LP : 10 LP coefficients for current subframe in Q12             */
+/*      -(i) intPitchDelay : the integer part of Pitch Delay in Q0           */
+/*      -(i) subframeIndex : 0 or L_SUBFRAME for subframe 0 or 1             */
+/*      -(i) outputFormat : one of BCG729_OUTPUT_FORMAT_*                    */
+/*      -(i) stride : distance in samples between two output samples         */
+/*      -(o) output : the decoded frame, the subframe is written in the      */
+/*           output format                                                   */
+/*                                                                           */
+/*****************************************************************************/
+static void decodeOutputStage(bcg729DecoderChannelContextStruct *decoderChannelContext, word16_t *LP, int16_t intPitchDelay, int subframeIndex, uint8_t outputFormat, uint16_t stride, void *output)
+{
+	word16_t postFilteredSignal[L_SUBFRAME]; /* store the postfiltered signal in Q0 */
+	word16_t *reconstructedSpeech = &(decoderChannelContext->reconstructedSpeech[NB_LSP_COEFF+subframeIndex]);
+
+	switch (decoderChannelContext->decoderMode) {
+		case BCG729_DECODER_MODE_NO_POSTFILTER:
+			postFilterBypass(decoderChannelContext, LP, reconstructedSpeech, subframeIndex, postFilteredSignal);
+			postProcessing(decoderChannelContext, postFilteredSignal);
+			break;
+		case BCG729_DECODER_MODE_RAW:
+			postFilterBypass(decoderChannelContext, LP, reconstructedSpeech, subframeIndex, postFilteredSignal);
+			postProcessingBypass(decoderChannelContext, postFilteredSignal);
+			break;
+		default:
+			postFilter(decoderChannelContext, LP, reconstructedSpeech, intPitchDelay, subframeIndex, postFilteredSignal);
+			postProcessing(decoderChannelContext, postFilteredSignal);
+			break;
+	}
+
+	/* convert postProcessing Output while it is still in cache and write it to the output buffer */
+	writeOutputSubframe(decoderChannelContext, postFilteredSignal, outputFormat, subframeIndex, stride, output);
+}
+
 /*****************************************************************************/
 /* initBcg729DecoderChannel : create context structure and initialise it     */
 /*    return value :                                                         */
@@ -62,6 +104,8 @@ bcg729DecoderChannelContextStruct *initBcg729DecoderChannel()
 	memset(decoderChannelContext->reconstructedSpeech, 0, NB_LSP_COEFF*sizeof(word16_t)); /* initialise to zero all the values used from previous frame to get the current frame reconstructed speech */
 	decoderChannelContext->previousFrameIsActiveFlag = 1;
 	decoderChannelContext->CNGChannelContext = initBcg729CNGChannel();
+	decoderChannelContext->decoderMode = BCG729_DECODER_MODE_STANDARD;
+	decoderChannelContext->outputFormat = BCG729_OUTPUT_FORMAT_PCM16;
 
 
 	/* initialisation of the differents blocs which need to be initialised */
@@ -70,6 +114,8 @@ bcg729DecoderChannelContextStruct *initBcg729DecoderChannel()
 	initDecodeGains(decoderChannelContext);
 	initPostFilter(decoderChannelContext);
 	initPostProcessing(decoderChannelContext);
+	initActiveSpeakerDetection(decoderChannelContext);
+	decoderChannelContext->encoderHints.flags = 0;
 
 	return decoderChannelContext;
 }
@@ -92,33 +138,21 @@ void closeBcg729DecoderChannel(bcg729DecoderChannelContextStruct *decoderChannel
 }
 
 /*****************************************************************************/
-/* bcg729Decoder :                                                           */
+/* parseFrame : get the frame parameters and its type                        */
 /*    parameters:                                                            */
 /*      -(i) decoderChannelContext : the channel context data                */
 /*      -(i) bitStream : 15 parameters on 80 bits                            */
-/*      -(i): bitStreamLength : in bytes, length of previous buffer          */
-/*      -(i) frameErased: flag: true, frame has been erased                  */
-/*      -(i) SIDFrameFlag: flag: true, frame is a SID one                    */
-/*      -(i) rfc3389PayloadFlag: true when CN payload follow rfc3389         */
-/*      -(o) signal : a decoded frame 80 samples (16 bits PCM)               */
+/*      -(i) bitStreamLength : in bytes, length of previous buffer           */
+/*      -(i) frameErasureFlag : flag: true, frame has been erased            */
+/*      -(i) SIDFrameFlag : flag: true, frame is a SID one                   */
+/*      -(o) parameters : 15 parameters as in spec 4 - Table 8, set to 0 if  */
+/*           there is no bitStream                                           */
+/*    return value : true if the frame shall be decoded as a SID one         */
 /*                                                                           */
 /*****************************************************************************/
-void bcg729Decoder(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, int16_t signal[])
+static uint8_t parseFrame(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint16_t parameters[])
 {
 	int i;
-	uint16_t parameters[NB_PARAMETERS];
-	/* internal buffers which we do not need to keep between calls */
-	word16_t qLSP[NB_LSP_COEFF]; /* store the qLSP coefficients in Q0.15 */
-	word16_t interpolatedqLSP[NB_LSP_COEFF]; /* store the interpolated qLSP coefficient in Q0.15 */
-	word16_t LP[2*NB_LSP_COEFF]; /* store the 2 sets of LP coefficients in Q12 */
-	int16_t intPitchDelay; /* store the Pitch Delay in and out of decodeAdaptativeCodeVector, in for decodeFixedCodeVector */
-	word16_t fixedCodebookVector[L_SUBFRAME]; /* the fixed Codebook Vector in Q1.13*/
-	word16_t postFilteredSignal[L_SUBFRAME]; /* store the postfiltered signal in Q0 */
-
-	uint8_t parityErrorFlag;
-	int subframeIndex;
-	int parametersIndex = 4; /* this is used to select the right parameter according to the subframe currently computed, start pointing to P1 */
-	int LPCoefficientsIndex = 0; /* this is used to select the right LP Coefficients according to the subframe currently computed */
 
 	/*** parse the bitstream and get all parameter into an array as in spec 4 - Table 8 ***/
 	/* parameters buffer mapping : */
@@ -152,6 +186,20 @@ void bcg729Decoder(bcg729DecoderChannelContextStruct *decoderChannelContext, con
 		}
 	}
 
+	decoderChannelContext->traceSyncFlag = 0; /* set back by the trace if this frame is traced */
+
+	/* operational statistics, on the received frame type */
+	decoderChannelContext->stats.framesNbr++;
+	if (frameErasureFlag) {
+		decoderChannelContext->stats.erasedFramesNbr++;
+	} else if (SIDFrameFlag == 0) {
+		decoderChannelContext->stats.activeFramesNbr++;
+	} else if (bitStream != NULL && bitStreamLength > 0) {
+		decoderChannelContext->stats.SIDFramesNbr++;
+	} else {
+		decoderChannelContext->stats.untransmittedFramesNbr++;
+	}
+
 	/* manage frameErasure and CNG as specified in B.27 */
 	if (frameErasureFlag) {
 		if (decoderChannelContext->previousFrameIsActiveFlag) {
@@ -161,69 +209,94 @@ void bcg729Decoder(bcg729DecoderChannelContextStruct *decoderChannelContext, con
 		}
 	}
 
-	/* this is a SID frame, process it using the dedicated function */
-	if (SIDFrameFlag == 1) {
-		decodeSIDframe(decoderChannelContext->CNGChannelContext, decoderChannelContext->previousFrameIsActiveFlag, bitStream, bitStreamLength, &(decoderChannelContext->excitationVector[L_PAST_EXCITATION]), decoderChannelContext->previousqLSP, LP, &(decoderChannelContext->CNGpseudoRandomSeed), decoderChannelContext->previousLCodeWord, rfc3389PayloadFlag);
-		decoderChannelContext->previousFrameIsActiveFlag = 0;
-
-		/* loop over the two subframes */
-		for (subframeIndex=0; subframeIndex<L_FRAME; subframeIndex+=L_SUBFRAME) {
-			/* reconstruct speech using LP synthesis filter spec 4.1.6 eq77 */
-			/* excitationVector in Q0, LP in Q12, recontructedSpeech in Q0 -> +NB_LSP_COEFF on the index of this one because the first NB_LSP_COEFF elements store the previous frame filter output */
-			LPSynthesisFilter(&(decoderChannelContext->excitationVector[L_PAST_EXCITATION + subframeIndex]), &(LP[LPCoefficientsIndex]), &(decoderChannelContext->reconstructedSpeech[NB_LSP_COEFF+subframeIndex]) );
-
-			/* NOTE: ITU code check for overflow after LP Synthesis Filter computation and if it happened, divide excitation buffer by 2 and recompute the LP Synthesis Filter */
-			/*	here, possible overflows are managed directly inside the Filter by saturation at MAXINT16 on each result */
-
-			/* postFilter */
-			postFilter(decoderChannelContext, &(LP[LPCoefficientsIndex]), /* select the LP coefficients for this subframe, use last frame intPitchDelay */
-				&(decoderChannelContext->reconstructedSpeech[NB_LSP_COEFF+subframeIndex]), decoderChannelContext->previousIntPitchDelay, subframeIndex, postFilteredSignal);
+	return SIDFrameFlag;
+}
 
-			/* postProcessing */
-			postProcessing(decoderChannelContext, postFilteredSignal);
+/*****************************************************************************/
+/* decodeSIDFrameSignal : decode a SID, untransmitted or erased frame during */
+/*      a silence period: comfort noise generation                           */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) bitStream : SID frame payload, may be NULL                      */
+/*      -(i) bitStreamLength : in bytes, length of previous buffer           */
+/*      -(i) rfc3389PayloadFlag : true when CN payload follow rfc3389        */
+/*      -(i) outputFormat : one of BCG729_OUTPUT_FORMAT_*                    */
+/*      -(i) stride : distance in samples between two output samples         */
+/*      -(o) output : a decoded frame in the output format                   */
+/*                                                                           */
+/*****************************************************************************/
+static void decodeSIDFrameSignal(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t rfc3389PayloadFlag, uint8_t outputFormat, uint16_t stride, void *output)
+{
+	int subframeIndex;
+	int LPCoefficientsIndex = 0; /* this is used to select the right LP Coefficients according to the subframe currently computed */
+	word16_t LP[2*NB_LSP_COEFF]; /* store the 2 sets of LP coefficients in Q12 */
 
-			/* copy postProcessing Output to the signal output buffer */
-			for (i=0; i<L_SUBFRAME; i++) {
-				signal[subframeIndex+i] = postFilteredSignal[i];
-			}
+	decodeSIDframe(decoderChannelContext->CNGChannelContext, decoderChannelContext->previousFrameIsActiveFlag, bitStream, bitStreamLength, &(decoderChannelContext->excitationVector[L_PAST_EXCITATION]), decoderChannelContext->previousqLSP, LP, &(decoderChannelContext->CNGpseudoRandomSeed), decoderChannelContext->previousLCodeWord, rfc3389PayloadFlag);
+	decoderChannelContext->previousFrameIsActiveFlag = 0;
 
-			/* increase LPCoefficient Indexes */
-			LPCoefficientsIndex+=NB_LSP_COEFF;
-		}
+	/* loop over the two subframes */
+	for (subframeIndex=0; subframeIndex<L_FRAME; subframeIndex+=L_SUBFRAME) {
+		/* reconstruct speech using LP synthesis filter spec 4.1.6 eq77 */
+		/* excitationVector in Q0, LP in Q12, recontructedSpeech in Q0 -> +NB_LSP_COEFF on the index of this one because the first NB_LSP_COEFF elements store the previous frame filter output */
+		decoderChannelContext->stats.saturatedSamplesNbr += LPSynthesisFilter(&(decoderChannelContext->excitationVector[L_PAST_EXCITATION + subframeIndex]), &(LP[LPCoefficientsIndex]), &(decoderChannelContext->reconstructedSpeech[NB_LSP_COEFF+subframeIndex]) );
 
-		decoderChannelContext->boundedAdaptativeCodebookGain = BOUNDED_PITCH_GAIN_MIN;
+		/* NOTE: ITU code check for overflow after LP Synthesis Filter computation and if it happened, divide excitation buffer by 2 and recompute the LP Synthesis Filter */
+		/*	here, possible overflows are managed directly inside the Filter by saturation at MAXINT16 on each result */
 
-		/* Shift Excitation Vector by L_FRAME left */
-		memmove(decoderChannelContext->excitationVector, &(decoderChannelContext->excitationVector[L_FRAME]), L_PAST_EXCITATION*sizeof(word16_t));
-		/* Copy the last 10 words of reconstructed Speech to the begining of the array for next frame computation */
-		memcpy(decoderChannelContext->reconstructedSpeech, &(decoderChannelContext->reconstructedSpeech[L_FRAME]), NB_LSP_COEFF*sizeof(word16_t));
+		/* postFilter and postProcessing, use last frame intPitchDelay */
+		decodeOutputStage(decoderChannelContext, &(LP[LPCoefficientsIndex]), decoderChannelContext->previousIntPitchDelay, subframeIndex, outputFormat, stride, output);
 
-		return;
+		/* increase LPCoefficient Indexes */
+		LPCoefficientsIndex+=NB_LSP_COEFF;
 	}
 
-	decoderChannelContext->previousFrameIsActiveFlag = 1;
-	/* re-init the CNG pseudo random seed at each active frame spec B.4 */
-	decoderChannelContext->CNGpseudoRandomSeed = CNG_DTX_RANDOM_SEED_INIT; /* re-initialise CNG pseudo Random seed to 11111 according to ITU code */
-
+	decoderChannelContext->boundedAdaptativeCodebookGain = BOUNDED_PITCH_GAIN_MIN;
 
-	/*****************************************************************************************/
-	/*** on frame basis : decodeLSP, interpolate them with previous ones and convert to LP ***/
-	decodeLSP(decoderChannelContext, parameters, qLSP, frameErasureFlag); /* decodeLSP need the first 4 parameters: L0-L3 */
+	/* Shift Excitation Vector by L_FRAME left */
+	memmove(decoderChannelContext->excitationVector, &(decoderChannelContext->excitationVector[L_FRAME]), L_PAST_EXCITATION*sizeof(word16_t));
+	/* Copy the last 10 words of reconstructed Speech to the begining of the array for next frame computation */
+	memcpy(decoderChannelContext->reconstructedSpeech, &(decoderChannelContext->reconstructedSpeech[L_FRAME]), NB_LSP_COEFF*sizeof(word16_t));
 
+	/* active speaker detection */
+	updateActiveSpeakerDetection(decoderChannelContext, 0, estimateComfortNoiseEnergy(decoderChannelContext));
+	decoderChannelContext->synthesisFlag = 1;
+	decoderChannelContext->encoderHints.flags = 0;
+}
 
-	interpolateqLSP(decoderChannelContext->previousqLSP, qLSP, interpolatedqLSP);
-	/* copy the currentqLSP to previousqLSP buffer */
-	for (i=0; i<NB_LSP_COEFF; i++) {
-		decoderChannelContext->previousqLSP[i] = qLSP[i];
-	}
+/*****************************************************************************/
+/* decodeActiveFrameSignal : decode an active or erased active frame once    */
+/*      its LP coefficients are computed                                     */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i/o) parameters : 15 parameters as in spec 4 - Table 8, fixed      */
+/*             codebook ones are replaced by pseudo random values on erasure */
+/*      -(i) frameErasureFlag : flag: true, frame has been erased            */
+/*      -(i) LP : 2 sets of 10 LP coefficients in Q12, one per subframe      */
+/*      -(i) outputFormat : one of BCG729_OUTPUT_FORMAT_*                    */
+/*      -(i) stride : distance in samples between two output samples         */
+/*      -(o) output : a decoded frame in the output format                   */
+/*                                                                           */
+/*****************************************************************************/
+static void decodeActiveFrameSignal(bcg729DecoderChannelContextStruct *decoderChannelContext, uint16_t parameters[], uint8_t frameErasureFlag, word16_t LP[], uint8_t outputFormat, uint16_t stride, void *output)
+{
+	int i;
+	int16_t intPitchDelay; /* store the Pitch Delay in and out of decodeAdaptativeCodeVector, in for decodeFixedCodeVector */
+	word16_t fixedCodebookVector[L_SUBFRAME]; /* the fixed Codebook Vector in Q1.13*/
+	uint8_t parityErrorFlag;
+	int subframeIndex;
+	int parametersIndex = 4; /* this is used to select the right parameter according to the subframe currently computed, start pointing to P1 */
+	int LPCoefficientsIndex = 0; /* this is used to select the right LP Coefficients according to the subframe currently computed */
+	word32_t frameEnergy = 0; /* excitation energy estimate used by active speaker detection */
 
-	/* call the qLSP2LP function for first subframe */
-	qLSP2LP(interpolatedqLSP, LP);
-	/* call the qLSP2LP function for second subframe */
-	qLSP2LP(qLSP, &(LP[NB_LSP_COEFF]));
+	/* parameters of this frame given to a tandem encoder, extrapolated ones are not */
+	decoderChannelContext->encoderHints.flags = frameErasureFlag?0:(BCG729_ENCODER_HINT_LSP|BCG729_ENCODER_HINT_PITCH);
+	decoderChannelContext->encoderHints.L1 = parameters[1];
 
 	/* check the parity on the adaptativeCodebookIndexSubframe1(P1) with the received one (P0)*/
 	parityErrorFlag = (uint8_t)(computeParity(parameters[4]) ^ parameters[5]);
+	if (parityErrorFlag && !frameErasureFlag) {
+		decoderChannelContext->stats.parityErrorsNbr++;
+	}
 
 	/* loop over the two subframes */
 	for (subframeIndex=0; subframeIndex<L_FRAME; subframeIndex+=L_SUBFRAME) {
@@ -236,6 +309,7 @@ void bcg729Decoder(bcg729DecoderChannelContextStruct *decoderChannelContext, con
 						&intPitchDelay,
 
 						&(decoderChannelContext->excitationVector[L_PAST_EXCITATION + subframeIndex]));
+		decoderChannelContext->encoderHints.intPitchDelay[subframeIndex/L_SUBFRAME] = intPitchDelay;
 		if (subframeIndex==0) { /* at first subframe we have P0 between P1 and C1 */
 			parametersIndex+=2;
 		} else {
@@ -266,6 +340,9 @@ void bcg729Decoder(bcg729DecoderChannelContextStruct *decoderChannelContext, con
 			decoderChannelContext->boundedAdaptativeCodebookGain = BOUNDED_PITCH_GAIN_MIN;
 		}
 
+		/* excitation energy estimate from gains, mean of the two subframes */
+		frameEnergy = ADD32(frameEnergy, SHR(estimateExcitationEnergy(decoderChannelContext, fixedCodebookVector), 1));
+
 		/* compute excitation vector according to eq75 */
 		/* excitationVector = adaptative Codebook Vector * adaptativeCodebookGain + fixed Codebook Vector * fixedCodebookGain */
 		/* the adaptative Codebook Vector is in the excitationVector buffer [L_PAST_EXCITATION + subframeIndex] */
@@ -281,22 +358,13 @@ void bcg729Decoder(bcg729DecoderChannelContextStruct *decoderChannelContext, con
 
 		/* reconstruct speech using LP synthesis filter spec 4.1.6 eq77 */
 		/* excitationVector in Q0, LP in Q12, recontructedSpeech in Q0 -> +NB_LSP_COEFF on the index of this one because the first NB_LSP_COEFF elements store the previous frame filter output */
-		LPSynthesisFilter(&(decoderChannelContext->excitationVector[L_PAST_EXCITATION + subframeIndex]), &(LP[LPCoefficientsIndex]), &(decoderChannelContext->reconstructedSpeech[NB_LSP_COEFF+subframeIndex]) );
+		decoderChannelContext->stats.saturatedSamplesNbr += LPSynthesisFilter(&(decoderChannelContext->excitationVector[L_PAST_EXCITATION + subframeIndex]), &(LP[LPCoefficientsIndex]), &(decoderChannelContext->reconstructedSpeech[NB_LSP_COEFF+subframeIndex]) );
 
 		/* NOTE: ITU code check for overflow after LP Synthesis Filter computation and if it happened, divide excitation buffer by 2 and recompute the LP Synthesis Filter */
 		/*	here, possible overflows are managed directly inside the Filter by saturation at MAXINT16 on each result */ 
 
-		/* postFilter */
-		postFilter(decoderChannelContext, &(LP[LPCoefficientsIndex]), /* select the LP coefficients for this subframe */
-				&(decoderChannelContext->reconstructedSpeech[NB_LSP_COEFF+subframeIndex]), intPitchDelay, subframeIndex, postFilteredSignal);
-
-		/* postProcessing */
-		postProcessing(decoderChannelContext, postFilteredSignal);
-
-		/* copy postProcessing Output to the signal output buffer */
-		for (i=0; i<L_SUBFRAME; i++) {
-			signal[subframeIndex+i] = postFilteredSignal[i]; 
-		}
+		/* postFilter and postProcessing */
+		decodeOutputStage(decoderChannelContext, &(LP[LPCoefficientsIndex]), intPitchDelay, subframeIndex, outputFormat, stride, output);
 
 		/* increase LPCoefficient Indexes */
 		LPCoefficientsIndex+=NB_LSP_COEFF;
@@ -307,5 +375,343 @@ void bcg729Decoder(bcg729DecoderChannelContextStruct *decoderChannelContext, con
 	/* Copy the last 10 words of reconstructed Speech to the begining of the array for next frame computation */
 	memcpy(decoderChannelContext->reconstructedSpeech, &(decoderChannelContext->reconstructedSpeech[L_FRAME]), NB_LSP_COEFF*sizeof(word16_t));
 
+	/* active speaker detection */
+	updateActiveSpeakerDetection(decoderChannelContext, 1, frameEnergy);
+	decoderChannelContext->synthesisFlag = 1;
+}
+
+/*****************************************************************************/
+/* decodeFrame : decode a frame in the given output format                   */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer          */
+/*      -(i) frameErased: flag: true, frame has been erased                  */
+/*      -(i) SIDFrameFlag: flag: true, frame is a SID one                    */
+/*      -(i) rfc3389PayloadFlag: true when CN payload follow rfc3389         */
+/*      -(i) outputFormat : one of BCG729_OUTPUT_FORMAT_*                    */
+/*      -(i) stride : distance in samples between two output samples         */
+/*      -(o) output : a decoded frame in the output format                   */
+/*                                                                           */
+/*****************************************************************************/
+static void decodeFrame(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, uint8_t outputFormat, uint16_t stride, void *output)
+{
+	int i;
+	uint16_t parameters[NB_PARAMETERS];
+	/* internal buffers which we do not need to keep between calls */
+	word16_t qLSP[NB_LSP_COEFF]; /* store the qLSP coefficients in Q0.15 */
+	word16_t interpolatedqLSP[NB_LSP_COEFF]; /* store the interpolated qLSP coefficient in Q0.15 */
+	word16_t LP[2*NB_LSP_COEFF]; /* store the 2 sets of LP coefficients in Q12 */
+
+	/* this is a SID frame, process it using the dedicated function */
+	if (parseFrame(decoderChannelContext, bitStream, bitStreamLength, frameErasureFlag, SIDFrameFlag, parameters) == 1) {
+		decodeSIDFrameSignal(decoderChannelContext, bitStream, bitStreamLength, rfc3389PayloadFlag, outputFormat, stride, output);
+		return;
+	}
+
+	decoderChannelContext->previousFrameIsActiveFlag = 1;
+	/* re-init the CNG pseudo random seed at each active frame spec B.4 */
+	decoderChannelContext->CNGpseudoRandomSeed = CNG_DTX_RANDOM_SEED_INIT; /* re-initialise CNG pseudo Random seed to 11111 according to ITU code */
+
+
+	/*****************************************************************************************/
+	/*** on frame basis : decodeLSP, interpolate them with previous ones and convert to LP ***/
+	decodeLSP(decoderChannelContext, parameters, qLSP, frameErasureFlag); /* decodeLSP need the first 4 parameters: L0-L3 */
+
+
+	interpolateqLSP(decoderChannelContext->previousqLSP, qLSP, interpolatedqLSP);
+	/* copy the currentqLSP to previousqLSP buffer */
+	for (i=0; i<NB_LSP_COEFF; i++) {
+		decoderChannelContext->previousqLSP[i] = qLSP[i];
+	}
+
+	/* call the qLSP2LP function for first subframe */
+	qLSP2LP(interpolatedqLSP, LP);
+	/* call the qLSP2LP function for second subframe */
+	qLSP2LP(qLSP, &(LP[NB_LSP_COEFF]));
+
+	decodeActiveFrameSignal(decoderChannelContext, parameters, frameErasureFlag, LP, outputFormat, stride, output);
 	return;
 }
+
+/*****************************************************************************/
+/* bcg729Decoder :                                                           */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer          */
+/*      -(i) frameErased: flag: true, frame has been erased                  */
+/*      -(i) SIDFrameFlag: flag: true, frame is a SID one                    */
+/*      -(i) rfc3389PayloadFlag: true when CN payload follow rfc3389         */
+/*      -(o) signal : a decoded frame 80 samples (16 bits PCM)               */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729Decoder(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, int16_t signal[])
+{
+	if (decoderChannelContext->traceWriter == NULL) {
+		decodeFrame(decoderChannelContext, bitStream, bitStreamLength, frameErasureFlag, SIDFrameFlag, rfc3389PayloadFlag, BCG729_OUTPUT_FORMAT_PCM16, 1, signal);
+		return;
+	}
+
+	traceDecoderSync(decoderChannelContext);
+	decodeFrame(decoderChannelContext, bitStream, bitStreamLength, frameErasureFlag, SIDFrameFlag, rfc3389PayloadFlag, BCG729_OUTPUT_FORMAT_PCM16, 1, signal);
+	traceDecoderFrame(decoderChannelContext, bitStream, bitStreamLength, frameErasureFlag, SIDFrameFlag, rfc3389PayloadFlag, signal);
+}
+
+/*****************************************************************************/
+/* bcg729DecoderFormatted : decode a frame as bcg729Decoder does and write   */
+/*      it in the output format of the channel                               */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer          */
+/*      -(i) frameErased: flag: true, frame has been erased                  */
+/*      -(i) SIDFrameFlag: flag: true, frame is a SID one                    */
+/*      -(i) rfc3389PayloadFlag: true when CN payload follow rfc3389         */
+/*      -(o) output : a decoded frame in the channel output format           */
+/*    return value : number of bytes written in output                       */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t bcg729DecoderFormatted(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, void *output)
+{
+	decodeFrame(decoderChannelContext, bitStream, bitStreamLength, frameErasureFlag, SIDFrameFlag, rfc3389PayloadFlag, decoderChannelContext->outputFormat, 1, output);
+	return getOutputFrameSize(decoderChannelContext->outputFormat);
+}
+
+/*****************************************************************************/
+/* bcg729DecoderStrided : decode a frame as bcg729DecoderFormatted does and  */
+/*      write its samples interleaved with other channels ones               */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer          */
+/*      -(i) frameErased: flag: true, frame has been erased                  */
+/*      -(i) SIDFrameFlag: flag: true, frame is a SID one                    */
+/*      -(i) rfc3389PayloadFlag: true when CN payload follow rfc3389         */
+/*      -(o) output : first sample of the frame in the channel output format */
+/*      -(i) stride : distance in samples between two samples of the frame,  */
+/*           0 is handled as 1                                               */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729DecoderStrided(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, void *output, uint16_t stride)
+{
+	decodeFrame(decoderChannelContext, bitStream, bitStreamLength, frameErasureFlag, SIDFrameFlag, rfc3389PayloadFlag, decoderChannelContext->outputFormat, (stride==0)?1:stride, output);
+}
+
+/*****************************************************************************/
+/* bcg729DecoderMultiChannel : decode one frame on each channel of a set,    */
+/*      see decoder.h                                                        */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContexts : channelsNbr distinct channels        */
+/*      -(i) channelsNbr : number of channels                                */
+/*      -(i) bitStreams : channelsNbr frames payloads, may be NULL           */
+/*      -(i) bitStreamLength : channelsNbr payloads lengths in bytes         */
+/*      -(i) frameErasureFlag : channelsNbr flags                            */
+/*      -(i) SIDFrameFlag : channelsNbr flags                                */
+/*      -(i) rfc3389PayloadFlag : true when CN payload follow rfc3389        */
+/*      -(o) signals : channelsNbr buffers of 80 samples (16 bits PCM)       */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729DecoderMultiChannel(bcg729DecoderChannelContextStruct *decoderChannelContexts[], uint16_t channelsNbr, const uint8_t *bitStreams[], const uint8_t bitStreamLength[], const uint8_t frameErasureFlag[], const uint8_t SIDFrameFlag[], uint8_t rfc3389PayloadFlag, int16_t *signals[])
+{
+	int i, k;
+	uint16_t firstChannel, channel;
+
+	for (channel=0; channel<channelsNbr; channel++) {
+		if (decoderChannelContexts[channel]->traceWriter != NULL) {
+			traceDecoderSync(decoderChannelContexts[channel]);
+		}
+	}
+
+	/* channels are processed by groups of MULTI_CHANNEL_LANES: each channel decodes its frame LSP, the conversion to LP */
+	/* is done for the active frames of the group at once, in lanes, then each channel decodes its subframes. */
+	/* SID frames are decoded channel by channel */
+	for (firstChannel=0; firstChannel<channelsNbr; firstChannel+=MULTI_CHANNEL_LANES) {
+		bcg729DecoderChannelContextStruct *laneContexts[MULTI_CHANNEL_LANES];
+		uint16_t parameters[MULTI_CHANNEL_LANES][NB_PARAMETERS];
+		uint8_t laneFrameErasureFlag[MULTI_CHANNEL_LANES];
+		uint16_t laneChannel[MULTI_CHANNEL_LANES];
+		int lanesNbr = 0;
+		word16_t qLSP[NB_LSP_COEFF][MULTI_CHANNEL_LANES]; /* qLSP in Q0.15 */
+		word16_t previousqLSP[NB_LSP_COEFF][MULTI_CHANNEL_LANES]; /* qLSP of previous frame in Q0.15 */
+		word16_t interpolatedqLSP[NB_LSP_COEFF][MULTI_CHANNEL_LANES]; /* interpolated qLSP in Q0.15 */
+		word16_t LP[2][NB_LSP_COEFF][MULTI_CHANNEL_LANES]; /* LP coefficients of each subframe in Q12 */
+
+		for (channel=firstChannel; channel<channelsNbr && channel<firstChannel+MULTI_CHANNEL_LANES; channel++) {
+			bcg729DecoderChannelContextStruct *decoderChannelContext = decoderChannelContexts[channel];
+			const uint8_t *bitStream = (bitStreams!=NULL)?bitStreams[channel]:NULL;
+			word16_t laneqLSP[NB_LSP_COEFF];
+
+			if (parseFrame(decoderChannelContext, bitStream, bitStreamLength[channel], frameErasureFlag[channel], SIDFrameFlag[channel], parameters[lanesNbr]) == 1) {
+				decodeSIDFrameSignal(decoderChannelContext, bitStream, bitStreamLength[channel], rfc3389PayloadFlag, BCG729_OUTPUT_FORMAT_PCM16, 1, signals[channel]);
+				continue;
+			}
+
+			decoderChannelContext->previousFrameIsActiveFlag = 1;
+			/* re-init the CNG pseudo random seed at each active frame spec B.4 */
+			decoderChannelContext->CNGpseudoRandomSeed = CNG_DTX_RANDOM_SEED_INIT;
+
+			/* decodeLSP is a chain of dependent steps on the channel MA predictor memory: it runs faster channel by channel than in lanes */
+			decodeLSP(decoderChannelContext, parameters[lanesNbr], laneqLSP, frameErasureFlag[channel]);
+			for (i=0; i<NB_LSP_COEFF; i++) {
+				qLSP[i][lanesNbr] = laneqLSP[i];
+				previousqLSP[i][lanesNbr] = decoderChannelContext->previousqLSP[i];
+				decoderChannelContext->previousqLSP[i] = laneqLSP[i];
+			}
+
+			laneContexts[lanesNbr] = decoderChannelContext;
+			laneFrameErasureFlag[lanesNbr] = frameErasureFlag[channel];
+			laneChannel[lanesNbr] = channel;
+			lanesNbr++;
+		}
+
+		/*** interpolate qLSP with previous ones and convert to LP ***/
+		if (lanesNbr >= MULTI_CHANNEL_LANES/2) { /* the lanes conversion costs the same whatever the number of used lanes */
+			for (k=lanesNbr; k<MULTI_CHANNEL_LANES; k++) { /* unused lanes replicate the first one */
+				for (i=0; i<NB_LSP_COEFF; i++) {
+					qLSP[i][k] = qLSP[i][0];
+					previousqLSP[i][k] = previousqLSP[i][0];
+				}
+			}
+			interpolateqLSPMultiChannel(previousqLSP, qLSP, interpolatedqLSP);
+			qLSP2LPMultiChannel(interpolatedqLSP, LP[0]);
+			qLSP2LPMultiChannel(qLSP, LP[1]);
+		} else {
+			for (k=0; k<lanesNbr; k++) {
+				word16_t lanePreviousqLSP[NB_LSP_COEFF], laneqLSP[NB_LSP_COEFF], laneInterpolatedqLSP[NB_LSP_COEFF], laneLP[NB_LSP_COEFF];
+				for (i=0; i<NB_LSP_COEFF; i++) {
+					lanePreviousqLSP[i] = previousqLSP[i][k];
+					laneqLSP[i] = qLSP[i][k];
+				}
+				interpolateqLSP(lanePreviousqLSP, laneqLSP, laneInterpolatedqLSP);
+				qLSP2LP(laneInterpolatedqLSP, laneLP);
+				for (i=0; i<NB_LSP_COEFF; i++) {
+					LP[0][i][k] = laneLP[i];
+				}
+				qLSP2LP(laneqLSP, laneLP);
+				for (i=0; i<NB_LSP_COEFF; i++) {
+					LP[1][i][k] = laneLP[i];
+				}
+			}
+		}
+
+		/*** subframes decoding ***/
+		for (k=0; k<lanesNbr; k++) {
+			word16_t laneLP[2*NB_LSP_COEFF];
+			for (i=0; i<NB_LSP_COEFF; i++) {
+				laneLP[i] = LP[0][i][k];
+				laneLP[NB_LSP_COEFF+i] = LP[1][i][k];
+			}
+			decodeActiveFrameSignal(laneContexts[k], parameters[k], laneFrameErasureFlag[k], laneLP, BCG729_OUTPUT_FORMAT_PCM16, 1, signals[laneChannel[k]]);
+		}
+	}
+
+	for (channel=0; channel<channelsNbr; channel++) {
+		if (decoderChannelContexts[channel]->traceWriter != NULL) {
+			traceDecoderFrame(decoderChannelContexts[channel], (bitStreams!=NULL)?bitStreams[channel]:NULL, bitStreamLength[channel], frameErasureFlag[channel], SIDFrameFlag[channel], rfc3389PayloadFlag, signals[channel]);
+		}
+	}
+}
+
+/*****************************************************************************/
+/* bcg729DecoderAdvance : update the decoder state with a frame without      */
+/*      producing any signal: LSP, pitch delay, gains and SID parameters are */
+/*      decoded, excitation, synthesis and post filter are not computed      */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer          */
+/*      -(i) frameErased: flag: true, frame has been erased                  */
+/*      -(i) SIDFrameFlag: flag: true, frame is a SID one                    */
+/*      -(i) rfc3389PayloadFlag: true when CN payload follow rfc3389         */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729DecoderAdvance(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag)
+{
+	bcg729FrameFeatures features;
+
+	analyzeDecoderFrame(decoderChannelContext, bitStream, bitStreamLength, frameErasureFlag, SIDFrameFlag, rfc3389PayloadFlag, &features);
+	decoderChannelContext->traceSyncFlag = 0; /* the frame is not traced */
+
+	/* past excitation and synthesis filter memory are not valid anymore: reset them so a fully decoded frame can follow */
+	memset(decoderChannelContext->excitationVector, 0, L_PAST_EXCITATION*sizeof(word16_t));
+	memset(decoderChannelContext->reconstructedSpeech, 0, NB_LSP_COEFF*sizeof(word16_t));
+	decoderChannelContext->encoderHints.flags = 0;
+}
+
+/*****************************************************************************/
+/* bcg729GetDecoderStats : get the operational counters of a channel         */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(o) stats : counters since the channel creation or the last reset   */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729GetDecoderStats(bcg729DecoderChannelContextStruct *decoderChannelContext, bcg729DecoderStats *stats)
+{
+	*stats = decoderChannelContext->stats;
+	stats->LSPConversionFailuresNbr = decoderChannelContext->CNGChannelContext->LSPConversionFailuresNbr;
+}
+
+/*****************************************************************************/
+/* bcg729ResetDecoderStats : reset the operational counters of a channel     */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729ResetDecoderStats(bcg729DecoderChannelContextStruct *decoderChannelContext)
+{
+	memset(&(decoderChannelContext->stats), 0, sizeof(bcg729DecoderStats));
+	decoderChannelContext->CNGChannelContext->LSPConversionFailuresNbr = 0;
+}
+
+/*****************************************************************************/
+/* bcg729GetEncoderHints : get the parameters of the last decoded frame to   */
+/*      be given to bcg729SetEncoderHints when the decoded signal is         */
+/*      re-encoded                                                           */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(o) hints : the encoder hints                                       */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729GetEncoderHints(bcg729DecoderChannelContextStruct *decoderChannelContext, bcg729EncoderHints *hints)
+{
+	*hints = decoderChannelContext->encoderHints;
+}
+
+/*****************************************************************************/
+/* bcg729SetDecoderMode : select the output stages used by the decoder       */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) mode : one of BCG729_DECODER_MODE_*, unknown values select      */
+/*           BCG729_DECODER_MODE_STANDARD                                    */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729SetDecoderMode(bcg729DecoderChannelContextStruct *decoderChannelContext, uint8_t mode)
+{
+	if (mode == BCG729_DECODER_MODE_NO_POSTFILTER || mode == BCG729_DECODER_MODE_RAW) {
+		decoderChannelContext->decoderMode = mode;
+	} else {
+		decoderChannelContext->decoderMode = BCG729_DECODER_MODE_STANDARD;
+	}
+}
+
+/*****************************************************************************/
+/* bcg729SetDecoderOutputFormat : select the output format written by       */
+/*      bcg729DecoderFormatted on this channel                               */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) format : one of BCG729_OUTPUT_FORMAT_*, unknown values select   */
+/*           BCG729_OUTPUT_FORMAT_PCM16                                      */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729SetDecoderOutputFormat(bcg729DecoderChannelContextStruct *decoderChannelContext, uint8_t format)
+{
+	if (format > BCG729_OUTPUT_FORMAT_PCM16_48KHZ) {
+		format = BCG729_OUTPUT_FORMAT_PCM16;
+	}
+	if (format != decoderChannelContext->outputFormat) {
+		/* upsampling memory is updated only by the upsampled formats: reset it */
+		memset(decoderChannelContext->upsamplingMemory, 0, (UPSAMPLING_TAPS_PER_PHASE-1)*sizeof(word16_t));
+		decoderChannelContext->outputFormat = format;
+	}
+}
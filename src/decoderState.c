@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "typedef.h"
+#include "codecParameters.h"
+#include "basicOperationsMacros.h"
+
+#include "decoderState.h"
+
+/* little endian serialization, buffer pointer is advanced */
+static void writeWords(uint8_t **state, const word16_t *words, int wordsNbr)
+{
+	int i;
+	for (i=0; i<wordsNbr; i++) {
+		(*state)[2*i] = (uint8_t)(words[i]&0xFF);
+		(*state)[2*i+1] = (uint8_t)((words[i]>>8)&0xFF);
+	}
+	*state += 2*wordsNbr;
+}
+
+static void readWords(const uint8_t **state, word16_t *words, int wordsNbr)
+{
+	int i;
+	for (i=0; i<wordsNbr; i++) {
+		words[i] = (word16_t)((uint16_t)(*state)[2*i] | ((uint16_t)(*state)[2*i+1]<<8));
+	}
+	*state += 2*wordsNbr;
+}
+
+static void writeWord(uint8_t **state, word16_t word)
+{
+	writeWords(state, &word, 1);
+}
+
+static word16_t readWord(const uint8_t **state)
+{
+	word16_t word;
+	readWords(state, &word, 1);
+	return word;
+}
+
+static void writeWord32(uint8_t **state, word32_t word)
+{
+	writeWord(state, (word16_t)(word&0xFFFF));
+	writeWord(state, (word16_t)((word>>16)&0xFFFF));
+}
+
+static word32_t readWord32(const uint8_t **state)
+{
+	uword32_t low = (uint16_t)readWord(state);
+	uword32_t high = (uint16_t)readWord(state);
+	return (word32_t)(low | (high<<16));
+}
+
+/*****************************************************************************/
+/* saveDecoderState : serialize the decoder channel state between two frames */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(o) state : DECODER_STATE_SIZE bytes                                */
+/*                                                                           */
+/*****************************************************************************/
+void saveDecoderState(bcg729DecoderChannelContextStruct *decoderChannelContext, uint8_t state[])
+{
+	bcg729CNGChannelContextStruct *CNGChannelContext = decoderChannelContext->CNGChannelContext;
+	int i;
+
+	/* decoder: between two frames, only the past part of excitation and reconstructed speech buffers is used */
+	writeWords(&state, decoderChannelContext->previousqLSP, NB_LSP_COEFF);
+	writeWords(&state, decoderChannelContext->excitationVector, L_PAST_EXCITATION);
+	writeWord(&state, decoderChannelContext->boundedAdaptativeCodebookGain);
+	writeWord(&state, decoderChannelContext->adaptativeCodebookGain);
+	writeWord(&state, decoderChannelContext->fixedCodebookGain);
+	writeWords(&state, decoderChannelContext->reconstructedSpeech, NB_LSP_COEFF);
+	writeWord(&state, (word16_t)decoderChannelContext->pseudoRandomSeed);
+	writeWord(&state, (word16_t)decoderChannelContext->CNGpseudoRandomSeed);
+
+	/* decodeLSP, decodeAdaptativeCodeVector and decodeGains */
+	writeWords(&state, decoderChannelContext->lastqLSF, NB_LSP_COEFF);
+	for (i=0; i<MA_MAX_K; i++) {
+		writeWords(&state, decoderChannelContext->previousLCodeWord[i], NB_LSP_COEFF);
+	}
+	writeWord(&state, decoderChannelContext->lastValidL0);
+	writeWord(&state, (word16_t)decoderChannelContext->previousIntPitchDelay);
+	writeWords(&state, decoderChannelContext->previousGainPredictionError, 4);
+
+	/* postFilter: the scaled residual signal is the residual one shifted by 2, it is not saved */
+	writeWords(&state, decoderChannelContext->residualSignalBuffer, MAXIMUM_INT_PITCH_DELAY);
+	writeWord(&state, decoderChannelContext->longTermFilteredResidualSignalBuffer[0]);
+	writeWords(&state, decoderChannelContext->shortTermFilteredResidualSignalBuffer, NB_LSP_COEFF);
+	writeWord(&state, decoderChannelContext->previousAdaptativeGain);
+	writeWord(&state, decoderChannelContext->postFilterPitchDelay);
+
+	/* postProcessing */
+	writeWord(&state, decoderChannelContext->inputX0);
+	writeWord(&state, decoderChannelContext->inputX1);
+	writeWord32(&state, decoderChannelContext->outputY2);
+	writeWord32(&state, decoderChannelContext->outputY1);
+
+	/* CNG */
+	writeWord(&state, CNGChannelContext->receivedSIDGain);
+	writeWord(&state, CNGChannelContext->smoothedSIDGain);
+	writeWords(&state, CNGChannelContext->qLSP, NB_LSP_COEFF);
+	writeWord32(&state, (word32_t)(CNGChannelContext->lastFrameEnergy&0xFFFFFFFF));
+	writeWord32(&state, (word32_t)(CNGChannelContext->lastFrameEnergy>>32));
+	writeWord(&state, decoderChannelContext->previousFrameIsActiveFlag);
+
+	/* active speaker detection */
+	writeWord32(&state, decoderChannelContext->excitationEnergy);
+	writeWord(&state, decoderChannelContext->smoothedEnergydB);
+	writeWord(&state, decoderChannelContext->noiseFloordB);
+	writeWord(&state, decoderChannelContext->activityHangover);
+	writeWord(&state, decoderChannelContext->synthesisFlag);
+}
+
+/*****************************************************************************/
+/* restoreDecoderState : set the decoder channel state saved by              */
+/*      saveDecoderState                                                     */
+/*    parameters:                                                            */
+/*      -(o) decoderChannelContext : the channel context data                */
+/*      -(i) state : DECODER_STATE_SIZE bytes                                */
+/*                                                                           */
+/*****************************************************************************/
+void restoreDecoderState(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t state[])
+{
+	bcg729CNGChannelContextStruct *CNGChannelContext = decoderChannelContext->CNGChannelContext;
+	word32_t lastFrameEnergyLow;
+	int i;
+
+	decoderChannelContext->traceSyncFlag = 0; /* a trace of this channel must hold the new state */
+
+	/* decoder */
+	readWords(&state, decoderChannelContext->previousqLSP, NB_LSP_COEFF);
+	readWords(&state, decoderChannelContext->excitationVector, L_PAST_EXCITATION);
+	decoderChannelContext->boundedAdaptativeCodebookGain = readWord(&state);
+	decoderChannelContext->adaptativeCodebookGain = readWord(&state);
+	decoderChannelContext->fixedCodebookGain = readWord(&state);
+	readWords(&state, decoderChannelContext->reconstructedSpeech, NB_LSP_COEFF);
+	decoderChannelContext->pseudoRandomSeed = (uint16_t)readWord(&state);
+	decoderChannelContext->CNGpseudoRandomSeed = (uint16_t)readWord(&state);
+
+	/* decodeLSP, decodeAdaptativeCodeVector and decodeGains */
+	readWords(&state, decoderChannelContext->lastqLSF, NB_LSP_COEFF);
+	for (i=0; i<MA_MAX_K; i++) {
+		readWords(&state, decoderChannelContext->previousLCodeWord[i], NB_LSP_COEFF);
+	}
+	decoderChannelContext->lastValidL0 = readWord(&state);
+	decoderChannelContext->previousIntPitchDelay = (uint16_t)readWord(&state);
+	readWords(&state, decoderChannelContext->previousGainPredictionError, 4);
+
+	/* postFilter */
+	readWords(&state, decoderChannelContext->residualSignalBuffer, MAXIMUM_INT_PITCH_DELAY);
+	for (i=0; i<MAXIMUM_INT_PITCH_DELAY; i++) {
+		decoderChannelContext->scaledResidualSignalBuffer[i] = PSHR(decoderChannelContext->residualSignalBuffer[i], 2);
+	}
+	decoderChannelContext->longTermFilteredResidualSignalBuffer[0] = readWord(&state);
+	readWords(&state, decoderChannelContext->shortTermFilteredResidualSignalBuffer, NB_LSP_COEFF);
+	decoderChannelContext->previousAdaptativeGain = readWord(&state);
+	decoderChannelContext->postFilterPitchDelay = readWord(&state);
+
+	/* postProcessing */
+	decoderChannelContext->inputX0 = readWord(&state);
+	decoderChannelContext->inputX1 = readWord(&state);
+	decoderChannelContext->outputY2 = readWord32(&state);
+	decoderChannelContext->outputY1 = readWord32(&state);
+
+	/* CNG */
+	CNGChannelContext->receivedSIDGain = readWord(&state);
+	CNGChannelContext->smoothedSIDGain = readWord(&state);
+	readWords(&state, CNGChannelContext->qLSP, NB_LSP_COEFF);
+	lastFrameEnergyLow = readWord32(&state);
+	CNGChannelContext->lastFrameEnergy = (word64_t)(((uint64_t)(uword32_t)readWord32(&state)<<32) | (uword32_t)lastFrameEnergyLow);
+	decoderChannelContext->previousFrameIsActiveFlag = (uint8_t)readWord(&state);
+
+	/* active speaker detection */
+	decoderChannelContext->excitationEnergy = readWord32(&state);
+	decoderChannelContext->smoothedEnergydB = readWord(&state);
+	decoderChannelContext->noiseFloordB = readWord(&state);
+	decoderChannelContext->activityHangover = (uint8_t)readWord(&state);
+	decoderChannelContext->synthesisFlag = (uint8_t)readWord(&state);
+
+	/* encoder hints and time scaling buffer belong to the previous position */
+	decoderChannelContext->encoderHints.flags = 0;
+	decoderChannelContext->timeScaleBufferLength = 0;
+	decoderChannelContext->timeScaleDebt = 0;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef DECODERSTATE_H
+#define DECODERSTATE_H
+/*****************************************************************************/
+/* saveDecoderState : serialize the decoder channel state between two frames */
+/*      in a portable(little endian) buffer. Decoder mode, encoder hints and */
+/*      time scaling buffer are not part of it                               */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(o) state : DECODER_STATE_SIZE bytes                                */
+/*                                                                           */
+/*****************************************************************************/
+void saveDecoderState(bcg729DecoderChannelContextStruct *decoderChannelContext, uint8_t state[]);
+
+/*****************************************************************************/
+/* restoreDecoderState : set the decoder channel state saved by              */
+/*      saveDecoderState, decoding resumes bit exact from the saved frame    */
+/*    parameters:                                                            */
+/*      -(o) decoderChannelContext : the channel context data                */
+/*      -(i) state : DECODER_STATE_SIZE bytes                                */
+/*                                                                           */
+/*****************************************************************************/
+void restoreDecoderState(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t state[]);
+#endif /* ifndef DECODERSTATE_H */
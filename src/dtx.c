@@ -225,20 +225,9 @@ bcg729DTXChannelContextStruct *initBcg729DTXChannel() {
 /*                                                                                         */
 /*******************************************************************************************/
 void updateDTXContext(bcg729DTXChannelContextStruct *DTXChannelContext, word32_t *autocorrelationCoefficients, int8_t autocorrelationCoefficientsScale) {
-	/* move previous autocorrelation coefficients and store the new one */ 
-	/* TODO: optimise it buy using rolling index */
-	memcpy(DTXChannelContext->autocorrelationCoefficients[6], DTXChannelContext->autocorrelationCoefficients[5], (NB_LSP_COEFF+1)*sizeof(word32_t));
-	DTXChannelContext->autocorrelationCoefficientsScale[6] = DTXChannelContext->autocorrelationCoefficientsScale[5];
-	memcpy(DTXChannelContext->autocorrelationCoefficients[5], DTXChannelContext->autocorrelationCoefficients[4], (NB_LSP_COEFF+1)*sizeof(word32_t));
-	DTXChannelContext->autocorrelationCoefficientsScale[5] = DTXChannelContext->autocorrelationCoefficientsScale[4];
-	memcpy(DTXChannelContext->autocorrelationCoefficients[4], DTXChannelContext->autocorrelationCoefficients[3], (NB_LSP_COEFF+1)*sizeof(word32_t));
-	DTXChannelContext->autocorrelationCoefficientsScale[4] = DTXChannelContext->autocorrelationCoefficientsScale[3];
-	memcpy(DTXChannelContext->autocorrelationCoefficients[3], DTXChannelContext->autocorrelationCoefficients[2], (NB_LSP_COEFF+1)*sizeof(word32_t));
-	DTXChannelContext->autocorrelationCoefficientsScale[3] = DTXChannelContext->autocorrelationCoefficientsScale[2];
-	memcpy(DTXChannelContext->autocorrelationCoefficients[2], DTXChannelContext->autocorrelationCoefficients[1], (NB_LSP_COEFF+1)*sizeof(word32_t));
-	DTXChannelContext->autocorrelationCoefficientsScale[2] = DTXChannelContext->autocorrelationCoefficientsScale[1];
-	memcpy(DTXChannelContext->autocorrelationCoefficients[1], DTXChannelContext->autocorrelationCoefficients[0], (NB_LSP_COEFF+1)*sizeof(word32_t));
-	DTXChannelContext->autocorrelationCoefficientsScale[1] = DTXChannelContext->autocorrelationCoefficientsScale[0];
+	/* move previous autocorrelation coefficients and store the new one: the history is contiguous, shift it at once */
+	memmove(DTXChannelContext->autocorrelationCoefficients[1], DTXChannelContext->autocorrelationCoefficients[0], 6*(NB_LSP_COEFF+1)*sizeof(word32_t));
+	memmove(&(DTXChannelContext->autocorrelationCoefficientsScale[1]), DTXChannelContext->autocorrelationCoefficientsScale, 6*sizeof(int8_t));
 	memcpy(DTXChannelContext->autocorrelationCoefficients[0], autocorrelationCoefficients, (NB_LSP_COEFF+1)*sizeof(word32_t));
 	DTXChannelContext->autocorrelationCoefficientsScale[0] = autocorrelationCoefficientsScale;
 }
@@ -367,6 +356,7 @@ void encodeSIDFrame(bcg729DTXChannelContextStruct *DTXChannelContext, word16_t *
 			if (!LP2LSPConversion(pastAverageLPCoefficients, LSPCoefficients)) {
 				/* unable to find the 10 roots repeat previous LSP */
 				memcpy(LSPCoefficients, previousqLSPCoefficients, NB_LSP_COEFF*sizeof(word16_t));
+				DTXChannelContext->LSPConversionFailuresNbr++;
 			}
 			/* LPCoefficientAutocorrelation are already in DTXChannelContext */ 
 			/* save the reflection coefficients in the DTX context as they will be requested to generate RFC3389 payload */
@@ -378,6 +368,7 @@ void encodeSIDFrame(bcg729DTXChannelContextStruct *DTXChannelContext, word16_t *
 			if (!LP2LSPConversion(LPCoefficients, LSPCoefficients)) {
 				/* unable to find the 10 roots repeat previous LSP */
 				memcpy(LSPCoefficients, previousqLSPCoefficients, NB_LSP_COEFF*sizeof(word16_t));
+				DTXChannelContext->LSPConversionFailuresNbr++;
 			}
 			/* save the reflection coefficients in the DTX context as they will be requested to generate RFC3389 payload */
 			memcpy(DTXChannelContext->reflectionCoefficients, reflectionCoefficients, NB_LSP_COEFF*sizeof(word32_t));
@@ -25,6 +25,7 @@
 #include "utils.h"
 
 #include "bcg729/encoder.h"
+#include "encoder.h"
 
 #include "interpolateqLSP.h"
 #include "qLSP2LP.h"
@@ -42,10 +43,104 @@
 #include "g729FixedPointMath.h"
 #include "vad.h"
 #include "dtx.h"
+#include "trace.h"
 
 /* buffers allocation */
 static const word16_t previousLSPInitialValues[NB_LSP_COEFF] = {30000, 26000, 21000, 15000, 8000, 0, -8000,-15000,-21000,-26000}; /* in Q0.15 the initials values for the previous LSP buffer */
 
+/* number of null frames needed to get a null LP analysis window */
+#define ZERO_SIGNAL_LP_ANALYSIS_FRAMES (L_LP_ANALYSIS_WINDOW/L_FRAME)
+
+/* weighting factors of the quantized LP coefficients: Gamma^(i+1) (i=0..9) with Gamma = 0.75 in Q15, spec A3.3.3 */
+static const word16_t weightingFactors[NB_LSP_COEFF] = {GAMMA_E1, GAMMA_E2, GAMMA_E3, GAMMA_E4, GAMMA_E5, GAMMA_E6, GAMMA_E7, GAMMA_E8, GAMMA_E9, GAMMA_E10};
+
+/*****************************************************************************/
+/* frameLPAnalysis : LP analysis of the signal buffer, conversion to LSP and */
+/*      LSF: computed once per frame and shared by VAD, DTX and LSP          */
+/*      quantization                                                         */
+/*    parameters:                                                            */
+/*      -(i) encoderChannelContext : context for this encoder channel        */
+/*      -(o) frameAnalysis : the frame LP analysis, LSP and LSF are not set  */
+/*           when the LSP conversion fails                                   */
+/*                                                                           */
+/*****************************************************************************/
+static void frameLPAnalysis(bcg729EncoderChannelContextStruct *encoderChannelContext, bcg729FrameAnalysisStruct *frameAnalysis)
+{
+	int i;
+
+	/* use the whole signal Buffer for windowing and autocorrelation */
+	/* autoCorrelation Coefficients are computed and used internally, in case of VAD we must compute and retrieve 13 coefficients, compute only 11 when VAD is disabled */
+	computeLP(encoderChannelContext->signalBuffer, frameAnalysis->LPCoefficients, frameAnalysis->reflectionCoefficients, frameAnalysis->autoCorrelationCoefficients, frameAnalysis->noLagAutoCorrelationCoefficients, &(frameAnalysis->autoCorrelationCoefficientsScale), (encoderChannelContext->VADChannelContext != NULL)?(NB_LSP_COEFF+3):(NB_LSP_COEFF+1));
+	frameAnalysis->LSPConversionSuccess = LP2LSPConversion(frameAnalysis->LPCoefficients, frameAnalysis->LSPCoefficients);
+
+	/*** compute LSF in Q2.13 : lsf = arcos(lsp) range [0, Pi[ spec 3.2.4 eq18 ***/
+	if (frameAnalysis->LSPConversionSuccess) {
+		for (i=0; i<NB_LSP_COEFF; i++) {
+			frameAnalysis->LSFCoefficients[i] = g729Acos_Q15Q13(frameAnalysis->LSPCoefficients[i]);
+		}
+	}
+}
+
+/*****************************************************************************/
+/* zeroSignalLPAnalysis : LP analysis of an all zero signal buffer: computed */
+/*      on first call and then retrieved from the channel context            */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*      -(o) frameAnalysis : see frameLPAnalysis                             */
+/*                                                                           */
+/*****************************************************************************/
+static void zeroSignalLPAnalysis(bcg729EncoderChannelContextStruct *encoderChannelContext, bcg729FrameAnalysisStruct *frameAnalysis)
+{
+	bcg729ZeroSignalAnalysisStruct *zeroSignalAnalysis = &(encoderChannelContext->zeroSignalAnalysis);
+
+	if (!zeroSignalAnalysis->LPAnalysisValid) {
+		frameLPAnalysis(encoderChannelContext, &(zeroSignalAnalysis->frameAnalysis));
+		zeroSignalAnalysis->LPAnalysisValid = 1;
+	}
+
+	*frameAnalysis = zeroSignalAnalysis->frameAnalysis;
+}
+
+/*****************************************************************************/
+/* computeWeightedqLPCoefficients : weight the quantized LP coefficients of  */
+/*      both subframes according to spec A3.3.3                              */
+/*    parameters:                                                            */
+/*      -(i) qLPCoefficients : 2 sets of 10 qLP coefficients in Q3.12        */
+/*      -(o) weightedqLPCoefficients : 2 sets of 10 coefficients in Q3.12    */
+/*                                                                           */
+/*****************************************************************************/
+static void computeWeightedqLPCoefficients(const word16_t qLPCoefficients[], word16_t weightedqLPCoefficients[])
+{
+	int i;
+
+	/*  weightedqLPCoefficients[i] = qLPCoefficients[i]*Gamma^(i+1) (i=0..9) for each subframe */
+	for (i=0; i<NB_LSP_COEFF; i++) {
+		weightedqLPCoefficients[i] = MULT16_16_P15(qLPCoefficients[i], weightingFactors[i]);
+		weightedqLPCoefficients[NB_LSP_COEFF+i] = MULT16_16_P15(qLPCoefficients[NB_LSP_COEFF+i], weightingFactors[i]);
+	}
+}
+
+/*****************************************************************************/
+/* encoderWeightedSpeech : call computeWeightedSpeech unless input signal,   */
+/*      its 10 previous values and the weighted signal filter memory are all */
+/*      zero: weighted and LP residual signals are then null too            */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*      -(i) qLPCoefficients, weightedqLPCoefficients : 20 values in Q12     */
+/*      -(o) LPResidualSignal: 80 values of residual signal in Q0            */
+/*                                                                           */
+/*****************************************************************************/
+static void encoderWeightedSpeech(bcg729EncoderChannelContextStruct *encoderChannelContext, word16_t qLPCoefficients[], word16_t weightedqLPCoefficients[], word16_t LPResidualSignal[])
+{
+	if (encoderChannelContext->zeroSignalFramesCount >= ZERO_SIGNAL_LP_ANALYSIS_FRAMES
+		&& isNullVector(&(encoderChannelContext->weightedInputSignal[MAXIMUM_INT_PITCH_DELAY-NB_LSP_COEFF]), NB_LSP_COEFF)) {
+		memset(&(encoderChannelContext->weightedInputSignal[MAXIMUM_INT_PITCH_DELAY]), 0, L_FRAME*sizeof(word16_t));
+		memset(LPResidualSignal, 0, L_FRAME*sizeof(word16_t));
+	} else {
+		computeWeightedSpeech(encoderChannelContext->signalCurrentFrame, qLPCoefficients, weightedqLPCoefficients, &(encoderChannelContext->weightedInputSignal[MAXIMUM_INT_PITCH_DELAY]), LPResidualSignal); /* weightedInputSignal contains MAXIMUM_INT_PITCH_DELAY values from previous frame, points to current frame */
+	}
+}
+
 /*****************************************************************************/
 /* initBcg729EncoderChannel : create context structure and initialise it     */
 /*    return value :                                                         */
@@ -68,6 +163,15 @@ bcg729EncoderChannelContextStruct *initBcg729EncoderChannel(uint8_t enableVAD)
 	memset(encoderChannelContext->excitationVector, 0, L_PAST_EXCITATION*sizeof(word16_t)); /* set to zero values of previous excitation vector */
 	memset(encoderChannelContext->targetSignal, 0, NB_LSP_COEFF*sizeof(word16_t)); /* set to zero values filter memory for the targetSignal computation */
 	encoderChannelContext->lastQuantizedAdaptativeCodebookGain = O2_IN_Q14; /* quantized gain is initialized at his minimum value: 0.2 */
+	encoderChannelContext->zeroSignalFramesCount = 0;
+	encoderChannelContext->silenceThreshold = 0; /* bit exact */
+	encoderChannelContext->zeroSignalAnalysis.LPAnalysisValid = 0;
+	encoderChannelContext->zeroSignalAnalysis.openLoopPitchDelay = 0;
+	encoderChannelContext->hints.flags = 0;
+	encoderChannelContext->previousHints.flags = 0;
+	encoderChannelContext->streamTailLength = 0;
+	encoderChannelContext->inputFormat = BCG729_INPUT_FORMAT_PCM16;
+	encoderChannelContext->traceSyncFlag = 1; /* a trace attached now replays the channel from its creation */
 	if (enableVAD == 1) {
 		encoderChannelContext->VADChannelContext = initBcg729VADChannel();
 		encoderChannelContext->DTXChannelContext = initBcg729DTXChannel();
@@ -104,25 +208,82 @@ void closeBcg729EncoderChannel(bcg729EncoderChannelContextStruct *encoderChannel
 }
 
 /*****************************************************************************/
-/* bcg729Encoder :                                                           */
+/* encoderFrameAnalysis : preProcessing of the input frame and LP analysis   */
+/*      of the signal buffer: the encoder front end, shared with the         */
+/*      standalone VAD                                                       */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel, the */
+/*             signal buffer is not shifted                                  */
+/*      -(i) input : a frame in the input format                             */
+/*      -(i) inputFormat : one of BCG729_INPUT_FORMAT_*                      */
+/*      -(i) stride : distance in samples between two input samples          */
+/*      -(o) frameAnalysis : the frame LP analysis, LSP and LSF, the         */
+/*           previous frame LSP are used when the LSP conversion fails       */
+/*                                                                           */
+/*****************************************************************************/
+void encoderFrameAnalysis(bcg729EncoderChannelContextStruct *encoderChannelContext, const void *input, uint8_t inputFormat, uint16_t stride, bcg729FrameAnalysisStruct *frameAnalysis)
+{
+	int i;
+
+	preProcessingFormatted(encoderChannelContext, input, inputFormat, stride, encoderChannelContext->signalLastInputFrame); /* output of the function in the signal buffer */
+
+	/*** digital silence detection: count consecutive null frames at preProcessing output ***/
+	if (encoderChannelContext->silenceThreshold > 0) { /* not bit exact: low level frames are encoded as digital silence */
+		for (i=0; i<L_FRAME; i++) {
+			if (encoderChannelContext->signalLastInputFrame[i] > encoderChannelContext->silenceThreshold || encoderChannelContext->signalLastInputFrame[i] < -encoderChannelContext->silenceThreshold) {
+				break;
+			}
+		}
+		if (i==L_FRAME) {
+			memset(encoderChannelContext->signalLastInputFrame, 0, L_FRAME*sizeof(word16_t));
+		}
+	}
+	if (isNullVector(encoderChannelContext->signalLastInputFrame, L_FRAME)) {
+		if (encoderChannelContext->zeroSignalFramesCount < 255) {
+			encoderChannelContext->zeroSignalFramesCount++;
+		}
+	} else {
+		encoderChannelContext->zeroSignalFramesCount = 0;
+	}
+
+	/*** LP analysis: computed once and shared by VAD, DTX and LSP quantization ***/
+	if (encoderChannelContext->zeroSignalFramesCount >= ZERO_SIGNAL_LP_ANALYSIS_FRAMES) { /* the whole signal buffer is null, LP analysis output is known */
+		zeroSignalLPAnalysis(encoderChannelContext, frameAnalysis);
+	} else {
+		frameLPAnalysis(encoderChannelContext, frameAnalysis);
+	}
+	/*** compute LSP: it might fail, get the previous one in this case ***/
+	if (!frameAnalysis->LSPConversionSuccess) {
+		/* unable to find the 10 roots repeat previous LSP */
+		memcpy(frameAnalysis->LSPCoefficients, encoderChannelContext->previousLSPCoefficients, NB_LSP_COEFF*sizeof(word16_t));
+		encoderChannelContext->stats.LSPConversionFailuresNbr++;
+		for (i=0; i<NB_LSP_COEFF; i++) {
+			frameAnalysis->LSFCoefficients[i] = g729Acos_Q15Q13(frameAnalysis->LSPCoefficients[i]);
+		}
+	}
+}
+
+/*****************************************************************************/
+/* encodeFrame : encode a frame given in an input format                     */
 /*    parameters:                                                            */
 /*      -(i) encoderChannelContext : context for this encoder channel        */
-/*      -(i) inputFrame : 80 samples (16 bits PCM)                           */
+/*      -(i) input : a frame in the input format                             */
+/*      -(i) inputFormat : one of BCG729_INPUT_FORMAT_*                      */
+/*      -(i) stride : distance in samples between two input samples          */
 /*      -(o) bitStream : The 15 parameters for a frame on 80 bits            */
 /*           on 80 bits (10 8bits words)                                     */
+/*      -(o) bitStreamLength : actual length of output, may be 0, 2 or 10    */
 /*                                                                           */
 /*****************************************************************************/
-void bcg729Encoder(bcg729EncoderChannelContextStruct *encoderChannelContext, const int16_t inputFrame[], uint8_t bitStream[], uint8_t *bitStreamLength)
+static void encodeFrame(bcg729EncoderChannelContextStruct *encoderChannelContext, const void *input, uint8_t inputFormat, uint16_t stride, uint8_t bitStream[], uint8_t *bitStreamLength)
 {
 	int i;
 	uint16_t parameters[NB_PARAMETERS]; /* the output parameters in an array */
 
 	/* internal buffers which we do not need to keep between calls */
-	word16_t LPCoefficients[NB_LSP_COEFF]; /* the LP coefficients in Q3.12 */
-	word16_t LSFCoefficients[NB_LSP_COEFF]; /* the LSF coefficients in Q3.12 */
+	bcg729FrameAnalysisStruct frameAnalysis; /* LP analysis, LSP and LSF of the current frame */
 	word16_t qLPCoefficients[2*NB_LSP_COEFF]; /* the quantized LP coefficients in Q3.12 computed from the qLSP one after interpolation: two sets, one for each subframe */
 	word16_t weightedqLPCoefficients[2*NB_LSP_COEFF]; /* the qLP coefficients in Q3.12 weighted according to spec A3.3.3 */
-	word16_t LSPCoefficients[NB_LSP_COEFF]; /* the LSP coefficients in Q15 */
 	word16_t qLSPCoefficients[NB_LSP_COEFF]; /* the quantized LSP coefficients in Q15 */
 	word16_t interpolatedqLSP[NB_LSP_COEFF]; /* the interpolated qLSP used for first subframe in Q15 */
 
@@ -134,38 +295,26 @@ void bcg729Encoder(bcg729EncoderChannelContextStruct *encoderChannelContext, con
 	int parametersIndex = 4; /* index to insert parameters in the parameters output array */
 	word16_t impulseResponseInput[L_SUBFRAME]; /* input buffer for the impulse response computation: in Q12, 1 followed by all zeros see spec A3.5*/
 
-	/* used for VAD */
-	word32_t reflectionCoefficients[NB_LSP_COEFF]; /* in Q31, computed during LP generation, reflectionCoefficients[1] is requested by VAD, the others are stored in context if we cover RFC3389 payload generation */
-	word32_t autoCorrelationCoefficients[NB_LSP_COEFF+3]; /* if VAD is enabled we must compute 13 coefficients, 11 otherwise but used only internally by computeLP function in that case */
-	word32_t noLagAutoCorrelationCoefficients[NB_LSP_COEFF+3]; /* DTX must have access to autocorrelation Coefficients on which lag windowing as not been applied */
-	int8_t autoCorrelationCoefficientsScale; /* autocorrelation coefficients are normalised by computeLP, must get their scaling factor */
+	/* encoder hints: the current frame is delayed by a subframe from the input one, so its first subframe matches the second subframe */
+	/* of the previous hints and its second subframe the first one of the current hints */
+	bcg729EncoderHints hints = encoderChannelContext->hints;
+	bcg729EncoderHints previousHints = encoderChannelContext->previousHints;
+	encoderChannelContext->previousHints = encoderChannelContext->hints;
+	encoderChannelContext->traceSyncFlag = 0; /* set back by the trace if this frame is traced */
+	encoderChannelContext->hints.flags = 0;
 
 	/*****************************************************************************************/
 	/*** on frame basis : preProcessing, LP Analysis, Open-loop pitch search               ***/
-	preProcessing(encoderChannelContext, inputFrame, encoderChannelContext->signalLastInputFrame); /* output of the function in the signal buffer */
-
-	/* use the whole signal Buffer for windowing and autocorrelation */
-	/* autoCorrelation Coefficients are computed and used internally, in case of VAD we must compute and retrieve 13 coefficients, compute only 11 when VAD is disabled */
-	computeLP(encoderChannelContext->signalBuffer, LPCoefficients, reflectionCoefficients, autoCorrelationCoefficients, noLagAutoCorrelationCoefficients, &autoCorrelationCoefficientsScale, (encoderChannelContext->VADChannelContext != NULL)?(NB_LSP_COEFF+3):(NB_LSP_COEFF+1));
-	/*** compute LSP: it might fail, get the previous one in this case ***/
-	if (!LP2LSPConversion(LPCoefficients, LSPCoefficients)) {
-		/* unable to find the 10 roots repeat previous LSP */
-		memcpy(LSPCoefficients, encoderChannelContext->previousLSPCoefficients, NB_LSP_COEFF*sizeof(word16_t));
-	}
+	encoderFrameAnalysis(encoderChannelContext, input, inputFormat, stride, &frameAnalysis);
+	encoderChannelContext->stats.framesNbr++;
 
 	/*********** VAD *****************/
 	if (encoderChannelContext->VADChannelContext != NULL) { /* if VAD is not enable, no context */
 		uint8_t VADflag = 1;
 		/* update DTX context */
-		updateDTXContext(encoderChannelContext->DTXChannelContext, noLagAutoCorrelationCoefficients, autoCorrelationCoefficientsScale);
-
-		/*** compute LSF in Q2.13 : lsf = arcos(lsp) range [0, Pi[ spec 3.2.4 eq18 ***/
-		/* TODO : remove it from LSPQuantizationFunction and perform it out of enableVAD test */
-		for (i=0; i<NB_LSP_COEFF; i++)  {
-			LSFCoefficients[i] = g729Acos_Q15Q13(LSPCoefficients[i]);
-		}
+		updateDTXContext(encoderChannelContext->DTXChannelContext, frameAnalysis.noLagAutoCorrelationCoefficients, frameAnalysis.autoCorrelationCoefficientsScale);
 
-		VADflag = bcg729_vad(encoderChannelContext->VADChannelContext, reflectionCoefficients[1], LSFCoefficients, autoCorrelationCoefficients, autoCorrelationCoefficientsScale, encoderChannelContext->signalCurrentFrame);
+		VADflag = bcg729_vad(encoderChannelContext->VADChannelContext, frameAnalysis.reflectionCoefficients[1], frameAnalysis.LSFCoefficients, frameAnalysis.autoCorrelationCoefficients, frameAnalysis.autoCorrelationCoefficientsScale, encoderChannelContext->signalCurrentFrame);
 
 		/* call encodeSIDFrame even if it is a voice frame as it will update DTXContext with current VADflag : TODO : move updateDTXContext in the encodeSIDFrame as part of the update is performed in it anyway */
 		encodeSIDFrame(encoderChannelContext->DTXChannelContext,  encoderChannelContext->previousLSPCoefficients, encoderChannelContext->previousqLSPCoefficients, VADflag, encoderChannelContext->previousqLSF, &(encoderChannelContext->excitationVector[L_PAST_EXCITATION]), qLPCoefficients, bitStream, bitStreamLength);
@@ -174,30 +323,10 @@ void bcg729Encoder(bcg729EncoderChannelContextStruct *encoderChannelContext, con
 			word16_t residualSignal[L_FRAME];
 			/* update encoder context : generate weighted signal */
 			/*** Compute the weighted Quantized LP Coefficients according to spec A3.3.3 ***/
-			/*  weightedqLPCoefficients[0] = qLPCoefficients[0]*Gamma^(i+1) (i=0..9) with Gamma = 0.75 in Q15 */
-			weightedqLPCoefficients[0] = MULT16_16_P15(qLPCoefficients[0], GAMMA_E1);
-			weightedqLPCoefficients[1] = MULT16_16_P15(qLPCoefficients[1], GAMMA_E2);
-			weightedqLPCoefficients[2] = MULT16_16_P15(qLPCoefficients[2], GAMMA_E3);
-			weightedqLPCoefficients[3] = MULT16_16_P15(qLPCoefficients[3], GAMMA_E4);
-			weightedqLPCoefficients[4] = MULT16_16_P15(qLPCoefficients[4], GAMMA_E5);
-			weightedqLPCoefficients[5] = MULT16_16_P15(qLPCoefficients[5], GAMMA_E6);
-			weightedqLPCoefficients[6] = MULT16_16_P15(qLPCoefficients[6], GAMMA_E7);
-			weightedqLPCoefficients[7] = MULT16_16_P15(qLPCoefficients[7], GAMMA_E8);
-			weightedqLPCoefficients[8] = MULT16_16_P15(qLPCoefficients[8], GAMMA_E9);
-			weightedqLPCoefficients[9] = MULT16_16_P15(qLPCoefficients[9], GAMMA_E10);
-			weightedqLPCoefficients[10] = MULT16_16_P15(qLPCoefficients[10], GAMMA_E1);
-			weightedqLPCoefficients[11] = MULT16_16_P15(qLPCoefficients[11], GAMMA_E2);
-			weightedqLPCoefficients[12] = MULT16_16_P15(qLPCoefficients[12], GAMMA_E3);
-			weightedqLPCoefficients[13] = MULT16_16_P15(qLPCoefficients[13], GAMMA_E4);
-			weightedqLPCoefficients[14] = MULT16_16_P15(qLPCoefficients[14], GAMMA_E5);
-			weightedqLPCoefficients[15] = MULT16_16_P15(qLPCoefficients[15], GAMMA_E6);
-			weightedqLPCoefficients[16] = MULT16_16_P15(qLPCoefficients[16], GAMMA_E7);
-			weightedqLPCoefficients[17] = MULT16_16_P15(qLPCoefficients[17], GAMMA_E8);
-			weightedqLPCoefficients[18] = MULT16_16_P15(qLPCoefficients[18], GAMMA_E9);
-			weightedqLPCoefficients[19] = MULT16_16_P15(qLPCoefficients[19], GAMMA_E10);
+			computeWeightedqLPCoefficients(qLPCoefficients, weightedqLPCoefficients);
 
 			/*** Compute weighted signal according to spec A3.3.3, this function also compute LPResidualSignal(entire frame values) as specified in eq A.3 ***/
-			computeWeightedSpeech(encoderChannelContext->signalCurrentFrame, qLPCoefficients, weightedqLPCoefficients, &(encoderChannelContext->weightedInputSignal[MAXIMUM_INT_PITCH_DELAY]), residualSignal); /* weightedInputSignal contains MAXIMUM_INT_PITCH_DELAY values from previous frame, points to current frame */
+			encoderWeightedSpeech(encoderChannelContext, qLPCoefficients, weightedqLPCoefficients, residualSignal);
 
 			/* update the target Signal : targetSignal = residualSignal - excitationVector */
 			for (subframeIndex=0; subframeIndex<L_FRAME; subframeIndex+=L_SUBFRAME) {
@@ -216,12 +345,18 @@ void bcg729Encoder(bcg729EncoderChannelContextStruct *encoderChannelContext, con
 			/* shift left by L_FRAME the excitationVector */
 			memmove(encoderChannelContext->excitationVector, &(encoderChannelContext->excitationVector[L_FRAME]), L_PAST_EXCITATION*sizeof(word16_t));
 
+			if (*bitStreamLength == 0) {
+				encoderChannelContext->stats.untransmittedFramesNbr++;
+			} else {
+				encoderChannelContext->stats.SIDFramesNbr++;
+			}
 			return;
 		}
 	}
 
 	/* set generated bitStream length: active voice is compressed into 80 bits */
 	*bitStreamLength = 10;
+	encoderChannelContext->stats.activeFramesNbr++;
 
 	/*********** VAD *****************/
 
@@ -230,7 +365,15 @@ void bcg729Encoder(bcg729EncoderChannelContextStruct *encoderChannelContext, con
 
 
 	/*** LSPQuantization and compute L0, L1, L2, L3: the first four parameters ***/
-	LSPQuantization(encoderChannelContext, LSPCoefficients, qLSPCoefficients, parameters);
+	/* the current frame LSP lies between the previous and current hinted ones */
+	encoderChannelContext->L1HintsNbr = 0;
+	if (previousHints.flags&BCG729_ENCODER_HINT_LSP) {
+		encoderChannelContext->L1Hints[encoderChannelContext->L1HintsNbr++] = previousHints.L1;
+	}
+	if ((hints.flags&BCG729_ENCODER_HINT_LSP) && !(encoderChannelContext->L1HintsNbr==1 && hints.L1==previousHints.L1)) {
+		encoderChannelContext->L1Hints[encoderChannelContext->L1HintsNbr++] = hints.L1;
+	}
+	LSPQuantization(encoderChannelContext, frameAnalysis.LSFCoefficients, qLSPCoefficients, parameters);
 	
 	/*** interpolate qLSP and convert to LP ***/
 	interpolateqLSP(encoderChannelContext->previousqLSPCoefficients, qLSPCoefficients, interpolatedqLSP);
@@ -245,33 +388,35 @@ void bcg729Encoder(bcg729EncoderChannelContextStruct *encoderChannelContext, con
 	qLSP2LP(qLSPCoefficients, &(qLPCoefficients[NB_LSP_COEFF]));
 
 	/*** Compute the weighted Quantized LP Coefficients according to spec A3.3.3 ***/
-	/*  weightedqLPCoefficients[0] = qLPCoefficients[0]*Gamma^(i+1) (i=0..9) with Gamma = 0.75 in Q15 */
-	weightedqLPCoefficients[0] = MULT16_16_P15(qLPCoefficients[0], GAMMA_E1);
-	weightedqLPCoefficients[1] = MULT16_16_P15(qLPCoefficients[1], GAMMA_E2);
-	weightedqLPCoefficients[2] = MULT16_16_P15(qLPCoefficients[2], GAMMA_E3);
-	weightedqLPCoefficients[3] = MULT16_16_P15(qLPCoefficients[3], GAMMA_E4);
-	weightedqLPCoefficients[4] = MULT16_16_P15(qLPCoefficients[4], GAMMA_E5);
-	weightedqLPCoefficients[5] = MULT16_16_P15(qLPCoefficients[5], GAMMA_E6);
-	weightedqLPCoefficients[6] = MULT16_16_P15(qLPCoefficients[6], GAMMA_E7);
-	weightedqLPCoefficients[7] = MULT16_16_P15(qLPCoefficients[7], GAMMA_E8);
-	weightedqLPCoefficients[8] = MULT16_16_P15(qLPCoefficients[8], GAMMA_E9);
-	weightedqLPCoefficients[9] = MULT16_16_P15(qLPCoefficients[9], GAMMA_E10);
-	weightedqLPCoefficients[10] = MULT16_16_P15(qLPCoefficients[10], GAMMA_E1);
-	weightedqLPCoefficients[11] = MULT16_16_P15(qLPCoefficients[11], GAMMA_E2);
-	weightedqLPCoefficients[12] = MULT16_16_P15(qLPCoefficients[12], GAMMA_E3);
-	weightedqLPCoefficients[13] = MULT16_16_P15(qLPCoefficients[13], GAMMA_E4);
-	weightedqLPCoefficients[14] = MULT16_16_P15(qLPCoefficients[14], GAMMA_E5);
-	weightedqLPCoefficients[15] = MULT16_16_P15(qLPCoefficients[15], GAMMA_E6);
-	weightedqLPCoefficients[16] = MULT16_16_P15(qLPCoefficients[16], GAMMA_E7);
-	weightedqLPCoefficients[17] = MULT16_16_P15(qLPCoefficients[17], GAMMA_E8);
-	weightedqLPCoefficients[18] = MULT16_16_P15(qLPCoefficients[18], GAMMA_E9);
-	weightedqLPCoefficients[19] = MULT16_16_P15(qLPCoefficients[19], GAMMA_E10);
+	computeWeightedqLPCoefficients(qLPCoefficients, weightedqLPCoefficients);
 
 	/*** Compute weighted signal according to spec A3.3.3, this function also set LPResidualSignal(entire frame values) as specified in eq A.3 in excitationVector[L_PAST_EXCITATION] ***/
-	computeWeightedSpeech(encoderChannelContext->signalCurrentFrame, qLPCoefficients, weightedqLPCoefficients, &(encoderChannelContext->weightedInputSignal[MAXIMUM_INT_PITCH_DELAY]), &(encoderChannelContext->excitationVector[L_PAST_EXCITATION])); /* weightedInputSignal contains MAXIMUM_INT_PITCH_DELAY values from previous frame, points to current frame  */
+	encoderWeightedSpeech(encoderChannelContext, qLPCoefficients, weightedqLPCoefficients, &(encoderChannelContext->excitationVector[L_PAST_EXCITATION]));
 
 	/*** find the open loop pitch delay ***/
-	openLoopPitchDelay = findOpenLoopPitchDelay(&(encoderChannelContext->weightedInputSignal[MAXIMUM_INT_PITCH_DELAY]));
+	if (encoderChannelContext->zeroSignalFramesCount >= ZERO_SIGNAL_LP_ANALYSIS_FRAMES && isNullVector(encoderChannelContext->weightedInputSignal, MAXIMUM_INT_PITCH_DELAY+L_FRAME)) {
+		/* null weighted signal: the open loop pitch delay is known once computed */
+		if (encoderChannelContext->zeroSignalAnalysis.openLoopPitchDelay == 0) {
+			encoderChannelContext->zeroSignalAnalysis.openLoopPitchDelay = findOpenLoopPitchDelay(&(encoderChannelContext->weightedInputSignal[MAXIMUM_INT_PITCH_DELAY]));
+		}
+		openLoopPitchDelay = encoderChannelContext->zeroSignalAnalysis.openLoopPitchDelay;
+	} else if (previousHints.flags&BCG729_ENCODER_HINT_PITCH) { /* encoder hints: search around the pitch delay of the matching decoded subframe */
+		int16_t rangeOpen = previousHints.intPitchDelay[1]-OPEN_LOOP_PITCH_HINT_RANGE;
+		int16_t rangeClose = previousHints.intPitchDelay[1]+OPEN_LOOP_PITCH_HINT_RANGE;
+		if (rangeOpen < 20) {
+			rangeOpen = 20;
+		}
+		if (rangeClose > MAXIMUM_INT_PITCH_DELAY) {
+			rangeClose = MAXIMUM_INT_PITCH_DELAY;
+		}
+		if (rangeOpen > rangeClose) { /* invalid hint */
+			openLoopPitchDelay = findOpenLoopPitchDelay(&(encoderChannelContext->weightedInputSignal[MAXIMUM_INT_PITCH_DELAY]));
+		} else {
+			openLoopPitchDelay = findOpenLoopPitchDelayInRange(&(encoderChannelContext->weightedInputSignal[MAXIMUM_INT_PITCH_DELAY]), rangeOpen, rangeClose);
+		}
+	} else {
+		openLoopPitchDelay = findOpenLoopPitchDelay(&(encoderChannelContext->weightedInputSignal[MAXIMUM_INT_PITCH_DELAY]));
+	}
 
 	/* define boundaries for closed loop pitch delay search as specified in 3.7 */
 	intPitchDelayMin = openLoopPitchDelay-3;
@@ -311,8 +456,19 @@ void bcg729Encoder(bcg729EncoderChannelContextStruct *encoderChannelContext, con
 
 		/*** Adaptative Codebook search : compute the intPitchDelay, fracPitchDelay and associated parameter, compute also the adaptative codebook vector used to generate the excitation ***/
 		/* after this call, the excitationVector[L_PAST_EXCITATION + subFrameIndex] contains the adaptative codebook vector as in spec 3.7.1 */
-		adaptativeCodebookSearch(&(encoderChannelContext->excitationVector[L_PAST_EXCITATION + subframeIndex]), &intPitchDelayMin, &intPitchDelayMax, &(impulseResponseBuffer[NB_LSP_COEFF]), &(encoderChannelContext->targetSignal[NB_LSP_COEFF]),
-			&intPitchDelay, &fracPitchDelay, &(parameters[parametersIndex]), subframeIndex);
+		if (subframeIndex!=0 && (hints.flags&BCG729_ENCODER_HINT_PITCH)
+			&& hints.intPitchDelay[0]+CLOSED_LOOP_PITCH_HINT_RANGE >= intPitchDelayMin && hints.intPitchDelay[0]-CLOSED_LOOP_PITCH_HINT_RANGE <= intPitchDelayMax) {
+			/* encoder hints: search the second subframe around the pitch delay of the matching decoded subframe */
+			int16_t hintPitchDelayMin = (hints.intPitchDelay[0]-CLOSED_LOOP_PITCH_HINT_RANGE > intPitchDelayMin)?hints.intPitchDelay[0]-CLOSED_LOOP_PITCH_HINT_RANGE:intPitchDelayMin;
+			int16_t hintPitchDelayMax = (hints.intPitchDelay[0]+CLOSED_LOOP_PITCH_HINT_RANGE < intPitchDelayMax)?hints.intPitchDelay[0]+CLOSED_LOOP_PITCH_HINT_RANGE:intPitchDelayMax;
+			adaptativeCodebookSearch(&(encoderChannelContext->excitationVector[L_PAST_EXCITATION + subframeIndex]), &hintPitchDelayMin, &hintPitchDelayMax, &(impulseResponseBuffer[NB_LSP_COEFF]), &(encoderChannelContext->targetSignal[NB_LSP_COEFF]),
+				&intPitchDelay, &fracPitchDelay, &(parameters[parametersIndex]), subframeIndex);
+			/* P2 codeword is relative to the search range lower boundary: rebase it on the first subframe one */
+			parameters[parametersIndex] += 3*(hintPitchDelayMin - intPitchDelayMin);
+		} else {
+			adaptativeCodebookSearch(&(encoderChannelContext->excitationVector[L_PAST_EXCITATION + subframeIndex]), &intPitchDelayMin, &intPitchDelayMax, &(impulseResponseBuffer[NB_LSP_COEFF]), &(encoderChannelContext->targetSignal[NB_LSP_COEFF]),
+				&intPitchDelay, &fracPitchDelay, &(parameters[parametersIndex]), subframeIndex);
+		}
 
 		/*** Compute adaptative codebook gain spec 3.7.3, result in Q14 ***/
 		/* compute the filtered adaptative codebook vector spec 3.7.3 */
@@ -369,7 +525,7 @@ void bcg729Encoder(bcg729EncoderChannelContextStruct *encoderChannelContext, con
 	/* shift left by L_FRAME the signal buffer */
 	memmove(encoderChannelContext->signalBuffer, &(encoderChannelContext->signalBuffer[L_FRAME]), (L_LP_ANALYSIS_WINDOW-L_FRAME)*sizeof(word16_t)); 
 	/* update previousLSP coefficient buffer */
-	memcpy(encoderChannelContext->previousLSPCoefficients, LSPCoefficients, NB_LSP_COEFF*sizeof(word16_t));
+	memcpy(encoderChannelContext->previousLSPCoefficients, frameAnalysis.LSPCoefficients, NB_LSP_COEFF*sizeof(word16_t));
 	memcpy(encoderChannelContext->previousqLSPCoefficients, qLSPCoefficients, NB_LSP_COEFF*sizeof(word16_t));
 	/* shift left by L_FRAME the weightedInputSignal buffer */
 	memmove(encoderChannelContext->weightedInputSignal, &(encoderChannelContext->weightedInputSignal[L_FRAME]), MAXIMUM_INT_PITCH_DELAY*sizeof(word16_t));
@@ -382,6 +538,211 @@ void bcg729Encoder(bcg729EncoderChannelContextStruct *encoderChannelContext, con
 	return;
 }
 
+/*****************************************************************************/
+/* bcg729Encoder :                                                           */
+/*    parameters:                                                            */
+/*      -(i) encoderChannelContext : context for this encoder channel        */
+/*      -(i) inputFrame : 80 samples (16 bits PCM)                           */
+/*      -(o) bitStream : The 15 parameters for a frame on 80 bits            */
+/*           on 80 bits (10 8bits words)                                     */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729Encoder(bcg729EncoderChannelContextStruct *encoderChannelContext, const int16_t inputFrame[], uint8_t bitStream[], uint8_t *bitStreamLength)
+{
+	bcg729EncoderHints hints;
+
+	if (encoderChannelContext->traceWriter == NULL) {
+		encodeFrame(encoderChannelContext, inputFrame, BCG729_INPUT_FORMAT_PCM16, 1, bitStream, bitStreamLength);
+		return;
+	}
+
+	/* traced call: the hints are consumed by encodeFrame */
+	hints = encoderChannelContext->hints;
+	traceEncoderSync(encoderChannelContext);
+	encodeFrame(encoderChannelContext, inputFrame, BCG729_INPUT_FORMAT_PCM16, 1, bitStream, bitStreamLength);
+	traceEncoderFrame(encoderChannelContext, inputFrame, &hints, bitStream, *bitStreamLength);
+}
+
+/*****************************************************************************/
+/* bcg729EncoderFormatted : encode a frame given in the input format of the  */
+/*      channel as bcg729Encoder does                                        */
+/*    parameters:                                                            */
+/*      -(i) encoderChannelContext : context for this encoder channel        */
+/*      -(i) input : a frame in the channel input format                     */
+/*      -(o) bitStream : The 15 parameters for a frame on 80 bits            */
+/*           on 80 bits (10 8bits words)                                     */
+/*      -(o) bitStreamLength : actual length of output, may be 0, 2 or 10    */
+/*    return value : number of bytes read from input                         */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t bcg729EncoderFormatted(bcg729EncoderChannelContextStruct *encoderChannelContext, const void *input, uint8_t bitStream[], uint8_t *bitStreamLength)
+{
+	encodeFrame(encoderChannelContext, input, encoderChannelContext->inputFormat, 1, bitStream, bitStreamLength);
+	return getInputFrameSize(encoderChannelContext->inputFormat);
+}
+
+/*****************************************************************************/
+/* bcg729EncoderStrided : encode a frame of samples interleaved with other   */
+/*      channels ones, given in the input format of the channel              */
+/*    parameters:                                                            */
+/*      -(i) encoderChannelContext : context for this encoder channel        */
+/*      -(i) input : first sample of the frame in the channel input format   */
+/*      -(i) stride : distance in samples between two samples of the frame, */
+/*           0 is handled as 1                                               */
+/*      -(o) bitStream : The 15 parameters for a frame on 80 bits            */
+/*           on 80 bits (10 8bits words)                                     */
+/*      -(o) bitStreamLength : actual length of output, may be 0, 2 or 10    */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729EncoderStrided(bcg729EncoderChannelContextStruct *encoderChannelContext, const void *input, uint16_t stride, uint8_t bitStream[], uint8_t *bitStreamLength)
+{
+	encodeFrame(encoderChannelContext, input, encoderChannelContext->inputFormat, (stride==0)?1:stride, bitStream, bitStreamLength);
+}
+
+/*****************************************************************************/
+/* bcg729EncoderStream : encode any number of samples, the samples not       */
+/*      filling a frame are kept in the context for the next call            */
+/*    parameters:                                                            */
+/*      -(i) encoderChannelContext : context for this encoder channel        */
+/*      -(i) input : 16 bits PCM samples                                     */
+/*      -(i) inputLength : number of samples in input                        */
+/*      -(o) bitStream : the encoded frames, concatenated                    */
+/*      -(o) bitStreamLength : length of each encoded frame                  */
+/*      -(i) maxFramesNbr : maximum number of frames to encode               */
+/*      -(o) inputConsumed : number of input samples consumed, may be NULL   */
+/*    return value : the number of encoded frames                            */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t bcg729EncoderStream(bcg729EncoderChannelContextStruct *encoderChannelContext, const int16_t input[], uint32_t inputLength, uint8_t bitStream[], uint8_t bitStreamLength[], uint16_t maxFramesNbr, uint32_t *inputConsumed)
+{
+	uint32_t inputIndex = 0;
+	uint16_t framesNbr = 0;
+
+	/* complete the frame started at previous call */
+	if (encoderChannelContext->streamTailLength > 0 && maxFramesNbr > 0) {
+		uint32_t missingSamplesNbr = L_FRAME - encoderChannelContext->streamTailLength;
+		if (inputLength < missingSamplesNbr) {
+			missingSamplesNbr = inputLength;
+		}
+		memcpy(&(encoderChannelContext->streamTail[encoderChannelContext->streamTailLength]), input, missingSamplesNbr*sizeof(word16_t));
+		encoderChannelContext->streamTailLength += missingSamplesNbr;
+		inputIndex = missingSamplesNbr;
+		if (encoderChannelContext->streamTailLength == L_FRAME) {
+			bcg729Encoder(encoderChannelContext, encoderChannelContext->streamTail, bitStream, &(bitStreamLength[0]));
+			bitStream += bitStreamLength[0];
+			framesNbr++;
+			encoderChannelContext->streamTailLength = 0;
+		}
+	}
+
+	/* whole frames are encoded from the input buffer */
+	while (inputLength - inputIndex >= L_FRAME && framesNbr < maxFramesNbr) {
+		bcg729Encoder(encoderChannelContext, &(input[inputIndex]), bitStream, &(bitStreamLength[framesNbr]));
+		bitStream += bitStreamLength[framesNbr];
+		framesNbr++;
+		inputIndex += L_FRAME;
+	}
+
+	/* keep the last samples for next call */
+	if (inputLength - inputIndex < L_FRAME && encoderChannelContext->streamTailLength == 0) {
+		memcpy(encoderChannelContext->streamTail, &(input[inputIndex]), (inputLength - inputIndex)*sizeof(word16_t));
+		encoderChannelContext->streamTailLength = (uint8_t)(inputLength - inputIndex);
+		inputIndex = inputLength;
+	}
+
+	if (inputConsumed != NULL) {
+		*inputConsumed = inputIndex;
+	}
+	return framesNbr;
+}
+
+/*****************************************************************************/
+/* bcg729SetEncoderInputFormat : select the input format read by             */
+/*      bcg729EncoderFormatted on this channel                               */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*      -(i) format : one of BCG729_INPUT_FORMAT_*, unknown values select    */
+/*           BCG729_INPUT_FORMAT_PCM16                                       */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729SetEncoderInputFormat(bcg729EncoderChannelContextStruct *encoderChannelContext, uint8_t format)
+{
+	if (format > BCG729_INPUT_FORMAT_FLOAT_48KHZ) {
+		format = BCG729_INPUT_FORMAT_PCM16;
+	}
+	if (format != encoderChannelContext->inputFormat) {
+		/* decimation memory is updated only by the 16 and 48kHz formats: reset it */
+		memset(encoderChannelContext->decimationMemory, 0, (DECIMATION_48KHZ_TAPS-1)*sizeof(word16_t));
+		encoderChannelContext->inputFormat = format;
+	}
+}
+
+/*****************************************************************************/
+/* bcg729SetEncoderSilenceThreshold : frames with preProcessing output below */
+/*      threshold are encoded as digital silence, see encoder.h              */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*      -(i) threshold : maximum magnitude in Q0, 0 keeps bit exactness      */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729SetEncoderSilenceThreshold(bcg729EncoderChannelContextStruct *encoderChannelContext, uint16_t threshold)
+{
+	encoderChannelContext->silenceThreshold = (word16_t)((threshold>MAXINT16)?MAXINT16:threshold);
+}
+
+/*****************************************************************************/
+/* bcg729SetEncoderHints : give the parameters of the decoded frame matching */
+/*      the next input frame when re-encoding a G729 decoded signal          */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*      -(i) hints : as given by bcg729GetEncoderHints, NULL for no hint     */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729SetEncoderHints(bcg729EncoderChannelContextStruct *encoderChannelContext, const bcg729EncoderHints *hints)
+{
+	if (hints == NULL) {
+		encoderChannelContext->hints.flags = 0;
+		return;
+	}
+	encoderChannelContext->hints = *hints;
+	/* discard out of range values */
+	if (hints->L1 >= L1_RANGE) {
+		encoderChannelContext->hints.flags &= ~BCG729_ENCODER_HINT_LSP;
+	}
+	if (hints->intPitchDelay[0] < 20 || hints->intPitchDelay[0] > MAXIMUM_INT_PITCH_DELAY || hints->intPitchDelay[1] < 20 || hints->intPitchDelay[1] > MAXIMUM_INT_PITCH_DELAY) {
+		encoderChannelContext->hints.flags &= ~BCG729_ENCODER_HINT_PITCH;
+	}
+}
+
+/*****************************************************************************/
+/* bcg729GetEncoderStats : get the operational counters of a channel         */
+/*    parameters:                                                            */
+/*      -(i) encoderChannelContext : context for this encoder channel        */
+/*      -(o) stats : counters since the channel creation or the last reset   */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729GetEncoderStats(bcg729EncoderChannelContextStruct *encoderChannelContext, bcg729EncoderStats *stats)
+{
+	*stats = encoderChannelContext->stats;
+	if (encoderChannelContext->DTXChannelContext != NULL) {
+		stats->LSPConversionFailuresNbr += encoderChannelContext->DTXChannelContext->LSPConversionFailuresNbr;
+	}
+}
+
+/*****************************************************************************/
+/* bcg729ResetEncoderStats : reset the operational counters of a channel     */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729ResetEncoderStats(bcg729EncoderChannelContextStruct *encoderChannelContext)
+{
+	memset(&(encoderChannelContext->stats), 0, sizeof(bcg729EncoderStats));
+	if (encoderChannelContext->DTXChannelContext != NULL) {
+		encoderChannelContext->DTXChannelContext->LSPConversionFailuresNbr = 0;
+	}
+}
+
 /*****************************************************************************/
 /* bcg729GetRFC3389Payload : return the comfort noise payload according to   */
 /*                     RFC3389 for the last CN frame generated by encoder    */
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef PRIVATE_ENCODER_H
+#define PRIVATE_ENCODER_H
+
+/*****************************************************************************/
+/* encoderFrameAnalysis : preProcessing of the input frame and LP analysis   */
+/*      of the signal buffer: the encoder front end, shared with the         */
+/*      standalone VAD                                                       */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel, the */
+/*             signal buffer is not shifted                                  */
+/*      -(i) input : a frame in the input format                             */
+/*      -(i) inputFormat : one of BCG729_INPUT_FORMAT_*                      */
+/*      -(i) stride : distance in samples between two input samples          */
+/*      -(o) frameAnalysis : the frame LP analysis, LSP and LSF, the         */
+/*           previous frame LSP are used when the LSP conversion fails       */
+/*                                                                           */
+/*****************************************************************************/
+void encoderFrameAnalysis(bcg729EncoderChannelContextStruct *encoderChannelContext, const void *input, uint8_t inputFormat, uint16_t stride, bcg729FrameAnalysisStruct *frameAnalysis);
+#endif /* ifndef PRIVATE_ENCODER_H */
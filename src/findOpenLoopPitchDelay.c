@@ -30,6 +30,8 @@
 word32_t getCorrelationMax(uint16_t *index, word16_t inputSignal[], uint16_t rangeOpen, uint16_t rangeClose, uint16_t step);
 /* compute eqA.4 from spec3.4 */
 word32_t getCorrelation(word16_t inputSignal[], uint16_t index); 
+/* scale the signal to avoid overflows, return the scaled signal: either scaledWeightedInputSignalBuffer or weightedInputSignal */
+static word16_t *scaleWeightedInputSignal(word16_t weightedInputSignal[], word16_t scaledWeightedInputSignalBuffer[]);
 
 /*****************************************************************************/
 /* findOpenLoopPitchDelay : as specified in specA3.4                         */
@@ -42,11 +44,9 @@ word32_t getCorrelation(word16_t inputSignal[], uint16_t index);
 /*****************************************************************************/
 uint16_t findOpenLoopPitchDelay(word16_t weightedInputSignal[])
 {
-	int i;
 	/*** scale the signal to avoid overflows ***/
 	word16_t scaledWeightedInputSignalBuffer[MAXIMUM_INT_PITCH_DELAY+L_FRAME]; /* this buffer might store the scaled version of input Signal, if scaling is not needed, it is not used */
 	word16_t *scaledWeightedInputSignal; /* points to the begining of present frame either scaled or directly the input signal */
-	word64_t autocorrelation = 0;
 	uint16_t indexRange1=0, indexRange2=0, indexRange3Even=0, indexRange3;
 	word32_t correlationMaxRange1;
 	word32_t correlationMaxRange2;
@@ -60,22 +60,7 @@ uint16_t findOpenLoopPitchDelay(word16_t weightedInputSignal[])
 	word32_t normalisedCorrelationMaxRange3;
 	uint16_t indexMultiple;
 
-	/* compute on 64 bits the autocorrelation on the input signal and if needed scale to have it on 32 bits */
-	for (i=-MAXIMUM_INT_PITCH_DELAY; i<L_FRAME; i++) {
-		autocorrelation = MAC64(autocorrelation, weightedInputSignal[i], weightedInputSignal[i]);
-	}
-	if (autocorrelation>MAXINT32) {
-		int overflowScale;
-		scaledWeightedInputSignal = &(scaledWeightedInputSignalBuffer[MAXIMUM_INT_PITCH_DELAY]);
-		overflowScale = PSHR(31-countLeadingZeros((word32_t)(autocorrelation>>31)),1); /* count number of bits needed over the 31 bits allowed and divide by 2 to get the right scaling for the signal */
-		for (i=-MAXIMUM_INT_PITCH_DELAY; i<L_FRAME; i++) {
-			scaledWeightedInputSignal[i] = SHR(weightedInputSignal[i], overflowScale);
-		}
-
-	} else { /* scaledWeightedInputSignal points directly to weightedInputSignal */
-		scaledWeightedInputSignal = weightedInputSignal;
-	}
-
+	scaledWeightedInputSignal = scaleWeightedInputSignal(weightedInputSignal, scaledWeightedInputSignalBuffer);
 
 	/*** compute the correlationMax in the different ranges ***/
 	correlationMaxRange1 = getCorrelationMax(&indexRange1, scaledWeightedInputSignal, 20, 39, 1);
@@ -150,6 +135,66 @@ uint16_t findOpenLoopPitchDelay(word16_t weightedInputSignal[])
 
 
 
+/*****************************************************************************/
+/* findOpenLoopPitchDelayInRange : correlation maximum as in specA3.4 eqA.4  */
+/*      on a range given by encoder hints, the lower delays favouring of     */
+/*      specA3.4 is not applied                                              */
+/*    paremeters:                                                            */
+/*      -(i) weightedInputSignal: 223 values in Q0, buffer                   */
+/*           accessed in range [-MAXIMUM_INT_PITCH_DELAY(143), L_FRAME(80)[  */
+/*      -(i) rangeOpen and rangeClose : the delay range in [20, 143]         */
+/*    return value:                                                          */
+/*      - the openLoopIntegerPitchDelay in Q0 range [rangeOpen, rangeClose] */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t findOpenLoopPitchDelayInRange(word16_t weightedInputSignal[], uint16_t rangeOpen, uint16_t rangeClose)
+{
+	word16_t scaledWeightedInputSignalBuffer[MAXIMUM_INT_PITCH_DELAY+L_FRAME]; /* this buffer might store the scaled version of input Signal, if scaling is not needed, it is not used */
+	uint16_t index = rangeOpen;
+
+	getCorrelationMax(&index, scaleWeightedInputSignal(weightedInputSignal, scaledWeightedInputSignalBuffer), rangeOpen, rangeClose, 1);
+
+	return index;
+}
+
+/*****************************************************************************/
+/* scaleWeightedInputSignal : scale the signal to avoid overflows in the     */
+/*      correlations computation                                             */
+/*    paremeters:                                                            */
+/*      -(i) weightedInputSignal: 223 values in Q0, buffer                   */
+/*           accessed in range [-MAXIMUM_INT_PITCH_DELAY(143), L_FRAME(80)[  */
+/*      -(o) scaledWeightedInputSignalBuffer: 223 values buffer used to      */
+/*           store the scaled signal when needed                             */
+/*    return value:                                                          */
+/*      - points to the begining of present frame either scaled or directly  */
+/*        the input signal                                                   */
+/*                                                                           */
+/*****************************************************************************/
+static word16_t *scaleWeightedInputSignal(word16_t weightedInputSignal[], word16_t scaledWeightedInputSignalBuffer[])
+{
+	int i;
+	word16_t *scaledWeightedInputSignal;
+	word64_t autocorrelation = 0;
+
+	/* compute on 64 bits the autocorrelation on the input signal and if needed scale to have it on 32 bits */
+	for (i=-MAXIMUM_INT_PITCH_DELAY; i<L_FRAME; i++) {
+		autocorrelation = MAC64(autocorrelation, weightedInputSignal[i], weightedInputSignal[i]);
+	}
+	if (autocorrelation>MAXINT32) {
+		int overflowScale;
+		scaledWeightedInputSignal = &(scaledWeightedInputSignalBuffer[MAXIMUM_INT_PITCH_DELAY]);
+		overflowScale = PSHR(31-countLeadingZeros((word32_t)(autocorrelation>>31)),1); /* count number of bits needed over the 31 bits allowed and divide by 2 to get the right scaling for the signal */
+		for (i=-MAXIMUM_INT_PITCH_DELAY; i<L_FRAME; i++) {
+			scaledWeightedInputSignal[i] = SHR(weightedInputSignal[i], overflowScale);
+		}
+
+	} else { /* scaledWeightedInputSignal points directly to weightedInputSignal */
+		scaledWeightedInputSignal = weightedInputSignal;
+	}
+
+	return scaledWeightedInputSignal;
+}
+
 /*****************************************************************************/
 /* getCorrelation : as specified in specA3.4 eqA.4                           */
 /*      correlation = ∑(i=0..39)inputSignal[2*i]*inputSignal[2*i-index]      */
@@ -28,4 +28,18 @@
 /*                                                                           */
 /*****************************************************************************/
 uint16_t findOpenLoopPitchDelay(word16_t weightedInputSignal[]);
+
+/*****************************************************************************/
+/* findOpenLoopPitchDelayInRange : correlation maximum as in specA3.4 eqA.4  */
+/*      on a range given by encoder hints, the lower delays favouring of     */
+/*      specA3.4 is not applied                                              */
+/*    paremeters:                                                            */
+/*      -(i) weightedInputSignal: 223 values in Q0, buffer                   */
+/*           accessed in range [-MAXIMUM_INT_PITCH_DELAY(143), L_FRAME(80)[  */
+/*      -(i) rangeOpen and rangeClose : the delay range in [20, 143]         */
+/*    return value:                                                          */
+/*      - the openLoopIntegerPitchDelay in Q0 range [rangeOpen, rangeClose] */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t findOpenLoopPitchDelayInRange(word16_t weightedInputSignal[], uint16_t rangeOpen, uint16_t rangeClose);
 #endif /* ifndef FINDOPENLOOPPITCHDELAY_H */
@@ -80,125 +80,134 @@ void fixedCodebookSearch(word16_t targetSignal[], word16_t impulseResponse[], in
 		impulseResponse[i] = MAC16_16_Q14(impulseResponse[i], impulseResponse[i-intPitchDelay], lastQuantizedAdaptativeCodebookGain); /* h[n] = h[n] + β*h[n-T], impulseResponse in Q12, lastQuantizedAdaptativeCodebookGain in Q14 */
 	}
 
-	/* compute the correlation signal as in spec 3.8.1 eq52 */
-	/* compute on 32 bits and get the maximum */
-	for (n=0; n<L_SUBFRAME; n++) {
-		correlationSignal32[n] = 0;
-		for (i=n; i<L_SUBFRAME; i++) {
-			correlationSignal32[n] = MAC16_16(correlationSignal32[n], fixedCodebookTargetSignal[i], impulseResponse[i-n]);
+	if (isNullVector(fixedCodebookTargetSignal, L_SUBFRAME)) {
+		/* null target signal (digital silence): correlation signal is null, so is the correlation of every tested pulses combination */
+		/* energy being positive, the first combination tested is selected: pulses at positions 0, 1, 2 and 3 (jx = 0) with positive signs */
+		i0 = 0; i1 = 1; i2 = 2; i3 = 3;
+		for (i=0; i<4; i++) {
+			correlationSignalSign[i] = 1;
 		}
-		abscCrrelationSignal32 = correlationSignal32[n]>=0?correlationSignal32[n]:-correlationSignal32[n];
-		if (abscCrrelationSignal32>correlationSignalMax) {
-			correlationSignalMax = abscCrrelationSignal32;
+	} else {
+		/* compute the correlation signal as in spec 3.8.1 eq52 */
+		/* compute on 32 bits and get the maximum */
+		for (n=0; n<L_SUBFRAME; n++) {
+			correlationSignal32[n] = 0;
+			for (i=n; i<L_SUBFRAME; i++) {
+				correlationSignal32[n] = MAC16_16(correlationSignal32[n], fixedCodebookTargetSignal[i], impulseResponse[i-n]);
+			}
+			abscCrrelationSignal32 = correlationSignal32[n]>=0?correlationSignal32[n]:-correlationSignal32[n];
+			if (abscCrrelationSignal32>correlationSignalMax) {
+				correlationSignalMax = abscCrrelationSignal32;
+			}
 		}
-	}
-	/* normalise on 13 bits */
-	correlationSignalMaxNorm = countLeadingZeros(correlationSignalMax);
-	if (correlationSignalMaxNorm<18) { /* if it doesn't already fit on 13 bits */
-		for (i=0; i<L_SUBFRAME; i++) {
-			correlationSignal[i] = (word16_t)(SHR(correlationSignal32[i], 18-correlationSignalMaxNorm));
-		 }
-	} else { /* it fits on 13 bits, just copy it to the 16 bits buffer */
-		for (i=0; i<L_SUBFRAME; i++) {
-			correlationSignal[i] = (word16_t)correlationSignal32[i];
+		/* normalise on 13 bits */
+		correlationSignalMaxNorm = countLeadingZeros(correlationSignalMax);
+		if (correlationSignalMaxNorm<18) { /* if it doesn't already fit on 13 bits */
+			for (i=0; i<L_SUBFRAME; i++) {
+				correlationSignal[i] = (word16_t)(SHR(correlationSignal32[i], 18-correlationSignalMaxNorm));
+			 }
+		} else { /* it fits on 13 bits, just copy it to the 16 bits buffer */
+			for (i=0; i<L_SUBFRAME; i++) {
+				correlationSignal[i] = (word16_t)correlationSignal32[i];
+			}
 		}
-	}
 
-	computeImpulseResponseCorrelationMatrix(impulseResponse, correlationSignal, correlationSignalSign, Phi);
+		computeImpulseResponseCorrelationMatrix(impulseResponse, correlationSignal, correlationSignalSign, Phi);
 	
-	/* search for impulses leading to a max in C^2/E : spec 3.8.1 eq53 */
-	/* algorithm, not described in spec, retrieved from ITU code */
-	/* by tracks are intended series of index m0 track is 0,5,10,...35. m1 is 1,6,11,..,36. m2 is 2,7,12,..,37. m3 is 3,8,13,..,38. m4 is 4,9,14,..,39 */
-	/* note index m3 will follow track m3 and m4 */
-	/* The following search is performed twice: first with m3 index following m3 track, and then m3 index follow m4 track */
-	/*    The following operation are performed twice, first using indexes m2, m3, m0, m1 and then m3, m0, m1, m2 as following */
-	/*       description is made for the first run, for the second one, juste substitute m2 by m3, m3 by m0, m0 by m1 and m1 by m2 */
-	/*       - search in m2 track two maxima for the correlation Signal. For each of this maximum : */
-	/*         -- compute for the whole m3 track (8 values) the values C^2 and E (see eq58 and 59) and keep the one giving the best ratio */
-	/*       - compute for the whole tracks m0 and m1 (64 values) the values C^2 and E (keeping the m2 and m3 previously computed) and save the one giving the best ratio */
-	for (m3Base=3; m3Base<5; m3Base++) {
-		for(mIndex=0; mIndex<2; mIndex++) {
-			/* define for this loop on m3 track the Correlation and Energy giving the maximum of eq53 */
-			word32_t m3TrackCorrelationSquare = -1;
-			word32_t m3TrackEnergy = 1;
+		/* search for impulses leading to a max in C^2/E : spec 3.8.1 eq53 */
+		/* algorithm, not described in spec, retrieved from ITU code */
+		/* by tracks are intended series of index m0 track is 0,5,10,...35. m1 is 1,6,11,..,36. m2 is 2,7,12,..,37. m3 is 3,8,13,..,38. m4 is 4,9,14,..,39 */
+		/* note index m3 will follow track m3 and m4 */
+		/* The following search is performed twice: first with m3 index following m3 track, and then m3 index follow m4 track */
+		/*    The following operation are performed twice, first using indexes m2, m3, m0, m1 and then m3, m0, m1, m2 as following */
+		/*       description is made for the first run, for the second one, juste substitute m2 by m3, m3 by m0, m0 by m1 and m1 by m2 */
+		/*       - search in m2 track two maxima for the correlation Signal. For each of this maximum : */
+		/*         -- compute for the whole m3 track (8 values) the values C^2 and E (see eq58 and 59) and keep the one giving the best ratio */
+		/*       - compute for the whole tracks m0 and m1 (64 values) the values C^2 and E (keeping the m2 and m3 previously computed) and save the one giving the best ratio */
+		for (m3Base=3; m3Base<5; m3Base++) {
+			for(mIndex=0; mIndex<2; mIndex++) {
+				/* define for this loop on m3 track the Correlation and Energy giving the maximum of eq53 */
+				word32_t m3TrackCorrelationSquare = -1;
+				word32_t m3TrackEnergy = 1;
 
-			/* Loop on the two maxima of correlation in the m2 index */
-			int firstM2 = 0; /* save the first maximum index to not select it again */
-			word16_t correlationM2M3Max = 0; /* stores the contribution of m2 and m3 impulses to the correlation for the maximum selected */
-			word32_t energyM2M3Max = 0; /* same thing but for the energy */
-			for (i=0; i<2; i++) {
-				word16_t correlationM2 = -1;
-				int currentM2=0;
-				word32_t energyM2;
-				for (j=mSwitch[mIndex][0]; j<L_SUBFRAME; j+=5) { /* in the m2 range, find the correlation Max -> select m2 */
-					if (correlationSignal[j]>correlationM2 && j!=firstM2) {
-						currentM2 = j;
-						correlationM2=correlationSignal[j];
+				/* Loop on the two maxima of correlation in the m2 index */
+				int firstM2 = 0; /* save the first maximum index to not select it again */
+				word16_t correlationM2M3Max = 0; /* stores the contribution of m2 and m3 impulses to the correlation for the maximum selected */
+				word32_t energyM2M3Max = 0; /* same thing but for the energy */
+				for (i=0; i<2; i++) {
+					word16_t correlationM2 = -1;
+					int currentM2=0;
+					word32_t energyM2;
+					for (j=mSwitch[mIndex][0]; j<L_SUBFRAME; j+=5) { /* in the m2 range, find the correlation Max -> select m2 */
+						if (correlationSignal[j]>correlationM2 && j!=firstM2) {
+							currentM2 = j;
+							correlationM2=correlationSignal[j];
+						}
 					}
-				}
-				firstM2 = currentM2; /* to avoid selecting the same maximum at next iteration */
+					firstM2 = currentM2; /* to avoid selecting the same maximum at next iteration */
 
-				energyM2 = Phi[currentM2][currentM2]; /* compute the energy with terms of eq55 using m2 only: Phi'(m2,m2) */		
+					energyM2 = Phi[currentM2][currentM2]; /* compute the energy with terms of eq55 using m2 only: Phi'(m2,m2) */		
 			
-				/* with selected m2, test the 8 m3 possibilities for the current m3 track */
-				for (j=mSwitch[mIndex][1]; j<L_SUBFRAME; j+=5) {
-					word16_t correlationM2M3 = ADD16(correlationM2, correlationSignal[j]); /* compute the correlation sum due to m2 and m3 pulses */
-					word32_t energyM2M3 =  ADD32(energyM2, ADD32(Phi[currentM2][j], Phi[j][j])); /* compute the energy if eq55 using term including m2 and m3: Phi'(m2,m2) is already in energyM2 + Phi'(m2,m3) + Phi'(m3,m3) */
-					word32_t correlationM2M3Square = MULT16_16(correlationM2M3, correlationM2M3);
-					/* check if the current correlation/energy couple gives better results than the stored one : maximise C^2/E -> C^2/E > C^2max/Emax => Emax*C^2 > C^2max*E */
-					if (MULT32_32(m3TrackEnergy,correlationM2M3Square) > MULT32_32(energyM2M3, m3TrackCorrelationSquare)) {
-						m3TrackCorrelationSquare = correlationM2M3Square;
-						m3TrackEnergy = energyM2M3;
-						correlationM2M3Max = correlationM2M3;
-						m3 = j;
-						m2 = currentM2; 
+					/* with selected m2, test the 8 m3 possibilities for the current m3 track */
+					for (j=mSwitch[mIndex][1]; j<L_SUBFRAME; j+=5) {
+						word16_t correlationM2M3 = ADD16(correlationM2, correlationSignal[j]); /* compute the correlation sum due to m2 and m3 pulses */
+						word32_t energyM2M3 =  ADD32(energyM2, ADD32(Phi[currentM2][j], Phi[j][j])); /* compute the energy if eq55 using term including m2 and m3: Phi'(m2,m2) is already in energyM2 + Phi'(m2,m3) + Phi'(m3,m3) */
+						word32_t correlationM2M3Square = MULT16_16(correlationM2M3, correlationM2M3);
+						/* check if the current correlation/energy couple gives better results than the stored one : maximise C^2/E -> C^2/E > C^2max/Emax => Emax*C^2 > C^2max*E */
+						if (MULT32_32(m3TrackEnergy,correlationM2M3Square) > MULT32_32(energyM2M3, m3TrackCorrelationSquare)) {
+							m3TrackCorrelationSquare = correlationM2M3Square;
+							m3TrackEnergy = energyM2M3;
+							correlationM2M3Max = correlationM2M3;
+							m3 = j;
+							m2 = currentM2; 
+						}
 					}
 				}
-			}
-			energyM2M3Max = m3TrackEnergy;
+				energyM2M3Max = m3TrackEnergy;
 
-			/* reset the current m3 track correlationSquare and energy */
-			m3TrackCorrelationSquare = -1;
-			m3TrackEnergy = 1;
+				/* reset the current m3 track correlationSquare and energy */
+				m3TrackCorrelationSquare = -1;
+				m3TrackEnergy = 1;
 
-			for (i=mSwitch[mIndex][2]; i<L_SUBFRAME; i+=5) { /* test the 8 possibilities for m0 track */
-				word16_t correlationM2M3M0 = ADD16(correlationM2M3Max, correlationSignal[i]); /* compute correlation with current m0 taking in account the previously selected m2 and m3 */
-				word32_t energyM2M3M0 = ADD32(energyM2M3Max, ADD32(Phi[i][i], ADD32(Phi[i][m2], Phi[i][m3]))); /* add to the previously computed energy the terms of eq59 we can compute with the selected m0: Phi'(m0,m0) + Phi'(m0,m2) + Phi'(m0,m3) */ 
-				for (j=mSwitch[mIndex][3]; j<L_SUBFRAME; j+=5) { /* test the 8 possibilities for m1 track */
-					word16_t correlationM2M3M0M1 = ADD16(correlationM2M3M0, correlationSignal[j]); /* compute correlation with current m1 taking in account the previously selected m2, m3 and m0 */
-					word32_t energyM2M3M0M1 = ADD32(energyM2M3M0, ADD32(Phi[j][i], ADD32(Phi[j][j], ADD32(Phi[j][m2], Phi[j][m3])))); /* add to the previously computed energy the terms of eq59 we can compute with the selected m1: Phi'(m1,m0) + Phi'(m1,m1) + Phi'(m1,m2) + Phi'(m1,m3) */ 
-					word32_t correlationM2M3M0M1Square = MULT16_16(correlationM2M3M0M1, correlationM2M3M0M1);
-					/* check if the current correlation/energy couple gives better results than the stored one : maximise C^2/E -> C^2/E > C^2max/Emax => Emax*C^2 > C^2max*E */
-					if (MULT32_32(m3TrackEnergy,correlationM2M3M0M1Square) > MULT32_32(energyM2M3M0M1, m3TrackCorrelationSquare)) {
-						m3TrackCorrelationSquare = correlationM2M3M0M1Square;
-						m3TrackEnergy = energyM2M3M0M1;
-						m1 = j;
-						m0 = i; 
+				for (i=mSwitch[mIndex][2]; i<L_SUBFRAME; i+=5) { /* test the 8 possibilities for m0 track */
+					word16_t correlationM2M3M0 = ADD16(correlationM2M3Max, correlationSignal[i]); /* compute correlation with current m0 taking in account the previously selected m2 and m3 */
+					word32_t energyM2M3M0 = ADD32(energyM2M3Max, ADD32(Phi[i][i], ADD32(Phi[i][m2], Phi[i][m3]))); /* add to the previously computed energy the terms of eq59 we can compute with the selected m0: Phi'(m0,m0) + Phi'(m0,m2) + Phi'(m0,m3) */ 
+					for (j=mSwitch[mIndex][3]; j<L_SUBFRAME; j+=5) { /* test the 8 possibilities for m1 track */
+						word16_t correlationM2M3M0M1 = ADD16(correlationM2M3M0, correlationSignal[j]); /* compute correlation with current m1 taking in account the previously selected m2, m3 and m0 */
+						word32_t energyM2M3M0M1 = ADD32(energyM2M3M0, ADD32(Phi[j][i], ADD32(Phi[j][j], ADD32(Phi[j][m2], Phi[j][m3])))); /* add to the previously computed energy the terms of eq59 we can compute with the selected m1: Phi'(m1,m0) + Phi'(m1,m1) + Phi'(m1,m2) + Phi'(m1,m3) */ 
+						word32_t correlationM2M3M0M1Square = MULT16_16(correlationM2M3M0M1, correlationM2M3M0M1);
+						/* check if the current correlation/energy couple gives better results than the stored one : maximise C^2/E -> C^2/E > C^2max/Emax => Emax*C^2 > C^2max*E */
+						if (MULT32_32(m3TrackEnergy,correlationM2M3M0M1Square) > MULT32_32(energyM2M3M0M1, m3TrackCorrelationSquare)) {
+							m3TrackCorrelationSquare = correlationM2M3M0M1Square;
+							m3TrackEnergy = energyM2M3M0M1;
+							m1 = j;
+							m0 = i; 
+						}
 					}
 				}
-			}
 
-			/* check with currently selected indexes if this one is better */
-			if (MULT32_32(energyMax,m3TrackCorrelationSquare) > MULT32_32(m3TrackEnergy, correlationSquareMax)) {
-				correlationSquareMax = m3TrackCorrelationSquare;
-				energyMax = m3TrackEnergy;
-				if (mIndex==0) {
-					i0 = m0;
-					i1 = m1;
-					i2 = m2;
-					i3 = m3;
-				} else {
-					i0 = m3;
-					i1 = m0;
-					i2 = m1;
-					i3 = m2;
+				/* check with currently selected indexes if this one is better */
+				if (MULT32_32(energyMax,m3TrackCorrelationSquare) > MULT32_32(m3TrackEnergy, correlationSquareMax)) {
+					correlationSquareMax = m3TrackCorrelationSquare;
+					energyMax = m3TrackEnergy;
+					if (mIndex==0) {
+						i0 = m0;
+						i1 = m1;
+						i2 = m2;
+						i3 = m3;
+					} else {
+						i0 = m3;
+						i1 = m0;
+						i2 = m1;
+						i3 = m2;
+					}
+					jx = m3Base - 3; /* needed for parameter computation apec 3.8.2 eq62 */
 				}
-				jx = m3Base - 3; /* needed for parameter computation apec 3.8.2 eq62 */
-			}
 
 			
+			}
+			mSwitch[0][1]++; mSwitch[1][0]++; /*increment the m3Base into the mSwitch */
 		}
-		mSwitch[0][1]++; mSwitch[1][0]++; /*increment the m3Base into the mSwitch */
 	}
 
 	/* compute the fixedCodebookVector */
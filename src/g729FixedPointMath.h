@@ -119,10 +119,10 @@ static BCG729_INLINE word32_t g729Exp2_Q11Q16(word16_t x)
 }
 
 /* constants in Q14 */
-#define C0 3634
-#define C1 21173
-#define C2 -12627
-#define C3 4204
+#define SQRT_C0 3634
+#define SQRT_C1 21173
+#define SQRT_C2 -12627
+#define SQRT_C3 4204
 /*****************************************************************************/
 /* g729Sqrt_Q0Q7 : Square root                                               */
 /*    paremeters:                                                            */
@@ -143,7 +143,7 @@ static BCG729_INLINE word32_t g729Sqrt_Q0Q7(uword32_t x)
 
 	/* sqrt(x) ~= 0.22178 + 1.29227*x - 0.77070*x^2 + 0.25659*x^3 (for .25 < x < 1) */
 	/* consider x as in Q14: y = x.2^(-2k-14) -> and give sqrt(y).2^14 = sqrt(x).2^(-k-7).2^14 */
-	rt = ADD16(C0, MULT16_16_Q14(x, ADD16(C1, MULT16_16_Q14(x, ADD16(C2, MULT16_16_Q14(x, (C3))))))); /* rt = sqrt(x).2^(7-k)*/ 
+	rt = ADD16(SQRT_C0, MULT16_16_Q14(x, ADD16(SQRT_C1, MULT16_16_Q14(x, ADD16(SQRT_C2, MULT16_16_Q14(x, (SQRT_C3))))))); /* rt = sqrt(x).2^(7-k)*/ 
 	rt = VSHR32(rt,-k); /* rt = sqrt(x).2^7 */
 	return rt;
 }
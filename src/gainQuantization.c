@@ -34,6 +34,54 @@ void initGainQuantization(bcg729EncoderChannelContextStruct *encoderChannelConte
 	encoderChannelContext->previousGainPredictionError[3] = -14336;
 }
 
+/*****************************************************************************/
+/* isProductAbove : check value >= factor*denominator without overflow       */
+/*    parameters:                                                            */
+/*      -(i) value : unsigned on 64 bits                                     */
+/*      -(i) denominator : on 64 bits, > 0                                   */
+/*      -(i) factor : unsigned on 32 bits, < 2^31                            */
+/*    return value : 1 if value >= factor*denominator, 0 otherwise           */
+/*                                                                           */
+/*****************************************************************************/
+static BCG729_INLINE int isProductAbove(uword64_t value, word64_t denominator, uword32_t factor)
+{
+	/* product computed in two 32 bits halves: if it needs more than 63 bits it is above any value */
+	uword64_t product = (uword64_t)SHR64(denominator, 32)*factor;
+	if (product>=((uword64_t)1<<31)) {
+		return 0;
+	}
+	product = (product<<32) + (uword64_t)(denominator&0xFFFFFFFF)*factor;
+	return value>=product;
+}
+
+/*****************************************************************************/
+/* isQuotientAbove : compare to a threshold the quotient of a division       */
+/*      truncated toward 0 and cast on 32 bits, without computing it         */
+/*      numerator/denominator > threshold <=> numerator >= (threshold+1)*den */
+/*      for positive numerator, denominator and threshold. The division is   */
+/*      performed when the denominator is not positive                       */
+/*    parameters:                                                            */
+/*      -(i) numerator : on 64 bits                                          */
+/*      -(i) denominator : on 64 bits, not 0                                 */
+/*      -(i) threshold : in range ]-2^31, 2^31-1[                            */
+/*    return value : 1 if (word32_t)(numerator/denominator) > threshold      */
+/*                                                                           */
+/*****************************************************************************/
+static BCG729_INLINE int isQuotientAbove(word64_t numerator, word64_t denominator, word32_t threshold)
+{
+	uword64_t absNumerator = (numerator<0)?(uword64_t)0-(uword64_t)numerator:(uword64_t)numerator;
+
+	/* negative denominator or quotient not fitting on 32 bits: perform the division to get the same cast result */
+	if (denominator<0 || (denominator<((word64_t)1<<32) && absNumerator>=((uword64_t)denominator<<31))) {
+		return (word32_t)(DIV64(numerator, denominator)) > threshold;
+	}
+	if (threshold>=0) { /* quotient >= threshold+1 > 0 */
+		return numerator>0 && isProductAbove(absNumerator, denominator, (uword32_t)threshold+1);
+	} else { /* quotient >= threshold+1, with threshold+1 <= 0 */
+		return numerator>=0 || !isProductAbove(absNumerator, denominator, (uword32_t)(-threshold));
+	}
+}
+
 /*****************************************************************************/
 /* gainQuantization : compute quantized adaptative and fixed codebooks gains */
 /*      spec 3.9                                                             */
@@ -63,13 +111,17 @@ void gainQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext,
 	word32_t zz;
 	uint16_t minNormalization = 31;
 	uint16_t currentNormalization;
-	word32_t bestAdaptativeCodebookGain, bestFixedCodebookGain;
+	word64_t bestAdaptativeCodebookGainNumerator, bestAdaptativeCodebookGainDenominator; /* bestAdaptativeCodebookGain in Q9 is their quotient */
+	word64_t bestFixedCodebookGainNumerator, bestFixedCodebookGainDenominator; /* bestFixedCodebookGain in Q2 is their quotient */
 	word64_t denominator;
 	word16_t predictedFixedCodebookGain;
 	uint16_t indexBaseGa=0;
 	uint16_t indexBaseGb=0;
-	uint16_t indexGa=0, indexGb=0;
-	word64_t distanceMin = MAXINT64;
+	uint16_t indexGa, indexGb;
+	word16_t gp[GAIN_QUANTIZATION_CANDIDATES_NBR]; /* candidates adaptative codebook gains in Q14 */
+	word32_t gc[GAIN_QUANTIZATION_CANDIDATES_NBR]; /* candidates fixed codebook gains in Q2 */
+	word64_t distance[GAIN_QUANTIZATION_CANDIDATES_NBR]; /* candidates eq63 in Q28 */
+	int bestCandidate = 0;
 
 	/*** compute spec 3.9 eq63 terms first on 64 bits and then scale them if needed to fit on 32 ***/
 	/* Xy64 and Yy64 already computed during adaptativeCodebookGain computation */
@@ -128,11 +180,15 @@ void gainQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext,
 	/* bestAdaptativeCodebookGain = (zz.xy - xz.yz) / (yy*zz) - yz^2) */
 	/* bestfixedCodebookGain = (yy*xz - xy*yz) / (yy*zz) - yz^2) */
 	/* best gain are computed in Q9 and Q2 and fits on 16 bits */
-	denominator = MAC64(MULT32_32(yy, zz), -yz, yz); /* (yy*zz) - yz^2) in Q24 (always >= 0)*/
+	/* best gains are used only to preselect the codebooks vectors: they are kept as fractions compared to the */
+	/* codebooks thresholds by isQuotientAbove, which gives the same result than the division without performing it */
+	denominator = MAC64(MULT32_32(yy, zz), -yz, yz); /* (yy*zz) - yz^2) in Q24, may be negative: after the normalisation of yy, yz and zz on 32 bits, yz^2 can exceed yy*zz for near colinear y and z */
 	/* avoid division by zero */
 	if (denominator==0) { /* consider it to be one */
-		bestAdaptativeCodebookGain = (word32_t)(SHR64(MAC64(MULT32_32(zz, xy), -xz, yz), 15)); /* MAC in Q24 -> Q9 */
-		bestFixedCodebookGain = (word32_t)(SHR64(MAC64(MULT32_32(yy, xz), -xy, yz), 10)); /* MAC in Q12 -> Q2 */
+		bestAdaptativeCodebookGainNumerator = (word32_t)(SHR64(MAC64(MULT32_32(zz, xy), -xz, yz), 15)); /* MAC in Q24 -> Q9 */
+		bestAdaptativeCodebookGainDenominator = 1;
+		bestFixedCodebookGainNumerator = (word32_t)(SHR64(MAC64(MULT32_32(yy, xz), -xy, yz), 10)); /* MAC in Q12 -> Q2 */
+		bestFixedCodebookGainDenominator = 1;
 	} else {
 		/* bestAdaptativeCodebookGain in Q9 */ 
 		uint16_t numeratorNorm;
@@ -142,13 +198,16 @@ void gainQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext,
 		numeratorH = (numeratorH>0)?numeratorH:-numeratorH;
 		numeratorNorm = countLeadingZeros(numeratorH);
 		if (numeratorNorm >= 9) {
-			bestAdaptativeCodebookGain = (word32_t)(DIV64(SSHL64(numerator,9), denominator)); /* bestAdaptativeCodebookGain in Q9 */
+			bestAdaptativeCodebookGainNumerator = SSHL64(numerator,9); /* bestAdaptativeCodebookGain in Q9 */
+			bestAdaptativeCodebookGainDenominator = denominator;
 		} else {
 			word64_t shiftedDenominator = SHR64(denominator, 9-numeratorNorm);
 			if (shiftedDenominator>0) { /* can't shift left by 9 the numerator, can we shift right by 9-numeratorNorm the denominator without hiting 0 */
-				bestAdaptativeCodebookGain = (word32_t)(DIV64(SHL64(numerator, numeratorNorm),shiftedDenominator)); /* bestAdaptativeCodebookGain in Q9 */
-			} else {
-				bestAdaptativeCodebookGain = SHL((word32_t)(DIV64(SHL64(numerator, numeratorNorm), denominator)), 9-numeratorNorm); /* shift left the division result to reach Q9 */
+				bestAdaptativeCodebookGainNumerator = SHL64(numerator, numeratorNorm); /* bestAdaptativeCodebookGain in Q9 */
+				bestAdaptativeCodebookGainDenominator = shiftedDenominator;
+			} else { /* denominator is tiny compared to numerator: keep the division in this degenerated case */
+				bestAdaptativeCodebookGainNumerator = SHL((word32_t)(DIV64(SHL64(numerator, numeratorNorm), denominator)), 9-numeratorNorm); /* shift left the division result to reach Q9 */
+				bestAdaptativeCodebookGainDenominator = 1;
 			}
 		}
 
@@ -159,13 +218,16 @@ void gainQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext,
 		numeratorNorm = countLeadingZeros(numeratorH);
 
 		if (numeratorNorm >= 14) {
-			bestFixedCodebookGain = (word32_t)(DIV64(SSHL64(numerator,14), denominator));
+			bestFixedCodebookGainNumerator = SSHL64(numerator,14);
+			bestFixedCodebookGainDenominator = denominator;
 		} else {
 			word64_t shiftedDenominator = SHR64(denominator, 14-numeratorNorm); /* bestFixedCodebookGain in Q14 */
 			if (shiftedDenominator>0) { /* can't shift left by 9 the numerator, can we shift right by 9-numeratorNorm the denominator without hiting 0 */
-				bestFixedCodebookGain = (word32_t)(DIV64(SHL64(numerator, numeratorNorm),shiftedDenominator)); /* bestFixedCodebookGain in Q14 */
-			} else {
-				bestFixedCodebookGain = SHL((word32_t)(DIV64(SHL64(numerator, numeratorNorm), denominator)), 14-numeratorNorm); /* shift left the division result to reach Q14 */
+				bestFixedCodebookGainNumerator = SHL64(numerator, numeratorNorm); /* bestFixedCodebookGain in Q14 */
+				bestFixedCodebookGainDenominator = shiftedDenominator;
+			} else { /* denominator is tiny compared to numerator: keep the division in this degenerated case */
+				bestFixedCodebookGainNumerator = SHL((word32_t)(DIV64(SHL64(numerator, numeratorNorm), denominator)), 14-numeratorNorm); /* shift left the division result to reach Q14 */
+				bestFixedCodebookGainDenominator = 1;
 			}
 		}
 	}
@@ -176,12 +238,12 @@ void gainQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext,
 	/***  preselection spec 3.9.2 ***/
 	/* Note: spec just says to select the best 50% of each vector, ITU code go through magical constant computation to select the begining of a continuous range */
 	/* much more simple here : vector are ordened in growing order so just select 2 (4 for Gb) indexes before the first value to be superior to the best gain previously computed */
-	while (indexBaseGa<6 && bestFixedCodebookGain>(MULT16_16_Q14(GACodebook[indexBaseGa][1],predictedFixedCodebookGain))) { /* bestFixedCodebookGain> in Q2, GACodebook in Q12 *predictedFixedCodebookGain in Q4 -> Q16-14 */
+	while (indexBaseGa<6 && isQuotientAbove(bestFixedCodebookGainNumerator, bestFixedCodebookGainDenominator, MULT16_16_Q14(GACodebook[indexBaseGa][1],predictedFixedCodebookGain))) { /* bestFixedCodebookGain> in Q2, GACodebook in Q12 *predictedFixedCodebookGain in Q4 -> Q16-14 */
 		indexBaseGa++;
 	}
 	if (indexBaseGa>0) indexBaseGa--;
 	if (indexBaseGa>0) indexBaseGa--;
-	while (indexBaseGb<12 && bestAdaptativeCodebookGain>(SHR(GBCodebook[indexBaseGb][0],5))) {
+	while (indexBaseGb<12 && isQuotientAbove(bestAdaptativeCodebookGainNumerator, bestAdaptativeCodebookGainDenominator, SHR(GBCodebook[indexBaseGb][0],5))) {
 		indexBaseGb++;
 	}
 	if (indexBaseGb>0) indexBaseGb--;
@@ -194,29 +256,34 @@ void gainQuantization(bcg729EncoderChannelContextStruct *encoderChannelContext,
 	xz = -SSHL(xz,1); /* xz term is always used with a -2 factor */
 	yz = SSHL(yz,1); /* yz term is always used with a 2 factor */
 
+	/* compute gamma->gc and gp of the 4x8 preselected candidates first so the distances computation loop has no dependency */
 	for (i=0; i<4; i++) {
 		for (j=0; j<8; j++) {
-			/* compute gamma->gc and gp */
-			word16_t gp =  ADD16(GACodebook[i+indexBaseGa][0], GBCodebook[j+indexBaseGb][0]); /* result in Q14 */
 			word16_t gamma =  ADD16(GACodebook[i+indexBaseGa][1], GBCodebook[j+indexBaseGb][1]); /* result in Q3.12 (range [0.185, 5.05])*/
-			word32_t gc = MULT16_16_Q14(gamma, predictedFixedCodebookGain); /* gamma in Q12, predictedFixedCodebookGain in Q4 -> Q16 -14 -> Q2 */
-			
-			/* compute E as in eq63 (first term excluded) */
-			word64_t acc = MULT32_32(MULT16_16(gp, gp), yy); /* acc = gp^2*yy  gp in Q14, yy in Q0 -> acc in Q28 */
-			acc = MAC64(acc, MULT16_16(gc, gc), zz); /* gc in Q2, zz in Q24 -> acc in Q28, note gc is on 32 bits but in a range making gc^2 fitting on 32 bits */
-			acc = MAC64(acc, SHL32((word32_t)gp, 14), xy); /* gp in Q14 shifted to Q28, xy in Q0 -> acc in Q28 */
-			acc = MAC64(acc, SHL32(gc, 14), xz); /* gc in Q2 shifted to Q16, xz in Q12 -> acc in Q28 */
-			acc = MAC64(acc, MULT16_16(gp,gc), yz); /* gp in Q14, gc in Q2 yz in Q12 -> acc in Q28 */
-			
-			if (acc<distanceMin) {
-				distanceMin = acc;
-				indexGa = i+indexBaseGa;
-				indexGb = j+indexBaseGb;
-				*quantizedAdaptativeCodebookGain = gp;
-				*quantizedFixedCodebookGain = (word16_t)SHR(gc, 1);
-			}
+			gp[8*i+j] = ADD16(GACodebook[i+indexBaseGa][0], GBCodebook[j+indexBaseGb][0]); /* result in Q14 */
+			gc[8*i+j] = MULT16_16_Q14(gamma, predictedFixedCodebookGain); /* gamma in Q12, predictedFixedCodebookGain in Q4 -> Q16 -14 -> Q2 */
+		}
+	}
+
+	/* compute E as in eq63 (first term excluded) for all candidates */
+	for (i=0; i<GAIN_QUANTIZATION_CANDIDATES_NBR; i++) {
+		word64_t acc = MULT32_32(MULT16_16(gp[i], gp[i]), yy); /* acc = gp^2*yy  gp in Q14, yy in Q0 -> acc in Q28 */
+		acc = MAC64(acc, MULT16_16(gc[i], gc[i]), zz); /* gc in Q2, zz in Q24 -> acc in Q28, note gc is on 32 bits but in a range making gc^2 fitting on 32 bits */
+		acc = MAC64(acc, SHL32((word32_t)gp[i], 14), xy); /* gp in Q14 shifted to Q28, xy in Q0 -> acc in Q28 */
+		acc = MAC64(acc, SHL32(gc[i], 14), xz); /* gc in Q2 shifted to Q16, xz in Q12 -> acc in Q28 */
+		distance[i] = MAC64(acc, MULT16_16(gp[i],gc[i]), yz); /* gp in Q14, gc in Q2 yz in Q12 -> acc in Q28 */
+	}
+
+	/* select the first minimum */
+	for (i=1; i<GAIN_QUANTIZATION_CANDIDATES_NBR; i++) {
+		if (distance[i]<distance[bestCandidate]) {
+			bestCandidate = i;
 		}
 	}
+	indexGa = (uint16_t)(bestCandidate/8 + indexBaseGa);
+	indexGb = (uint16_t)(bestCandidate%8 + indexBaseGb);
+	*quantizedAdaptativeCodebookGain = gp[bestCandidate];
+	*quantizedFixedCodebookGain = (word16_t)SHR(gc[bestCandidate], 1);
 
 	/* update the previous gain prediction error */
 	computeGainPredictionError(ADD16(GACodebook[indexGa][1], GBCodebook[indexGb][1]), encoderChannelContext->previousGainPredictionError);
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "basicOperationsMacros.h"
+
+#include "bcg729/rtp.h"
+#include "bcg729/jitterBuffer.h"
+
+/* a jitter buffer frame slot */
+typedef struct {
+	uint32_t timestamp; /* RTP timestamp of the frame */
+	uint8_t bitStreamLength; /* 10 for speech frames, 2 for SID ones, JITTER_BUFFER_EMPTY_SLOT when no frame is stored */
+	uint8_t bitStream[RTP_FRAME_LENGTH];
+} bcg729JitterBufferSlot;
+
+/* define the context structure to store all static data for a jitter buffer */
+struct bcg729JitterBufferStruct_struct {
+	bcg729DecoderChannelContextStruct *decoderChannelContext; /* not owned by the jitter buffer */
+	bcg729JitterBufferSlot slots[JITTER_BUFFER_SLOTS_NBR]; /* frames indexed by their timestamp in frames modulo JITTER_BUFFER_SLOTS_NBR */
+	uint8_t startedFlag; /* set when the first packet is received */
+	uint8_t playingFlag; /* set when the first frame is played */
+	uint32_t clock; /* in samples, incremented by L_FRAME on each frame played */
+	uint32_t nextTimestamp; /* timestamp of the next frame to play */
+	uint16_t highestSequenceNumber; /* highest RTP sequence number received */
+	/* transit(arrival clock - timestamp) of the fastest packet, over the current and previous windows of JITTER_BUFFER_TRANSIT_WINDOW packets */
+	uint32_t minTransit;
+	uint32_t windowMinTransit;
+	uint32_t previousWindowMinTransit;
+	uint16_t windowPacketsNbr;
+	word32_t delayHistogram[JITTER_BUFFER_MAXIMUM_DELAY+1]; /* in Q30, probability of packets delay over the fastest one, in frames, recent packets weighting more */
+	int32_t minDelay, maxDelay; /* in samples */
+	bcg729JitterBufferStats stats;
+};
+
+/* get the slot of a timestamp, NULL if the frame was not received */
+static bcg729JitterBufferSlot *getSlot(bcg729JitterBufferStruct *jitterBuffer, uint32_t timestamp)
+{
+	bcg729JitterBufferSlot *slot = &(jitterBuffer->slots[(timestamp/L_FRAME)%JITTER_BUFFER_SLOTS_NBR]);
+
+	if (slot->bitStreamLength == JITTER_BUFFER_EMPTY_SLOT || slot->timestamp != timestamp) {
+		return NULL;
+	}
+	return slot;
+}
+
+/* empty the buffer and set the playout delay of the given packet to the target one */
+static void resetPlayout(bcg729JitterBufferStruct *jitterBuffer, uint32_t timestamp)
+{
+	int i;
+
+	for (i=0; i<JITTER_BUFFER_SLOTS_NBR; i++) {
+		jitterBuffer->slots[i].bitStreamLength = JITTER_BUFFER_EMPTY_SLOT;
+	}
+	jitterBuffer->minTransit = jitterBuffer->clock - timestamp;
+	jitterBuffer->windowMinTransit = jitterBuffer->minTransit;
+	jitterBuffer->previousWindowMinTransit = jitterBuffer->minTransit;
+	jitterBuffer->windowPacketsNbr = 0;
+	memset(jitterBuffer->delayHistogram, 0, sizeof(jitterBuffer->delayHistogram));
+	jitterBuffer->delayHistogram[0] = ONE_IN_Q30;
+	jitterBuffer->stats.targetDelay = (uint16_t)jitterBuffer->minDelay;
+	jitterBuffer->nextTimestamp = timestamp - (uint32_t)jitterBuffer->minDelay;
+}
+
+/*****************************************************************************/
+/* initBcg729JitterBuffer : create jitter buffer and initialise it           */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the decoder channel fed by the buffer   */
+/*      -(i) minDelay : minimum playout delay, in frames                     */
+/*      -(i) maxDelay : maximum playout delay, in frames                     */
+/*    return value :                                                         */
+/*      - the jitter buffer, NULL if delays are invalid                      */
+/*                                                                           */
+/*****************************************************************************/
+bcg729JitterBufferStruct *initBcg729JitterBuffer(bcg729DecoderChannelContextStruct *decoderChannelContext, uint16_t minDelay, uint16_t maxDelay)
+{
+	bcg729JitterBufferStruct *jitterBuffer;
+
+	if (decoderChannelContext == NULL || minDelay > maxDelay || maxDelay > JITTER_BUFFER_MAXIMUM_DELAY) {
+		return NULL;
+	}
+
+	/* create the context structure */
+	jitterBuffer = malloc(sizeof(bcg729JitterBufferStruct));
+	memset(jitterBuffer, 0, sizeof(*jitterBuffer));
+
+	jitterBuffer->decoderChannelContext = decoderChannelContext;
+	jitterBuffer->minDelay = minDelay*L_FRAME;
+	jitterBuffer->maxDelay = maxDelay*L_FRAME;
+	jitterBuffer->stats.targetDelay = (uint16_t)jitterBuffer->minDelay;
+	resetPlayout(jitterBuffer, 0);
+
+	return jitterBuffer;
+}
+
+/*****************************************************************************/
+/* closeBcg729JitterBuffer : free memory of jitter buffer                    */
+/*    parameters:                                                            */
+/*      -(i) jitterBuffer : the jitter buffer                                */
+/*                                                                           */
+/*****************************************************************************/
+void closeBcg729JitterBuffer(bcg729JitterBufferStruct *jitterBuffer)
+{
+	free(jitterBuffer);
+	return;
+}
+
+/*****************************************************************************/
+/* bcg729JitterBufferPut : store the frames of a received RTP packet         */
+/*    parameters:                                                            */
+/*      -(i/o) jitterBuffer : the jitter buffer                              */
+/*      -(i) sequenceNumber : RTP sequence number                            */
+/*      -(i) timestamp : RTP timestamp(8kHz clock) of the first frame        */
+/*      -(i) payload : RTP payload(RFC3551 G729 payload)                     */
+/*      -(i) payloadLength : in bytes                                        */
+/*    return value : number of frames stored                                 */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t bcg729JitterBufferPut(bcg729JitterBufferStruct *jitterBuffer, uint16_t sequenceNumber, uint32_t timestamp, const uint8_t payload[], uint16_t payloadLength)
+{
+	uint16_t framesNbr = bcg729GetRTPPayloadFramesNbr(payloadLength);
+	uint16_t storedFramesNbr = 0;
+	uint32_t transit;
+	int32_t delay, targetDelay;
+	word32_t cumulatedProbability;
+	int j;
+	int32_t timestampOffset = (int32_t)(timestamp - jitterBuffer->nextTimestamp);
+	uint16_t i;
+
+	if (framesNbr == 0) { /* invalid payload */
+		return 0;
+	}
+
+	/* first packet or timestamp jump out of the buffer range: restart the playout on this packet */
+	if (jitterBuffer->startedFlag == 0 || timestampOffset >= JITTER_BUFFER_SLOTS_NBR*L_FRAME || timestampOffset <= -JITTER_BUFFER_SLOTS_NBR*L_FRAME) {
+		resetPlayout(jitterBuffer, timestamp);
+		jitterBuffer->startedFlag = 1;
+		jitterBuffer->highestSequenceNumber = sequenceNumber;
+	}
+
+	if ((int16_t)(sequenceNumber - jitterBuffer->highestSequenceNumber) < 0) {
+		jitterBuffer->stats.reorderedPacketsNbr++;
+	} else {
+		jitterBuffer->highestSequenceNumber = sequenceNumber;
+	}
+
+	/*** track the fastest packet transit over one or two windows, so the reference can rise on clock drift ***/
+	transit = jitterBuffer->clock - timestamp;
+	if (jitterBuffer->windowPacketsNbr == 0 || (int32_t)(transit - jitterBuffer->windowMinTransit) < 0) {
+		jitterBuffer->windowMinTransit = transit;
+	}
+	jitterBuffer->minTransit = ((int32_t)(jitterBuffer->windowMinTransit - jitterBuffer->previousWindowMinTransit) < 0)?jitterBuffer->windowMinTransit:jitterBuffer->previousWindowMinTransit;
+	jitterBuffer->windowPacketsNbr++;
+	if (jitterBuffer->windowPacketsNbr == JITTER_BUFFER_TRANSIT_WINDOW) {
+		jitterBuffer->previousWindowMinTransit = jitterBuffer->windowMinTransit;
+		jitterBuffer->windowPacketsNbr = 0;
+	}
+
+	/*** target delay: quantile of the packets delay over the fastest one, rounded up to a whole frame ***/
+	delay = (int32_t)(transit - jitterBuffer->minTransit);
+	delay = (delay + L_FRAME - 1)/L_FRAME;
+	if (delay > JITTER_BUFFER_MAXIMUM_DELAY) {
+		delay = JITTER_BUFFER_MAXIMUM_DELAY;
+	}
+	cumulatedProbability = 0;
+	targetDelay = -1;
+	for (j=0; j<=JITTER_BUFFER_MAXIMUM_DELAY; j++) {
+		jitterBuffer->delayHistogram[j] = MULT16_32_Q15(JITTER_BUFFER_HISTOGRAM_FORGET, jitterBuffer->delayHistogram[j]);
+		if (j == delay) {
+			jitterBuffer->delayHistogram[j] = ADD32(jitterBuffer->delayHistogram[j], SHL(ONE_IN_Q15 - JITTER_BUFFER_HISTOGRAM_FORGET, 15));
+		}
+		cumulatedProbability = ADD32(cumulatedProbability, jitterBuffer->delayHistogram[j]);
+		if (targetDelay < 0 && cumulatedProbability >= SHL(JITTER_BUFFER_QUANTILE, 15)) {
+			targetDelay = j;
+		}
+	}
+	if (targetDelay < 0) { /* rounding errors: histogram sums slightly below the quantile */
+		targetDelay = JITTER_BUFFER_MAXIMUM_DELAY;
+	}
+	targetDelay = MULT16_16(targetDelay, L_FRAME);
+	jitterBuffer->stats.targetDelay = (uint16_t)targetDelay;
+
+	/*** store the frames ***/
+	for (i=0; i<framesNbr; i++) {
+		uint32_t frameTimestamp = timestamp + i*L_FRAME;
+		bcg729JitterBufferSlot *slot = &(jitterBuffer->slots[(frameTimestamp/L_FRAME)%JITTER_BUFFER_SLOTS_NBR]);
+
+		if ((int32_t)(frameTimestamp - jitterBuffer->nextTimestamp) < 0) { /* playout time is over */
+			jitterBuffer->stats.lateFramesNbr++;
+			continue;
+		}
+		if ((int32_t)(frameTimestamp - jitterBuffer->nextTimestamp) >= JITTER_BUFFER_SLOTS_NBR*L_FRAME) { /* no room for it */
+			break;
+		}
+		if (slot->bitStreamLength != JITTER_BUFFER_EMPTY_SLOT && slot->timestamp == frameTimestamp) {
+			jitterBuffer->stats.duplicatedFramesNbr++;
+			continue;
+		}
+
+		slot->timestamp = frameTimestamp;
+		if (i == payloadLength/RTP_FRAME_LENGTH) { /* trailing SID frame */
+			slot->bitStreamLength = RTP_SID_FRAME_LENGTH;
+		} else {
+			slot->bitStreamLength = RTP_FRAME_LENGTH;
+		}
+		memcpy(slot->bitStream, &(payload[i*RTP_FRAME_LENGTH]), slot->bitStreamLength);
+		storedFramesNbr++;
+	}
+	jitterBuffer->stats.receivedFramesNbr += storedFramesNbr;
+
+	return storedFramesNbr;
+}
+
+/*****************************************************************************/
+/* bcg729JitterBufferGet : decode the next frame to play                     */
+/*    parameters:                                                            */
+/*      -(i/o) jitterBuffer : the jitter buffer                              */
+/*      -(o) signal : a decoded frame 80 samples (16 bits PCM)               */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729JitterBufferGet(bcg729JitterBufferStruct *jitterBuffer, int16_t signal[])
+{
+	bcg729DecoderChannelContextStruct *decoderChannelContext = jitterBuffer->decoderChannelContext;
+	bcg729JitterBufferSlot *slot = getSlot(jitterBuffer, jitterBuffer->nextTimestamp);
+	int32_t delay = (int32_t)(jitterBuffer->clock - jitterBuffer->nextTimestamp - jitterBuffer->minTransit);
+
+	if (jitterBuffer->playingFlag == 0 && slot == NULL) { /* nothing to play yet */
+		memset(signal, 0, L_FRAME*sizeof(int16_t));
+		if (jitterBuffer->startedFlag) {
+			jitterBuffer->nextTimestamp += L_FRAME;
+		}
+		jitterBuffer->clock += L_FRAME;
+		return;
+	}
+	jitterBuffer->playingFlag = 1;
+
+	/*** missing speech frame while the delay is under target: it may be late, conceal a frame and keep waiting for it ***/
+	if (slot == NULL && decoderChannelContext->previousFrameIsActiveFlag == 1 && delay < (int32_t)jitterBuffer->stats.targetDelay) {
+		bcg729Decoder(decoderChannelContext, NULL, 0, 1, 0, 0, signal);
+		jitterBuffer->stats.concealedFramesNbr++;
+		jitterBuffer->stats.insertedFramesNbr++;
+		jitterBuffer->stats.currentDelay = (uint16_t)((delay>0)?delay:0);
+		jitterBuffer->clock += L_FRAME;
+		return;
+	}
+
+	/*** playout delay adjustments, only on silence frames which were not transmitted ***/
+	if (slot == NULL && decoderChannelContext->previousFrameIsActiveFlag == 0) {
+		if (delay > (int32_t)jitterBuffer->stats.targetDelay + JITTER_BUFFER_HYSTERESIS) { /* drop this frame, play the next one */
+			jitterBuffer->nextTimestamp += L_FRAME;
+			delay -= L_FRAME;
+			jitterBuffer->stats.droppedFramesNbr++;
+			slot = getSlot(jitterBuffer, jitterBuffer->nextTimestamp);
+		} else if (delay < (int32_t)jitterBuffer->stats.targetDelay) { /* insert a comfort noise frame, keep the next frame for later */
+			bcg729Decoder(decoderChannelContext, NULL, 0, 0, 1, 0, signal);
+			jitterBuffer->stats.insertedFramesNbr++;
+			jitterBuffer->stats.currentDelay = (uint16_t)((delay>0)?delay:0);
+			jitterBuffer->clock += L_FRAME;
+			return;
+		}
+	}
+
+	if (slot != NULL) {
+		bcg729Decoder(decoderChannelContext, slot->bitStream, slot->bitStreamLength, 0, (slot->bitStreamLength==RTP_SID_FRAME_LENGTH)?1:0, 0, signal);
+		slot->bitStreamLength = JITTER_BUFFER_EMPTY_SLOT;
+	} else { /* missing frame: erased during speech, untransmitted during silence, the decoder manages both */
+		if (decoderChannelContext->previousFrameIsActiveFlag) {
+			jitterBuffer->stats.concealedFramesNbr++;
+		}
+		bcg729Decoder(decoderChannelContext, NULL, 0, 1, 0, 0, signal);
+	}
+
+	jitterBuffer->stats.currentDelay = (uint16_t)((delay>0)?delay:0);
+	jitterBuffer->nextTimestamp += L_FRAME;
+	jitterBuffer->clock += L_FRAME;
+}
+
+/*****************************************************************************/
+/* bcg729GetJitterBufferStats : get the jitter buffer statistics             */
+/*    parameters:                                                            */
+/*      -(i) jitterBuffer : the jitter buffer                                */
+/*      -(o) stats : the jitter buffer statistics                            */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729GetJitterBufferStats(bcg729JitterBufferStruct *jitterBuffer, bcg729JitterBufferStats *stats)
+{
+	memcpy(stats, &(jitterBuffer->stats), sizeof(bcg729JitterBufferStats));
+}
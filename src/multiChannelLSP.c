@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "basicOperationsMacros.h"
+
+#include "multiChannelLSP.h"
+
+/*****************************************************************************/
+/* interpolateqLSPMultiChannel : interpolateqLSP on all lanes                */
+/*    parameters:                                                            */
+/*      -(i) previousqLSP : 10 values in Q0.15 for each lane                 */
+/*      -(i) currentqLSP : 10 values in Q0.15 for each lane                  */
+/*      -(o) interpolatedqLSP : 10 values in Q0.15 for each lane             */
+/*                                                                           */
+/*****************************************************************************/
+void interpolateqLSPMultiChannel(word16_t previousqLSP[NB_LSP_COEFF][MULTI_CHANNEL_LANES], word16_t currentqLSP[NB_LSP_COEFF][MULTI_CHANNEL_LANES], word16_t interpolatedqLSP[NB_LSP_COEFF][MULTI_CHANNEL_LANES])
+{
+	int i,k;
+	for (i=0; i<NB_LSP_COEFF; i++) {
+		for (k=0; k<MULTI_CHANNEL_LANES; k++) {
+			interpolatedqLSP[i][k] = (word16_t)PSHR(ADD32(previousqLSP[i][k], currentqLSP[i][k]),1);
+		}
+	}
+}
+
+/*****************************************************************************/
+/* computePolynomialCoefficientsMultiChannel : according to spec. 3.2.6, see */
+/*      computePolynomialCoefficients in qLSP2LP.c                           */
+/*    parameters:                                                            */
+/*      -(i) qLSP : 10 LSP in Q0.15 for each lane, only the coefficients     */
+/*             offset, offset+2, ..., offset+8 are used                      */
+/*      -(i) offset : 0 for f1, 1 for f2                                     */
+/*      -(o) f : 6 values in Q24 for each lane                               */
+/*                                                                           */
+/*****************************************************************************/
+static void computePolynomialCoefficientsMultiChannel(word16_t qLSP[NB_LSP_COEFF][MULTI_CHANNEL_LANES], int offset, word32_t f[6][MULTI_CHANNEL_LANES])
+{
+	int i,j,k;
+
+	for (k=0; k<MULTI_CHANNEL_LANES; k++) {
+		f[0][k] = 16777216; /* 1 in Q24 */
+		f[1][k] = MULT16_16(qLSP[offset][k], -1024); /* f[1] = -2*qLSP[0] in Q24 */
+	}
+
+	for (i=2; i<6; i++) {
+		word16_t *laneqLSP = qLSP[2*i-2+offset];
+		for (k=0; k<MULTI_CHANNEL_LANES; k++) {
+			f[i][k] = SSHL(SUB32(f[i-2][k], MULT16_32_P15(laneqLSP[k], f[i-1][k])),1);
+		}
+		for (j=i-1; j>1; j--) {
+			for (k=0; k<MULTI_CHANNEL_LANES; k++) {
+				f[j][k] = ADD32(f[j][k], SUB32(f[j-2][k], MULT16_32_P14(laneqLSP[k], f[j-1][k])));
+			}
+		}
+		for (k=0; k<MULTI_CHANNEL_LANES; k++) {
+			f[1][k] = SUB32(f[1][k], SSHL(laneqLSP[k],10));
+		}
+	}
+}
+
+/*****************************************************************************/
+/* qLSP2LPMultiChannel : qLSP2LP on all lanes, spec. 3.2.6                   */
+/*    parameters:                                                            */
+/*      -(i) qLSP : 10 LSP in Q0.15 range [-1, +1[ for each lane             */
+/*      -(o) LP : 10 LP coefficients in Q12 for each lane                    */
+/*                                                                           */
+/*****************************************************************************/
+void qLSP2LPMultiChannel(word16_t qLSP[NB_LSP_COEFF][MULTI_CHANNEL_LANES], word16_t LP[NB_LSP_COEFF][MULTI_CHANNEL_LANES])
+{
+	int i,k;
+	word32_t f1[6][MULTI_CHANNEL_LANES], f2[6][MULTI_CHANNEL_LANES]; /* polynomials coefficients in Q24, fx[0] is used as a buffer */
+
+	computePolynomialCoefficientsMultiChannel(qLSP, 0, f1);
+	computePolynomialCoefficientsMultiChannel(qLSP, 1, f2);
+
+	/* f'1[i] = f1[i]+f[i-1] and f'2[i] = f2[i] - f2[i-1] */
+	for (i=5; i>0; i--) {
+		for (k=0; k<MULTI_CHANNEL_LANES; k++) {
+			f1[i][k] = ADD32(f1[i][k], f1[i-1][k]);
+			f2[i][k] = SUB32(f2[i][k], f2[i-1][k]);
+		}
+	}
+
+	/* LP[i] = (f1[i] + f2[i])/2 and LP[9-i] = (f1[i] - f2[i])/2 for i in [0,5[, f1 and f2 accessed from their element 1 */
+	for (i=0; i<5; i++) {
+		for (k=0; k<MULTI_CHANNEL_LANES; k++) {
+			LP[i][k] = PSHR(ADD32(f1[i+1][k], f2[i+1][k]),13);
+			LP[9-i][k] = PSHR(SUB32(f1[i+1][k], f2[i+1][k]),13);
+		}
+	}
+}
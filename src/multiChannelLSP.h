@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef MULTICHANNELLSP_H
+#define MULTICHANNELLSP_H
+/*****************************************************************************/
+/* LSP to LP conversion of several channels at once: channels are lanes of  */
+/* arrays indexed [coefficient][lane] so each step is a loop over the lanes  */
+/* without dependency, the channels results are the interpolateqLSP and     */
+/* qLSP2LP ones                                                              */
+/*****************************************************************************/
+
+/*****************************************************************************/
+/* interpolateqLSPMultiChannel : interpolateqLSP on all lanes                */
+/*    parameters:                                                            */
+/*      -(i) previousqLSP : 10 values in Q0.15 for each lane                 */
+/*      -(i) currentqLSP : 10 values in Q0.15 for each lane                  */
+/*      -(o) interpolatedqLSP : 10 values in Q0.15 for each lane             */
+/*                                                                           */
+/*****************************************************************************/
+void interpolateqLSPMultiChannel(word16_t previousqLSP[NB_LSP_COEFF][MULTI_CHANNEL_LANES], word16_t currentqLSP[NB_LSP_COEFF][MULTI_CHANNEL_LANES], word16_t interpolatedqLSP[NB_LSP_COEFF][MULTI_CHANNEL_LANES]);
+
+/*****************************************************************************/
+/* qLSP2LPMultiChannel : qLSP2LP on all lanes, spec. 3.2.6                   */
+/*    parameters:                                                            */
+/*      -(i) qLSP : 10 LSP in Q0.15 range [-1, +1[ for each lane             */
+/*      -(o) LP : 10 LP coefficients in Q12 for each lane                    */
+/*                                                                           */
+/*****************************************************************************/
+void qLSP2LPMultiChannel(word16_t qLSP[NB_LSP_COEFF][MULTI_CHANNEL_LANES], word16_t LP[NB_LSP_COEFF][MULTI_CHANNEL_LANES]);
+#endif /* ifndef MULTICHANNELLSP_H */
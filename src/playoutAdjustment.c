@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "basicOperationsMacros.h"
+
+#include "bcg729/decoder.h"
+
+/*****************************************************************************/
+/* removeSamples : remove samples from a signal with a linear crossfade over */
+/*      the whole output: first and last samples are kept so the output      */
+/*      stays continuous with the previous and next frames                   */
+/*    parameters:                                                            */
+/*      -(i/o) signal : the signal, processed in place                       */
+/*      -(i) signalLength : number of samples in signal                      */
+/*      -(i) removedSamplesNbr : number of samples to remove                 */
+/*                                                                           */
+/*****************************************************************************/
+static void removeSamples(int16_t signal[], int signalLength, int removedSamplesNbr)
+{
+	int i;
+	int outputLength = signalLength - removedSamplesNbr;
+
+	/* output[i] mixes signal[i] and signal[i+removedSamplesNbr], in place as signal[j>=i] only is read */
+	for (i=0; i<outputLength; i++) {
+		word16_t fadeIn = (word16_t)DIV32(SHL(i, 15), outputLength); /* in Q15 */
+		signal[i] = (int16_t)PSHR(ADD32(MULT16_16(signal[i], SUB32(ONE_IN_Q15, fadeIn)), MULT16_16(signal[i+removedSamplesNbr], fadeIn)), 15);
+	}
+}
+
+/*****************************************************************************/
+/* bcg729DecoderAdjustPlayout : see decoder.h                                */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer          */
+/*      -(i) frameErased: flag: true, frame has been erased                  */
+/*      -(i) SIDFrameFlag: flag: true, frame is a SID one                    */
+/*      -(i) rfc3389PayloadFlag: true when CN payload follow rfc3389         */
+/*      -(i) adjustment : in samples, in [-80, 80], positive to stretch      */
+/*      -(o) signal : decoded signal(16 bits PCM), must hold 160 samples     */
+/*    return value : number of samples in signal                             */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t bcg729DecoderAdjustPlayout(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, int16_t adjustment, int16_t signal[])
+{
+	bcg729Decoder(decoderChannelContext, bitStream, bitStreamLength, frameErasureFlag, SIDFrameFlag, rfc3389PayloadFlag, signal);
+
+	/* speech frame or nothing to do */
+	if (decoderChannelContext->previousFrameIsActiveFlag == 1 || adjustment == 0) {
+		return L_FRAME;
+	}
+
+	if (adjustment > L_FRAME) {
+		adjustment = L_FRAME;
+	}
+	if (adjustment < -L_FRAME) {
+		adjustment = -L_FRAME;
+	}
+
+	if (adjustment > 0) { /* continue the comfort noise on an extra untransmitted frame, then remove what is not needed */
+		bcg729Decoder(decoderChannelContext, NULL, 0, 0, 1, 0, &(signal[L_FRAME]));
+		removeSamples(signal, 2*L_FRAME, L_FRAME - adjustment);
+	} else {
+		removeSamples(signal, L_FRAME, -adjustment);
+	}
+
+	return (uint16_t)(L_FRAME + adjustment);
+}
+
+/*****************************************************************************/
+/* bcg729DecoderTimeScale : see decoder.h                                    */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(i) bitStream : 15 parameters on 80 bits                            */
+/*      -(i): bitStreamLength : in bytes, length of previous buffer          */
+/*      -(i) frameErased: flag: true, frame has been erased                  */
+/*      -(i) SIDFrameFlag: flag: true, frame is a SID one                    */
+/*      -(i) rfc3389PayloadFlag: true when CN payload follow rfc3389         */
+/*      -(i) speed : playback speed in Q8, in [256, 512]                     */
+/*      -(o) signal : time scaled signal(16 bits PCM), must hold 80 samples  */
+/*    return value : number of samples in signal, in [0, 80]                 */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t bcg729DecoderTimeScale(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, uint16_t speed, int16_t signal[])
+{
+	word16_t *buffer = decoderChannelContext->timeScaleBuffer;
+	int bufferLength = decoderChannelContext->timeScaleBufferLength;
+	int pitchDelay;
+	int outputLength;
+
+	if (speed < TIME_SCALE_SPEED_MIN) {
+		speed = TIME_SCALE_SPEED_MIN;
+	}
+	if (speed > TIME_SCALE_SPEED_MAX) {
+		speed = TIME_SCALE_SPEED_MAX;
+	}
+
+	bcg729Decoder(decoderChannelContext, bitStream, bitStreamLength, frameErasureFlag, SIDFrameFlag, rfc3389PayloadFlag, &(buffer[bufferLength]));
+	bufferLength += L_FRAME;
+
+	/* the decoded frame should last L_FRAME/speed samples: the difference is accumulated until a pitch period can be removed */
+	decoderChannelContext->timeScaleDebt = ADD32(decoderChannelContext->timeScaleDebt, SUB32(SHL(L_FRAME, 8), DIV32(SHL(L_FRAME, 16), speed)));
+
+	/* pitch delay of the last decoded subframe: the long term post filter refines it around the transmitted one */
+	if (decoderChannelContext->decoderMode == BCG729_DECODER_MODE_STANDARD) {
+		pitchDelay = decoderChannelContext->postFilterPitchDelay;
+	} else {
+		pitchDelay = decoderChannelContext->previousIntPitchDelay;
+	}
+
+	/* remove whole pitch periods from the end of the buffer: the last two periods are crossfaded into one */
+	while (decoderChannelContext->timeScaleDebt >= SHL(pitchDelay, 8) && bufferLength >= 2*pitchDelay) {
+		removeSamples(&(buffer[bufferLength - 2*pitchDelay]), 2*pitchDelay, pitchDelay);
+		bufferLength -= pitchDelay;
+		decoderChannelContext->timeScaleDebt = SUB32(decoderChannelContext->timeScaleDebt, SHL(pitchDelay, 8));
+	}
+
+	/* keep TIME_SCALE_RESERVE samples so two periods of the next frame pitch are always available */
+	outputLength = bufferLength - TIME_SCALE_RESERVE;
+	if (outputLength <= 0) {
+		decoderChannelContext->timeScaleBufferLength = (uint16_t)bufferLength;
+		return 0;
+	}
+	memcpy(signal, buffer, outputLength*sizeof(int16_t));
+	memmove(buffer, &(buffer[outputLength]), TIME_SCALE_RESERVE*sizeof(word16_t));
+	decoderChannelContext->timeScaleBufferLength = TIME_SCALE_RESERVE;
+
+	return (uint16_t)outputLength;
+}
+
+/*****************************************************************************/
+/* bcg729DecoderTimeScaleFlush : see decoder.h                               */
+/*    parameters:                                                            */
+/*      -(i) decoderChannelContext : the channel context data                */
+/*      -(o) signal : time scaled signal(16 bits PCM), must hold 80 samples  */
+/*    return value : number of samples in signal, 0 when all were output     */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t bcg729DecoderTimeScaleFlush(bcg729DecoderChannelContextStruct *decoderChannelContext, int16_t signal[])
+{
+	uint16_t outputLength = decoderChannelContext->timeScaleBufferLength;
+
+	if (outputLength > L_FRAME) {
+		outputLength = L_FRAME;
+	}
+	memcpy(signal, decoderChannelContext->timeScaleBuffer, outputLength*sizeof(int16_t));
+	decoderChannelContext->timeScaleBufferLength -= outputLength;
+	memmove(decoderChannelContext->timeScaleBuffer, &(decoderChannelContext->timeScaleBuffer[outputLength]), decoderChannelContext->timeScaleBufferLength*sizeof(word16_t));
+
+	return outputLength;
+}
@@ -24,6 +24,52 @@
 #include "utils.h"
 #include "g729FixedPointMath.h"
 
+/*****************************************************************************/
+/* computeLPGammaNCoefficients: LPGammaN[i] = LP[i]*GammaN^(i+1) (i=0..9)     */
+/*    parameters:                                                            */
+/*      -(i) LPCoefficients: 10 LP coeff for current subframe in Q12         */
+/*      -(o) LPGammaNCoefficients: 10 coefficients in Q12                    */
+/*                                                                           */
+/*****************************************************************************/
+static BCG729_INLINE void computeLPGammaNCoefficients(word16_t *LPCoefficients, word16_t *LPGammaNCoefficients)
+{
+	/* GAMMA_XX constants are in Q15 */
+	LPGammaNCoefficients[0] = MULT16_16_P15(LPCoefficients[0], GAMMA_N1);
+	LPGammaNCoefficients[1] = MULT16_16_P15(LPCoefficients[1], GAMMA_N2);
+	LPGammaNCoefficients[2] = MULT16_16_P15(LPCoefficients[2], GAMMA_N3);
+	LPGammaNCoefficients[3] = MULT16_16_P15(LPCoefficients[3], GAMMA_N4);
+	LPGammaNCoefficients[4] = MULT16_16_P15(LPCoefficients[4], GAMMA_N5);
+	LPGammaNCoefficients[5] = MULT16_16_P15(LPCoefficients[5], GAMMA_N6);
+	LPGammaNCoefficients[6] = MULT16_16_P15(LPCoefficients[6], GAMMA_N7);
+	LPGammaNCoefficients[7] = MULT16_16_P15(LPCoefficients[7], GAMMA_N8);
+	LPGammaNCoefficients[8] = MULT16_16_P15(LPCoefficients[8], GAMMA_N9);
+	LPGammaNCoefficients[9] = MULT16_16_P15(LPCoefficients[9], GAMMA_N10);
+}
+
+/*****************************************************************************/
+/* computeResidualSignal: compute the residual signal spec 4.2.1 eq79        */
+/*      Compute also a scaled residual signal: shift right by 2 to avoid     */
+/*      overflows on 32 bits when computing correlation and energy           */
+/*    parameters:                                                            */
+/*      -(i) LPGammaNCoefficients: 10 coefficients in Q12                    */
+/*      -(i) reconstructedSpeech: 50 values in Q0, accessed in [-10, 39]     */
+/*      -(o) residualSignal: 40 values in Q0                                 */
+/*      -(o) scaledResidualSignal: 40 values in Q-2                          */
+/*                                                                           */
+/*****************************************************************************/
+static BCG729_INLINE void computeResidualSignal(word16_t *LPGammaNCoefficients, word16_t *reconstructedSpeech, word16_t *residualSignal, word16_t *scaledResidualSignal)
+{
+	int i,j;
+	for (i=0; i<L_SUBFRAME; i++) {
+		word32_t acc = SSHL((word32_t)reconstructedSpeech[i], 12); /* reconstructedSpeech in Q0 shifted to set acc in Q12 */
+		for (j=0; j<NB_LSP_COEFF; j++) {
+			acc = MAC16_16(acc, LPGammaNCoefficients[j],reconstructedSpeech[i-j-1]); /* LPGammaNCoefficients in Q12, reconstructedSpeech in Q0 -> acc in Q12 */
+		}
+		residualSignal[i] = (word16_t)SATURATE(PSHR(acc, 12), MAXINT16); /* shift back acc to Q0 and saturate it to avoid overflow when going back to 16 bits */
+		scaledResidualSignal[i] = PSHR(residualSignal[i], 2); /* shift acc to Q-2 and saturate it to get the scaled version of the signal */
+	}
+}
+
 /* init function */
 void initPostFilter(bcg729DecoderChannelContextStruct *decoderChannelContext)
 {
@@ -38,6 +84,7 @@ void initPostFilter(bcg729DecoderChannelContextStruct *decoderChannelContext)
 	decoderChannelContext->shortTermFilteredResidualSignal = &(decoderChannelContext->shortTermFilteredResidualSignalBuffer[NB_LSP_COEFF]);
 	/* initialise the previous Gain for adaptative gain control */
 	decoderChannelContext->previousAdaptativeGain = 4096; /* 1 in Q12 */
+	decoderChannelContext->postFilterPitchDelay = 60;
 }
 
 /*****************************************************************************/
@@ -80,33 +127,13 @@ void postFilter(bcg729DecoderChannelContextStruct *decoderChannelContext, word16
 	/* Long Term Post Filter                                            */
 	/********************************************************************/
 	/*** Compute LPGammaN and LPGammaD coefficients : LPGamma[0] = LP[0]*Gamma^(i+1) (i=0..9) ***/
-	/* GAMMA_XX constants are in Q15 */
-	LPGammaNCoefficients[0] = MULT16_16_P15(LPCoefficients[0], GAMMA_N1);
-	LPGammaNCoefficients[1] = MULT16_16_P15(LPCoefficients[1], GAMMA_N2);
-	LPGammaNCoefficients[2] = MULT16_16_P15(LPCoefficients[2], GAMMA_N3);
-	LPGammaNCoefficients[3] = MULT16_16_P15(LPCoefficients[3], GAMMA_N4);
-	LPGammaNCoefficients[4] = MULT16_16_P15(LPCoefficients[4], GAMMA_N5);
-	LPGammaNCoefficients[5] = MULT16_16_P15(LPCoefficients[5], GAMMA_N6);
-	LPGammaNCoefficients[6] = MULT16_16_P15(LPCoefficients[6], GAMMA_N7);
-	LPGammaNCoefficients[7] = MULT16_16_P15(LPCoefficients[7], GAMMA_N8);
-	LPGammaNCoefficients[8] = MULT16_16_P15(LPCoefficients[8], GAMMA_N9);
-	LPGammaNCoefficients[9] = MULT16_16_P15(LPCoefficients[9], GAMMA_N10);
+	computeLPGammaNCoefficients(LPCoefficients, LPGammaNCoefficients);
 
 	/*** Compute the residual signal as described in spec 4.2.1 eq79 ***/
-	/* Compute also a scaled residual signal: shift right by 2 to avoid overflows on 32 bits when computing correlation and energy */
-	
 	/* pointers to current subframe beginning */
 	residualSignal = &(decoderChannelContext->residualSignalBuffer[MAXIMUM_INT_PITCH_DELAY+subframeIndex]);
 	scaledResidualSignal = &(decoderChannelContext->scaledResidualSignalBuffer[MAXIMUM_INT_PITCH_DELAY+subframeIndex]);
-
-	for (i=0; i<L_SUBFRAME; i++) {
-		word32_t acc = SSHL((word32_t)reconstructedSpeech[i], 12); /* reconstructedSpeech in Q0 shifted to set acc in Q12 */
-		for (j=0; j<NB_LSP_COEFF; j++) {
-			acc = MAC16_16(acc, LPGammaNCoefficients[j],reconstructedSpeech[i-j-1]); /* LPGammaNCoefficients in Q12, reconstructedSpeech in Q0 -> acc in Q12 */
-		}
-		residualSignal[i] = (word16_t)SATURATE(PSHR(acc, 12), MAXINT16); /* shift back acc to Q0 and saturate it to avoid overflow when going back to 16 bits */
-		scaledResidualSignal[i] = PSHR(residualSignal[i], 2); /* shift acc to Q-2 and saturate it to get the scaled version of the signal */
-	}
+	computeResidualSignal(LPGammaNCoefficients, reconstructedSpeech, residualSignal, scaledResidualSignal);
 
 	/*** Compute the maximum correlation on scaledResidualSignal delayed by intPitchDelay +/- 3 to get the best delay. Spec 4.2.1 eq80 ***/
 	/* using a scaled(Q-2) signals gives correlation in Q-4. */
@@ -128,6 +155,7 @@ void postFilter(bcg729DecoderChannelContextStruct *decoderChannelContext, word16
 			bestIntPitchDelay = i; /* get the intPitchDelay */
 		}
 	}
+	decoderChannelContext->postFilterPitchDelay = bestIntPitchDelay;
 
 	/* saturate correlation to a positive integer */
 	if (correlationMax<0) {
@@ -342,3 +370,42 @@ void postFilter(bcg729DecoderChannelContextStruct *decoderChannelContext, word16
 	}
 	return;
 }
+
+/*****************************************************************************/
+/* postFilterBypass: skip the post filter but keep its context up to date so */
+/*      the complete postFilter can be resumed on any subframe               */
+/*      residual signal history is maintained for the long term filter, the  */
+/*      short term filter memory is loaded with the reconstructed speech and */
+/*      the adaptative gain control is reset to unity gain                   */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) LPCoefficients: 10 LP coeff for current subframe in Q12         */
+/*      -(i) reconstructedSpeech: output of LP Synthesis, 50 values in Q0    */
+/*           10 values of previous subframe, accessed in range [-10, 39]     */
+/*      -(i) subframeIndex: 0 or L_SUBFRAME for subframe 0 or 1              */
+/*      -(o) postFilteredSignal: 40 values in Q0, copy of reconstructedSpeech*/
+/*                                                                           */
+/*****************************************************************************/
+void postFilterBypass(bcg729DecoderChannelContextStruct *decoderChannelContext, word16_t *LPCoefficients, word16_t *reconstructedSpeech, int subframeIndex,
+		word16_t *postFilteredSignal)
+{
+	word16_t LPGammaNCoefficients[NB_LSP_COEFF]; /* in Q12 */
+	word16_t *residualSignal = &(decoderChannelContext->residualSignalBuffer[MAXIMUM_INT_PITCH_DELAY+subframeIndex]);
+
+	/* residual signal is needed by the long term post filter pitch search over the next 143 samples */
+	computeLPGammaNCoefficients(LPCoefficients, LPGammaNCoefficients);
+	computeResidualSignal(LPGammaNCoefficients, reconstructedSpeech, residualSignal, &(decoderChannelContext->scaledResidualSignalBuffer[MAXIMUM_INT_PITCH_DELAY+subframeIndex]));
+
+	/* tilt compensation and short term filter memories: use the closest available signals */
+	decoderChannelContext->longTermFilteredResidualSignal[-1] = residualSignal[L_SUBFRAME-1];
+	memcpy(decoderChannelContext->shortTermFilteredResidualSignalBuffer, &(reconstructedSpeech[L_SUBFRAME-NB_LSP_COEFF]), NB_LSP_COEFF*sizeof(word16_t));
+	decoderChannelContext->previousAdaptativeGain = 4096; /* 1 in Q12 */
+
+	memcpy(postFilteredSignal, reconstructedSpeech, L_SUBFRAME*sizeof(word16_t));
+
+	/* shift buffers if needed */
+	if (subframeIndex>0) { /* only after 2nd subframe treatment */
+		memmove(decoderChannelContext->residualSignalBuffer, &(decoderChannelContext->residualSignalBuffer[L_FRAME]), MAXIMUM_INT_PITCH_DELAY*sizeof(word16_t));
+		memmove(decoderChannelContext->scaledResidualSignalBuffer, &(decoderChannelContext->scaledResidualSignalBuffer[L_FRAME]), MAXIMUM_INT_PITCH_DELAY*sizeof(word16_t));
+	}
+}
@@ -35,4 +35,19 @@ void initPostFilter(bcg729DecoderChannelContextStruct *decoderChannelContext);
 /*****************************************************************************/
 void postFilter(bcg729DecoderChannelContextStruct *decoderChannelContext, word16_t *LPCoefficients, word16_t *reconstructedSpeech, int16_t intPitchDelay, int subframeIndex,
 		word16_t *postFilteredSignal);
+
+/*****************************************************************************/
+/* postFilterBypass: skip the post filter but keep its context up to date so */
+/*      the complete postFilter can be resumed on any subframe               */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) LPCoefficients: 10 LP coeff for current subframe in Q12         */
+/*      -(i) reconstructedSpeech: output of LP Synthesis, 50 values in Q0    */
+/*           10 values of previous subframe, accessed in range [-10, 39]     */
+/*      -(i) subframeIndex: 0 or L_SUBFRAME for subframe 0 or 1              */
+/*      -(o) postFilteredSignal: 40 values in Q0, copy of reconstructedSpeech*/
+/*                                                                           */
+/*****************************************************************************/
+void postFilterBypass(bcg729DecoderChannelContextStruct *decoderChannelContext, word16_t *LPCoefficients, word16_t *reconstructedSpeech, int subframeIndex,
+		word16_t *postFilteredSignal);
 #endif /* ifndef POSTFILTER_H */
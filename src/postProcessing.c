@@ -16,11 +16,14 @@
  * You should have received a copy of the GNU General Public License
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <string.h>
+
 #include "typedef.h"
 #include "codecParameters.h"
 #include "basicOperationsMacros.h"
 
 #include "preProcessing.h"
+#include "postProcessing.h"
 
 /*****************************************************************************/
 /*                                                                           */
@@ -44,6 +47,45 @@
 #define B1 ((word16_t)(-15398))
 #define B2 ((word16_t)(7699))
 
+/*****************************************************************************/
+/*                                                                           */
+/* Upsampling polyphase filter: a 96 taps lowpass at 4kHz for a 48kHz output */
+/* (kaiser windowed sinc, beta=7) split in 6 phases of 16 taps in Q14.       */
+/* The output sample of phase p computed on input sample n is:               */
+/*    y[6*n+p] = sum(k=0..15) upsamplingFilter[p][k]*x[n-k]                  */
+/* Phase 0 is a pure delay of 8 samples and each phase gain is 1, the 16kHz  */
+/* output uses phases 0 and 3.                                               */
+/*                                                                           */
+/*****************************************************************************/
+static const word16_t upsamplingFilter[UPSAMPLING_PHASES][UPSAMPLING_TAPS_PER_PHASE] = {
+	{0, 0, 0, 0, 0, 0, 0, 0, 16384, 0, 0, 0, 0, 0, 0, 0},
+	{-3, 19, -60, 147, -309, 605, -1197, 3021, 15625, -2086, 945, -486, 244, -111, 42, -12},
+	{-8, 41, -122, 290, -601, 1170, -2351, 6624, 13474, -3094, 1461, -754, 374, -166, 61, -15},
+	{-13, 58, -165, 381, -778, 1509, -3100, 10300, 10300, -3100, 1509, -778, 381, -165, 58, -13},
+	{-15, 61, -166, 374, -754, 1461, -3094, 13474, 6624, -2351, 1170, -601, 290, -122, 41, -8},
+	{-12, 42, -111, 244, -486, 945, -2086, 15625, 3021, -1197, 605, -309, 147, -60, 19, -3}
+};
+
+/* G711 segment of the magnitudes: A-law uses the magnitude on 13 bits >> 4, mu-law the biased magnitude on 14 bits >> 5 */
+static const uint8_t G711Segment[256] = {
+	0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7
+};
+
 /* Initialization of context values */
 void initPostProcessing(bcg729DecoderChannelContextStruct *decoderChannelContext) {
 	decoderChannelContext->outputY2 = 0;
@@ -87,3 +129,228 @@ void postProcessing(bcg729DecoderChannelContextStruct *decoderChannelContext, wo
 	}
 	return;
 }
+
+/*****************************************************************************/
+/* postProcessingBypass : skip the high pass filter, upscaling only          */
+/*      filter memory is loaded as if the input had no DC/low frequency      */
+/*      content (y=2*x) so postProcessing can be resumed on any subframe     */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i/o) signal : 40 values in Q0, reconstructed speech, output        */
+/*             replaces the input in buffer                                  */
+/*                                                                           */
+/*****************************************************************************/
+void postProcessingBypass(bcg729DecoderChannelContextStruct *decoderChannelContext, word16_t signal[]) {
+	int i;
+
+	decoderChannelContext->inputX1 = signal[L_SUBFRAME-2];
+	decoderChannelContext->inputX0 = signal[L_SUBFRAME-1];
+	decoderChannelContext->outputY2 = SHL32((word32_t)signal[L_SUBFRAME-2], 13); /* output memory in Q13 holds 2*x */
+	decoderChannelContext->outputY1 = SHL32((word32_t)signal[L_SUBFRAME-1], 13);
+
+	for(i=0; i<L_SUBFRAME; i++) {
+		signal[i] = (word16_t)SATURATE(SHL32((word32_t)signal[i], 1), MAXINT16);
+	}
+	return;
+}
+
+/*****************************************************************************/
+/* linearToALaw : G711 A-law encoding of a 16 bits PCM sample                */
+/*    parameters:                                                            */
+/*      -(i) sample : 16 bits PCM                                            */
+/*    return value : the A-law code                                          */
+/*                                                                           */
+/*****************************************************************************/
+static uint8_t linearToALaw(word16_t sample)
+{
+	int16_t value = sample>>3; /* A-law works on 13 bits */
+	uint8_t mask = 0xD5; /* even bits toggled, sign bit set on positive values */
+	uint8_t code;
+	int segment;
+
+	if (value < 0) {
+		mask = 0x55;
+		value = -value - 1;
+	}
+
+	/* value is in [0, 4095] */
+	segment = G711Segment[value>>4];
+	code = (uint8_t)((segment<<4) | ((value>>((segment==0)?1:segment))&0x0F));
+	return code^mask;
+}
+
+/*****************************************************************************/
+/* linearToMuLaw : G711 mu-law encoding of a 16 bits PCM sample              */
+/*    parameters:                                                            */
+/*      -(i) sample : 16 bits PCM                                            */
+/*    return value : the mu-law code                                         */
+/*                                                                           */
+/*****************************************************************************/
+static uint8_t linearToMuLaw(word16_t sample)
+{
+	int16_t value = sample>>2; /* mu-law works on 14 bits */
+	uint8_t mask = 0xFF; /* all bits toggled, sign bit set on positive values */
+	int segment;
+
+	if (value < 0) {
+		mask = 0x7F;
+		value = -value;
+	}
+	if (value > 8158) { /* clip the magnitude so the biased one fits the last segment: codes are the same as with the usual 8159 clip */
+		value = 8158;
+	}
+	value += 33; /* bias */
+
+	segment = G711Segment[value>>5];
+	return (uint8_t)((segment<<4) | ((value>>(segment+1))&0x0F))^mask;
+}
+
+/*****************************************************************************/
+/* bcg729LinearToG711 : compress 16 bits PCM to G711 codes as                */
+/*      bcg729DecoderFormatted does on ULAW and ALAW outputs                 */
+/*    parameters:                                                            */
+/*      -(i) signal : samplesNbr 16 bits PCM samples                         */
+/*      -(i) samplesNbr : number of samples to convert                       */
+/*      -(i) format : BCG729_OUTPUT_FORMAT_ULAW or BCG729_OUTPUT_FORMAT_ALAW */
+/*      -(o) codes : samplesNbr G711 mu-law or A-law codes                   */
+/*    return value : 0 on success, -1 if format is not a G711 one            */
+/*                                                                           */
+/*****************************************************************************/
+int bcg729LinearToG711(const int16_t signal[], uint32_t samplesNbr, uint8_t format, uint8_t codes[])
+{
+	uint32_t i;
+
+	switch (format) {
+		case BCG729_OUTPUT_FORMAT_ULAW:
+			for (i=0; i<samplesNbr; i++) {
+				codes[i] = linearToMuLaw(signal[i]);
+			}
+			return 0;
+		case BCG729_OUTPUT_FORMAT_ALAW:
+			for (i=0; i<samplesNbr; i++) {
+				codes[i] = linearToALaw(signal[i]);
+			}
+			return 0;
+		default:
+			return -1;
+	}
+}
+
+/*****************************************************************************/
+/* upsampleSubframe : polyphase upsampling of a subframe                     */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data, the         */
+/*             upsampling memory is updated                                  */
+/*      -(i) signal : 40 values in Q0                                        */
+/*      -(i) phasesStep : 1 for 48kHz output, 3 for 16kHz output             */
+/*      -(i) stride : distance in samples between two output samples         */
+/*      -(o) output : 40*UPSAMPLING_PHASES/phasesStep values in Q0           */
+/*                                                                           */
+/*****************************************************************************/
+static void upsampleSubframe(bcg729DecoderChannelContextStruct *decoderChannelContext, const word16_t signal[], int phasesStep, uint16_t stride, int16_t output[])
+{
+	int i, j, k;
+	word16_t buffer[UPSAMPLING_TAPS_PER_PHASE-1+L_SUBFRAME]; /* the filter memory followed by the subframe */
+	word32_t acc; /* in Q14 */
+
+	memcpy(buffer, decoderChannelContext->upsamplingMemory, (UPSAMPLING_TAPS_PER_PHASE-1)*sizeof(word16_t));
+	memcpy(&(buffer[UPSAMPLING_TAPS_PER_PHASE-1]), signal, L_SUBFRAME*sizeof(word16_t));
+
+	for (i=0; i<L_SUBFRAME; i++) {
+		const word16_t *x = &(buffer[UPSAMPLING_TAPS_PER_PHASE-1+i]); /* x[-k] is the input sample i-k */
+
+		/* phase 0 is a pure delay */
+		*output = x[-UPSAMPLING_TAPS_PER_PHASE/2];
+		output += stride;
+		for (j=phasesStep; j<UPSAMPLING_PHASES; j+=phasesStep) {
+			acc = 0;
+			for (k=0; k<UPSAMPLING_TAPS_PER_PHASE; k++) {
+				acc = MAC16_16(acc, upsamplingFilter[j][k], x[-k]);
+			}
+			*output = (int16_t)SATURATE(PSHR(acc, 14), MAXINT16);
+			output += stride;
+		}
+	}
+
+	memcpy(decoderChannelContext->upsamplingMemory, &(buffer[L_SUBFRAME]), (UPSAMPLING_TAPS_PER_PHASE-1)*sizeof(word16_t));
+}
+
+/*****************************************************************************/
+/* writeOutputSubframe : convert a post processed subframe to the output     */
+/*      format and write it in the output frame                              */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data, upsampling  */
+/*             memory is updated by the 16 and 48kHz formats                 */
+/*      -(i) signal : 40 values in Q0, post processed speech                 */
+/*      -(i) outputFormat : one of BCG729_OUTPUT_FORMAT_*                    */
+/*      -(i) subframeIndex : 0 or L_SUBFRAME for subframe 0 or 1             */
+/*      -(i) stride : distance in samples between two output samples, 1 for  */
+/*           a contiguous frame                                              */
+/*      -(o) output : the output frame                                       */
+/*                                                                           */
+/*****************************************************************************/
+void writeOutputSubframe(bcg729DecoderChannelContextStruct *decoderChannelContext, const word16_t signal[], uint8_t outputFormat, int subframeIndex, uint16_t stride, void *output)
+{
+	int i;
+
+	switch (outputFormat) {
+		case BCG729_OUTPUT_FORMAT_FLOAT: {
+			float *floatOutput = &(((float *)output)[subframeIndex*stride]);
+			for (i=0; i<L_SUBFRAME; i++) {
+				floatOutput[i*stride] = (float)signal[i]*(1.0f/32768.0f);
+			}
+			break;
+		}
+		case BCG729_OUTPUT_FORMAT_ULAW: {
+			uint8_t *codeOutput = &(((uint8_t *)output)[subframeIndex*stride]);
+			for (i=0; i<L_SUBFRAME; i++) {
+				codeOutput[i*stride] = linearToMuLaw(signal[i]);
+			}
+			break;
+		}
+		case BCG729_OUTPUT_FORMAT_ALAW: {
+			uint8_t *codeOutput = &(((uint8_t *)output)[subframeIndex*stride]);
+			for (i=0; i<L_SUBFRAME; i++) {
+				codeOutput[i*stride] = linearToALaw(signal[i]);
+			}
+			break;
+		}
+		case BCG729_OUTPUT_FORMAT_PCM16_16KHZ:
+			upsampleSubframe(decoderChannelContext, signal, UPSAMPLING_PHASES/2, stride, &(((int16_t *)output)[2*subframeIndex*stride]));
+			break;
+		case BCG729_OUTPUT_FORMAT_PCM16_48KHZ:
+			upsampleSubframe(decoderChannelContext, signal, 1, stride, &(((int16_t *)output)[UPSAMPLING_PHASES*subframeIndex*stride]));
+			break;
+		default: {
+			int16_t *PCMOutput = &(((int16_t *)output)[subframeIndex*stride]);
+			for (i=0; i<L_SUBFRAME; i++) {
+				PCMOutput[i*stride] = signal[i];
+			}
+			break;
+		}
+	}
+}
+
+/*****************************************************************************/
+/* getOutputFrameSize : size of a frame in an output format                  */
+/*    parameters:                                                            */
+/*      -(i) outputFormat : one of BCG729_OUTPUT_FORMAT_*                    */
+/*    return value : the frame size in bytes                                 */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t getOutputFrameSize(uint8_t outputFormat)
+{
+	switch (outputFormat) {
+		case BCG729_OUTPUT_FORMAT_FLOAT:
+			return L_FRAME*sizeof(float);
+		case BCG729_OUTPUT_FORMAT_ULAW:
+		case BCG729_OUTPUT_FORMAT_ALAW:
+			return L_FRAME;
+		case BCG729_OUTPUT_FORMAT_PCM16_16KHZ:
+			return 2*L_FRAME*sizeof(int16_t);
+		case BCG729_OUTPUT_FORMAT_PCM16_48KHZ:
+			return UPSAMPLING_PHASES*L_FRAME*sizeof(int16_t);
+		default:
+			return L_FRAME*sizeof(int16_t);
+	}
+}
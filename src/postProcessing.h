@@ -30,4 +30,41 @@ void initPostProcessing(bcg729DecoderChannelContextStruct *decoderChannelContext
 /*                                                                           */
 /*****************************************************************************/
 void postProcessing(bcg729DecoderChannelContextStruct *decoderChannelContext, word16_t signal[]);
+
+/*****************************************************************************/
+/* postProcessingBypass : skip the high pass filter, upscaling only          */
+/*      filter memory is loaded as if the input had no DC/low frequency      */
+/*      content (y=2*x) so postProcessing can be resumed on any subframe     */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i/o) signal : 40 values in Q0, reconstructed speech, output        */
+/*             replaces the input in buffer                                  */
+/*                                                                           */
+/*****************************************************************************/
+void postProcessingBypass(bcg729DecoderChannelContextStruct *decoderChannelContext, word16_t signal[]);
+
+/*****************************************************************************/
+/* writeOutputSubframe : convert a post processed subframe to the output     */
+/*      format and write it in the output frame                              */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data, upsampling  */
+/*             memory is updated by the 16 and 48kHz formats                 */
+/*      -(i) signal : 40 values in Q0, post processed speech                 */
+/*      -(i) outputFormat : one of BCG729_OUTPUT_FORMAT_*                    */
+/*      -(i) subframeIndex : 0 or L_SUBFRAME for subframe 0 or 1             */
+/*      -(i) stride : distance in samples between two output samples, 1 for  */
+/*           a contiguous frame                                              */
+/*      -(o) output : the output frame                                       */
+/*                                                                           */
+/*****************************************************************************/
+void writeOutputSubframe(bcg729DecoderChannelContextStruct *decoderChannelContext, const word16_t signal[], uint8_t outputFormat, int subframeIndex, uint16_t stride, void *output);
+
+/*****************************************************************************/
+/* getOutputFrameSize : size of a frame in an output format                  */
+/*    parameters:                                                            */
+/*      -(i) outputFormat : one of BCG729_OUTPUT_FORMAT_*                    */
+/*    return value : the frame size in bytes                                 */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t getOutputFrameSize(uint8_t outputFormat);
 #endif /* ifndef POSTPROCESSING_H */
@@ -16,9 +16,12 @@
  * You should have received a copy of the GNU General Public License
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#include <string.h>
+
 #include "typedef.h"
 #include "codecParameters.h"
 #include "basicOperationsMacros.h"
+#include "utils.h"
 
 #include "preProcessing.h"
 
@@ -44,6 +47,31 @@
 #define B1 ((word16_t)(-3798))
 #define B2 ((word16_t)(1899))
 
+/*****************************************************************************/
+/*                                                                           */
+/* Decimation filters: linear phase lowpass, -3dB at 3.7kHz, -22dB at 4.4kHz */
+/* (kaiser windowed sinc, beta=5) in Q15, gain is 1. The 8kHz output sample  */
+/* n is computed on the input samples up to L*n:                             */
+/*    x[n] = sum(k=0..taps-1) decimationFilter[k]*input[L*n-k]               */
+/* the filters delay are (taps-1)/2 input samples: 8 samples at 8kHz         */
+/*                                                                           */
+/*****************************************************************************/
+static const word16_t decimationFilter16kHz[DECIMATION_16KHZ_TAPS] = {
+	-14, -41, 44, 117, -91, -261, 152, 507, -223, -918, 294, 1638, -354, -3192, 395, 10338,
+	15986, 10338, 395, -3192, -354, 1638, 294, -918, -223, 507, 152, -261, -91, 117, 44, -41,
+	-14
+};
+
+static const word16_t decimationFilter48kHz[DECIMATION_48KHZ_TAPS] = {
+	-5, -9, -13, -14, -9, 1, 15, 29, 39, 39, 27, 2, -30, -63, -85, -87,
+	-63, -14, 51, 116, 161, 169, 129, 43, -74, -194, -282, -306, -246, -104, 98, 312,
+	481, 546, 467, 235, -118, -522, -874, -1064, -991, -595, 132, 1132, 2289, 3446, 4432, 5094,
+	5322, 5094, 4432, 3446, 2289, 1132, 132, -595, -991, -1064, -874, -522, -118, 235, 467, 546,
+	481, 312, 98, -104, -246, -306, -282, -194, -74, 43, 129, 169, 161, 116, 51, -14,
+	-63, -87, -85, -63, -30, 2, 27, 39, 39, 29, 15, 1, -9, -14, -13, -9,
+	-5
+};
+
 /* Initialization of context values */
 void initPreProcessing(bcg729EncoderChannelContextStruct *encoderChannelContext) {
 	encoderChannelContext->outputY2 = 0;
@@ -53,6 +81,117 @@ void initPreProcessing(bcg729EncoderChannelContextStruct *encoderChannelContext)
 }
 
 
+/*****************************************************************************/
+/* G711 expansions of mu-law and A-law codes to 16 bits PCM                  */
+/*****************************************************************************/
+static word16_t muLawToLinear(uint8_t code)
+{
+	word16_t value;
+
+	code = ~code;
+	value = (((code&0x0F)<<3) + 0x84)<<((code&0x70)>>4);
+	return (code&0x80)?(0x84-value):(value-0x84);
+}
+
+static word16_t ALawToLinear(uint8_t code)
+{
+	word16_t value;
+	int segment;
+
+	code ^= 0x55;
+	value = (code&0x0F)<<4;
+	segment = (code&0x70)>>4;
+	if (segment == 0) {
+		value += 8;
+	} else {
+		value = (value + 0x108)<<(segment-1);
+	}
+	return (code&0x80)?value:-value;
+}
+
+/*****************************************************************************/
+/* bcg729G711ToLinear : expand G711 codes to 16 bits PCM as                  */
+/*      bcg729EncoderFormatted does on ULAW and ALAW inputs                  */
+/*    parameters:                                                            */
+/*      -(i) codes : samplesNbr G711 mu-law or A-law codes                   */
+/*      -(i) samplesNbr : number of samples to convert                       */
+/*      -(i) format : BCG729_INPUT_FORMAT_ULAW or BCG729_INPUT_FORMAT_ALAW   */
+/*      -(o) signal : samplesNbr 16 bits PCM samples                         */
+/*    return value : 0 on success, -1 if format is not a G711 one            */
+/*                                                                           */
+/*****************************************************************************/
+int bcg729G711ToLinear(const uint8_t codes[], uint32_t samplesNbr, uint8_t format, int16_t signal[])
+{
+	uint32_t i;
+
+	switch (format) {
+		case BCG729_INPUT_FORMAT_ULAW:
+			for (i=0; i<samplesNbr; i++) {
+				signal[i] = muLawToLinear(codes[i]);
+			}
+			return 0;
+		case BCG729_INPUT_FORMAT_ALAW:
+			for (i=0; i<samplesNbr; i++) {
+				signal[i] = ALawToLinear(codes[i]);
+			}
+			return 0;
+		default:
+			return -1;
+	}
+}
+
+/*****************************************************************************/
+/* floatToLinear : float sample in [-1, 1[ to 16 bits PCM, rounded and       */
+/*      saturated                                                            */
+/*****************************************************************************/
+static BCG729_INLINE word16_t floatToLinear(float sample)
+{
+	float value = sample*32768.0f;
+
+	if (value >= 32767.0f) {
+		return MAXINT16;
+	}
+	if (value <= -32768.0f) {
+		return -32768;
+	}
+	return (word16_t)((value >= 0.0f)?(value + 0.5f):(value - 0.5f));
+}
+
+/*****************************************************************************/
+/* highPassFilterSample : one sample of the preProcessing high pass filter   */
+/*    parameters :                                                           */
+/*      -(i/o) encoderChannelContext : the channel context data              */
+/*      -(i) input : the input sample in Q0                                  */
+/*    return value : the filtered sample in Q0                               */
+/*                                                                           */
+/*****************************************************************************/
+static BCG729_INLINE word16_t highPassFilterSample(bcg729EncoderChannelContextStruct *encoderChannelContext, word16_t input) {
+	word16_t inputX2;
+	word32_t acc; /* in Q12 */
+
+	inputX2 = encoderChannelContext->inputX1;
+	encoderChannelContext->inputX1 = encoderChannelContext->inputX0;
+	encoderChannelContext->inputX0 = input;
+	
+	/* compute with acc and coefficients in Q12 */
+	acc = MULT16_32_Q12(A1, encoderChannelContext->outputY1); /* Y1 in Q15.12 * A1 in Q1.12 -> acc in Q17.12*/
+	acc = MAC16_32_Q12(acc, A2, encoderChannelContext->outputY2); /* Y2 in Q15.12 * A2 in Q0.12 -> Q15.12 + acc in Q17.12 -> acc in Q18.12 */
+	/* 3*(Xi in Q15.0 * Bi in Q0.12)->Q17.12 + acc in Q18.12 -> acc in 19.12 */
+	acc = MAC16_16(acc, encoderChannelContext->inputX0, B0);
+	acc = MAC16_16(acc, encoderChannelContext->inputX1, B1);
+	acc = MAC16_16(acc, inputX2, B2);
+	/*  acc in Q19.12 : We must check it won't overflow 
+		- the Q15.12 of Y
+		- the Q15.0 extracted from it by shifting 12 right
+	 -> saturate to 28 bits -> acc in Q15.12 */
+	acc = SATURATE(acc, MAXINT28);
+
+	encoderChannelContext->outputY2 = encoderChannelContext->outputY1;
+	encoderChannelContext->outputY1 = acc;
+
+	return PSHR(acc,12); /* extract integer value of the Q15.12 representation */
+}
+
 /*****************************************************************************/
 /* preProcessing : 2nd order highpass filter with cut off frequency at 140Hz */
 /*      Algorithm:                                                           */
@@ -65,30 +204,144 @@ void initPreProcessing(bcg729EncoderChannelContextStruct *encoderChannelContext)
 /*****************************************************************************/
 void preProcessing(bcg729EncoderChannelContextStruct *encoderChannelContext, const word16_t signal[], word16_t preProcessedSignal[]) {
 	int i;
-	word16_t inputX2;
-	word32_t acc; /* in Q12 */
 
 	for(i=0; i<L_FRAME; i++) {
-		inputX2 = encoderChannelContext->inputX1;
-		encoderChannelContext->inputX1 = encoderChannelContext->inputX0;
-		encoderChannelContext->inputX0 = signal[i];
-	
-		/* compute with acc and coefficients in Q12 */
-		acc = MULT16_32_Q12(A1, encoderChannelContext->outputY1); /* Y1 in Q15.12 * A1 in Q1.12 -> acc in Q17.12*/
-		acc = MAC16_32_Q12(acc, A2, encoderChannelContext->outputY2); /* Y2 in Q15.12 * A2 in Q0.12 -> Q15.12 + acc in Q17.12 -> acc in Q18.12 */
-		/* 3*(Xi in Q15.0 * Bi in Q0.12)->Q17.12 + acc in Q18.12 -> acc in 19.12 */
-		acc = MAC16_16(acc, encoderChannelContext->inputX0, B0);
-		acc = MAC16_16(acc, encoderChannelContext->inputX1, B1);
-		acc = MAC16_16(acc, inputX2, B2);
-		/*  acc in Q19.12 : We must check it won't overflow 
-			- the Q15.12 of Y
-			- the Q15.0 extracted from it by shifting 12 right
-		 -> saturate to 28 bits -> acc in Q15.12 */
-		acc = SATURATE(acc, MAXINT28);
-		
-		preProcessedSignal[i] = PSHR(acc,12); /* extract integer value of the Q15.12 representation */
-		encoderChannelContext->outputY2 = encoderChannelContext->outputY1;
-		encoderChannelContext->outputY1 = acc;
+		preProcessedSignal[i] = highPassFilterSample(encoderChannelContext, signal[i]);
 	}
 	return;
 }
+
+/*****************************************************************************/
+/* decimatingPreProcessing : decimation to 8kHz and high pass filter of a    */
+/*      16 or 48kHz input frame: each decimated sample is given to the high  */
+/*      pass filter as soon as it is computed                                */
+/*    parameters :                                                           */
+/*      -(i/o) encoderChannelContext : the channel context data, the         */
+/*             decimation memory is updated                                  */
+/*      -(i) input : 80*factor samples, 16 bits PCM or float                 */
+/*      -(i) stride : distance in samples between two input samples          */
+/*      -(i) floatInput : true when input samples are float                  */
+/*      -(i) factor : 2 or 6 for 16 or 48kHz input                           */
+/*      -(i) decimationFilter : the taps coefficients in Q15                 */
+/*      -(i) taps : number of filter taps                                    */
+/*      -(o) preProcessedSignal : 80 values in Q0                            */
+/*                                                                           */
+/*****************************************************************************/
+static void decimatingPreProcessing(bcg729EncoderChannelContextStruct *encoderChannelContext, const void *input, uint16_t stride, int floatInput, int factor, const word16_t decimationFilter[], int taps, word16_t preProcessedSignal[]) {
+	int i, k;
+	word16_t buffer[DECIMATION_48KHZ_TAPS-1+6*L_FRAME]; /* the filter memory followed by the input frame in 16 bits PCM */
+	word32_t acc; /* in Q15 */
+
+	memcpy(buffer, encoderChannelContext->decimationMemory, (taps-1)*sizeof(word16_t));
+	if (floatInput) {
+		const float *floatInputFrame = (const float *)input;
+		for (i=0; i<factor*L_FRAME; i++) {
+			buffer[taps-1+i] = floatToLinear(floatInputFrame[i*stride]);
+		}
+	} else if (stride == 1) {
+		memcpy(&(buffer[taps-1]), input, factor*L_FRAME*sizeof(word16_t));
+	} else {
+		const word16_t *PCMInputFrame = (const word16_t *)input;
+		for (i=0; i<factor*L_FRAME; i++) {
+			buffer[taps-1+i] = PCMInputFrame[i*stride];
+		}
+	}
+
+	for (i=0; i<L_FRAME; i++) {
+		const word16_t *x = &(buffer[factor*i]); /* x[k] is the input sample factor*i-(taps-1)+k */
+		acc = 0;
+		for (k=0; k<taps; k++) { /* the filter is symmetric: x[taps-1-k] weighted by decimationFilter[k] is computed in increasing addresses order */
+			acc = MAC16_16(acc, decimationFilter[k], x[k]);
+		}
+		preProcessedSignal[i] = highPassFilterSample(encoderChannelContext, (word16_t)SATURATE(PSHR(acc, 15), MAXINT16));
+	}
+
+	memcpy(encoderChannelContext->decimationMemory, &(buffer[factor*L_FRAME]), (taps-1)*sizeof(word16_t));
+}
+
+/*****************************************************************************/
+/* preProcessingFormatted : preProcessing of a frame given in any input      */
+/*      format: the conversion to 16 bits PCM and the decimation to 8kHz are */
+/*      done in the high pass filter loop                                    */
+/*    parameters :                                                           */
+/*      -(i/o) encoderChannelContext : the channel context data              */
+/*      -(i) input : a frame in the input format                             */
+/*      -(i) inputFormat : one of BCG729_INPUT_FORMAT_*                      */
+/*      -(i) stride : distance in samples between two input samples, 1 for   */
+/*           a contiguous frame                                              */
+/*      -(o) preProcessedSignal : 80 values in Q0                            */
+/*                                                                           */
+/*****************************************************************************/
+void preProcessingFormatted(bcg729EncoderChannelContextStruct *encoderChannelContext, const void *input, uint8_t inputFormat, uint16_t stride, word16_t preProcessedSignal[]) {
+	int i;
+
+	switch (inputFormat) {
+		case BCG729_INPUT_FORMAT_FLOAT: {
+			const float *floatInputFrame = (const float *)input;
+			for (i=0; i<L_FRAME; i++) {
+				preProcessedSignal[i] = highPassFilterSample(encoderChannelContext, floatToLinear(floatInputFrame[i*stride]));
+			}
+			break;
+		}
+		case BCG729_INPUT_FORMAT_ULAW: {
+			const uint8_t *codeInputFrame = (const uint8_t *)input;
+			for (i=0; i<L_FRAME; i++) {
+				preProcessedSignal[i] = highPassFilterSample(encoderChannelContext, muLawToLinear(codeInputFrame[i*stride]));
+			}
+			break;
+		}
+		case BCG729_INPUT_FORMAT_ALAW: {
+			const uint8_t *codeInputFrame = (const uint8_t *)input;
+			for (i=0; i<L_FRAME; i++) {
+				preProcessedSignal[i] = highPassFilterSample(encoderChannelContext, ALawToLinear(codeInputFrame[i*stride]));
+			}
+			break;
+		}
+		case BCG729_INPUT_FORMAT_PCM16_16KHZ:
+		case BCG729_INPUT_FORMAT_FLOAT_16KHZ:
+			decimatingPreProcessing(encoderChannelContext, input, stride, inputFormat==BCG729_INPUT_FORMAT_FLOAT_16KHZ, 2, decimationFilter16kHz, DECIMATION_16KHZ_TAPS, preProcessedSignal);
+			break;
+		case BCG729_INPUT_FORMAT_PCM16_48KHZ:
+		case BCG729_INPUT_FORMAT_FLOAT_48KHZ:
+			decimatingPreProcessing(encoderChannelContext, input, stride, inputFormat==BCG729_INPUT_FORMAT_FLOAT_48KHZ, 6, decimationFilter48kHz, DECIMATION_48KHZ_TAPS, preProcessedSignal);
+			break;
+		default:
+			if (stride == 1) {
+				preProcessing(encoderChannelContext, (const word16_t *)input, preProcessedSignal);
+			} else {
+				const word16_t *PCMInputFrame = (const word16_t *)input;
+				for (i=0; i<L_FRAME; i++) {
+					preProcessedSignal[i] = highPassFilterSample(encoderChannelContext, PCMInputFrame[i*stride]);
+				}
+			}
+			break;
+	}
+}
+
+/*****************************************************************************/
+/* getInputFrameSize : size of a frame in an input format                    */
+/*    parameters:                                                            */
+/*      -(i) inputFormat : one of BCG729_INPUT_FORMAT_*                      */
+/*    return value : the frame size in bytes                                 */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t getInputFrameSize(uint8_t inputFormat)
+{
+	switch (inputFormat) {
+		case BCG729_INPUT_FORMAT_FLOAT:
+			return L_FRAME*sizeof(float);
+		case BCG729_INPUT_FORMAT_ULAW:
+		case BCG729_INPUT_FORMAT_ALAW:
+			return L_FRAME;
+		case BCG729_INPUT_FORMAT_PCM16_16KHZ:
+			return 2*L_FRAME*sizeof(int16_t);
+		case BCG729_INPUT_FORMAT_PCM16_48KHZ:
+			return 6*L_FRAME*sizeof(int16_t);
+		case BCG729_INPUT_FORMAT_FLOAT_16KHZ:
+			return 2*L_FRAME*sizeof(float);
+		case BCG729_INPUT_FORMAT_FLOAT_48KHZ:
+			return 6*L_FRAME*sizeof(float);
+		default:
+			return L_FRAME*sizeof(int16_t);
+	}
+}
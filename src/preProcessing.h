@@ -32,4 +32,29 @@ void initPreProcessing(bcg729EncoderChannelContextStruct *encoderChannelContext)
 /*                                                                           */
 /*****************************************************************************/
 void preProcessing(bcg729EncoderChannelContextStruct *encoderChannelContext, const word16_t signal[], word16_t preProcessedSignal[]);
+
+/*****************************************************************************/
+/* preProcessingFormatted : preProcessing of a frame given in any input      */
+/*      format: the conversion to 16 bits PCM and the decimation to 8kHz are */
+/*      done in the high pass filter loop                                    */
+/*    parameters :                                                           */
+/*      -(i/o) encoderChannelContext : the channel context data, decimation  */
+/*             memory is updated by the 16 and 48kHz formats                 */
+/*      -(i) input : a frame in the input format                             */
+/*      -(i) inputFormat : one of BCG729_INPUT_FORMAT_*                      */
+/*      -(i) stride : distance in samples between two input samples, 1 for   */
+/*           a contiguous frame                                              */
+/*      -(o) preProcessedSignal : 80 values in Q0                            */
+/*                                                                           */
+/*****************************************************************************/
+void preProcessingFormatted(bcg729EncoderChannelContextStruct *encoderChannelContext, const void *input, uint8_t inputFormat, uint16_t stride, word16_t preProcessedSignal[]);
+
+/*****************************************************************************/
+/* getInputFrameSize : size of a frame in an input format                    */
+/*    parameters:                                                            */
+/*      -(i) inputFormat : one of BCG729_INPUT_FORMAT_*                      */
+/*    return value : the frame size in bytes                                 */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t getInputFrameSize(uint8_t inputFormat);
 #endif /* ifndef PREPROCESSING_H */
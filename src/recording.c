@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+
+#include "decoderState.h"
+#include "bcg729/recording.h"
+
+/* frame lengths in bytes */
+#define FRAME_LENGTH 10
+#define SID_FRAME_LENGTH 2
+
+static const uint8_t recordingMagic[4] = {'B', 'C', 'G', 'R'};
+
+/* little endian accessors */
+static void writeUint16(uint8_t *buffer, uint16_t value)
+{
+	buffer[0] = (uint8_t)(value&0xFF);
+	buffer[1] = (uint8_t)(value>>8);
+}
+
+static void writeUint32(uint8_t *buffer, uint32_t value)
+{
+	writeUint16(buffer, (uint16_t)(value&0xFFFF));
+	writeUint16(&(buffer[2]), (uint16_t)(value>>16));
+}
+
+static uint16_t readUint16(const uint8_t *buffer)
+{
+	return (uint16_t)(buffer[0] | (buffer[1]<<8));
+}
+
+static uint32_t readUint32(const uint8_t *buffer)
+{
+	return (uint32_t)readUint16(buffer) | ((uint32_t)readUint16(&(buffer[2]))<<16);
+}
+
+/* payload length of a frame type, 0xFF for invalid types */
+static uint8_t getPayloadLength(uint8_t frameType)
+{
+	switch (frameType) {
+		case BCG729_FRAME_TYPE_ACTIVE:
+			return FRAME_LENGTH;
+		case BCG729_FRAME_TYPE_SID:
+			return SID_FRAME_LENGTH;
+		case BCG729_FRAME_TYPE_UNTRANSMITTED:
+		case BCG729_FRAME_TYPE_ERASED:
+			return 0;
+		default:
+			return 0xFF;
+	}
+}
+
+/* decode a recorded frame */
+static void decodeFrame(bcg729DecoderChannelContextStruct *decoderChannelContext, uint8_t frameType, const uint8_t bitStream[], int16_t signal[])
+{
+	switch (frameType) {
+		case BCG729_FRAME_TYPE_ACTIVE:
+			bcg729Decoder(decoderChannelContext, bitStream, FRAME_LENGTH, 0, 0, 0, signal);
+			break;
+		case BCG729_FRAME_TYPE_SID:
+			bcg729Decoder(decoderChannelContext, bitStream, SID_FRAME_LENGTH, 0, 1, 0, signal);
+			break;
+		case BCG729_FRAME_TYPE_UNTRANSMITTED:
+			bcg729Decoder(decoderChannelContext, NULL, 0, 0, 1, 0, signal);
+			break;
+		default: /* erased */
+			bcg729Decoder(decoderChannelContext, NULL, 0, 1, 0, 0, signal);
+			break;
+	}
+}
+
+/*****************************************************************************/
+/* initBcg729RecordingWriter : create a recording writer                     */
+/*    parameters:                                                            */
+/*      -(i) checkpointInterval : in frames                                  */
+/*    return value :                                                         */
+/*      - the recording writer, NULL if checkpointInterval is 0              */
+/*                                                                           */
+/*****************************************************************************/
+bcg729RecordingWriterStruct *initBcg729RecordingWriter(uint16_t checkpointInterval)
+{
+	bcg729RecordingWriterStruct *recordingWriter;
+
+	if (checkpointInterval == 0) {
+		return NULL;
+	}
+
+	recordingWriter = malloc(sizeof(bcg729RecordingWriterStruct));
+	memset(recordingWriter, 0, sizeof(bcg729RecordingWriterStruct));
+	recordingWriter->decoderChannelContext = initBcg729DecoderChannel();
+	recordingWriter->checkpointInterval = checkpointInterval;
+
+	return recordingWriter;
+}
+
+/*****************************************************************************/
+/* closeBcg729RecordingWriter : free memory of recording writer              */
+/*    parameters:                                                            */
+/*      -(i) recordingWriter : the recording writer                          */
+/*                                                                           */
+/*****************************************************************************/
+void closeBcg729RecordingWriter(bcg729RecordingWriterStruct *recordingWriter)
+{
+	closeBcg729DecoderChannel(recordingWriter->decoderChannelContext);
+	free(recordingWriter->frameTypes);
+	free(recordingWriter->bitStreams);
+	free(recordingWriter->checkpoints);
+	free(recordingWriter);
+}
+
+/*****************************************************************************/
+/* bcg729RecordingWriterAddFrame : append a frame to the recording           */
+/*    parameters:                                                            */
+/*      -(i/o) recordingWriter : the recording writer                        */
+/*      -(i) bitStream : the frame payload                                   */
+/*      -(i) bitStreamLength : in bytes, 10, 2 or 0                          */
+/*      -(i) frameErasureFlag : flag: true, frame has been erased            */
+/*    return value : frame type, BCG729_FRAME_TYPE_INVALID if not recorded   */
+/*                                                                           */
+/*****************************************************************************/
+uint8_t bcg729RecordingWriterAddFrame(bcg729RecordingWriterStruct *recordingWriter, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag)
+{
+	uint8_t frameType;
+	uint8_t payloadLength;
+	int16_t signal[L_FRAME];
+
+	if (frameErasureFlag) {
+		frameType = BCG729_FRAME_TYPE_ERASED;
+	} else if (bitStreamLength == FRAME_LENGTH) {
+		frameType = BCG729_FRAME_TYPE_ACTIVE;
+	} else if (bitStreamLength == SID_FRAME_LENGTH) {
+		frameType = BCG729_FRAME_TYPE_SID;
+	} else if (bitStreamLength == 0) {
+		frameType = BCG729_FRAME_TYPE_UNTRANSMITTED;
+	} else {
+		return BCG729_FRAME_TYPE_INVALID;
+	}
+	payloadLength = getPayloadLength(frameType);
+
+	if (recordingWriter->framesNbr == recordingWriter->framesAllocated) {
+		recordingWriter->framesAllocated += RECORDING_FRAMES_ALLOCATION;
+		recordingWriter->frameTypes = realloc(recordingWriter->frameTypes, recordingWriter->framesAllocated*sizeof(uint8_t));
+		recordingWriter->bitStreams = realloc(recordingWriter->bitStreams, recordingWriter->framesAllocated*FRAME_LENGTH*sizeof(uint8_t));
+	}
+
+	/* checkpoint: decoder state before decoding this frame */
+	if (recordingWriter->framesNbr%recordingWriter->checkpointInterval == 0) {
+		uint32_t checkpointIndex = recordingWriter->framesNbr/recordingWriter->checkpointInterval;
+		uint8_t *checkpoint;
+		recordingWriter->checkpoints = realloc(recordingWriter->checkpoints, (checkpointIndex+1)*RECORDING_CHECKPOINT_SIZE*sizeof(uint8_t));
+		checkpoint = &(recordingWriter->checkpoints[checkpointIndex*RECORDING_CHECKPOINT_SIZE]);
+		writeUint32(checkpoint, recordingWriter->bitStreamsLength);
+		saveDecoderState(recordingWriter->decoderChannelContext, &(checkpoint[4]));
+	}
+
+	recordingWriter->frameTypes[recordingWriter->framesNbr] = frameType;
+	if (payloadLength > 0) {
+		memcpy(&(recordingWriter->bitStreams[recordingWriter->bitStreamsLength]), bitStream, payloadLength*sizeof(uint8_t));
+	}
+	decodeFrame(recordingWriter->decoderChannelContext, frameType, &(recordingWriter->bitStreams[recordingWriter->bitStreamsLength]), signal);
+	recordingWriter->bitStreamsLength += payloadLength;
+	recordingWriter->framesNbr++;
+
+	return frameType;
+}
+
+/*****************************************************************************/
+/* bcg729GetRecordingSize : size of the recording container                  */
+/*    parameters:                                                            */
+/*      -(i) recordingWriter : the recording writer                          */
+/*    return value : size in bytes                                           */
+/*                                                                           */
+/*****************************************************************************/
+uint32_t bcg729GetRecordingSize(bcg729RecordingWriterStruct *recordingWriter)
+{
+	uint32_t checkpointsNbr = (recordingWriter->framesNbr + recordingWriter->checkpointInterval - 1)/recordingWriter->checkpointInterval;
+
+	return RECORDING_HEADER_SIZE + recordingWriter->framesNbr + checkpointsNbr*RECORDING_CHECKPOINT_SIZE + recordingWriter->bitStreamsLength;
+}
+
+/*****************************************************************************/
+/* bcg729WriteRecording : write the recording container                      */
+/*    parameters:                                                            */
+/*      -(i) recordingWriter : the recording writer                          */
+/*      -(o) recording : the container, bcg729GetRecordingSize bytes         */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729WriteRecording(bcg729RecordingWriterStruct *recordingWriter, uint8_t recording[])
+{
+	uint32_t checkpointsNbr = (recordingWriter->framesNbr + recordingWriter->checkpointInterval - 1)/recordingWriter->checkpointInterval;
+	uint32_t frameTypesOffset = RECORDING_HEADER_SIZE;
+	uint32_t checkpointsOffset = frameTypesOffset + recordingWriter->framesNbr;
+	uint32_t bitStreamsOffset = checkpointsOffset + checkpointsNbr*RECORDING_CHECKPOINT_SIZE;
+
+	/* header */
+	memcpy(recording, recordingMagic, 4);
+	writeUint16(&(recording[4]), RECORDING_VERSION);
+	writeUint16(&(recording[6]), recordingWriter->checkpointInterval);
+	writeUint32(&(recording[8]), recordingWriter->framesNbr);
+	writeUint32(&(recording[12]), checkpointsNbr);
+	writeUint32(&(recording[16]), RECORDING_CHECKPOINT_SIZE);
+	writeUint32(&(recording[20]), frameTypesOffset);
+	writeUint32(&(recording[24]), checkpointsOffset);
+	writeUint32(&(recording[28]), bitStreamsOffset);
+
+	/* frame index, checkpoints and payloads */
+	memcpy(&(recording[frameTypesOffset]), recordingWriter->frameTypes, recordingWriter->framesNbr*sizeof(uint8_t));
+	memcpy(&(recording[checkpointsOffset]), recordingWriter->checkpoints, checkpointsNbr*RECORDING_CHECKPOINT_SIZE*sizeof(uint8_t));
+	memcpy(&(recording[bitStreamsOffset]), recordingWriter->bitStreams, recordingWriter->bitStreamsLength*sizeof(uint8_t));
+}
+
+/*****************************************************************************/
+/* initBcg729RecordingReader : create a reader on a recording container      */
+/*    parameters:                                                            */
+/*      -(i) recording : the container                                       */
+/*      -(i) recordingSize : in bytes                                        */
+/*      -(i) decoderChannelContext : the decoder channel used                */
+/*    return value :                                                         */
+/*      - the recording reader, NULL if the container header is invalid      */
+/*                                                                           */
+/*****************************************************************************/
+bcg729RecordingReaderStruct *initBcg729RecordingReader(const uint8_t recording[], uint32_t recordingSize, bcg729DecoderChannelContextStruct *decoderChannelContext)
+{
+	bcg729RecordingReaderStruct *recordingReader;
+	uint16_t checkpointInterval;
+	uint32_t framesNbr, checkpointsNbr, frameTypesOffset, checkpointsOffset, bitStreamsOffset;
+
+	/* check the header: frame index and checkpoints must be in the container, payloads are checked when read */
+	if (decoderChannelContext == NULL || recording == NULL || recordingSize < RECORDING_HEADER_SIZE
+		|| memcmp(recording, recordingMagic, 4) != 0 || readUint16(&(recording[4])) != RECORDING_VERSION
+		|| readUint32(&(recording[16])) != RECORDING_CHECKPOINT_SIZE) {
+		return NULL;
+	}
+	checkpointInterval = readUint16(&(recording[6]));
+	framesNbr = readUint32(&(recording[8]));
+	checkpointsNbr = readUint32(&(recording[12]));
+	frameTypesOffset = readUint32(&(recording[20]));
+	checkpointsOffset = readUint32(&(recording[24]));
+	bitStreamsOffset = readUint32(&(recording[28]));
+	if (checkpointInterval == 0 || checkpointsNbr != (uint32_t)(((uint64_t)framesNbr + checkpointInterval - 1)/checkpointInterval)
+		|| frameTypesOffset > recordingSize || framesNbr > recordingSize - frameTypesOffset
+		|| checkpointsOffset > recordingSize || checkpointsNbr > (recordingSize - checkpointsOffset)/RECORDING_CHECKPOINT_SIZE
+		|| bitStreamsOffset > recordingSize) {
+		return NULL;
+	}
+
+	recordingReader = malloc(sizeof(bcg729RecordingReaderStruct));
+	recordingReader->decoderChannelContext = decoderChannelContext;
+	recordingReader->recording = recording;
+	recordingReader->recordingSize = recordingSize;
+	recordingReader->checkpointInterval = checkpointInterval;
+	recordingReader->framesNbr = framesNbr;
+	recordingReader->checkpointsNbr = checkpointsNbr;
+	recordingReader->frameTypes = &(recording[frameTypesOffset]);
+	recordingReader->checkpoints = &(recording[checkpointsOffset]);
+	recordingReader->bitStreamsOffset = bitStreamsOffset;
+	/* force a restore of the first checkpoint */
+	recordingReader->currentFrame = framesNbr;
+	recordingReader->currentOffset = 0;
+	bcg729RecordingSeek(recordingReader, 0);
+
+	return recordingReader;
+}
+
+/*****************************************************************************/
+/* closeBcg729RecordingReader : free memory of recording reader              */
+/*    parameters:                                                            */
+/*      -(i) recordingReader : the recording reader                          */
+/*                                                                           */
+/*****************************************************************************/
+void closeBcg729RecordingReader(bcg729RecordingReaderStruct *recordingReader)
+{
+	free(recordingReader);
+}
+
+/*****************************************************************************/
+/* bcg729GetRecordingFramesNbr : number of frames in the recording           */
+/*    parameters:                                                            */
+/*      -(i) recordingReader : the recording reader                          */
+/*    return value : number of frames                                        */
+/*                                                                           */
+/*****************************************************************************/
+uint32_t bcg729GetRecordingFramesNbr(bcg729RecordingReaderStruct *recordingReader)
+{
+	return recordingReader->framesNbr;
+}
+
+/*****************************************************************************/
+/* bcg729RecordingSeek : position the reader on a frame                      */
+/*    parameters:                                                            */
+/*      -(i/o) recordingReader : the recording reader                        */
+/*      -(i) frameIndex : index of the next frame to read                    */
+/*    return value : index of the next frame to read                         */
+/*                                                                           */
+/*****************************************************************************/
+uint32_t bcg729RecordingSeek(bcg729RecordingReaderStruct *recordingReader, uint32_t frameIndex)
+{
+	uint32_t checkpointIndex;
+	int16_t signal[L_FRAME];
+
+	if (frameIndex > recordingReader->framesNbr) {
+		frameIndex = recordingReader->framesNbr;
+	}
+	if (recordingReader->checkpointsNbr == 0) { /* empty recording */
+		recordingReader->currentFrame = 0;
+		return 0;
+	}
+
+	/* restore the closest checkpoint unless the target is after the current frame and before the next checkpoint */
+	checkpointIndex = frameIndex/recordingReader->checkpointInterval;
+	if (checkpointIndex >= recordingReader->checkpointsNbr) { /* the end of a recording whose frames number is a multiple of the interval */
+		checkpointIndex = recordingReader->checkpointsNbr - 1;
+	}
+	if (frameIndex < recordingReader->currentFrame || recordingReader->currentFrame < checkpointIndex*recordingReader->checkpointInterval) {
+		const uint8_t *checkpoint = &(recordingReader->checkpoints[checkpointIndex*RECORDING_CHECKPOINT_SIZE]);
+		restoreDecoderState(recordingReader->decoderChannelContext, &(checkpoint[4]));
+		recordingReader->currentFrame = checkpointIndex*recordingReader->checkpointInterval;
+		recordingReader->currentOffset = readUint32(checkpoint);
+	}
+
+	/* decode up to the requested frame */
+	while (recordingReader->currentFrame < frameIndex && bcg729RecordingRead(recordingReader, 1, signal) == 1);
+
+	return recordingReader->currentFrame;
+}
+
+/*****************************************************************************/
+/* bcg729RecordingRead : decode the next frames of the recording             */
+/*    parameters:                                                            */
+/*      -(i/o) recordingReader : the recording reader                        */
+/*      -(i) framesNbr : maximum number of frames to decode                  */
+/*      -(o) signal : decoded signal(16 bits PCM), 80 samples per frame      */
+/*    return value : number of frames decoded                                */
+/*                                                                           */
+/*****************************************************************************/
+uint32_t bcg729RecordingRead(bcg729RecordingReaderStruct *recordingReader, uint32_t framesNbr, int16_t signal[])
+{
+	uint32_t i;
+
+	for (i=0; i<framesNbr && recordingReader->currentFrame < recordingReader->framesNbr; i++) {
+		uint8_t frameType = recordingReader->frameTypes[recordingReader->currentFrame];
+		uint8_t payloadLength = getPayloadLength(frameType);
+		uint64_t payloadOffset = (uint64_t)recordingReader->bitStreamsOffset + recordingReader->currentOffset;
+
+		/* stop on corrupted frame index or truncated container */
+		if (payloadLength == 0xFF || payloadOffset + payloadLength > recordingReader->recordingSize) {
+			break;
+		}
+		decodeFrame(recordingReader->decoderChannelContext, frameType, &(recordingReader->recording[(uint32_t)payloadOffset]), &(signal[i*L_FRAME]));
+		recordingReader->currentFrame++;
+		recordingReader->currentOffset += payloadLength;
+	}
+
+	return i;
+}
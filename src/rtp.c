@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "typedef.h"
+#include "codecParameters.h"
+
+#include "bcg729/rtp.h"
+
+/*****************************************************************************/
+/* bcg729GetRTPPayloadFramesNbr : number of frames in a G729 RTP payload     */
+/*    parameters:                                                            */
+/*      -(i) payloadLength : in bytes                                        */
+/*    return value : number of frames(SID frame included), 0 if invalid     */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t bcg729GetRTPPayloadFramesNbr(uint16_t payloadLength)
+{
+	switch (payloadLength%RTP_FRAME_LENGTH) {
+		case 0:
+			return payloadLength/RTP_FRAME_LENGTH;
+		case RTP_SID_FRAME_LENGTH:
+			return payloadLength/RTP_FRAME_LENGTH + 1;
+		default:
+			return 0;
+	}
+}
+
+/*****************************************************************************/
+/* bcg729EncodeRTPPayload : encode frames directly in a RTP packet payload   */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*      -(i) input : framesNbr frames of 80 16 bits PCM samples              */
+/*      -(i) framesNbr : maximum number of frames to put in the payload      */
+/*      -(o) packet : the payload is written from packet[headroom]           */
+/*      -(i) headroom : room left at the beginning of packet for RTP header  */
+/*      -(o) payloadFirstFrame : index in input of the payload first frame   */
+/*      -(o) framesConsumed : number of input frames encoded                 */
+/*    return value : the payload length in bytes                             */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t bcg729EncodeRTPPayload(bcg729EncoderChannelContextStruct *encoderChannelContext, const int16_t input[], uint16_t framesNbr, uint8_t packet[], uint16_t headroom, uint16_t *payloadFirstFrame, uint16_t *framesConsumed)
+{
+	uint16_t i;
+	uint16_t payloadLength = 0;
+	uint8_t *payload = &(packet[headroom]);
+
+	*payloadFirstFrame = 0;
+	for (i=0; i<framesNbr; i++) {
+		uint8_t bitStreamLength;
+
+		bcg729Encoder(encoderChannelContext, &(input[i*L_FRAME]), &(payload[payloadLength]), &bitStreamLength);
+
+		if (bitStreamLength == 0) { /* untransmitted frame */
+			if (payloadLength == 0) { /* payload not started yet: move its first frame */
+				*payloadFirstFrame = i+1;
+				continue;
+			}
+			i++; /* end of payload, this frame is consumed */
+			break;
+		}
+
+		payloadLength += bitStreamLength;
+		if (bitStreamLength == RTP_SID_FRAME_LENGTH) { /* SID frame must be the last one of the payload */
+			i++;
+			break;
+		}
+	}
+	*framesConsumed = i;
+
+	return payloadLength;
+}
+
+/*****************************************************************************/
+/* bcg729DecodeRTPPayload : decode all the frames of a RTP payload directly  */
+/*      from the packet                                                      */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) payload : RTP packet payload                                    */
+/*      -(i) payloadLength : in bytes                                        */
+/*      -(o) signal : decoded frames, 80 samples (16 bits PCM) per frame     */
+/*    return value : number of decoded frames, 0 if payload is invalid       */
+/*                                                                           */
+/*****************************************************************************/
+uint16_t bcg729DecodeRTPPayload(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t payload[], uint16_t payloadLength, int16_t signal[])
+{
+	uint16_t framesNbr = bcg729GetRTPPayloadFramesNbr(payloadLength);
+	uint16_t i;
+
+	if (framesNbr == 0) { /* invalid payload length */
+		return 0;
+	}
+
+	for (i=0; i<payloadLength/RTP_FRAME_LENGTH; i++) {
+		bcg729Decoder(decoderChannelContext, &(payload[i*RTP_FRAME_LENGTH]), RTP_FRAME_LENGTH, 0, 0, 0, &(signal[i*L_FRAME]));
+	}
+
+	if (payloadLength%RTP_FRAME_LENGTH == RTP_SID_FRAME_LENGTH) { /* Annex B SID frame at the end of payload */
+		bcg729Decoder(decoderChannelContext, &(payload[i*RTP_FRAME_LENGTH]), RTP_SID_FRAME_LENGTH, 0, 1, 0, &(signal[i*L_FRAME]));
+	}
+
+	return framesNbr;
+}
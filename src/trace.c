@@ -0,0 +1,471 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+
+#include "decoderState.h"
+#include "trace.h"
+#include "bcg729/trace.h"
+
+/* records sizes in bytes, record header excluded */
+#define ENCODER_OPEN_SIZE 2
+#define ENCODE_SIZE (2*L_FRAME+2+1+1) /* without hints and bitstream */
+#define ENCODE_HINTS_SIZE 6
+#define DECODE_SIZE (1+1+4) /* without bitstream */
+
+/* DECODE record flags */
+#define DECODE_FLAG_ERASURE 0x01
+#define DECODE_FLAG_SID 0x02
+#define DECODE_FLAG_RFC3389 0x04
+#define DECODE_FLAG_NULL_BITSTREAM 0x08
+#define DECODE_MODE_SHIFT 4
+
+static const uint8_t traceMagic[4] = {'B', 'C', 'G', 'T'};
+
+/* little endian accessors */
+static void writeUint16(uint8_t *buffer, uint16_t value)
+{
+	buffer[0] = (uint8_t)(value&0xFF);
+	buffer[1] = (uint8_t)(value>>8);
+}
+
+static void writeUint32(uint8_t *buffer, uint32_t value)
+{
+	writeUint16(buffer, (uint16_t)(value&0xFFFF));
+	writeUint16(&(buffer[2]), (uint16_t)(value>>16));
+}
+
+static uint16_t readUint16(const uint8_t *buffer)
+{
+	return (uint16_t)(buffer[0] | (buffer[1]<<8));
+}
+
+static uint32_t readUint32(const uint8_t *buffer)
+{
+	return (uint32_t)readUint16(buffer) | ((uint32_t)readUint16(&(buffer[2]))<<16);
+}
+
+/* number of bitstream bytes read by the decoder: the given length is used by RFC3389 payloads only */
+static uint8_t getDecoderBitStreamLength(uint8_t nullBitStreamFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, uint8_t bitStreamLength)
+{
+	uint8_t CNFilterOrder;
+
+	if (nullBitStreamFlag) {
+		return 0;
+	}
+	if (SIDFrameFlag == 0) {
+		return 10;
+	}
+	if (rfc3389PayloadFlag == 0) {
+		return 2;
+	}
+	CNFilterOrder = (uint8_t)(bitStreamLength-1); /* as in decodeSIDParameters */
+	return ((CNFilterOrder>NB_LSP_COEFF)?NB_LSP_COEFF:CNFilterOrder) + 1;
+}
+
+/* reserve a record in the writer buffer and write its header, return the record payload */
+static uint8_t *startRecord(bcg729TraceWriterStruct *traceWriter, uint8_t type, uint32_t channelId, uint16_t payloadSize)
+{
+	uint8_t *record;
+
+	if (traceWriter->bufferLength + TRACE_RECORD_HEADER_SIZE + payloadSize > TRACE_BUFFER_SIZE) {
+		bcg729FlushTraceWriter(traceWriter);
+	}
+	record = &(traceWriter->buffer[traceWriter->bufferLength]);
+	traceWriter->bufferLength += TRACE_RECORD_HEADER_SIZE + payloadSize;
+
+	record[0] = type;
+	writeUint32(&(record[1]), channelId);
+	return &(record[TRACE_RECORD_HEADER_SIZE]);
+}
+
+static void writeEncoderOpen(bcg729EncoderChannelContextStruct *encoderChannelContext)
+{
+	uint8_t *record = startRecord(encoderChannelContext->traceWriter, BCG729_TRACE_ENCODER_OPEN, encoderChannelContext->traceChannelId, ENCODER_OPEN_SIZE);
+
+	record[0] = (encoderChannelContext->VADChannelContext != NULL)?1:0;
+	record[1] = encoderChannelContext->traceSyncFlag;
+	encoderChannelContext->traceSyncFlag = 1;
+}
+
+/*****************************************************************************/
+/* traceEncoderSync : called before encoding a traced frame, writes an       */
+/*      ENCODER_OPEN record if the channel encoded frames out of the trace   */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : a channel with a trace writer         */
+/*                                                                           */
+/*****************************************************************************/
+void traceEncoderSync(bcg729EncoderChannelContextStruct *encoderChannelContext)
+{
+	if (encoderChannelContext->traceSyncFlag == 0) {
+		writeEncoderOpen(encoderChannelContext);
+	}
+}
+
+/*****************************************************************************/
+/* traceEncoderFrame : write the ENCODE record of a frame                    */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : a channel with a trace writer         */
+/*      -(i) inputFrame : 80 samples (16 bits PCM)                           */
+/*      -(i) hints : the hints given for this frame                          */
+/*      -(i) bitStream : the encoded frame                                   */
+/*      -(i) bitStreamLength : 0, 2 or 10                                    */
+/*                                                                           */
+/*****************************************************************************/
+void traceEncoderFrame(bcg729EncoderChannelContextStruct *encoderChannelContext, const int16_t inputFrame[], const bcg729EncoderHints *hints, const uint8_t bitStream[], uint8_t bitStreamLength)
+{
+	int i;
+	uint8_t *record = startRecord(encoderChannelContext->traceWriter, BCG729_TRACE_ENCODE, encoderChannelContext->traceChannelId, ENCODE_SIZE + ((hints->flags!=0)?ENCODE_HINTS_SIZE:0) + bitStreamLength);
+
+	for (i=0; i<L_FRAME; i++) {
+		writeUint16(record, (uint16_t)inputFrame[i]);
+		record += 2;
+	}
+	writeUint16(record, (uint16_t)encoderChannelContext->silenceThreshold);
+	record[2] = hints->flags;
+	record += 3;
+	if (hints->flags != 0) {
+		writeUint16(record, hints->L1);
+		writeUint16(&(record[2]), (uint16_t)hints->intPitchDelay[0]);
+		writeUint16(&(record[4]), (uint16_t)hints->intPitchDelay[1]);
+		record += ENCODE_HINTS_SIZE;
+	}
+	record[0] = bitStreamLength;
+	memcpy(&(record[1]), bitStream, bitStreamLength);
+
+	encoderChannelContext->traceSyncFlag = 1;
+}
+
+/*****************************************************************************/
+/* traceDecoderSync : called before decoding a traced frame, writes a        */
+/*      DECODER_OPEN record if the channel decoded frames out of the trace   */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : a channel with a trace writer         */
+/*                                                                           */
+/*****************************************************************************/
+void traceDecoderSync(bcg729DecoderChannelContextStruct *decoderChannelContext)
+{
+	if (decoderChannelContext->traceSyncFlag == 0) {
+		uint8_t *record = startRecord(decoderChannelContext->traceWriter, BCG729_TRACE_DECODER_OPEN, decoderChannelContext->traceChannelId, DECODER_STATE_SIZE);
+		saveDecoderState(decoderChannelContext, record);
+		decoderChannelContext->traceSyncFlag = 1;
+	}
+}
+
+/*****************************************************************************/
+/* traceDecoderFrame : write the DECODE record of a frame                    */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : a channel with a trace writer         */
+/*      -(i) bitStream, bitStreamLength, frameErasureFlag, SIDFrameFlag,     */
+/*           rfc3389PayloadFlag : as given to the decoder                    */
+/*      -(i) signal : the decoded frame 80 samples (16 bits PCM)             */
+/*                                                                           */
+/*****************************************************************************/
+void traceDecoderFrame(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, const int16_t signal[])
+{
+	uint8_t length = getDecoderBitStreamLength((bitStream==NULL)?1:0, SIDFrameFlag, rfc3389PayloadFlag, bitStreamLength);
+	uint8_t *record = startRecord(decoderChannelContext->traceWriter, BCG729_TRACE_DECODE, decoderChannelContext->traceChannelId, DECODE_SIZE + length);
+
+	record[0] = (uint8_t)((frameErasureFlag?DECODE_FLAG_ERASURE:0) | (SIDFrameFlag?DECODE_FLAG_SID:0) | (rfc3389PayloadFlag?DECODE_FLAG_RFC3389:0)
+		| ((bitStream==NULL)?DECODE_FLAG_NULL_BITSTREAM:0) | (decoderChannelContext->decoderMode<<DECODE_MODE_SHIFT));
+	record[1] = bitStreamLength;
+	if (length > 0) {
+		memcpy(&(record[2]), bitStream, length);
+	}
+	writeUint32(&(record[2+length]), bcg729TraceChecksum(signal));
+
+	decoderChannelContext->traceSyncFlag = 1;
+}
+
+/*****************************************************************************/
+/* initBcg729TraceWriter : create a trace writer                             */
+/*    parameters:                                                            */
+/*      -(i) output : receives the trace data                                */
+/*      -(i) userData : given to output                                      */
+/*    return value :                                                         */
+/*      - the trace writer                                                   */
+/*                                                                           */
+/*****************************************************************************/
+bcg729TraceWriterStruct *initBcg729TraceWriter(bcg729TraceOutput output, void *userData)
+{
+	bcg729TraceWriterStruct *traceWriter = malloc(sizeof(bcg729TraceWriterStruct));
+
+	traceWriter->output = output;
+	traceWriter->userData = userData;
+	memcpy(traceWriter->buffer, traceMagic, 4);
+	writeUint16(&(traceWriter->buffer[4]), TRACE_VERSION);
+	writeUint16(&(traceWriter->buffer[6]), 0);
+	traceWriter->bufferLength = TRACE_HEADER_SIZE;
+
+	return traceWriter;
+}
+
+/*****************************************************************************/
+/* closeBcg729TraceWriter : flush and free memory of trace writer            */
+/*    parameters:                                                            */
+/*      -(i) traceWriter : the trace writer                                  */
+/*                                                                           */
+/*****************************************************************************/
+void closeBcg729TraceWriter(bcg729TraceWriterStruct *traceWriter)
+{
+	if (traceWriter) {
+		bcg729FlushTraceWriter(traceWriter);
+		free(traceWriter);
+	}
+}
+
+/*****************************************************************************/
+/* bcg729FlushTraceWriter : give the buffered records to the output          */
+/*    parameters:                                                            */
+/*      -(i/o) traceWriter : the trace writer                                */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729FlushTraceWriter(bcg729TraceWriterStruct *traceWriter)
+{
+	if (traceWriter->bufferLength > 0) {
+		traceWriter->output(traceWriter->userData, traceWriter->buffer, traceWriter->bufferLength);
+		traceWriter->bufferLength = 0;
+	}
+}
+
+/*****************************************************************************/
+/* bcg729SetEncoderTrace : attach a trace writer to an encoder channel       */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : context for this encoder channel      */
+/*      -(i) traceWriter : the trace writer, NULL to detach                  */
+/*      -(i) channelId : identifies the channel in the trace                 */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729SetEncoderTrace(bcg729EncoderChannelContextStruct *encoderChannelContext, bcg729TraceWriterStruct *traceWriter, uint32_t channelId)
+{
+	encoderChannelContext->traceWriter = traceWriter;
+	encoderChannelContext->traceChannelId = channelId;
+	if (traceWriter != NULL) {
+		writeEncoderOpen(encoderChannelContext);
+	} else {
+		encoderChannelContext->traceSyncFlag = 0; /* the frames encoded until the next trace are not traced */
+	}
+}
+
+/*****************************************************************************/
+/* bcg729SetDecoderTrace : attach a trace writer to a decoder channel        */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : the channel context data              */
+/*      -(i) traceWriter : the trace writer, NULL to detach                  */
+/*      -(i) channelId : identifies the channel in the trace                 */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729SetDecoderTrace(bcg729DecoderChannelContextStruct *decoderChannelContext, bcg729TraceWriterStruct *traceWriter, uint32_t channelId)
+{
+	decoderChannelContext->traceWriter = traceWriter;
+	decoderChannelContext->traceChannelId = channelId;
+	decoderChannelContext->traceSyncFlag = 0;
+	if (traceWriter != NULL) {
+		traceDecoderSync(decoderChannelContext);
+	}
+}
+
+/*****************************************************************************/
+/* initBcg729TraceReader : create a reader on a trace                        */
+/*    parameters:                                                            */
+/*      -(i) trace : the trace                                               */
+/*      -(i) traceSize : in bytes                                            */
+/*    return value :                                                         */
+/*      - the trace reader, NULL if the trace header is invalid              */
+/*                                                                           */
+/*****************************************************************************/
+bcg729TraceReaderStruct *initBcg729TraceReader(const uint8_t trace[], uint32_t traceSize)
+{
+	bcg729TraceReaderStruct *traceReader;
+
+	if (trace == NULL || traceSize < TRACE_HEADER_SIZE || memcmp(trace, traceMagic, 4) != 0 || readUint16(&(trace[4])) != TRACE_VERSION) {
+		return NULL;
+	}
+
+	traceReader = malloc(sizeof(bcg729TraceReaderStruct));
+	traceReader->trace = trace;
+	traceReader->traceSize = traceSize;
+	traceReader->currentOffset = TRACE_HEADER_SIZE;
+
+	return traceReader;
+}
+
+/*****************************************************************************/
+/* closeBcg729TraceReader : free memory of trace reader                      */
+/*    parameters:                                                            */
+/*      -(i) traceReader : the trace reader                                  */
+/*                                                                           */
+/*****************************************************************************/
+void closeBcg729TraceReader(bcg729TraceReaderStruct *traceReader)
+{
+	if (traceReader) {
+		free(traceReader);
+	}
+}
+
+/*****************************************************************************/
+/* bcg729TraceReaderNext : read the next record of the trace                 */
+/*    parameters:                                                            */
+/*      -(i/o) traceReader : the trace reader                                */
+/*      -(o) record : the record                                             */
+/*    return value : the record type, BCG729_TRACE_END at the end of the     */
+/*           trace or on a truncated or invalid record                       */
+/*                                                                           */
+/*****************************************************************************/
+uint8_t bcg729TraceReaderNext(bcg729TraceReaderStruct *traceReader, bcg729TraceRecord *record)
+{
+	const uint8_t *payload;
+	uint32_t availableSize = traceReader->traceSize - traceReader->currentOffset;
+	uint32_t payloadSize;
+	int i;
+
+	record->type = BCG729_TRACE_END;
+	if (availableSize < TRACE_RECORD_HEADER_SIZE) {
+		return BCG729_TRACE_END;
+	}
+	payload = &(traceReader->trace[traceReader->currentOffset + TRACE_RECORD_HEADER_SIZE]);
+	availableSize -= TRACE_RECORD_HEADER_SIZE;
+
+	switch (traceReader->trace[traceReader->currentOffset]) {
+		case BCG729_TRACE_ENCODER_OPEN:
+			payloadSize = ENCODER_OPEN_SIZE;
+			if (availableSize < payloadSize) {
+				return BCG729_TRACE_END;
+			}
+			record->enableVAD = payload[0];
+			record->initialStateFlag = payload[1];
+			break;
+		case BCG729_TRACE_DECODER_OPEN:
+			payloadSize = DECODER_STATE_SIZE;
+			if (availableSize < payloadSize) {
+				return BCG729_TRACE_END;
+			}
+			record->decoderState = payload;
+			break;
+		case BCG729_TRACE_ENCODE:
+			payloadSize = ENCODE_SIZE;
+			if (availableSize < payloadSize) {
+				return BCG729_TRACE_END;
+			}
+			if (payload[2*L_FRAME+2] != 0) {
+				payloadSize += ENCODE_HINTS_SIZE;
+				if (availableSize < payloadSize) {
+					return BCG729_TRACE_END;
+				}
+			}
+			record->bitStreamLength = payload[payloadSize-1];
+			if (record->bitStreamLength > BCG729_TRACE_MAX_BITSTREAM_LENGTH || availableSize < payloadSize + record->bitStreamLength) {
+				return BCG729_TRACE_END;
+			}
+			for (i=0; i<L_FRAME; i++) {
+				record->inputFrame[i] = (int16_t)readUint16(&(payload[2*i]));
+			}
+			record->silenceThreshold = readUint16(&(payload[2*L_FRAME]));
+			record->hints.flags = payload[2*L_FRAME+2];
+			if (record->hints.flags != 0) {
+				record->hints.L1 = readUint16(&(payload[2*L_FRAME+3]));
+				record->hints.intPitchDelay[0] = (int16_t)readUint16(&(payload[2*L_FRAME+5]));
+				record->hints.intPitchDelay[1] = (int16_t)readUint16(&(payload[2*L_FRAME+7]));
+			}
+			memcpy(record->bitStream, &(payload[payloadSize]), record->bitStreamLength);
+			payloadSize += record->bitStreamLength;
+			break;
+		case BCG729_TRACE_DECODE: {
+			uint8_t length;
+			payloadSize = DECODE_SIZE;
+			if (availableSize < payloadSize) {
+				return BCG729_TRACE_END;
+			}
+			record->frameErasureFlag = (payload[0]&DECODE_FLAG_ERASURE)?1:0;
+			record->SIDFrameFlag = (payload[0]&DECODE_FLAG_SID)?1:0;
+			record->rfc3389PayloadFlag = (payload[0]&DECODE_FLAG_RFC3389)?1:0;
+			record->nullBitStreamFlag = (payload[0]&DECODE_FLAG_NULL_BITSTREAM)?1:0;
+			record->decoderMode = payload[0]>>DECODE_MODE_SHIFT;
+			record->bitStreamLength = payload[1];
+			length = getDecoderBitStreamLength(record->nullBitStreamFlag, record->SIDFrameFlag, record->rfc3389PayloadFlag, record->bitStreamLength);
+			payloadSize += length;
+			if (availableSize < payloadSize) {
+				return BCG729_TRACE_END;
+			}
+			memcpy(record->bitStream, &(payload[2]), length);
+			record->signalChecksum = readUint32(&(payload[2+length]));
+			break;
+		}
+		default:
+			return BCG729_TRACE_END;
+	}
+
+	record->type = traceReader->trace[traceReader->currentOffset];
+	record->channelId = readUint32(&(traceReader->trace[traceReader->currentOffset+1]));
+	traceReader->currentOffset += TRACE_RECORD_HEADER_SIZE + payloadSize;
+	return record->type;
+}
+
+/*****************************************************************************/
+/* initBcg729TracedEncoderChannel : create an encoder channel as traced by   */
+/*      an ENCODER_OPEN record                                               */
+/*    parameters:                                                            */
+/*      -(i) record : the ENCODER_OPEN record                                */
+/*    return value :                                                         */
+/*      - the encoder channel context data                                   */
+/*                                                                           */
+/*****************************************************************************/
+bcg729EncoderChannelContextStruct *initBcg729TracedEncoderChannel(const bcg729TraceRecord *record)
+{
+	return initBcg729EncoderChannel(record->enableVAD);
+}
+
+/*****************************************************************************/
+/* initBcg729TracedDecoderChannel : create a decoder channel in the state    */
+/*      traced by a DECODER_OPEN record                                      */
+/*    parameters:                                                            */
+/*      -(i) record : the DECODER_OPEN record                                */
+/*    return value :                                                         */
+/*      - the decoder channel context data                                   */
+/*                                                                           */
+/*****************************************************************************/
+bcg729DecoderChannelContextStruct *initBcg729TracedDecoderChannel(const bcg729TraceRecord *record)
+{
+	bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+
+	restoreDecoderState(decoderChannelContext, record->decoderState);
+	return decoderChannelContext;
+}
+
+/*****************************************************************************/
+/* bcg729TraceChecksum : FNV-1a hash of the frame samples in little endian   */
+/*    parameters:                                                            */
+/*      -(i) signal : a decoded frame 80 samples (16 bits PCM)               */
+/*    return value : the checksum                                            */
+/*                                                                           */
+/*****************************************************************************/
+uint32_t bcg729TraceChecksum(const int16_t signal[])
+{
+	uint32_t checksum = 2166136261u;
+	int i;
+
+	for (i=0; i<L_FRAME; i++) {
+		checksum = (checksum ^ ((uint16_t)signal[i]&0xFF))*16777619u;
+		checksum = (checksum ^ ((uint16_t)signal[i]>>8))*16777619u;
+	}
+	return checksum;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef PRIVATE_TRACE_H
+#define PRIVATE_TRACE_H
+/*****************************************************************************/
+/* traceEncoderSync : called before encoding a traced frame, writes an       */
+/*      ENCODER_OPEN record if the channel encoded frames out of the trace   */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : a channel with a trace writer         */
+/*                                                                           */
+/*****************************************************************************/
+void traceEncoderSync(bcg729EncoderChannelContextStruct *encoderChannelContext);
+
+/*****************************************************************************/
+/* traceEncoderFrame : write the ENCODE record of a frame                    */
+/*    parameters:                                                            */
+/*      -(i/o) encoderChannelContext : a channel with a trace writer         */
+/*      -(i) inputFrame : 80 samples (16 bits PCM)                           */
+/*      -(i) hints : the hints given for this frame                          */
+/*      -(i) bitStream : the encoded frame                                   */
+/*      -(i) bitStreamLength : 0, 2 or 10                                    */
+/*                                                                           */
+/*****************************************************************************/
+void traceEncoderFrame(bcg729EncoderChannelContextStruct *encoderChannelContext, const int16_t inputFrame[], const bcg729EncoderHints *hints, const uint8_t bitStream[], uint8_t bitStreamLength);
+
+/*****************************************************************************/
+/* traceDecoderSync : called before decoding a traced frame, writes a        */
+/*      DECODER_OPEN record if the channel decoded frames out of the trace   */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : a channel with a trace writer         */
+/*                                                                           */
+/*****************************************************************************/
+void traceDecoderSync(bcg729DecoderChannelContextStruct *decoderChannelContext);
+
+/*****************************************************************************/
+/* traceDecoderFrame : write the DECODE record of a frame                    */
+/*    parameters:                                                            */
+/*      -(i/o) decoderChannelContext : a channel with a trace writer         */
+/*      -(i) bitStream, bitStreamLength, frameErasureFlag, SIDFrameFlag,     */
+/*           rfc3389PayloadFlag : as given to the decoder                    */
+/*      -(i) signal : the decoded frame 80 samples (16 bits PCM)             */
+/*                                                                           */
+/*****************************************************************************/
+void traceDecoderFrame(bcg729DecoderChannelContextStruct *decoderChannelContext, const uint8_t bitStream[], uint8_t bitStreamLength, uint8_t frameErasureFlag, uint8_t SIDFrameFlag, uint8_t rfc3389PayloadFlag, const int16_t signal[]);
+#endif /* ifndef PRIVATE_TRACE_H */
@@ -28,12 +28,17 @@
 #include "codecParameters.h"
 #include "bcg729/encoder.h"
 #include "bcg729/decoder.h"
+#include "bcg729/analyzer.h"
+#include "bcg729/recording.h"
+#include "bcg729/voiceActivity.h"
+#include "bcg729/trace.h"
 
 typedef int16_t word16_t;
 typedef uint16_t uword16_t;
 typedef int32_t word32_t;
 typedef uint32_t uword32_t;
 typedef int64_t word64_t;
+typedef uint64_t uword64_t;
 
 struct bcg729VADChannelContextStruct_struct {
 	/* buffer used during the init period - first N0(32) frames */
@@ -77,6 +82,7 @@ struct bcg729DTXChannelContextStruct_struct {
 	word16_t qLSPCoefficients[NB_LSP_COEFF]; /* current Quantized LSP coefficient in Q15, saved to be re-used in case of untransmitted frame */
 	word32_t reflectionCoefficients[NB_LSP_COEFF]; /* used to generate the RFC3389 payload, generated during LP computation */
 	int8_t decodedLogEnergy; /* log10(frame residual energy), used to generate noise level for RFC3389 paylaod */
+	uint32_t LSPConversionFailuresNbr; /* LP to LSP conversions of SID frames which failed, reported by bcg729GetEncoderStats */
 };
 typedef struct bcg729DTXChannelContextStruct_struct bcg729DTXChannelContextStruct;
 
@@ -85,6 +91,7 @@ struct bcg729CNGChannelContextStruct_struct {
 	word16_t smoothedSIDGain; /* gain in Q3 */
 	word16_t qLSP[NB_LSP_COEFF]; /* qLSP in Q0.15 */
 	word64_t lastFrameEnergy; /* in Q0 */
+	uint32_t LSPConversionFailuresNbr; /* LP to LSP conversions of RFC3389 payloads which failed, reported by bcg729GetDecoderStats */
 };
 
 typedef struct bcg729CNGChannelContextStruct_struct bcg729CNGChannelContextStruct;
@@ -124,6 +131,7 @@ struct bcg729DecoderChannelContextStruct_struct {
 	word16_t shortTermFilteredResidualSignalBuffer[NB_LSP_COEFF+L_SUBFRAME]; /* the output of short term filter(synthesis filter) in Q0, need NB_LSP_COEFF word from previous subframe as filter memory */
 	word16_t *shortTermFilteredResidualSignal; /* points to the beginning of current subframe shortTermFilteredResidualSignal */
 	word16_t previousAdaptativeGain; /* previous gain for adaptative gain control */
+	int16_t postFilterPitchDelay; /* best integer pitch delay found by the long term post filter on the last subframe */
 
 	/*** buffers used in postProcessing bloc ***/
 	word16_t inputX0;
@@ -135,7 +143,54 @@ struct bcg729DecoderChannelContextStruct_struct {
 	bcg729CNGChannelContextStruct *CNGChannelContext; /* store informations specific to CNG */
 	uint8_t previousFrameIsActiveFlag; /* store last processed frame type */
 
+	/* output stage selection */
+	uint8_t decoderMode; /* one of BCG729_DECODER_MODE_*, selects the post filter and post processing stages used */
+	uint8_t outputFormat; /* one of BCG729_OUTPUT_FORMAT_*, selects the samples written by bcg729DecoderFormatted */
+	word16_t upsamplingMemory[UPSAMPLING_TAPS_PER_PHASE-1]; /* last post processed samples, upsampling filter memory */
+
+	/*** active speaker detection ***/
+	word32_t excitationEnergy; /* excitation energy estimate of the last subframe, in Q0 */
+	int16_t smoothedEnergydB; /* frame excitation energy smoothed, in dB in Q8 */
+	int16_t noiseFloordB; /* frame excitation energy noise floor, in dB in Q8 */
+	uint8_t activityHangover; /* number of frames before voice activity is cleared */
+	uint8_t synthesisFlag; /* set when the last frame was fully decoded, reset when it was only analyzed */
+	/*** encoder hints ***/
+	bcg729EncoderHints encoderHints; /* parameters of the last decoded frame */
+
+	/*** time scaling ***/
+	word16_t timeScaleBuffer[TIME_SCALE_RESERVE+L_FRAME]; /* decoded signal not output yet, pitch periods are removed from its end */
+	uint16_t timeScaleBufferLength; /* number of samples in timeScaleBuffer */
+	word32_t timeScaleDebt; /* number of samples to remove from the output to reach the requested speed, in Q8 */
+
+	/*** operational statistics ***/
+	bcg729DecoderStats stats; /* CNG LSP conversion failures are counted in the CNG context */
+
+	/*** call trace ***/
+	bcg729TraceWriterStruct *traceWriter; /* NULL when the channel is not traced */
+	uint32_t traceChannelId;
+	uint8_t traceSyncFlag; /* set while the trace holds the channel state: cleared by each frame decoded, set back when the frame is traced */
+};
+
+/* LP analysis of the current frame: computed once by the encoder and shared by the VAD, the DTX and the LSP quantization */
+struct bcg729FrameAnalysisStruct_struct {
+	word16_t LPCoefficients[NB_LSP_COEFF]; /* in Q3.12 */
+	word32_t reflectionCoefficients[NB_LSP_COEFF]; /* in Q31, reflectionCoefficients[1] is requested by VAD */
+	word32_t autoCorrelationCoefficients[NB_LSP_COEFF+3]; /* 13 coefficients when VAD is enabled, 11 otherwise */
+	word32_t noLagAutoCorrelationCoefficients[NB_LSP_COEFF+3]; /* autocorrelation before lag windowing, used by DTX */
+	int8_t autoCorrelationCoefficientsScale; /* autocorrelation coefficients are normalised by computeLP, this is their scaling factor */
+	uint8_t LSPConversionSuccess; /* LP2LSPConversion return value */
+	word16_t LSPCoefficients[NB_LSP_COEFF]; /* in Q15, previous frame ones when LSPConversionSuccess is false */
+	word16_t LSFCoefficients[NB_LSP_COEFF]; /* in Q2.13 */
 };
+typedef struct bcg729FrameAnalysisStruct_struct bcg729FrameAnalysisStruct;
+
+/* LP analysis and open loop pitch delay of an all zero signal: they do not depend on any other context data, compute them once per channel */
+struct bcg729ZeroSignalAnalysisStruct_struct {
+	uint8_t LPAnalysisValid; /* set when the following LP analysis is available */
+	bcg729FrameAnalysisStruct frameAnalysis; /* LSP and LSF are valid only if LSPConversionSuccess is set */
+	uint16_t openLoopPitchDelay; /* 0 until computed */
+};
+typedef struct bcg729ZeroSignalAnalysisStruct_struct bcg729ZeroSignalAnalysisStruct;
 
 /* define the context structure to store all static data for an encoder channel */
 struct bcg729EncoderChannelContextStruct_struct {
@@ -163,6 +218,8 @@ struct bcg729EncoderChannelContextStruct_struct {
 	/*** buffer used in preProcessing ***/
 	word16_t inputX0, inputX1;
 	word32_t outputY2, outputY1;
+	uint8_t inputFormat; /* one of BCG729_INPUT_FORMAT_*, selects the samples read by bcg729EncoderFormatted */
+	word16_t decimationMemory[DECIMATION_48KHZ_TAPS-1]; /* last input samples converted to 16 bits PCM, decimation filter memory */
 
 	/*** buffer used in LSPQuantization ***/
 	word16_t previousqLSF[MA_MAX_K][NB_LSP_COEFF]; /* previousqLSF of the last 4(MA pred buffer size) frames in Q13, contains actually quantizer output (l) and not LSF (w)*/ 
@@ -173,6 +230,75 @@ struct bcg729EncoderChannelContextStruct_struct {
 	/*** VAD management ***/
 	bcg729VADChannelContextStruct *VADChannelContext;
 	bcg729DTXChannelContextStruct *DTXChannelContext;
+
+	/*** digital silence management ***/
+	uint8_t zeroSignalFramesCount; /* number of consecutive all zero frames at preProcessing output, saturates at 255 */
+	word16_t silenceThreshold; /* preProcessing output frames with all samples magnitude below or equal are zeroed, 0 to keep the encoder bit exact */
+	bcg729ZeroSignalAnalysisStruct zeroSignalAnalysis;
+	/*** encoder hints ***/
+	bcg729EncoderHints hints; /* hints for the next frame to encode */
+	bcg729EncoderHints previousHints; /* hints given with the previous frame: the encoder current frame is delayed by a subframe */
+	uint16_t L1Hints[2]; /* L1 vectors around which the LSP quantizer first stage is searched */
+	uint8_t L1HintsNbr; /* 0 to search the whole L1 codebook */
+	/*** streaming input ***/
+	word16_t streamTail[L_FRAME]; /* input samples not encoded yet by bcg729EncoderStream */
+	uint8_t streamTailLength; /* number of samples in streamTail */
+
+	/*** operational statistics ***/
+	bcg729EncoderStats stats; /* SID frames LSP conversion failures are counted in the DTX context */
+
+	/*** call trace ***/
+	bcg729TraceWriterStruct *traceWriter; /* NULL when the channel is not traced */
+	uint32_t traceChannelId;
+	uint8_t traceSyncFlag; /* set while a new channel fed with the traced frames gets the channel state: cleared by each frame encoded, set back when the frame is traced */
+};
+
+/* define the context structure to store all static data for a bitstream analyzer channel */
+struct bcg729AnalyzerChannelContextStruct_struct {
+	bcg729DecoderChannelContextStruct *decoderChannelContext; /* only the LSP, pitch delay, gains, SID parameters and active speaker detection states are used */
+};
+
+/* define the context structure to store all static data for a standalone voice activity detection channel */
+struct bcg729VoiceActivityChannelContextStruct_struct {
+	bcg729EncoderChannelContextStruct *encoderChannelContext; /* only the preProcessing, LP analysis and VAD states are used */
+};
+
+struct bcg729RecordingWriterStruct_struct {
+	bcg729DecoderChannelContextStruct *decoderChannelContext; /* decodes the recorded frames to get the checkpoints decoder state */
+	uint16_t checkpointInterval; /* in frames */
+	uint32_t framesNbr;
+	uint32_t framesAllocated; /* frames the buffers can hold */
+	uint8_t *frameTypes; /* BCG729_FRAME_TYPE_* of each frame */
+	uint8_t *bitStreams; /* frames payloads, concatenated */
+	uint32_t bitStreamsLength; /* in bytes */
+	uint8_t *checkpoints; /* RECORDING_CHECKPOINT_SIZE bytes per checkpoint, as in the container */
+};
+
+struct bcg729RecordingReaderStruct_struct {
+	bcg729DecoderChannelContextStruct *decoderChannelContext; /* not owned by the reader */
+	const uint8_t *recording; /* the container, not owned by the reader */
+	uint32_t recordingSize; /* in bytes */
+	uint16_t checkpointInterval; /* in frames */
+	uint32_t framesNbr;
+	uint32_t checkpointsNbr;
+	const uint8_t *frameTypes; /* points in the container */
+	const uint8_t *checkpoints; /* points in the container */
+	uint32_t bitStreamsOffset; /* in bytes from the container beginning */
+	uint32_t currentFrame; /* index of the next frame to decode */
+	uint32_t currentOffset; /* its payload offset from bitStreamsOffset */
+};
+
+struct bcg729TraceWriterStruct_struct {
+	bcg729TraceOutput output;
+	void *userData; /* given to output */
+	uint8_t buffer[TRACE_BUFFER_SIZE]; /* records not given to the output yet */
+	uint32_t bufferLength; /* in bytes */
+};
+
+struct bcg729TraceReaderStruct_struct {
+	const uint8_t *trace; /* not owned by the reader */
+	uint32_t traceSize; /* in bytes */
+	uint32_t currentOffset; /* offset of the next record */
 };
 
 /* MAXINTXX define the maximum signed integer value on XX bits(2^(XX-1) - 1) */
@@ -134,6 +134,24 @@ static BCG729_INLINE uint16_t unsignedCountLeadingZeros(uword32_t x)
 }
 
 
+/*****************************************************************************/
+/* isNullVector : check if all elements of an array are zero                 */
+/*    parameters :                                                           */
+/*      -(i) x : the array to be checked                                     */
+/*      -(i) length : the array length                                       */
+/*    return value :                                                         */
+/*      - 1 if all elements are zero, 0 otherwise                            */
+/*                                                                           */
+/*****************************************************************************/
+static BCG729_INLINE uint8_t isNullVector(word16_t x[], int length)
+{
+	int i;
+	for (i=0; i<length; i++) {
+		if (x[i]!=0) return 0;
+	}
+	return 1;
+}
+
 /*** gain related functions ***/
 /*****************************************************************************/
 /* MACodeGainPrediction : spec 3.9.1                                         */
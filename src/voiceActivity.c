@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string.h>
+#include <stdlib.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+
+#include "bcg729/voiceActivity.h"
+#include "encoder.h"
+#include "vad.h"
+
+/*****************************************************************************/
+/* initBcg729VoiceActivityChannel : create context structure and initialise  */
+/*    return value :                                                         */
+/*      - the voice activity detection channel context data                  */
+/*                                                                           */
+/*****************************************************************************/
+bcg729VoiceActivityChannelContextStruct *initBcg729VoiceActivityChannel(void)
+{
+	/* create the context structure */
+	bcg729VoiceActivityChannelContextStruct *voiceActivityChannelContext = malloc(sizeof(bcg729VoiceActivityChannelContextStruct));
+	memset(voiceActivityChannelContext, 0, sizeof(*voiceActivityChannelContext));
+
+	/* use a regular encoder context with VAD enabled so the preProcessing, LP analysis and VAD states evolve exactly as in the encoder */
+	voiceActivityChannelContext->encoderChannelContext = initBcg729EncoderChannel(1);
+
+	return voiceActivityChannelContext;
+}
+
+/*****************************************************************************/
+/* closeBcg729VoiceActivityChannel : free memory of context structure        */
+/*    parameters:                                                            */
+/*      -(i) voiceActivityChannelContext : the channel context data          */
+/*                                                                           */
+/*****************************************************************************/
+void closeBcg729VoiceActivityChannel(bcg729VoiceActivityChannelContextStruct *voiceActivityChannelContext)
+{
+	if (voiceActivityChannelContext) {
+		closeBcg729EncoderChannel(voiceActivityChannelContext->encoderChannelContext);
+		free(voiceActivityChannelContext);
+	}
+	return;
+}
+
+/*****************************************************************************/
+/* bcg729DetectVoiceActivity : voice activity decision of a frame            */
+/*    parameters:                                                            */
+/*      -(i/o) voiceActivityChannelContext : the channel context data        */
+/*      -(i) inputFrame : 80 samples (16 bits PCM)                           */
+/*    return value : 1 for active voice frame, 0 for noise frame             */
+/*                                                                           */
+/*****************************************************************************/
+uint8_t bcg729DetectVoiceActivity(bcg729VoiceActivityChannelContextStruct *voiceActivityChannelContext, const int16_t inputFrame[])
+{
+	bcg729EncoderChannelContextStruct *encoderChannelContext = voiceActivityChannelContext->encoderChannelContext;
+	bcg729FrameAnalysisStruct frameAnalysis;
+	uint8_t VADflag;
+
+	/*** preProcessing and LP analysis as in the encoder ***/
+	encoderFrameAnalysis(encoderChannelContext, inputFrame, BCG729_INPUT_FORMAT_PCM16, 1, &frameAnalysis);
+
+	VADflag = bcg729_vad(encoderChannelContext->VADChannelContext, frameAnalysis.reflectionCoefficients[1], frameAnalysis.LSFCoefficients, frameAnalysis.autoCorrelationCoefficients, frameAnalysis.autoCorrelationCoefficientsScale, encoderChannelContext->signalCurrentFrame);
+
+	/*** memory updates: the encoder keeps the previous LSP on noise frames(but on SID frames where it is not tracked here) ***/
+	/* shift left by L_FRAME the signal buffer */
+	memmove(encoderChannelContext->signalBuffer, &(encoderChannelContext->signalBuffer[L_FRAME]), (L_LP_ANALYSIS_WINDOW-L_FRAME)*sizeof(word16_t));
+	if (VADflag == 1) {
+		memcpy(encoderChannelContext->previousLSPCoefficients, frameAnalysis.LSPCoefficients, NB_LSP_COEFF*sizeof(word16_t));
+	}
+
+	return VADflag;
+}
+
+/*****************************************************************************/
+/* bcg729DetectVoiceActivityMultiChannel : voice activity decision of the    */
+/*      current frame of several channels                                    */
+/*    parameters:                                                            */
+/*      -(i/o) voiceActivityChannelContexts : channelsNbr channels contexts  */
+/*      -(i) channelsNbr : number of channels                                */
+/*      -(i) inputFrames : channelsNbr frames of 80 samples (16 bits PCM)    */
+/*      -(o) voiceActivity : channelsNbr decisions                           */
+/*                                                                           */
+/*****************************************************************************/
+void bcg729DetectVoiceActivityMultiChannel(bcg729VoiceActivityChannelContextStruct *voiceActivityChannelContexts[], uint16_t channelsNbr, const int16_t *inputFrames[], uint8_t voiceActivity[])
+{
+	uint16_t i;
+
+	for (i=0; i<channelsNbr; i++) {
+		voiceActivity[i] = bcg729DetectVoiceActivity(voiceActivityChannelContexts[i], inputFrames[i]);
+	}
+}
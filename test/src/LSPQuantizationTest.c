@@ -36,6 +36,7 @@
 
 #include "testUtils.h"
 
+#include "g729FixedPointMath.h"
 #include "LSPQuantization.h"
 
 int main(int argc, char *argv[] )
@@ -51,6 +52,7 @@ int main(int argc, char *argv[] )
 	/*** input and output buffers ***/
 	/* input file: 10 LSP Coefficients(Q15) */
 	word16_t LSP[NB_LSP_COEFF];
+	word16_t LSF[NB_LSP_COEFF]; /* LSF coefficients in Q2.13, computed by the encoder LP analysis */
 	
 	/* output file: 10 qLSP Coefficients(Q15) */
 	word16_t qLSP[NB_LSP_COEFF];
@@ -89,8 +91,13 @@ int main(int argc, char *argv[] )
 	{
 		int i;
 		
+		/* compute LSF as the encoder does before calling the tested function */
+		for (i=0; i<NB_LSP_COEFF; i++) {
+			LSF[i] = g729Acos_Q15Q13(LSP[i]);
+		}
+
 		/* call the tested funtion */
-		LSPQuantization(encoderChannelContext, LSP, qLSP, parametersL);
+		LSPQuantization(encoderChannelContext, LSF, qLSP, parametersL);
  
 		/* write the output to the output file */
 		fprintf(fpOutput,"%d", qLSP[0]);
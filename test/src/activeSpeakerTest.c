@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for active speaker detection and selective decoding         */
+/*    Input: 15 parameters and the frame erasure flag on each row of a       */
+/*           a text CSV file (same input than decoderTest)                   */
+/*    The input is used to build CONFERENCE_CHANNELS_NBR streams starting at */
+/*    different offsets, each of them talking on one block of               */
+/*    CONFERENCE_TALK_BLOCKS and sending untransmitted frames on the others. */
+/*    All streams are decoded, and in parallel, only the selected speakers  */
+/*    are decoded while the other streams are advanced.                      */
+/*    Ouput: on stdout, the decoding times, the number of frames on which    */
+/*           advanced channels LSP and gains differ from the fully decoded   */
+/*           ones (must be 0) and the SNR of the mix of selected speakers    */
+/*           against the mix of all fully decoded streams                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <math.h>
+#include <time.h>
+
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "utils.h"
+
+#include "testUtils.h"
+
+#include "bcg729/decoder.h"
+
+#define CONFERENCE_CHANNELS_NBR 8
+#define CONFERENCE_SPEAKERS_NBR 3
+#define CONFERENCE_TALK_BLOCKS 4
+#define CONFERENCE_BLOCK_LENGTH 100 /* in frames */
+#define MIN_MIX_SNR 10.0 /* in dB */
+
+int main(int argc, char *argv[] )
+{
+	int i,j,k;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+
+	/*** input and output buffers ***/
+	uint16_t inputBuffer[NB_PARAMETERS+1]; /* input buffer: an array containing the 15 parameters and the frame erasure flag */
+	int framesNbr = 0, framesAllocated = 0;
+	uint8_t *bitStreams = NULL; /* all the binary inputs for the decoder */
+	uint8_t *erasureFlags = NULL;
+	int16_t output[L_FRAME];
+	int32_t referenceMix[L_FRAME], conferenceMix[L_FRAME];
+	uint16_t selectedChannels[CONFERENCE_SPEAKERS_NBR];
+	uint16_t selectedNbr;
+	int mismatchNbr = 0;
+	clock_t start;
+	double referenceTime=0.0, conferenceTime=0.0;
+	double signalEnergy=0.0, noiseEnergy=0.0;
+
+	bcg729DecoderChannelContextStruct *referenceChannelContexts[CONFERENCE_CHANNELS_NBR];
+	bcg729DecoderChannelContextStruct *conferenceChannelContexts[CONFERENCE_CHANNELS_NBR];
+
+	/*** inits ***/
+	/* open the input file */
+	if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+		printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	/*** load the whole input file ***/
+	while(fscanf(fpInput, "%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd", &(inputBuffer[0]), &(inputBuffer[1]), &(inputBuffer[2]), &(inputBuffer[3]), &(inputBuffer[4]), &(inputBuffer[5]), &(inputBuffer[6]), &(inputBuffer[7]), &(inputBuffer[8]), &(inputBuffer[9]), &(inputBuffer[10]), &(inputBuffer[11]), &(inputBuffer[12]), &(inputBuffer[13]), &(inputBuffer[14]), &(inputBuffer[15]))==16)
+	{
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			bitStreams = realloc(bitStreams, 10*framesAllocated*sizeof(uint8_t));
+			erasureFlags = realloc(erasureFlags, framesAllocated*sizeof(uint8_t));
+		}
+		parametersArray2BitStream(inputBuffer, &(bitStreams[10*framesNbr]));
+		erasureFlags[framesNbr] = (uint8_t)inputBuffer[15];
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	for (k=0; k<CONFERENCE_CHANNELS_NBR; k++) {
+		referenceChannelContexts[k] = initBcg729DecoderChannel();
+		conferenceChannelContexts[k] = initBcg729DecoderChannel();
+	}
+
+	for (i=0; i<framesNbr; i++) {
+		/*** selection on previous frames energy ***/
+		start = clock();
+		selectedNbr = bcg729SelectActiveSpeakers(conferenceChannelContexts, CONFERENCE_CHANNELS_NBR, CONFERENCE_SPEAKERS_NBR, selectedChannels);
+		conferenceTime += ((double) (clock() - start));
+
+		memset(referenceMix, 0, L_FRAME*sizeof(int32_t));
+		memset(conferenceMix, 0, L_FRAME*sizeof(int32_t));
+
+		for (k=0; k<CONFERENCE_CHANNELS_NBR; k++) {
+			/* channel k plays the input from a shifted position and talks on one block out of CONFERENCE_TALK_BLOCKS */
+			int frameIndex = (i + k*framesNbr/CONFERENCE_CHANNELS_NBR)%framesNbr;
+			uint8_t talkingFlag = (((i/CONFERENCE_BLOCK_LENGTH) + k)%CONFERENCE_TALK_BLOCKS == 0)?1:0;
+			const uint8_t *bitStream = talkingFlag?&(bitStreams[10*frameIndex]):NULL;
+			uint8_t bitStreamLength = talkingFlag?10:0;
+			uint8_t erasureFlag = talkingFlag?erasureFlags[frameIndex]:0;
+			uint8_t SIDFrameFlag = talkingFlag?0:1; /* untransmitted frames */
+			uint16_t l;
+
+			/* reference: decode all channels */
+			start = clock();
+			bcg729Decoder(referenceChannelContexts[k], bitStream, bitStreamLength, erasureFlag, SIDFrameFlag, 0, output);
+			referenceTime += ((double) (clock() - start));
+			for (j=0; j<L_FRAME; j++) {
+				referenceMix[j] += output[j];
+			}
+
+			/* conference: decode selected channels only */
+			for (l=0; l<selectedNbr && selectedChannels[l]!=k; l++);
+			start = clock();
+			if (l<selectedNbr) {
+				bcg729Decoder(conferenceChannelContexts[k], bitStream, bitStreamLength, erasureFlag, SIDFrameFlag, 0, output);
+				conferenceTime += ((double) (clock() - start));
+				for (j=0; j<L_FRAME; j++) {
+					conferenceMix[j] += output[j];
+				}
+			} else {
+				bcg729DecoderAdvance(conferenceChannelContexts[k], bitStream, bitStreamLength, erasureFlag, SIDFrameFlag, 0);
+				conferenceTime += ((double) (clock() - start));
+			}
+
+			/* advanced channels shall keep the same parameters than fully decoded ones */
+			if (memcmp(referenceChannelContexts[k]->previousqLSP, conferenceChannelContexts[k]->previousqLSP, NB_LSP_COEFF*sizeof(word16_t))!=0
+				|| referenceChannelContexts[k]->adaptativeCodebookGain != conferenceChannelContexts[k]->adaptativeCodebookGain
+				|| referenceChannelContexts[k]->fixedCodebookGain != conferenceChannelContexts[k]->fixedCodebookGain
+				|| referenceChannelContexts[k]->previousIntPitchDelay != conferenceChannelContexts[k]->previousIntPitchDelay) {
+				mismatchNbr++;
+			}
+		}
+
+		for (j=0; j<L_FRAME; j++) {
+			signalEnergy += (double)referenceMix[j]*(double)referenceMix[j];
+			noiseEnergy += (double)(referenceMix[j]-conferenceMix[j])*(double)(referenceMix[j]-conferenceMix[j]);
+		}
+	}
+
+	for (k=0; k<CONFERENCE_CHANNELS_NBR; k++) {
+		closeBcg729DecoderChannel(referenceChannelContexts[k]);
+		closeBcg729DecoderChannel(conferenceChannelContexts[k]);
+	}
+
+	printf("%s: %d frames on %d channels, %d speakers decoded\n  decode all : %f us/frame\n  conference : %f us/frame (x%.2f)\n", filePrefix, framesNbr, CONFERENCE_CHANNELS_NBR, CONFERENCE_SPEAKERS_NBR, referenceTime*1000000/CLOCKS_PER_SEC/framesNbr, conferenceTime*1000000/CLOCKS_PER_SEC/framesNbr, referenceTime/conferenceTime);
+	printf("  LSP, pitch delay and gains mismatches: %d frames\n", mismatchNbr);
+	printf("  selected speakers mix SNR: %.2f dB\n", 10.0*log10((signalEnergy+1.0)/(noiseEnergy+1.0)));
+
+	free(bitStreams);
+	free(erasureFlags);
+	exit ((mismatchNbr==0 && 10.0*log10((signalEnergy+1.0)/(noiseEnergy+1.0))>MIN_MIX_SNR)?0:-1);
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for bitstream analyzer                                       */
+/*    Input: 15 parameters and the frame erasure flag on each row of a       */
+/*           a text CSV file (same input than decoderTest)                   */
+/*    Ouput: on stdout, the analysis and decoding times, the number of       */
+/*           frames on which analyzer LSP, pitch delay and gains differ from */
+/*           the decoder ones (must be 0) and the correlation between the    */
+/*           energy estimate and the decoded frame energy, in dB             */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <math.h>
+#include <time.h>
+
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "utils.h"
+
+#include "testUtils.h"
+
+#include "bcg729/decoder.h"
+#include "bcg729/analyzer.h"
+
+int main(int argc, char *argv[] )
+{
+	int i,j;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+
+	/*** input and output buffers ***/
+	uint16_t inputBuffer[NB_PARAMETERS+1]; /* input buffer: an array containing the 15 parameters and the frame erasure flag */
+	int framesNbr = 0, framesAllocated = 0;
+	uint8_t *bitStreams = NULL; /* all the binary inputs for the decoder */
+	uint8_t *erasureFlags = NULL;
+	int16_t output[L_FRAME];
+	bcg729FrameFeatures *features;
+	bcg729FrameParameters parameters;
+	double *decodedEnergydB;
+	int mismatchNbr = 0;
+	clock_t start;
+	double decoderTime=0.0, analyzerTime=0.0;
+	double sumX=0.0, sumY=0.0, sumXX=0.0, sumYY=0.0, sumXY=0.0;
+	int activeFramesNbr = 0;
+
+	bcg729DecoderChannelContextStruct *decoderChannelContext;
+	bcg729AnalyzerChannelContextStruct *analyzerChannelContext;
+
+	/*** inits ***/
+	/* open the input file */
+	if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+		printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	/*** load the whole input file ***/
+	while(fscanf(fpInput, "%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd", &(inputBuffer[0]), &(inputBuffer[1]), &(inputBuffer[2]), &(inputBuffer[3]), &(inputBuffer[4]), &(inputBuffer[5]), &(inputBuffer[6]), &(inputBuffer[7]), &(inputBuffer[8]), &(inputBuffer[9]), &(inputBuffer[10]), &(inputBuffer[11]), &(inputBuffer[12]), &(inputBuffer[13]), &(inputBuffer[14]), &(inputBuffer[15]))==16)
+	{
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			bitStreams = realloc(bitStreams, 10*framesAllocated*sizeof(uint8_t));
+			erasureFlags = realloc(erasureFlags, framesAllocated*sizeof(uint8_t));
+		}
+		parametersArray2BitStream(inputBuffer, &(bitStreams[10*framesNbr]));
+		erasureFlags[framesNbr] = (uint8_t)inputBuffer[15];
+
+		/* check the unpacking against the input parameters */
+		bcg729UnpackFrame(&(bitStreams[10*framesNbr]), 10, &parameters);
+		if (parameters.L0!=inputBuffer[0] || parameters.L1!=inputBuffer[1] || parameters.L2!=inputBuffer[2] || parameters.L3!=inputBuffer[3]
+			|| parameters.P1!=inputBuffer[4] || parameters.P0!=inputBuffer[5] || parameters.C1!=inputBuffer[6] || parameters.S1!=inputBuffer[7]
+			|| parameters.GA1!=inputBuffer[8] || parameters.GB1!=inputBuffer[9] || parameters.P2!=inputBuffer[10] || parameters.C2!=inputBuffer[11]
+			|| parameters.S2!=inputBuffer[12] || parameters.GA2!=inputBuffer[13] || parameters.GB2!=inputBuffer[14]) {
+			printf("%s - Error: unpacking mismatch on frame %d\n", argv[0], framesNbr);
+			exit(-1);
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	features = malloc(framesNbr*sizeof(bcg729FrameFeatures));
+	decodedEnergydB = malloc(framesNbr*sizeof(double));
+
+	/*** analyze all frames ***/
+	analyzerChannelContext = initBcg729AnalyzerChannel();
+	for (i=0; i<framesNbr; i++) {
+		start = clock();
+		bcg729AnalyzeFrame(analyzerChannelContext, &(bitStreams[10*i]), 10, erasureFlags[i], 0, 0, &(features[i]));
+		analyzerTime += ((double) (clock() - start));
+	}
+	closeBcg729AnalyzerChannel(analyzerChannelContext);
+
+	/*** decode all frames and compare the decoder state with the analyzer output ***/
+	decoderChannelContext = initBcg729DecoderChannel();
+	for (i=0; i<framesNbr; i++) {
+		double energy = 0.0;
+		start = clock();
+		bcg729Decoder(decoderChannelContext, &(bitStreams[10*i]), 10, erasureFlags[i], 0, 0, output);
+		decoderTime += ((double) (clock() - start));
+
+		if (memcmp(features[i].LSP, decoderChannelContext->previousqLSP, NB_LSP_COEFF*sizeof(word16_t))!=0
+			|| features[i].adaptativeCodebookGain[1] != decoderChannelContext->adaptativeCodebookGain
+			|| features[i].fixedCodebookGain[1] != decoderChannelContext->fixedCodebookGain
+			|| (erasureFlags[i]==0 && features[i].intPitchDelay[1] != (int16_t)decoderChannelContext->previousIntPitchDelay)) {
+			mismatchNbr++;
+		}
+
+		for (j=0; j<L_FRAME; j++) {
+			energy += (double)output[j]*(double)output[j];
+		}
+		decodedEnergydB[i] = 10.0*log10(energy/L_FRAME+1.0);
+		if (erasureFlags[i]==0 && features[i].energy>0) {
+			double x = features[i].energydB/256.0;
+			sumX += x; sumY += decodedEnergydB[i];
+			sumXX += x*x; sumYY += decodedEnergydB[i]*decodedEnergydB[i]; sumXY += x*decodedEnergydB[i];
+			activeFramesNbr++;
+		}
+	}
+	closeBcg729DecoderChannel(decoderChannelContext);
+
+	printf("%s: %d frames\n  decoder : %f us/frame\n  analyzer: %f us/frame (x%.2f)\n", filePrefix, framesNbr, decoderTime*1000000/CLOCKS_PER_SEC/framesNbr, analyzerTime*1000000/CLOCKS_PER_SEC/framesNbr, decoderTime/analyzerTime);
+	printf("  LSP, pitch delay and gains mismatches: %d frames\n", mismatchNbr);
+	if (activeFramesNbr>1) {
+		double n = activeFramesNbr;
+		printf("  energy estimate/decoded energy correlation: %.3f\n", (n*sumXY - sumX*sumY)/sqrt((n*sumXX - sumX*sumX)*(n*sumYY - sumY*sumY)));
+	}
+
+	free(bitStreams);
+	free(erasureFlags);
+	free(features);
+	free(decodedEnergydB);
+	exit ((mismatchNbr==0)?0:-1);
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for encoder and decoder channels operational statistics      */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The signal is encoded with VAD enabled and decoded, some frames being  */
+/*    erased and the P0 parity bit of some active frames flipped            */
+/*    Ouput: on stdout, the encoder and decoder statistics. They are checked */
+/*           against the frames types counted by the test, the parity errors */
+/*           must be the flipped frames and counters must be null after a    */
+/*           reset                                                           */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+
+#define ERASURE_PERIOD 17 /* one frame out of ERASURE_PERIOD is erased */
+#define PARITY_ERROR_PERIOD 23 /* P0 is flipped on one received active frame out of PARITY_ERROR_PERIOD */
+#define P0_BYTE 3 /* P0 is the bit 26 of an active frame: L0, L1, L2, L3 and P1 use the first 26 bits */
+#define P0_MASK 0x20
+
+int main(int argc, char *argv[] )
+{
+	int i;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int16_t inputBuffer[L_FRAME];
+	int16_t outputBuffer[L_FRAME];
+	uint8_t bitStream[10];
+	uint8_t bitStreamLength;
+	int errorsNbr = 0;
+
+	/*** expected counters ***/
+	uint32_t framesNbr = 0, activeFramesNbr = 0, SIDFramesNbr = 0, untransmittedFramesNbr = 0;
+	uint32_t receivedActiveFramesNbr = 0, receivedSIDFramesNbr = 0, receivedUntransmittedFramesNbr = 0, erasedFramesNbr = 0, flippedFramesNbr = 0;
+
+	bcg729EncoderStats encoderStats;
+	bcg729DecoderStats decoderStats;
+	bcg729EncoderChannelContextStruct *encoderChannelContext;
+	bcg729DecoderChannelContextStruct *decoderChannelContext;
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	encoderChannelContext = initBcg729EncoderChannel(1);
+	decoderChannelContext = initBcg729DecoderChannel();
+
+	/*** loop over input file ***/
+	while(1) {
+		if (inputIsBinary) {
+			if (fread(inputBuffer, sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(inputBuffer[0])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(inputBuffer[i])) != 1) break;
+			}
+		}
+
+		bcg729Encoder(encoderChannelContext, inputBuffer, bitStream, &bitStreamLength);
+		framesNbr++;
+		switch (bitStreamLength) {
+			case 10: activeFramesNbr++; break;
+			case 2: SIDFramesNbr++; break;
+			default: untransmittedFramesNbr++; break;
+		}
+
+		/* channel impairments */
+		if (framesNbr%ERASURE_PERIOD == 0) {
+			bcg729Decoder(decoderChannelContext, NULL, 0, 1, 0, 0, outputBuffer);
+			erasedFramesNbr++;
+			continue;
+		}
+		if (bitStreamLength == 10) {
+			receivedActiveFramesNbr++;
+			if (receivedActiveFramesNbr%PARITY_ERROR_PERIOD == 0) {
+				bitStream[P0_BYTE] ^= P0_MASK;
+				flippedFramesNbr++;
+			}
+		} else if (bitStreamLength == 2) {
+			receivedSIDFramesNbr++;
+		} else {
+			receivedUntransmittedFramesNbr++;
+		}
+		bcg729Decoder(decoderChannelContext, bitStream, bitStreamLength, 0, (bitStreamLength==10)?0:1, 0, outputBuffer);
+	}
+	fclose(fpInput);
+
+	/*** check the counters ***/
+	bcg729GetEncoderStats(encoderChannelContext, &encoderStats);
+	bcg729GetDecoderStats(decoderChannelContext, &decoderStats);
+	printf("%s: encoder: %u frames, %u active(%u%%), %u SID, %u untransmitted, %u LSP conversion failures\n", filePrefix, encoderStats.framesNbr, encoderStats.activeFramesNbr, (encoderStats.framesNbr>0)?100*encoderStats.activeFramesNbr/encoderStats.framesNbr:0, encoderStats.SIDFramesNbr, encoderStats.untransmittedFramesNbr, encoderStats.LSPConversionFailuresNbr);
+	printf("  decoder: %u frames, %u active, %u SID, %u untransmitted, %u erased, %u parity errors, %u LSP conversion failures, %u saturated samples\n", decoderStats.framesNbr, decoderStats.activeFramesNbr, decoderStats.SIDFramesNbr, decoderStats.untransmittedFramesNbr, decoderStats.erasedFramesNbr, decoderStats.parityErrorsNbr, decoderStats.LSPConversionFailuresNbr, decoderStats.saturatedSamplesNbr);
+
+	if (encoderStats.framesNbr != framesNbr || encoderStats.activeFramesNbr != activeFramesNbr || encoderStats.SIDFramesNbr != SIDFramesNbr || encoderStats.untransmittedFramesNbr != untransmittedFramesNbr) {
+		printf("  encoder frames counters differ: expected %u frames, %u active, %u SID, %u untransmitted\n", framesNbr, activeFramesNbr, SIDFramesNbr, untransmittedFramesNbr);
+		errorsNbr++;
+	}
+	if (decoderStats.framesNbr != framesNbr || decoderStats.activeFramesNbr != receivedActiveFramesNbr || decoderStats.SIDFramesNbr != receivedSIDFramesNbr || decoderStats.untransmittedFramesNbr != receivedUntransmittedFramesNbr || decoderStats.erasedFramesNbr != erasedFramesNbr) {
+		printf("  decoder frames counters differ: expected %u frames, %u active, %u SID, %u untransmitted, %u erased\n", framesNbr, receivedActiveFramesNbr, receivedSIDFramesNbr, receivedUntransmittedFramesNbr, erasedFramesNbr);
+		errorsNbr++;
+	}
+	if (decoderStats.parityErrorsNbr != flippedFramesNbr) {
+		printf("  decoder parity errors differ: expected %u\n", flippedFramesNbr);
+		errorsNbr++;
+	}
+
+	/*** reset ***/
+	bcg729ResetEncoderStats(encoderChannelContext);
+	bcg729ResetDecoderStats(decoderChannelContext);
+	bcg729GetEncoderStats(encoderChannelContext, &encoderStats);
+	bcg729GetDecoderStats(decoderChannelContext, &decoderStats);
+	if (encoderStats.framesNbr != 0 || encoderStats.LSPConversionFailuresNbr != 0 || decoderStats.framesNbr != 0 || decoderStats.parityErrorsNbr != 0 || decoderStats.LSPConversionFailuresNbr != 0 || decoderStats.saturatedSamplesNbr != 0) {
+		printf("  counters not null after reset\n");
+		errorsNbr++;
+	}
+
+	closeBcg729EncoderChannel(encoderChannelContext);
+	closeBcg729DecoderChannel(decoderChannelContext);
+	exit ((errorsNbr==0)?0:-1);
+}
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for chunk parallel encoding and decoding                     */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The input is encoded and decoded sequentially then in 8 chunks run on  */
+/*    4 threads, for several warm-up lengths                                 */
+/*    Ouput: on stdout, for each warm-up length, the number of frames        */
+/*           differing from the sequential output and the SNR of the chunked */
+/*           output against the sequential one, then the speed up. The first */
+/*           chunk must be bit exact. With the longest warm-up, the decoder  */
+/*           must have converged: no frame differing from the sequential     */
+/*           output. The encoder bitstream does not converge, its coding     */
+/*           SNR(decoded signal against input) must be within 0.2 dB of the  */
+/*           sequential one                                                  */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "utils.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+#include "bcg729/chunk.h"
+
+#define CHUNKS_NBR 8
+#define THREADS_NBR 4
+#define WARM_UP_LENGTHS_NBR 8
+static const uint32_t warmUpLengths[WARM_UP_LENGTHS_NBR] = {0, 2, 4, 8, 16, 32, 64, 256}; /* in frames */
+
+/* a chunk job: encode or decode frames [firstFrame, firstFrame+framesNbr[ */
+typedef struct {
+	uint8_t encodeFlag;
+	uint32_t firstFrame;
+	uint32_t framesNbr;
+	uint32_t warmUpFramesNbr;
+	const int16_t *input; /* whole stream input signal */
+	const uint8_t *bitStream; /* whole stream bitstream, 10 bytes per frame */
+	const uint8_t *bitStreamLength; /* whole stream frames length */
+	uint32_t bitStreamOffset; /* offset of the first warm-up frame in bitStream */
+	int16_t *signal; /* decoder output, 80 samples per frame, whole stream */
+	uint8_t *outputBitStream; /* encoder output, 10 bytes per frame, whole stream */
+	uint8_t *outputBitStreamLength;
+	uint32_t outputBitStreamLengthSum;
+} chunkJob;
+
+typedef struct {
+	chunkJob *jobs;
+	int jobsNbr;
+	int nextJob;
+	pthread_mutex_t mutex;
+} jobQueue;
+
+static void *worker(void *arg)
+{
+	jobQueue *queue = (jobQueue *)arg;
+
+	while (1) {
+		chunkJob *job;
+		pthread_mutex_lock(&(queue->mutex));
+		job = (queue->nextJob < queue->jobsNbr)?&(queue->jobs[queue->nextJob++]):NULL;
+		pthread_mutex_unlock(&(queue->mutex));
+		if (job == NULL) {
+			return NULL;
+		}
+		if (job->encodeFlag) {
+			job->outputBitStreamLengthSum = bcg729EncodeChunk(&(job->input[(job->firstFrame - job->warmUpFramesNbr)*L_FRAME]), job->warmUpFramesNbr, job->framesNbr, 0,
+				&(job->outputBitStream[10*job->firstFrame]), &(job->outputBitStreamLength[job->firstFrame]));
+		} else {
+			bcg729DecodeChunk(&(job->bitStream[job->bitStreamOffset]), &(job->bitStreamLength[job->firstFrame - job->warmUpFramesNbr]), job->warmUpFramesNbr, job->framesNbr, &(job->signal[job->firstFrame*L_FRAME]));
+		}
+	}
+}
+
+/* split the stream in chunks and run them on threads */
+static void runChunks(uint8_t encodeFlag, int framesNbr, uint32_t warmUpLength, const int16_t *input, const uint8_t *bitStream, const uint8_t *bitStreamLength, int16_t *signal, uint8_t *outputBitStream, uint8_t *outputBitStreamLength)
+{
+	chunkJob jobs[CHUNKS_NBR];
+	jobQueue queue;
+	pthread_t threads[THREADS_NBR];
+	uint32_t chunkLength = (framesNbr + CHUNKS_NBR - 1)/CHUNKS_NBR;
+	uint32_t bitStreamOffset = 0, frameIndex = 0;
+	int i;
+
+	for (i=0; i<CHUNKS_NBR; i++) {
+		chunkJob *job = &(jobs[i]);
+		job->encodeFlag = encodeFlag;
+		job->firstFrame = i*chunkLength;
+		job->framesNbr = (job->firstFrame + chunkLength <= (uint32_t)framesNbr)?chunkLength:framesNbr - job->firstFrame;
+		job->warmUpFramesNbr = (job->firstFrame < warmUpLength)?job->firstFrame:warmUpLength;
+		job->input = input;
+		job->bitStream = bitStream;
+		job->bitStreamLength = bitStreamLength;
+		job->signal = signal;
+		job->outputBitStream = outputBitStream;
+		job->outputBitStreamLength = outputBitStreamLength;
+		/* compressed bitstream: find the first warm-up frame offset */
+		if (!encodeFlag) {
+			while (frameIndex < job->firstFrame - job->warmUpFramesNbr) {
+				bitStreamOffset += bitStreamLength[frameIndex++];
+			}
+			job->bitStreamOffset = bitStreamOffset;
+		}
+	}
+
+	queue.jobs = jobs;
+	queue.jobsNbr = CHUNKS_NBR;
+	queue.nextJob = 0;
+	pthread_mutex_init(&(queue.mutex), NULL);
+	for (i=0; i<THREADS_NBR; i++) {
+		pthread_create(&(threads[i]), NULL, worker, &queue);
+	}
+	for (i=0; i<THREADS_NBR; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	pthread_mutex_destroy(&(queue.mutex));
+}
+
+static double getTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec/1e9;
+}
+
+/* count differing frames and compute SNR of signal against reference */
+static void compareSignals(const int16_t *reference, const int16_t *signal, int framesNbr, int *differingFramesNbr, double *SNR)
+{
+	double signalEnergy = 0.0, noiseEnergy = 0.0;
+	int i, j;
+
+	*differingFramesNbr = 0;
+	for (i=0; i<framesNbr; i++) {
+		int differ = 0;
+		for (j=i*L_FRAME; j<(i+1)*L_FRAME; j++) {
+			double difference = (double)signal[j] - reference[j];
+			signalEnergy += (double)reference[j]*reference[j];
+			noiseEnergy += difference*difference;
+			differ |= (difference != 0.0);
+		}
+		*differingFramesNbr += differ;
+	}
+	*SNR = (noiseEnergy > 0.0)?10.0*log10(signalEnergy/noiseEnergy):INFINITY;
+}
+
+int main(int argc, char *argv[] )
+{
+	int i, j;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int framesNbr = 0, framesAllocated = 0;
+	int16_t *input = NULL, *reference, *output;
+	uint8_t *bitStream, *chunkedBitStream;
+	uint8_t *bitStreamLength, *chunkedBitStreamLength;
+	int errorNbr = 0, decoderConvergenceErrorNbr = 0;
+	double sequentialSNR;
+	double start, sequentialEncoderTime, sequentialDecoderTime, chunkedEncoderTime = 0.0, chunkedDecoderTime = 0.0;
+	uint32_t chunkLength;
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	/*** load the whole input file ***/
+	while (1) {
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			input = realloc(input, framesAllocated*L_FRAME*sizeof(int16_t));
+		}
+		if (inputIsBinary) {
+			if (fread(&(input[framesNbr*L_FRAME]), sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(input[framesNbr*L_FRAME])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(input[framesNbr*L_FRAME+i])) != 1) break;
+			}
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	reference = malloc(framesNbr*L_FRAME*sizeof(int16_t));
+	output = malloc(framesNbr*L_FRAME*sizeof(int16_t));
+	bitStream = malloc(framesNbr*10*sizeof(uint8_t));
+	chunkedBitStream = malloc(framesNbr*10*sizeof(uint8_t));
+	bitStreamLength = malloc(framesNbr*sizeof(uint8_t));
+	chunkedBitStreamLength = malloc(framesNbr*sizeof(uint8_t));
+	chunkLength = (framesNbr + CHUNKS_NBR - 1)/CHUNKS_NBR;
+
+	/*** sequential encoding and decoding ***/
+	start = getTime();
+	bcg729EncodeChunk(input, 0, framesNbr, 0, bitStream, bitStreamLength);
+	sequentialEncoderTime = getTime() - start;
+	start = getTime();
+	bcg729DecodeChunk(bitStream, bitStreamLength, 0, framesNbr, reference);
+	sequentialDecoderTime = getTime() - start;
+
+	compareSignals(input, reference, framesNbr, &i, &sequentialSNR);
+	printf("%s: %d frames in %d chunks on %d threads, sequential coding SNR %.2f dB\n", filePrefix, framesNbr, CHUNKS_NBR, THREADS_NBR, sequentialSNR);
+	printf("  warm-up | encoder: frames differing, SNR against sequential, coding SNR | decoder: frames differing, SNR against sequential\n");
+	for (i=0; i<WARM_UP_LENGTHS_NBR; i++) {
+		int encoderDifferingFramesNbr = 0, encoderDifferingSignalFramesNbr, decoderDifferingFramesNbr;
+		double encoderSNR, encoderCodingSNR, decoderSNR;
+		int16_t *chunkedEncoderSignal = output;
+
+		/* chunked encoding without VAD, all frames are 10 bytes long: chunks outputs are contiguous. The encoder does not */
+		/* converge to the same bitstream, small state differences change the codebooks searches: compare the coding SNR  */
+		start = getTime();
+		runChunks(1, framesNbr, warmUpLengths[i], input, NULL, NULL, NULL, chunkedBitStream, chunkedBitStreamLength);
+		chunkedEncoderTime += getTime() - start;
+		for (j=0; j<framesNbr; j++) {
+			encoderDifferingFramesNbr += (memcmp(&(chunkedBitStream[10*j]), &(bitStream[10*j]), 10) != 0);
+		}
+		if (memcmp(chunkedBitStream, bitStream, 10*chunkLength) != 0) { /* first chunk is bit exact */
+			errorNbr++;
+		}
+		bcg729DecodeChunk(chunkedBitStream, chunkedBitStreamLength, 0, framesNbr, chunkedEncoderSignal);
+		compareSignals(reference, chunkedEncoderSignal, framesNbr, &encoderDifferingSignalFramesNbr, &encoderSNR);
+		compareSignals(input, chunkedEncoderSignal, framesNbr, &encoderDifferingSignalFramesNbr, &encoderCodingSNR);
+
+		/* chunked decoding of the sequential bitstream */
+		start = getTime();
+		runChunks(0, framesNbr, warmUpLengths[i], NULL, bitStream, bitStreamLength, output, NULL, NULL);
+		chunkedDecoderTime += getTime() - start;
+		compareSignals(reference, output, framesNbr, &decoderDifferingFramesNbr, &decoderSNR);
+		if (memcmp(output, reference, chunkLength*L_FRAME*sizeof(int16_t)) != 0) {
+			errorNbr++;
+		}
+
+		printf("  %7u | %17d, %21.1f dB, %7.2f dB | %17d, %21.1f dB\n", warmUpLengths[i], encoderDifferingFramesNbr, encoderSNR, encoderCodingSNR, decoderDifferingFramesNbr, decoderSNR);
+		/* on the longest warm-up, the decoder has converged: bit exact on all frames */
+		if (i == WARM_UP_LENGTHS_NBR-1 && decoderDifferingFramesNbr > 0) {
+			printf("  decoder did not converge with a %u frames warm-up: %d frames differ\n", warmUpLengths[i], decoderDifferingFramesNbr);
+			decoderConvergenceErrorNbr++;
+		}
+		/* the encoder does not converge, only its coding quality is checked */
+		if (i == WARM_UP_LENGTHS_NBR-1 && encoderCodingSNR < sequentialSNR - 0.2) {
+			errorNbr++;
+		}
+	}
+	printf("  speed up: encoder x%.2f, decoder x%.2f\n", WARM_UP_LENGTHS_NBR*sequentialEncoderTime/chunkedEncoderTime, WARM_UP_LENGTHS_NBR*sequentialDecoderTime/chunkedDecoderTime);
+	printf("  errors: %d, decoder convergence errors: %d\n", errorNbr, decoderConvergenceErrorNbr);
+
+	free(input);
+	free(reference);
+	free(output);
+	free(bitStream);
+	free(chunkedBitStream);
+	free(bitStreamLength);
+	free(chunkedBitStreamLength);
+	exit ((errorNbr==0 && decoderConvergenceErrorNbr==0)?0:-1);
+}
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for multi channel decoding                                   */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The input is encoded with VAD/DTX and the bitstream is decoded on 40   */
+/*    channels, each one starting at a different frame and with its own      */
+/*    erasures, by bcg729Decoder channel by channel and by                   */
+/*    bcg729DecoderMultiChannel                                              */
+/*    Ouput: on stdout, the number of frames differing between the two       */
+/*           decodings (must be 0), the decoding times and the LSP to LP     */
+/*           conversion time of qLSP2LP and qLSP2LPMultiChannel whose        */
+/*           outputs must be identical                                       */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "utils.h"
+#include "qLSP2LP.h"
+#include "multiChannelLSP.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+
+#define CHANNELS_NBR 40 /* more than 2 groups of MULTI_CHANNEL_LANES, the last one partially filled */
+#define CHANNEL_OFFSET 37 /* in frames, first frame decoded by each channel */
+#define LSP_CONVERSIONS_NBR 100000
+
+/* frame decoded by a channel: the bitstream is looped from an offset, each channel has its own erasure pattern */
+static void getChannelFrame(int channel, int frameIndex, int framesNbr, const uint8_t *bitStream, const uint32_t *bitStreamIndex, const uint8_t *bitStreamLength,
+		const uint8_t **frame, uint8_t *frameLength, uint8_t *frameErasureFlag, uint8_t *SIDFrameFlag)
+{
+	int streamFrame = (frameIndex + channel*CHANNEL_OFFSET)%framesNbr;
+
+	*frameLength = bitStreamLength[streamFrame];
+	*frame = (*frameLength>0)?&(bitStream[bitStreamIndex[streamFrame]]):NULL;
+	*frameErasureFlag = ((frameIndex + channel)%(17 + channel%5) == 0)?1:0;
+	if (*frameErasureFlag) {
+		*frame = NULL;
+		*frameLength = 0;
+	}
+	*SIDFrameFlag = (*frameLength==10)?0:1;
+}
+
+int main(int argc, char *argv[] )
+{
+	int i, j, k;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int framesNbr = 0, framesAllocated = 0;
+	int16_t *input = NULL, *reference, *output;
+	uint8_t *bitStream, *bitStreamLength;
+	uint32_t *bitStreamIndex, bitStreamSize = 0;
+	int16_t *signals[CHANNELS_NBR];
+	const uint8_t *frames[CHANNELS_NBR];
+	uint8_t frameLength[CHANNELS_NBR], frameErasureFlag[CHANNELS_NBR], SIDFrameFlag[CHANNELS_NBR];
+	int differingFramesNbr = 0, LPMismatchNbr = 0;
+	clock_t start;
+	double singleChannelTime, multiChannelTime, singleLPTime, multiLPTime;
+	word16_t qLSP[NB_LSP_COEFF][MULTI_CHANNEL_LANES], LP[NB_LSP_COEFF][MULTI_CHANNEL_LANES];
+	word16_t laneqLSP[MULTI_CHANNEL_LANES][NB_LSP_COEFF], laneLP[MULTI_CHANNEL_LANES][NB_LSP_COEFF];
+
+	bcg729EncoderChannelContextStruct *encoderChannelContext;
+	bcg729DecoderChannelContextStruct *decoderChannelContexts[CHANNELS_NBR];
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	/*** load the whole input file ***/
+	while (1) {
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			input = realloc(input, framesAllocated*L_FRAME*sizeof(int16_t));
+		}
+		if (inputIsBinary) {
+			if (fread(&(input[framesNbr*L_FRAME]), sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(input[framesNbr*L_FRAME])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(input[framesNbr*L_FRAME+i])) != 1) break;
+			}
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	/*** encode the input with VAD/DTX ***/
+	bitStream = malloc(framesNbr*10*sizeof(uint8_t));
+	bitStreamLength = malloc(framesNbr*sizeof(uint8_t));
+	bitStreamIndex = malloc(framesNbr*sizeof(uint32_t));
+	encoderChannelContext = initBcg729EncoderChannel(1);
+	for (i=0; i<framesNbr; i++) {
+		bitStreamIndex[i] = bitStreamSize;
+		bcg729Encoder(encoderChannelContext, &(input[i*L_FRAME]), &(bitStream[bitStreamSize]), &(bitStreamLength[i]));
+		bitStreamSize += bitStreamLength[i];
+	}
+	closeBcg729EncoderChannel(encoderChannelContext);
+
+	reference = malloc((size_t)CHANNELS_NBR*framesNbr*L_FRAME*sizeof(int16_t));
+	output = malloc((size_t)CHANNELS_NBR*framesNbr*L_FRAME*sizeof(int16_t));
+
+	/*** decode channel by channel, interleaved frame by frame as a server receiving all channels does ***/
+	start = clock();
+	for (j=0; j<CHANNELS_NBR; j++) {
+		decoderChannelContexts[j] = initBcg729DecoderChannel();
+	}
+	for (i=0; i<framesNbr; i++) {
+		for (j=0; j<CHANNELS_NBR; j++) {
+			getChannelFrame(j, i, framesNbr, bitStream, bitStreamIndex, bitStreamLength, &(frames[0]), &(frameLength[0]), &(frameErasureFlag[0]), &(SIDFrameFlag[0]));
+			bcg729Decoder(decoderChannelContexts[j], frames[0], frameLength[0], frameErasureFlag[0], SIDFrameFlag[0], 0, &(reference[((size_t)j*framesNbr + i)*L_FRAME]));
+		}
+	}
+	for (j=0; j<CHANNELS_NBR; j++) {
+		closeBcg729DecoderChannel(decoderChannelContexts[j]);
+	}
+	singleChannelTime = (double)(clock() - start);
+
+	/*** decode all channels at once ***/
+	start = clock();
+	for (j=0; j<CHANNELS_NBR; j++) {
+		decoderChannelContexts[j] = initBcg729DecoderChannel();
+	}
+	for (i=0; i<framesNbr; i++) {
+		for (j=0; j<CHANNELS_NBR; j++) {
+			getChannelFrame(j, i, framesNbr, bitStream, bitStreamIndex, bitStreamLength, &(frames[j]), &(frameLength[j]), &(frameErasureFlag[j]), &(SIDFrameFlag[j]));
+			signals[j] = &(output[((size_t)j*framesNbr + i)*L_FRAME]);
+		}
+		bcg729DecoderMultiChannel(decoderChannelContexts, CHANNELS_NBR, frames, frameLength, frameErasureFlag, SIDFrameFlag, 0, signals);
+	}
+	for (j=0; j<CHANNELS_NBR; j++) {
+		closeBcg729DecoderChannel(decoderChannelContexts[j]);
+	}
+	multiChannelTime = (double)(clock() - start);
+
+	for (i=0; i<CHANNELS_NBR*framesNbr; i++) {
+		if (memcmp(&(reference[(size_t)i*L_FRAME]), &(output[(size_t)i*L_FRAME]), L_FRAME*sizeof(int16_t)) != 0) {
+			differingFramesNbr++;
+		}
+	}
+
+	/*** LSP to LP conversion on the decoder qLSP: one channel at a time or all lanes at once ***/
+	for (k=0; k<MULTI_CHANNEL_LANES; k++) { /* take the LSP of a few active frames */
+		bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+		for (i=0; i<(k+1)*7 && i<framesNbr; i++) {
+			bcg729Decoder(decoderChannelContext, (bitStreamLength[i]==10)?&(bitStream[bitStreamIndex[i]]):NULL, bitStreamLength[i], 0, (bitStreamLength[i]==10)?0:1, 0, &(reference[0]));
+		}
+		for (j=0; j<NB_LSP_COEFF; j++) {
+			laneqLSP[k][j] = qLSP[j][k] = decoderChannelContext->previousqLSP[j];
+		}
+		closeBcg729DecoderChannel(decoderChannelContext);
+	}
+	start = clock();
+	for (i=0; i<LSP_CONVERSIONS_NBR; i++) {
+		for (k=0; k<MULTI_CHANNEL_LANES; k++) {
+			qLSP2LP(laneqLSP[k], laneLP[k]);
+		}
+	}
+	singleLPTime = (double)(clock() - start);
+	start = clock();
+	for (i=0; i<LSP_CONVERSIONS_NBR; i++) {
+		qLSP2LPMultiChannel(qLSP, LP);
+	}
+	multiLPTime = (double)(clock() - start);
+	for (k=0; k<MULTI_CHANNEL_LANES; k++) {
+		for (j=0; j<NB_LSP_COEFF; j++) {
+			if (laneLP[k][j] != LP[j][k]) {
+				LPMismatchNbr++;
+			}
+		}
+	}
+
+	printf("%s: %d channels of %d frames\n", filePrefix, CHANNELS_NBR, framesNbr);
+	printf("  frames differing between channel by channel and multi channel decoding: %d\n", differingFramesNbr);
+	printf("  bcg729Decoder            : %f us/frame\n", singleChannelTime*1000000/CLOCKS_PER_SEC/CHANNELS_NBR/framesNbr);
+	printf("  bcg729DecoderMultiChannel: %f us/frame\n", multiChannelTime*1000000/CLOCKS_PER_SEC/CHANNELS_NBR/framesNbr);
+	printf("  qLSP2LP: %f ns/channel, qLSP2LPMultiChannel: %f ns/channel (x%.2f), %d coefficients mismatches\n",
+		singleLPTime*1e9/CLOCKS_PER_SEC/LSP_CONVERSIONS_NBR/MULTI_CHANNEL_LANES, multiLPTime*1e9/CLOCKS_PER_SEC/LSP_CONVERSIONS_NBR/MULTI_CHANNEL_LANES, singleLPTime/multiLPTime, LPMismatchNbr);
+
+
+	free(input);
+	free(bitStream);
+	free(bitStreamLength);
+	free(bitStreamIndex);
+	free(reference);
+	free(output);
+	exit ((differingFramesNbr==0 && LPMismatchNbr==0)?0:-1);
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for decoder modes                                            */
+/*    Input: 15 parameters and the frame erasure flag on each row of a       */
+/*           a text CSV file (same input than decoderTest)                   */
+/*    Ouput: on stdout, for each decoder mode: the decoding time and the     */
+/*           SNR and segmental SNR against the standard mode output          */
+/*           a last run switches mode every 50 frames and gives the SNR      */
+/*           measured on the frames decoded in standard mode                 */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <math.h>
+#include <time.h>
+
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "utils.h"
+
+#include "testUtils.h"
+
+#include "bcg729/decoder.h"
+
+#define SWITCH_PERIOD 50
+
+/* decode all frames in the given mode, mode switching every SWITCH_PERIOD frames if switchMode is set, return cpu time */
+static double decodeAll(uint8_t *bitStreams, uint8_t *erasureFlags, int framesNbr, uint8_t mode, int switchMode, int16_t *output)
+{
+	int i;
+	clock_t start;
+	double cpu_time_used=0.0;
+	bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+
+	bcg729SetDecoderMode(decoderChannelContext, mode);
+	for (i=0; i<framesNbr; i++) {
+		if (switchMode && (i%SWITCH_PERIOD == 0)) {
+			bcg729SetDecoderMode(decoderChannelContext, ((i/SWITCH_PERIOD)%2==0)?BCG729_DECODER_MODE_STANDARD:mode);
+		}
+		start = clock();
+		bcg729Decoder(decoderChannelContext, &(bitStreams[10*i]), 10, erasureFlags[i], 0, 0, &(output[L_FRAME*i]));
+		cpu_time_used += ((double) (clock() - start));
+	}
+
+	closeBcg729DecoderChannel(decoderChannelContext);
+	return cpu_time_used/CLOCKS_PER_SEC;
+}
+
+/* compute SNR and segmental SNR(frame basis, silent frames skipped) of signal against reference, on standard mode frames only if switchMode is set */
+static void computeSNR(int16_t *reference, int16_t *signal, int framesNbr, int switchMode, double *SNR, double *segmentalSNR)
+{
+	int i,j;
+	double signalEnergy=0.0, noiseEnergy=0.0, segmentalSum=0.0;
+	int segmentNbr=0;
+
+	for (i=0; i<framesNbr; i++) {
+		double frameSignalEnergy=0.0, frameNoiseEnergy=0.0;
+		if (switchMode && ((i/SWITCH_PERIOD)%2!=0)) {
+			continue;
+		}
+		for (j=0; j<L_FRAME; j++) {
+			double diff = (double)reference[L_FRAME*i+j] - (double)signal[L_FRAME*i+j];
+			frameSignalEnergy += (double)reference[L_FRAME*i+j]*(double)reference[L_FRAME*i+j];
+			frameNoiseEnergy += diff*diff;
+		}
+		signalEnergy += frameSignalEnergy;
+		noiseEnergy += frameNoiseEnergy;
+		if (frameSignalEnergy > L_FRAME*100.0) { /* skip silent frames: rms < 10 */
+			segmentalSum += 10.0*log10((frameSignalEnergy+1.0)/(frameNoiseEnergy+1.0));
+			segmentNbr++;
+		}
+	}
+	*SNR = 10.0*log10((signalEnergy+1.0)/(noiseEnergy+1.0));
+	*segmentalSNR = (segmentNbr>0)?segmentalSum/segmentNbr:0.0;
+}
+
+int main(int argc, char *argv[] )
+{
+	int i;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+
+	/*** input and output buffers ***/
+	uint16_t inputBuffer[NB_PARAMETERS+1]; /* input buffer: an array containing the 15 parameters and the frame erasure flag */
+	int framesNbr = 0, framesAllocated = 0;
+	uint8_t *bitStreams = NULL; /* all the binary inputs for the decoder */
+	uint8_t *erasureFlags = NULL;
+	int16_t *referenceOutput, *modeOutput;
+	uint8_t modes[2] = {BCG729_DECODER_MODE_NO_POSTFILTER, BCG729_DECODER_MODE_RAW};
+	char *modesName[2] = {"NO_POSTFILTER", "RAW"};
+	double referenceTime, modeTime, SNR, segmentalSNR;
+
+	/*** inits ***/
+	/* open the input file */
+	if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+		printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	/*** load the whole input file ***/
+	while(fscanf(fpInput, "%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd,%hd", &(inputBuffer[0]), &(inputBuffer[1]), &(inputBuffer[2]), &(inputBuffer[3]), &(inputBuffer[4]), &(inputBuffer[5]), &(inputBuffer[6]), &(inputBuffer[7]), &(inputBuffer[8]), &(inputBuffer[9]), &(inputBuffer[10]), &(inputBuffer[11]), &(inputBuffer[12]), &(inputBuffer[13]), &(inputBuffer[14]), &(inputBuffer[15]))==16)
+	{
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			bitStreams = realloc(bitStreams, 10*framesAllocated*sizeof(uint8_t));
+			erasureFlags = realloc(erasureFlags, framesAllocated*sizeof(uint8_t));
+		}
+		parametersArray2BitStream(inputBuffer, &(bitStreams[10*framesNbr]));
+		erasureFlags[framesNbr] = (uint8_t)inputBuffer[15];
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	referenceOutput = malloc(L_FRAME*framesNbr*sizeof(int16_t));
+	modeOutput = malloc(L_FRAME*framesNbr*sizeof(int16_t));
+
+	/*** decode in standard mode to get the reference ***/
+	referenceTime = decodeAll(bitStreams, erasureFlags, framesNbr, BCG729_DECODER_MODE_STANDARD, 0, referenceOutput);
+	printf("%s: %d frames\n  STANDARD      : %f us/frame\n", filePrefix, framesNbr, referenceTime*1000000/framesNbr);
+
+	for (i=0; i<2; i++) {
+		modeTime = decodeAll(bitStreams, erasureFlags, framesNbr, modes[i], 0, modeOutput);
+		computeSNR(referenceOutput, modeOutput, framesNbr, 0, &SNR, &segmentalSNR);
+		printf("  %-14s: %f us/frame (x%.2f) SNR %.2f dB segSNR %.2f dB", modesName[i], modeTime*1000000/framesNbr, referenceTime/modeTime, SNR, segmentalSNR);
+		/* switching run: check the standard mode recovers from a bypass period */
+		decodeAll(bitStreams, erasureFlags, framesNbr, modes[i], 1, modeOutput);
+		computeSNR(referenceOutput, modeOutput, framesNbr, 1, &SNR, &segmentalSNR);
+		printf(" - switching: SNR %.2f dB segSNR %.2f dB\n", SNR, segmentalSNR);
+	}
+
+	free(bitStreams);
+	free(erasureFlags);
+	free(referenceOutput);
+	free(modeOutput);
+	exit (0);
+}
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for decoder output formats                                   */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The input is encoded with VAD enabled, the bitstream is decoded by     */
+/*    bcg729Decoder and by bcg729DecoderFormatted in each output format      */
+/*    Ouput: on stdout, for each output format: the decoding time and the    */
+/*           checks against the bcg729Decoder output:                        */
+/*           - PCM16 and float: identical samples                            */
+/*           - mu-law and A-law: SNR of the expanded codes                   */
+/*           - 16 and 48kHz: phase 0 samples identical to the delayed 8kHz   */
+/*             ones, SNR of the others against a long windowed sinc          */
+/*             interpolation                                                 */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <math.h>
+#include <time.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+
+#define FORMATS_NBR 6
+#define UPSAMPLING_DELAY 8 /* in samples at 8kHz, delay of the upsampling filter */
+#define SINC_HALF_LENGTH 64 /* in samples at 8kHz, half length of the reference interpolation filter */
+#define G711_MIN_SNR 30.0 /* in dB */
+#define UPSAMPLING_MIN_SNR 35.0 /* in dB */
+
+static const char *formatsName[FORMATS_NBR] = {"PCM16", "float", "mu-law", "A-law", "PCM16 16kHz", "PCM16 48kHz"};
+static const uint16_t formatsFrameSize[FORMATS_NBR] = {160, 320, 80, 80, 320, 960};
+
+/* G711 expansions from the reference implementation */
+static int16_t ALawToLinear(uint8_t code)
+{
+	int16_t value;
+	int segment;
+
+	code ^= 0x55;
+	value = (code&0x0F)<<4;
+	segment = (code&0x70)>>4;
+	if (segment == 0) {
+		value += 8;
+	} else if (segment == 1) {
+		value += 0x108;
+	} else {
+		value = (value + 0x108)<<(segment-1);
+	}
+	return (code&0x80)?value:-value;
+}
+
+static int16_t muLawToLinear(uint8_t code)
+{
+	int16_t value;
+
+	code = ~code;
+	value = (((code&0x0F)<<3) + 0x84)<<((code&0x70)>>4);
+	return (code&0x80)?(0x84-value):(value-0x84);
+}
+
+/* kaiser window of parameter beta at position x in [-1, 1] */
+static double besselI0(double x)
+{
+	double sum = 1.0, term = 1.0;
+	int k;
+
+	for (k=1; k<32; k++) {
+		term *= (x/(2.0*k))*(x/(2.0*k));
+		sum += term;
+	}
+	return sum;
+}
+
+/* reference interpolation filter: long kaiser windowed sinc, interpolationFilter[p][m] weights the sample n+m-SINC_HALF_LENGTH+1 to get the signal at n+p/6 */
+static double interpolationFilter[6][2*SINC_HALF_LENGTH];
+
+static void initInterpolationFilter(void)
+{
+	int p, m;
+
+	for (p=1; p<6; p++) {
+		for (m=0; m<2*SINC_HALF_LENGTH; m++) {
+			double x = (double)p/6 + SINC_HALF_LENGTH-1-m;
+			double w = x/SINC_HALF_LENGTH;
+			interpolationFilter[p][m] = sin(M_PI*x)/(M_PI*x)*besselI0(9.0*sqrt(1.0-w*w))/besselI0(9.0);
+		}
+	}
+}
+
+/* interpolation of the 8kHz signal at position n+p/6 */
+static double interpolate(const int16_t *signal, int samplesNbr, int n, int p)
+{
+	int m, k;
+	double sum = 0.0;
+
+	for (m=0; m<2*SINC_HALF_LENGTH; m++) {
+		k = n+m-SINC_HALF_LENGTH+1;
+		if (k>=0 && k<samplesNbr) {
+			sum += signal[k]*interpolationFilter[p][m];
+		}
+	}
+	return sum;
+}
+
+int main(int argc, char *argv[] )
+{
+	int i, j, format;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int framesNbr = 0, framesAllocated = 0;
+	int16_t *input = NULL;
+	int16_t *reference;
+	uint8_t *bitStream, *bitStreamLength;
+	uint32_t *bitStreamIndex;
+	uint32_t bitStreamSize = 0;
+	uint8_t *output;
+	clock_t start;
+	double referenceTime = 0.0;
+	int failuresNbr = 0;
+
+	bcg729EncoderChannelContextStruct *encoderChannelContext;
+	bcg729DecoderChannelContextStruct *decoderChannelContext;
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	/*** load the whole input file ***/
+	while (1) {
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			input = realloc(input, framesAllocated*L_FRAME*sizeof(int16_t));
+		}
+		if (inputIsBinary) {
+			if (fread(&(input[framesNbr*L_FRAME]), sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(input[framesNbr*L_FRAME])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(input[framesNbr*L_FRAME+i])) != 1) break;
+			}
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	/*** encode the input with VAD enabled ***/
+	bitStream = malloc((size_t)framesNbr*10*sizeof(uint8_t));
+	bitStreamLength = malloc(framesNbr*sizeof(uint8_t));
+	bitStreamIndex = malloc(framesNbr*sizeof(uint32_t));
+	encoderChannelContext = initBcg729EncoderChannel(1);
+	for (i=0; i<framesNbr; i++) {
+		bitStreamIndex[i] = bitStreamSize;
+		bcg729Encoder(encoderChannelContext, &(input[i*L_FRAME]), &(bitStream[bitStreamSize]), &(bitStreamLength[i]));
+		bitStreamSize += bitStreamLength[i];
+	}
+	closeBcg729EncoderChannel(encoderChannelContext);
+
+	/*** reference: bcg729Decoder output ***/
+	reference = malloc((size_t)framesNbr*L_FRAME*sizeof(int16_t));
+	decoderChannelContext = initBcg729DecoderChannel();
+	for (i=0; i<framesNbr; i++) {
+		start = clock();
+		bcg729Decoder(decoderChannelContext, &(bitStream[bitStreamIndex[i]]), bitStreamLength[i], 0, (bitStreamLength[i]==10)?0:1, 0, &(reference[i*L_FRAME]));
+		referenceTime += ((double) (clock() - start));
+	}
+	closeBcg729DecoderChannel(decoderChannelContext);
+
+	printf("%s: %d frames\n", filePrefix, framesNbr);
+	printf("  %-11s (bcg729Decoder): %f us/frame\n", "PCM16", referenceTime*1000000/CLOCKS_PER_SEC/framesNbr);
+
+	/*** decode in each output format ***/
+	initInterpolationFilter();
+	output = malloc((size_t)framesNbr*960);
+	for (format=0; format<FORMATS_NBR; format++) {
+		double formatTime = 0.0;
+		uint16_t frameSize;
+		int sizeMismatch = 0;
+		int differingSamplesNbr = 0;
+		double signalEnergy = 0.0, noiseEnergy = 0.0, SNR;
+
+		decoderChannelContext = initBcg729DecoderChannel();
+		bcg729SetDecoderOutputFormat(decoderChannelContext, format);
+		for (i=0; i<framesNbr; i++) {
+			start = clock();
+			frameSize = bcg729DecoderFormatted(decoderChannelContext, &(bitStream[bitStreamIndex[i]]), bitStreamLength[i], 0, (bitStreamLength[i]==10)?0:1, 0, &(output[(size_t)i*formatsFrameSize[format]]));
+			formatTime += ((double) (clock() - start));
+			if (frameSize != formatsFrameSize[format]) {
+				sizeMismatch = 1;
+			}
+		}
+		closeBcg729DecoderChannel(decoderChannelContext);
+
+		printf("  %-11s (formatted)    : %f us/frame", formatsName[format], formatTime*1000000/CLOCKS_PER_SEC/framesNbr);
+		if (sizeMismatch) {
+			printf(" wrong frame size");
+			failuresNbr++;
+		}
+
+		switch (format) {
+			case BCG729_OUTPUT_FORMAT_PCM16:
+				differingSamplesNbr = memcmp(output, reference, (size_t)framesNbr*L_FRAME*sizeof(int16_t))!=0;
+				printf(" %s\n", differingSamplesNbr==0?"identical":"differs");
+				break;
+			case BCG729_OUTPUT_FORMAT_FLOAT: {
+				float *floatOutput = (float *)output;
+				for (i=0; i<framesNbr*L_FRAME; i++) {
+					if (floatOutput[i] != (float)reference[i]/32768.0f) {
+						differingSamplesNbr++;
+					}
+				}
+				printf(" %d samples differing\n", differingSamplesNbr);
+				break;
+			}
+			case BCG729_OUTPUT_FORMAT_ULAW:
+			case BCG729_OUTPUT_FORMAT_ALAW:
+				for (i=0; i<framesNbr*L_FRAME; i++) {
+					double error = reference[i] - ((format==BCG729_OUTPUT_FORMAT_ULAW)?muLawToLinear(output[i]):ALawToLinear(output[i]));
+					signalEnergy += (double)reference[i]*reference[i];
+					noiseEnergy += error*error;
+				}
+				SNR = 10.0*log10((signalEnergy+1.0)/(noiseEnergy+1.0));
+				printf(" SNR %.2f dB\n", SNR);
+				if (SNR < G711_MIN_SNR) {
+					failuresNbr++;
+				}
+				break;
+			default: {
+				int16_t *PCMOutput = (int16_t *)output;
+				int factor = (format==BCG729_OUTPUT_FORMAT_PCM16_16KHZ)?2:6;
+				for (i=0; i<framesNbr*L_FRAME; i++) {
+					/* phase 0: the delayed 8kHz signal */
+					if (PCMOutput[i*factor] != ((i>=UPSAMPLING_DELAY)?reference[i-UPSAMPLING_DELAY]:0)) {
+						differingSamplesNbr++;
+					}
+					/* other phases: interpolation of the 8kHz signal */
+					for (j=1; j<factor; j++) {
+						double error = PCMOutput[i*factor+j] - interpolate(reference, framesNbr*L_FRAME, i-UPSAMPLING_DELAY, j*6/factor);
+						double value = PCMOutput[i*factor+j];
+						signalEnergy += value*value;
+						noiseEnergy += error*error;
+					}
+				}
+				SNR = 10.0*log10((signalEnergy+1.0)/(noiseEnergy+1.0));
+				printf(" %d phase 0 samples differing, SNR %.2f dB\n", differingSamplesNbr, SNR);
+				if (SNR < UPSAMPLING_MIN_SNR) {
+					failuresNbr++;
+				}
+				break;
+			}
+		}
+		if (differingSamplesNbr != 0) {
+			failuresNbr++;
+		}
+	}
+
+	free(input);
+	free(reference);
+	free(bitStream);
+	free(bitStreamLength);
+	free(bitStreamIndex);
+	free(output);
+	exit ((failuresNbr==0)?0:-1);
+}
@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for encoder input formats                                    */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The signal is converted to each input format and encoded, VAD enabled, */
+/*    by bcg729EncoderFormatted                                              */
+/*    Ouput: on stdout, for each input format: the encoding time and the     */
+/*           checks:                                                         */
+/*           - PCM16, float, mu-law and A-law: bitstream identical to the    */
+/*             bcg729Encoder one on the same 16 bits PCM samples             */
+/*           - 16 and 48kHz: the signal is upsampled by a long windowed sinc */
+/*             interpolation, SNR of the preProcessing output against the    */
+/*             delayed 8kHz one, float formats identical to PCM16 ones       */
+/*           - bcg729G711ToLinear and bcg729LinearToG711 against the         */
+/*             reference G711 on all codes and all 16 bits samples           */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <math.h>
+#include <time.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+#include "preProcessing.h"
+
+#define FORMATS_NBR 8
+#define DECIMATION_DELAY 8 /* in samples at 8kHz, delay of the decimation filter */
+#define SINC_HALF_LENGTH 64 /* in samples at 8kHz, half length of the interpolation filter */
+#define DECIMATION_MIN_SNR 25.0 /* in dB, the content above 3.7kHz is removed by the decimation filter */
+
+static const char *formatsName[FORMATS_NBR] = {"PCM16", "float", "mu-law", "A-law", "PCM16 16kHz", "PCM16 48kHz", "float 16kHz", "float 48kHz"};
+static const int formatsFactor[FORMATS_NBR] = {1, 1, 1, 1, 2, 6, 2, 6};
+static const int formatsSampleSize[FORMATS_NBR] = {2, 4, 1, 1, 2, 2, 4, 4};
+
+/* G711 compression and expansion from the reference implementation */
+static uint8_t linearToALaw(int16_t sample)
+{
+	int value = sample>>3;
+	int mask = (value >= 0)?0xD5:0x55;
+	int segment = 0;
+
+	if (value < 0) {
+		value = -value - 1;
+	}
+	while (segment < 8 && value >= (0x20<<segment)) {
+		segment++;
+	}
+	if (segment >= 8) {
+		return (uint8_t)(0x7F ^ mask);
+	}
+	return (uint8_t)(((segment<<4) | (((segment < 2)?(value>>1):(value>>segment))&0x0F)) ^ mask);
+}
+
+static int16_t ALawToLinear(uint8_t code)
+{
+	int16_t value;
+	int segment;
+
+	code ^= 0x55;
+	value = (code&0x0F)<<4;
+	segment = (code&0x70)>>4;
+	if (segment == 0) {
+		value += 8;
+	} else {
+		value = (value + 0x108)<<(segment-1);
+	}
+	return (code&0x80)?value:-value;
+}
+
+static uint8_t linearToMuLaw(int16_t sample)
+{
+	int value = sample>>2;
+	int mask = 0xFF;
+	int segment = 0;
+
+	if (value < 0) {
+		value = -value;
+		mask = 0x7F;
+	}
+	if (value > 8159) {
+		value = 8159;
+	}
+	value += 0x21;
+	while (segment < 8 && value >= (0x40<<segment)) {
+		segment++;
+	}
+	if (segment >= 8) {
+		return (uint8_t)(0x7F ^ mask);
+	}
+	return (uint8_t)(((segment<<4) | ((value>>(segment+1))&0x0F)) ^ mask);
+}
+
+static int16_t muLawToLinear(uint8_t code)
+{
+	int16_t value;
+
+	code = ~code;
+	value = (((code&0x0F)<<3) + 0x84)<<((code&0x70)>>4);
+	return (code&0x80)?(0x84-value):(value-0x84);
+}
+
+/* kaiser window of parameter beta at position x in [-1, 1] */
+static double besselI0(double x)
+{
+	double sum = 1.0, term = 1.0;
+	int k;
+
+	for (k=1; k<32; k++) {
+		term *= (x/(2.0*k))*(x/(2.0*k));
+		sum += term;
+	}
+	return sum;
+}
+
+/* upsample the 8kHz signal by factor(2 or 6): long kaiser windowed sinc interpolation, phase 0 is the signal itself */
+static void upsample(const int16_t *signal, int samplesNbr, int factor, int16_t *output)
+{
+	int n, p, m, k;
+	double filter[2*SINC_HALF_LENGTH];
+
+	for (n=0; n<samplesNbr; n++) {
+		output[n*factor] = signal[n];
+	}
+	for (p=1; p<factor; p++) {
+		for (m=0; m<2*SINC_HALF_LENGTH; m++) { /* filter[m] weights the sample n+m-SINC_HALF_LENGTH+1 to get the signal at n+p/factor */
+			double x = (double)p/factor + SINC_HALF_LENGTH-1-m;
+			double w = x/SINC_HALF_LENGTH;
+			filter[m] = sin(M_PI*x)/(M_PI*x)*besselI0(9.0*sqrt(1.0-w*w))/besselI0(9.0);
+		}
+		for (n=0; n<samplesNbr; n++) {
+			double sum = 0.0;
+			for (m=0; m<2*SINC_HALF_LENGTH; m++) {
+				k = n+m-SINC_HALF_LENGTH+1;
+				if (k>=0 && k<samplesNbr) {
+					sum += signal[k]*filter[m];
+				}
+			}
+			sum = floor(sum+0.5);
+			output[n*factor+p] = (sum>32767.0)?32767:((sum<-32768.0)?-32768:(int16_t)sum);
+		}
+	}
+}
+
+int main(int argc, char *argv[] )
+{
+	int i, format;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int framesNbr = 0, framesAllocated = 0;
+	int16_t *input = NULL;
+	int16_t *expandedInput;
+	uint8_t *formattedInput;
+	int16_t *upsampledInput[2];
+	uint8_t *reference, *referenceLength, *bitStream;
+	uint8_t bitStreamLength;
+	word16_t *preProcessedReference, *preProcessedSignal, *previousPreProcessedSignal = NULL;
+	clock_t start;
+	double referenceTime = 0.0;
+	int failuresNbr = 0;
+
+	bcg729EncoderChannelContextStruct *encoderChannelContext;
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	/*** load the whole input file ***/
+	while (1) {
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			input = realloc(input, framesAllocated*L_FRAME*sizeof(int16_t));
+		}
+		if (inputIsBinary) {
+			if (fread(&(input[framesNbr*L_FRAME]), sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(input[framesNbr*L_FRAME])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(input[framesNbr*L_FRAME+i])) != 1) break;
+			}
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	/*** reference: bcg729Encoder bitstream and preProcessing output ***/
+	reference = malloc((size_t)framesNbr*10*sizeof(uint8_t));
+	referenceLength = malloc(framesNbr*sizeof(uint8_t));
+	bitStream = malloc((size_t)framesNbr*10*sizeof(uint8_t));
+	encoderChannelContext = initBcg729EncoderChannel(1);
+	for (i=0; i<framesNbr; i++) {
+		start = clock();
+		bcg729Encoder(encoderChannelContext, &(input[i*L_FRAME]), &(reference[i*10]), &(referenceLength[i]));
+		referenceTime += ((double) (clock() - start));
+	}
+	closeBcg729EncoderChannel(encoderChannelContext);
+
+	preProcessedReference = malloc((size_t)framesNbr*L_FRAME*sizeof(word16_t));
+	preProcessedSignal = malloc((size_t)framesNbr*L_FRAME*sizeof(word16_t));
+	encoderChannelContext = initBcg729EncoderChannel(0);
+	for (i=0; i<framesNbr; i++) {
+		preProcessing(encoderChannelContext, &(input[i*L_FRAME]), &(preProcessedReference[i*L_FRAME]));
+	}
+	closeBcg729EncoderChannel(encoderChannelContext);
+
+	printf("%s: %d frames\n", filePrefix, framesNbr);
+	printf("  %-11s (bcg729Encoder): %f us/frame\n", "PCM16", referenceTime*1000000/CLOCKS_PER_SEC/framesNbr);
+
+	expandedInput = malloc((size_t)framesNbr*L_FRAME*sizeof(int16_t));
+	formattedInput = malloc((size_t)framesNbr*L_FRAME*6*sizeof(float));
+	upsampledInput[0] = malloc((size_t)framesNbr*L_FRAME*2*sizeof(int16_t));
+	upsampledInput[1] = malloc((size_t)framesNbr*L_FRAME*6*sizeof(int16_t));
+	upsample(input, framesNbr*L_FRAME, 2, upsampledInput[0]);
+	upsample(input, framesNbr*L_FRAME, 6, upsampledInput[1]);
+
+	for (format=0; format<FORMATS_NBR; format++) {
+		int frameSize = L_FRAME*formatsFactor[format]*formatsSampleSize[format];
+		int decimation = (format>=BCG729_INPUT_FORMAT_PCM16_16KHZ);
+		const int16_t *PCMInput = decimation?upsampledInput[formatsFactor[format]==2?0:1]:input;
+		int sizeMismatch = 0, differingFramesNbr = 0;
+		double formatTime = 0.0;
+
+		/*** convert the input, the G711 reference is the bcg729Encoder bitstream of the expanded codes ***/
+		for (i=0; i<framesNbr*L_FRAME*formatsFactor[format]; i++) {
+			switch (format) {
+				case BCG729_INPUT_FORMAT_FLOAT:
+				case BCG729_INPUT_FORMAT_FLOAT_16KHZ:
+				case BCG729_INPUT_FORMAT_FLOAT_48KHZ:
+					((float *)formattedInput)[i] = (float)PCMInput[i]/32768.0f;
+					break;
+				case BCG729_INPUT_FORMAT_ULAW:
+					formattedInput[i] = linearToMuLaw(PCMInput[i]);
+					expandedInput[i] = muLawToLinear(formattedInput[i]);
+					break;
+				case BCG729_INPUT_FORMAT_ALAW:
+					formattedInput[i] = linearToALaw(PCMInput[i]);
+					expandedInput[i] = ALawToLinear(formattedInput[i]);
+					break;
+				default:
+					((int16_t *)formattedInput)[i] = PCMInput[i];
+					break;
+			}
+		}
+		if (format == BCG729_INPUT_FORMAT_ULAW || format == BCG729_INPUT_FORMAT_ALAW) {
+			encoderChannelContext = initBcg729EncoderChannel(1);
+			for (i=0; i<framesNbr; i++) {
+				bcg729Encoder(encoderChannelContext, &(expandedInput[i*L_FRAME]), &(reference[i*10]), &(referenceLength[i]));
+			}
+			closeBcg729EncoderChannel(encoderChannelContext);
+		}
+
+		/*** encode ***/
+		encoderChannelContext = initBcg729EncoderChannel(1);
+		bcg729SetEncoderInputFormat(encoderChannelContext, format);
+		for (i=0; i<framesNbr; i++) {
+			start = clock();
+			if (bcg729EncoderFormatted(encoderChannelContext, &(formattedInput[(size_t)i*frameSize]), &(bitStream[i*10]), &bitStreamLength) != frameSize) {
+				sizeMismatch = 1;
+			}
+			formatTime += ((double) (clock() - start));
+			if (!decimation && (bitStreamLength != referenceLength[i] || memcmp(&(bitStream[i*10]), &(reference[i*10]), bitStreamLength) != 0)) {
+				differingFramesNbr++;
+			}
+		}
+		closeBcg729EncoderChannel(encoderChannelContext);
+
+		printf("  %-11s (formatted)    : %f us/frame", formatsName[format], formatTime*1000000/CLOCKS_PER_SEC/framesNbr);
+		if (sizeMismatch) {
+			printf(" wrong frame size");
+			failuresNbr++;
+		}
+
+		if (!decimation) {
+			printf(" %d frames differing\n", differingFramesNbr);
+		} else {
+			/*** decimation: check the preProcessing output against the 8kHz one ***/
+			double signalEnergy = 0.0, noiseEnergy = 0.0, SNR;
+			encoderChannelContext = initBcg729EncoderChannel(0);
+			for (i=0; i<framesNbr; i++) {
+				preProcessingFormatted(encoderChannelContext, &(formattedInput[(size_t)i*frameSize]), format, 1, &(preProcessedSignal[i*L_FRAME]));
+			}
+			closeBcg729EncoderChannel(encoderChannelContext);
+			for (i=DECIMATION_DELAY; i<framesNbr*L_FRAME; i++) {
+				double error = preProcessedSignal[i] - preProcessedReference[i-DECIMATION_DELAY];
+				signalEnergy += (double)preProcessedReference[i-DECIMATION_DELAY]*preProcessedReference[i-DECIMATION_DELAY];
+				noiseEnergy += error*error;
+			}
+			SNR = 10.0*log10((signalEnergy+1.0)/(noiseEnergy+1.0));
+			printf(" SNR %.2f dB", SNR);
+			if (SNR < DECIMATION_MIN_SNR) {
+				failuresNbr++;
+			}
+			/* float formats follow the PCM16 ones of the same rate */
+			if (format >= BCG729_INPUT_FORMAT_FLOAT_16KHZ) {
+				differingFramesNbr = memcmp(preProcessedSignal, &(previousPreProcessedSignal[(format-BCG729_INPUT_FORMAT_FLOAT_16KHZ)*framesNbr*L_FRAME]), (size_t)framesNbr*L_FRAME*sizeof(word16_t))!=0;
+				printf(", %s to PCM16", differingFramesNbr==0?"identical":"differs");
+			} else {
+				previousPreProcessedSignal = realloc(previousPreProcessedSignal, (size_t)(format-BCG729_INPUT_FORMAT_PCM16_16KHZ+1)*framesNbr*L_FRAME*sizeof(word16_t));
+				memcpy(&(previousPreProcessedSignal[(format-BCG729_INPUT_FORMAT_PCM16_16KHZ)*framesNbr*L_FRAME]), preProcessedSignal, (size_t)framesNbr*L_FRAME*sizeof(word16_t));
+			}
+			printf("\n");
+		}
+		if (differingFramesNbr != 0) {
+			failuresNbr++;
+		}
+	}
+
+	/*** standalone G711 conversions: all codes and all samples ***/
+	{
+		uint8_t codes[256], ALawCodes[65536], muLawCodes[65536];
+		int16_t muLawSignal[256], ALawSignal[256], signal[65536];
+		int differingValuesNbr = 0;
+
+		for (i=0; i<256; i++) {
+			codes[i] = (uint8_t)i;
+		}
+		for (i=0; i<65536; i++) {
+			signal[i] = (int16_t)(i-32768);
+		}
+		if (bcg729G711ToLinear(codes, 256, BCG729_INPUT_FORMAT_ULAW, muLawSignal) != 0 || bcg729G711ToLinear(codes, 256, BCG729_INPUT_FORMAT_ALAW, ALawSignal) != 0
+			|| bcg729LinearToG711(signal, 65536, BCG729_OUTPUT_FORMAT_ULAW, muLawCodes) != 0 || bcg729LinearToG711(signal, 65536, BCG729_OUTPUT_FORMAT_ALAW, ALawCodes) != 0
+			|| bcg729G711ToLinear(codes, 256, BCG729_INPUT_FORMAT_PCM16, muLawSignal) != -1 || bcg729LinearToG711(signal, 65536, BCG729_OUTPUT_FORMAT_FLOAT, muLawCodes) != -1) {
+			differingValuesNbr++;
+		}
+		for (i=0; i<256; i++) {
+			differingValuesNbr += (muLawSignal[i] != muLawToLinear(codes[i])) + (ALawSignal[i] != ALawToLinear(codes[i]));
+		}
+		for (i=0; i<65536; i++) {
+			differingValuesNbr += (muLawCodes[i] != linearToMuLaw(signal[i])) + (ALawCodes[i] != linearToALaw(signal[i]));
+		}
+		printf("  G711 standalone conversions: %d values differing\n", differingValuesNbr);
+		if (differingValuesNbr != 0) {
+			failuresNbr++;
+		}
+	}
+
+	free(input);
+	free(expandedInput);
+	free(formattedInput);
+	free(upsampledInput[0]);
+	free(upsampledInput[1]);
+	free(reference);
+	free(referenceLength);
+	free(bitStream);
+	free(preProcessedReference);
+	free(preProcessedSignal);
+	free(previousPreProcessedSignal);
+	exit ((failuresNbr==0)?0:-1);
+}
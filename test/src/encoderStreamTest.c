@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for streaming encoder                                        */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The input is encoded, with VAD/DTX enabled, frame by frame with        */
+/*    bcg729Encoder and by chunks of various sizes with bcg729EncoderStream  */
+/*    Ouput: on stdout, the number of chunk sizes giving an output differing */
+/*           from the frame by frame one (must be 0)                         */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "utils.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+
+/* chunk sizes in samples: 20, 30 and 32 ms, odd and smaller than a frame sizes, 0 for random ones */
+static const uint32_t chunkSizes[] = {160, 240, 256, 80, 1, 79, 81, 333, 0};
+
+int main(int argc, char *argv[] )
+{
+	int i,j;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int framesNbr = 0, framesAllocated = 0;
+	int16_t *input = NULL;
+	uint8_t *referenceBitStream, *bitStream;
+	uint8_t *referenceBitStreamLength, *bitStreamLength;
+	int mismatchNbr = 0;
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	/*** load the whole input file ***/
+	while (1) {
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			input = realloc(input, framesAllocated*L_FRAME*sizeof(int16_t));
+		}
+		if (inputIsBinary) {
+			if (fread(&(input[framesNbr*L_FRAME]), sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(input[framesNbr*L_FRAME])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(input[framesNbr*L_FRAME+i])) != 1) break;
+			}
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	referenceBitStream = malloc(10*framesNbr*sizeof(uint8_t));
+	referenceBitStreamLength = malloc(framesNbr*sizeof(uint8_t));
+	bitStream = malloc(10*framesNbr*sizeof(uint8_t));
+	bitStreamLength = malloc(framesNbr*sizeof(uint8_t));
+
+	/*** reference: frame by frame ***/
+	{
+		bcg729EncoderChannelContextStruct *encoderChannelContext = initBcg729EncoderChannel(1);
+		uint8_t *output = referenceBitStream;
+		for (i=0; i<framesNbr; i++) {
+			bcg729Encoder(encoderChannelContext, &(input[i*L_FRAME]), output, &(referenceBitStreamLength[i]));
+			output += referenceBitStreamLength[i];
+		}
+		closeBcg729EncoderChannel(encoderChannelContext);
+	}
+
+	/*** stream by chunks ***/
+	srand(1);
+	for (j=0; j<(int)(sizeof(chunkSizes)/sizeof(uint32_t)); j++) {
+		bcg729EncoderChannelContextStruct *encoderChannelContext = initBcg729EncoderChannel(1);
+		uint32_t inputIndex = 0;
+		int outputFramesNbr = 0;
+		uint8_t *output = bitStream;
+
+		while (inputIndex < (uint32_t)framesNbr*L_FRAME) {
+			uint32_t chunkSize = (chunkSizes[j]!=0)?chunkSizes[j]:(uint32_t)(rand()%400);
+			uint32_t inputConsumed;
+			uint16_t chunkFramesNbr;
+			int k;
+			if (chunkSize > framesNbr*L_FRAME - inputIndex) {
+				chunkSize = framesNbr*L_FRAME - inputIndex;
+			}
+			chunkFramesNbr = bcg729EncoderStream(encoderChannelContext, &(input[inputIndex]), chunkSize, output, &(bitStreamLength[outputFramesNbr]), (uint16_t)(framesNbr - outputFramesNbr), &inputConsumed);
+			if (inputConsumed != chunkSize) {
+				printf("%s - Error: chunk size %d, %d samples consumed out of %d\n", argv[0], chunkSizes[j], inputConsumed, chunkSize);
+				exit(-1);
+			}
+			for (k=0; k<chunkFramesNbr; k++) {
+				output += bitStreamLength[outputFramesNbr+k];
+			}
+			outputFramesNbr += chunkFramesNbr;
+			inputIndex += chunkSize;
+		}
+		closeBcg729EncoderChannel(encoderChannelContext);
+
+		if (outputFramesNbr != framesNbr || memcmp(bitStreamLength, referenceBitStreamLength, framesNbr*sizeof(uint8_t)) != 0
+			|| memcmp(bitStream, referenceBitStream, output-bitStream) != 0) {
+			printf("  chunk size %d: output mismatch\n", chunkSizes[j]);
+			mismatchNbr++;
+		}
+	}
+
+	printf("%s: %d frames, %d chunk sizes, %d mismatches\n", filePrefix, framesNbr, (int)(sizeof(chunkSizes)/sizeof(uint32_t)), mismatchNbr);
+
+	free(input);
+	free(referenceBitStream);
+	free(referenceBitStreamLength);
+	free(bitStream);
+	free(bitStreamLength);
+	exit ((mismatchNbr==0)?0:-1);
+}
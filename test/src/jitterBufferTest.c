@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for jitter buffer                                            */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The input is encoded with VAD/DTX enabled in RTP packets, then:        */
+/*     - packets are received without jitter: jitter buffer output must be   */
+/*       the frame by frame decoded signal delayed by a frame                */
+/*     - packets are received with jitter, reordering and losses: adaptive   */
+/*       and fixed delay buffers are compared                                */
+/*    Ouput: on stdout, mean playout delay, late and concealed frames, the   */
+/*           adaptive buffer must lose less than 3% of frames                */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "utils.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+#include "bcg729/rtp.h"
+#include "bcg729/jitterBuffer.h"
+
+#define FIXED_DELAY 8 /* in frames, a typical fixed depth buffer */
+#define INITIAL_TIMESTAMP 0xFFFF0000 /* check timestamp wrap around */
+
+typedef struct {
+	uint16_t sequenceNumber;
+	uint32_t timestamp;
+	uint32_t arrivalTime; /* in samples */
+	uint16_t payloadLength;
+	uint8_t payload[20];
+	uint8_t lostFlag;
+} packet_t;
+
+static int comparePacketsArrival(const void *a, const void *b)
+{
+	const packet_t *packetA = a, *packetB = b;
+	if (packetA->arrivalTime != packetB->arrivalTime) {
+		return (packetA->arrivalTime < packetB->arrivalTime)?-1:1;
+	}
+	return (packetA->sequenceNumber < packetB->sequenceNumber)?-1:1;
+}
+
+/* encode the input in RTP packets of up to framesPerPacket frames, arrival time is the sending time */
+static int packetize(int16_t *input, int framesNbr, uint16_t framesPerPacket, packet_t *packets)
+{
+	bcg729EncoderChannelContextStruct *encoderChannelContext = initBcg729EncoderChannel(1);
+	uint8_t packet[20];
+	int frameIndex = 0, packetsNbr = 0;
+
+	while (frameIndex < framesNbr) {
+		uint16_t payloadFirstFrame, framesConsumed, payloadLength;
+		uint16_t packetFramesNbr = (framesNbr - frameIndex < framesPerPacket)?(uint16_t)(framesNbr - frameIndex):framesPerPacket;
+
+		payloadLength = bcg729EncodeRTPPayload(encoderChannelContext, &(input[frameIndex*L_FRAME]), packetFramesNbr, packet, 0, &payloadFirstFrame, &framesConsumed);
+		if (payloadLength > 0) {
+			packets[packetsNbr].sequenceNumber = (uint16_t)packetsNbr;
+			packets[packetsNbr].timestamp = INITIAL_TIMESTAMP + (uint32_t)(frameIndex + payloadFirstFrame)*L_FRAME;
+			packets[packetsNbr].arrivalTime = (uint32_t)(frameIndex + framesConsumed)*L_FRAME;
+			packets[packetsNbr].payloadLength = payloadLength;
+			memcpy(packets[packetsNbr].payload, packet, payloadLength);
+			packets[packetsNbr].lostFlag = 0;
+			packetsNbr++;
+		}
+		frameIndex += framesConsumed;
+	}
+	closeBcg729EncoderChannel(encoderChannelContext);
+	return packetsNbr;
+}
+
+/* play the packets in a jitter buffer, packets must be sorted by arrival time, return the mean delay in samples */
+static double play(packet_t *packets, int packetsNbr, int outputFramesNbr, uint16_t minDelay, uint16_t maxDelay, int16_t *output, bcg729JitterBufferStats *stats)
+{
+	bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+	bcg729JitterBufferStruct *jitterBuffer = initBcg729JitterBuffer(decoderChannelContext, minDelay, maxDelay);
+	int i, packetIndex = 0;
+	double delaySum = 0;
+
+	for (i=0; i<outputFramesNbr; i++) {
+		while (packetIndex < packetsNbr && packets[packetIndex].arrivalTime <= (uint32_t)i*L_FRAME) {
+			if (!packets[packetIndex].lostFlag) {
+				bcg729JitterBufferPut(jitterBuffer, packets[packetIndex].sequenceNumber, packets[packetIndex].timestamp, packets[packetIndex].payload, packets[packetIndex].payloadLength);
+			}
+			packetIndex++;
+		}
+		bcg729JitterBufferGet(jitterBuffer, &(output[i*L_FRAME]));
+		bcg729GetJitterBufferStats(jitterBuffer, stats);
+		delaySum += stats->currentDelay;
+	}
+
+	closeBcg729JitterBuffer(jitterBuffer);
+	closeBcg729DecoderChannel(decoderChannelContext);
+	return delaySum/outputFramesNbr;
+}
+
+int main(int argc, char *argv[] )
+{
+	int i;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int framesNbr = 0, framesAllocated = 0, packetsNbr, outputFramesNbr;
+	int16_t *input = NULL, *reference, *output;
+	packet_t *packets;
+	bcg729JitterBufferStats stats, fixedStats;
+	double meanDelay, fixedMeanDelay;
+	int errorNbr = 0;
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	/*** load the whole input file ***/
+	while (1) {
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			input = realloc(input, framesAllocated*L_FRAME*sizeof(int16_t));
+		}
+		if (inputIsBinary) {
+			if (fread(&(input[framesNbr*L_FRAME]), sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(input[framesNbr*L_FRAME])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(input[framesNbr*L_FRAME+i])) != 1) break;
+			}
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	outputFramesNbr = framesNbr + 2*JITTER_BUFFER_MAXIMUM_DELAY;
+	reference = calloc(outputFramesNbr*L_FRAME, sizeof(int16_t));
+	output = malloc(outputFramesNbr*L_FRAME*sizeof(int16_t));
+	packets = malloc(framesNbr*sizeof(packet_t));
+
+	/*** reference: frame by frame ***/
+	{
+		bcg729EncoderChannelContextStruct *encoderChannelContext = initBcg729EncoderChannel(1);
+		bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+		for (i=0; i<framesNbr; i++) {
+			uint8_t bitStream[10];
+			uint8_t bitStreamLength;
+			bcg729Encoder(encoderChannelContext, &(input[i*L_FRAME]), bitStream, &bitStreamLength);
+			bcg729Decoder(decoderChannelContext, (bitStreamLength==0)?NULL:bitStream, bitStreamLength, 0, (bitStreamLength==10)?0:1, 0, &(reference[i*L_FRAME]));
+		}
+		closeBcg729EncoderChannel(encoderChannelContext);
+		closeBcg729DecoderChannel(decoderChannelContext);
+	}
+
+	/*** no jitter, a frame per packet: output is the reference delayed by the packetization ***/
+	packetsNbr = packetize(input, framesNbr, 1, packets);
+	play(packets, packetsNbr, framesNbr+1, 0, JITTER_BUFFER_MAXIMUM_DELAY, output, &stats);
+	for (i=0; i<L_FRAME; i++) {
+		if (output[i] != 0) {
+			break;
+		}
+	}
+	if (i<L_FRAME || memcmp(&(output[L_FRAME]), reference, framesNbr*L_FRAME*sizeof(int16_t)) != 0
+		|| stats.insertedFramesNbr != 0 || stats.droppedFramesNbr != 0 || stats.concealedFramesNbr != 0) {
+		printf("  no jitter: output differs from the reference\n");
+		errorNbr++;
+	}
+
+	/*** jitter: 2 frames per packet, 1% of packets lost, network delay in [0, 20ms] with 1% in [20, 80ms] on the first half ***/
+	/*** then in [0, 60ms] with 2% in [60, 140ms] on the second half ***/
+	packetsNbr = packetize(input, framesNbr, 2, packets);
+	srand(729);
+	for (i=0; i<packetsNbr; i++) {
+		int draw = rand()%100;
+		if (i < packetsNbr/2) {
+			packets[i].arrivalTime += (uint32_t)((draw<1)?(160 + rand()%480):(rand()%160));
+		} else {
+			packets[i].arrivalTime += (uint32_t)((draw<2)?(480 + rand()%640):(rand()%480));
+		}
+		packets[i].lostFlag = (rand()%100 == 0)?1:0;
+	}
+	qsort(packets, packetsNbr, sizeof(packet_t), comparePacketsArrival);
+
+	meanDelay = play(packets, packetsNbr, outputFramesNbr, 0, JITTER_BUFFER_MAXIMUM_DELAY, output, &stats);
+	fixedMeanDelay = play(packets, packetsNbr, outputFramesNbr, FIXED_DELAY, FIXED_DELAY, output, &fixedStats);
+
+	printf("%s: %d frames, %d packets, %d reordered\n", filePrefix, framesNbr, packetsNbr, stats.reorderedPacketsNbr);
+	printf("  adaptive buffer : mean delay %5.1f ms, late frames %4d, concealed frames %4d, inserted %d, dropped %d\n", meanDelay/8, stats.lateFramesNbr, stats.concealedFramesNbr, stats.insertedFramesNbr, stats.droppedFramesNbr);
+	printf("  fixed %3d ms    : mean delay %5.1f ms, late frames %4d, concealed frames %4d\n", FIXED_DELAY*10, fixedMeanDelay/8, fixedStats.lateFramesNbr, fixedStats.concealedFramesNbr);
+
+	if (stats.lateFramesNbr > (uint32_t)framesNbr*3/100) {
+		printf("  adaptive buffer: too many late frames\n");
+		errorNbr++;
+	}
+
+	free(input);
+	free(reference);
+	free(output);
+	free(packets);
+	exit ((errorNbr==0)?0:-1);
+}
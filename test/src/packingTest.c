@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for batch frame packing and unpacking                        */
+/*    no arguments: random frames parameters (active, SID and untransmitted  */
+/*    frames) are packed and unpacked, bitstreams are checked against a      */
+/*    byte by byte reference implementation of spec 4 - Table 8 and B4.3    */
+/*    Ouput: on stdout, the packing and unpacking times and the number of    */
+/*           mismatches (must be 0)                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bcg729/analyzer.h"
+
+#define FRAMES_NBR 50000
+#define LOOPS_NBR 20
+
+/* reference packing of an active frame: one byte at a time */
+static void referencePackActiveFrame(const bcg729FrameParameters *p, uint8_t bitStream[])
+{
+	bitStream[0] = (uint8_t)(((p->L0&0x1)<<7) | (p->L1&0x7f));
+	bitStream[1] = (uint8_t)(((p->L2&0x1f)<<3) | ((p->L3>>2)&0x7));
+	bitStream[2] = (uint8_t)(((p->L3&0x3)<<6) | ((p->P1>>2)&0x3f));
+	bitStream[3] = (uint8_t)(((p->P1&0x3)<<6) | ((p->P0&0x1)<<5) | ((p->C1>>8)&0x1f));
+	bitStream[4] = (uint8_t)(p->C1&0xff);
+	bitStream[5] = (uint8_t)(((p->S1&0xf)<<4) | ((p->GA1&0x7)<<1) | ((p->GB1>>3)&0x1));
+	bitStream[6] = (uint8_t)(((p->GB1&0x7)<<5) | (p->P2&0x1f));
+	bitStream[7] = (uint8_t)((p->C2>>5)&0xff);
+	bitStream[8] = (uint8_t)(((p->C2&0x1f)<<3) | ((p->S2>>1)&0x7));
+	bitStream[9] = (uint8_t)(((p->S2&0x1)<<7) | ((p->GA2&0x7)<<4) | (p->GB2&0xf));
+}
+
+/* reference packing of a SID frame */
+static void referencePackSIDFrame(const bcg729FrameParameters *p, uint8_t bitStream[])
+{
+	bitStream[0] = (uint8_t)(((p->L0&0x1)<<7) | ((p->L1&0x1f)<<2) | ((p->L2>>2)&0x3));
+	bitStream[1] = (uint8_t)(((p->L2&0x3)<<6) | ((p->gain&0x1f)<<1));
+}
+
+static uint16_t randomField(int bitsNbr)
+{
+	return (uint16_t)(rand()&((1<<bitsNbr)-1));
+}
+
+int main(int argc, char *argv[] )
+{
+	int i, loop;
+	bcg729FrameParameters *parameters = malloc(FRAMES_NBR*sizeof(bcg729FrameParameters));
+	bcg729FrameParameters *unpackedParameters = malloc(FRAMES_NBR*sizeof(bcg729FrameParameters));
+	uint8_t *bitStreamLength = malloc(FRAMES_NBR*sizeof(uint8_t));
+	uint8_t *bitStream = malloc(10*FRAMES_NBR*sizeof(uint8_t));
+	uint8_t *referenceBitStream = malloc(10*FRAMES_NBR*sizeof(uint8_t));
+	int bitStreamSize = 0;
+	int mismatchNbr = 0;
+	clock_t start;
+	double packTime, unpackTime, frameUnpackTime;
+
+	/*** random frames: mostly active ones ***/
+	srand(729);
+	memset(parameters, 0, FRAMES_NBR*sizeof(bcg729FrameParameters));
+	for (i=0; i<FRAMES_NBR; i++) {
+		int frameType = rand()%8;
+		if (frameType < 6) {
+			bitStreamLength[i] = 10;
+			parameters[i].L0 = randomField(1); parameters[i].L1 = randomField(7); parameters[i].L2 = randomField(5); parameters[i].L3 = randomField(5);
+			parameters[i].P1 = randomField(8); parameters[i].P0 = randomField(1); parameters[i].C1 = randomField(13); parameters[i].S1 = randomField(4);
+			parameters[i].GA1 = randomField(3); parameters[i].GB1 = randomField(4); parameters[i].P2 = randomField(5); parameters[i].C2 = randomField(13);
+			parameters[i].S2 = randomField(4); parameters[i].GA2 = randomField(3); parameters[i].GB2 = randomField(4);
+			referencePackActiveFrame(&(parameters[i]), &(referenceBitStream[bitStreamSize]));
+		} else if (frameType == 6) {
+			bitStreamLength[i] = 2;
+			parameters[i].L0 = randomField(1); parameters[i].L1 = randomField(5); parameters[i].L2 = randomField(4); parameters[i].gain = randomField(5);
+			referencePackSIDFrame(&(parameters[i]), &(referenceBitStream[bitStreamSize]));
+		} else {
+			bitStreamLength[i] = 0;
+		}
+		bitStreamSize += bitStreamLength[i];
+	}
+
+	/*** pack ***/
+	start = clock();
+	for (loop=0; loop<LOOPS_NBR; loop++) {
+		if (bcg729PackFrames(parameters, bitStreamLength, FRAMES_NBR, bitStream) != FRAMES_NBR) {
+			printf("%s - Error: packing stopped early\n", argv[0]);
+			exit(-1);
+		}
+	}
+	packTime = (double)(clock() - start);
+	if (memcmp(bitStream, referenceBitStream, bitStreamSize) != 0) {
+		printf("  packed bitstream differs from reference\n");
+		mismatchNbr++;
+	}
+
+	/*** unpack ***/
+	start = clock();
+	for (loop=0; loop<LOOPS_NBR; loop++) {
+		if (bcg729UnpackFrames(bitStream, bitStreamLength, FRAMES_NBR, unpackedParameters) != FRAMES_NBR) {
+			printf("%s - Error: unpacking stopped early\n", argv[0]);
+			exit(-1);
+		}
+	}
+	unpackTime = (double)(clock() - start);
+	if (memcmp(parameters, unpackedParameters, FRAMES_NBR*sizeof(bcg729FrameParameters)) != 0) {
+		printf("  unpacked parameters differ from packed ones\n");
+		mismatchNbr++;
+	}
+
+	/*** frame by frame unpacking gives the same result ***/
+	start = clock();
+	for (loop=0; loop<LOOPS_NBR; loop++) {
+		int offset = 0;
+		for (i=0; i<FRAMES_NBR; i++) {
+			bcg729UnpackFrame(&(bitStream[offset]), bitStreamLength[i], &(unpackedParameters[i]));
+			offset += bitStreamLength[i];
+		}
+	}
+	frameUnpackTime = (double)(clock() - start);
+	if (memcmp(parameters, unpackedParameters, FRAMES_NBR*sizeof(bcg729FrameParameters)) != 0) {
+		printf("  frame by frame unpacked parameters differ from packed ones\n");
+		mismatchNbr++;
+	}
+
+	/*** invalid frame length stops the batch ***/
+	bitStreamLength[FRAMES_NBR/2] = 5;
+	if (bcg729UnpackFrames(bitStream, bitStreamLength, FRAMES_NBR, unpackedParameters) != FRAMES_NBR/2
+		|| bcg729PackFrames(parameters, bitStreamLength, FRAMES_NBR, bitStream) != FRAMES_NBR/2) {
+		printf("  invalid frame length not detected\n");
+		mismatchNbr++;
+	}
+
+	printf("%d frames\n  pack  : %f ns/frame\n  unpack: %f ns/frame (frame by frame %f ns/frame)\n  mismatches: %d\n", FRAMES_NBR,
+		packTime*1000000000/CLOCKS_PER_SEC/FRAMES_NBR/LOOPS_NBR, unpackTime*1000000000/CLOCKS_PER_SEC/FRAMES_NBR/LOOPS_NBR, frameUnpackTime*1000000000/CLOCKS_PER_SEC/FRAMES_NBR/LOOPS_NBR, mismatchNbr);
+
+	free(parameters);
+	free(unpackedParameters);
+	free(bitStreamLength);
+	free(bitStream);
+	free(referenceBitStream);
+	exit ((mismatchNbr==0)?0:-1);
+}
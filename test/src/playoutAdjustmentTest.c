@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for playout adjustment during comfort noise                  */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The input is encoded with VAD/DTX enabled and decoded while            */
+/*    compensating a +/-1000 ppm clock drift with bcg729DecoderAdjustPlayout */
+/*    Ouput: on stdout, the number of adjusted frames and the remaining      */
+/*           drift, which must stay within MAX_RESIDUAL_DRIFT samples. When  */
+/*           shrinking, the decoder state is not modified: the frames not    */
+/*           adjusted must be identical to the reference ones                */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "utils.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+
+#define DRIFT_PPM 1000
+#define MAX_ADJUSTMENT 20 /* in samples, by frame */
+#define MAX_RESIDUAL_DRIFT 40 /* in samples, drift accumulated during speech and not yet compensated */
+
+int main(int argc, char *argv[] )
+{
+	int i, direction;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int framesNbr = 0, framesAllocated = 0;
+	int16_t *input = NULL, *reference;
+	uint8_t *bitStreams;
+	uint8_t *bitStreamLengths;
+	int16_t output[2*L_FRAME];
+	int mismatchNbr = 0, errorNbr = 0;
+	clock_t start;
+	double referenceTime;
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	/*** load the whole input file ***/
+	while (1) {
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			input = realloc(input, framesAllocated*L_FRAME*sizeof(int16_t));
+		}
+		if (inputIsBinary) {
+			if (fread(&(input[framesNbr*L_FRAME]), sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(input[framesNbr*L_FRAME])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(input[framesNbr*L_FRAME+i])) != 1) break;
+			}
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	reference = malloc(framesNbr*L_FRAME*sizeof(int16_t));
+	bitStreams = malloc(framesNbr*10*sizeof(uint8_t));
+	bitStreamLengths = malloc(framesNbr*sizeof(uint8_t));
+
+	/*** encode with VAD and decode the reference ***/
+	{
+		bcg729EncoderChannelContextStruct *encoderChannelContext = initBcg729EncoderChannel(1);
+		bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+		for (i=0; i<framesNbr; i++) {
+			bcg729Encoder(encoderChannelContext, &(input[i*L_FRAME]), &(bitStreams[i*10]), &(bitStreamLengths[i]));
+		}
+		start = clock();
+		for (i=0; i<framesNbr; i++) {
+			bcg729Decoder(decoderChannelContext, (bitStreamLengths[i]==0)?NULL:&(bitStreams[i*10]), bitStreamLengths[i], 0, (bitStreamLengths[i]==10)?0:1, 0, &(reference[i*L_FRAME]));
+		}
+		referenceTime = (double)(clock() - start);
+		closeBcg729EncoderChannel(encoderChannelContext);
+		closeBcg729DecoderChannel(decoderChannelContext);
+	}
+
+	printf("%s: %d frames\n", filePrefix, framesNbr);
+
+	/*** consumer clock faster(stretch) then slower(shrink) than the producer one ***/
+	for (direction=1; direction>=-1; direction-=2) {
+		bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+		int64_t outputLength = 0, expectedLength = 0;
+		int64_t drift = 0; /* in samples in Q20 */
+		int adjustedFramesNbr = 0;
+		double adjustTime;
+
+		start = clock();
+		for (i=0; i<framesNbr; i++) {
+			int16_t adjustment;
+			uint16_t outputFrameLength;
+
+			drift += (int64_t)direction*L_FRAME*DRIFT_PPM*(1<<20)/1000000;
+			adjustment = (int16_t)(drift/(1<<20)) - (int16_t)(outputLength - (int64_t)i*L_FRAME);
+			if (adjustment > MAX_ADJUSTMENT) adjustment = MAX_ADJUSTMENT;
+			if (adjustment < -MAX_ADJUSTMENT) adjustment = -MAX_ADJUSTMENT;
+
+			outputFrameLength = bcg729DecoderAdjustPlayout(decoderChannelContext, (bitStreamLengths[i]==0)?NULL:&(bitStreams[i*10]), bitStreamLengths[i], 0, (bitStreamLengths[i]==10)?0:1, 0, adjustment, output);
+			outputLength += outputFrameLength;
+			if (outputFrameLength != L_FRAME) {
+				adjustedFramesNbr++;
+			} else if (direction < 0 && memcmp(output, &(reference[i*L_FRAME]), L_FRAME*sizeof(int16_t)) != 0) {
+				mismatchNbr++;
+			}
+		}
+		adjustTime = (double)(clock() - start);
+		expectedLength = (int64_t)framesNbr*L_FRAME + drift/(1<<20);
+
+		if (adjustedFramesNbr == 0 || outputLength > expectedLength + MAX_RESIDUAL_DRIFT || outputLength < expectedLength - MAX_RESIDUAL_DRIFT) {
+			errorNbr++;
+		}
+
+		printf("  %+d ppm: %d frames adjusted, output %lld samples for %lld expected, time x%.3f\n", direction*DRIFT_PPM, adjustedFramesNbr, (long long)outputLength, (long long)expectedLength, adjustTime/referenceTime);
+		closeBcg729DecoderChannel(decoderChannelContext);
+	}
+	printf("  frames not adjusted differing from reference when shrinking: %d\n", mismatchNbr);
+	printf("  errors: %d\n", errorNbr);
+
+	free(input);
+	free(reference);
+	free(bitStreams);
+	free(bitStreamLengths);
+	exit ((mismatchNbr==0 && errorNbr==0)?0:-1);
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for recording container random access                        */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The input is encoded with VAD/DTX enabled, some frames are marked as   */
+/*    erased, and recorded with a checkpoint every 5 seconds                 */
+/*    Ouput: on stdout, the container overhead, the seek time and the number */
+/*           of frames differing from a decoding from the beginning after    */
+/*           random seeks and in segments decoded by concurrent readers      */
+/*           (must be 0)                                                     */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "utils.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+#include "bcg729/recording.h"
+
+#define CHECKPOINT_INTERVAL 500 /* 5 seconds */
+#define ERASED_FRAMES_PERIOD 53
+#define SEEKS_NBR 200
+#define SEEK_READ_FRAMES 20
+#define READERS_NBR 4
+
+int main(int argc, char *argv[] )
+{
+	int i, j;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int framesNbr = 0, framesAllocated = 0;
+	int16_t *input = NULL, *reference, *output;
+	uint8_t *bitStreams;
+	uint8_t *bitStreamLengths;
+	uint8_t *recording;
+	uint32_t recordingSize, bitStreamsSize = 0;
+	int mismatchNbr = 0;
+	uint32_t seed = 12345;
+	clock_t start;
+	double referenceTime, seekTime = 0.0;
+
+	bcg729RecordingWriterStruct *recordingWriter;
+	bcg729RecordingReaderStruct *recordingReaders[READERS_NBR];
+	bcg729DecoderChannelContextStruct *decoderChannelContexts[READERS_NBR];
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	/*** load the whole input file ***/
+	while (1) {
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			input = realloc(input, framesAllocated*L_FRAME*sizeof(int16_t));
+		}
+		if (inputIsBinary) {
+			if (fread(&(input[framesNbr*L_FRAME]), sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(input[framesNbr*L_FRAME])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(input[framesNbr*L_FRAME+i])) != 1) break;
+			}
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	reference = malloc(framesNbr*L_FRAME*sizeof(int16_t));
+	output = malloc(framesNbr*L_FRAME*sizeof(int16_t));
+	bitStreams = malloc(framesNbr*10*sizeof(uint8_t));
+	bitStreamLengths = malloc(framesNbr*sizeof(uint8_t));
+
+	/*** encode with VAD, record and decode the reference ***/
+	{
+		bcg729EncoderChannelContextStruct *encoderChannelContext = initBcg729EncoderChannel(1);
+		bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+		recordingWriter = initBcg729RecordingWriter(CHECKPOINT_INTERVAL);
+		for (i=0; i<framesNbr; i++) {
+			uint8_t erased = (i%ERASED_FRAMES_PERIOD == ERASED_FRAMES_PERIOD-1)?1:0;
+			bcg729Encoder(encoderChannelContext, &(input[i*L_FRAME]), &(bitStreams[i*10]), &(bitStreamLengths[i]));
+			bitStreamsSize += erased?0:bitStreamLengths[i];
+			if (bcg729RecordingWriterAddFrame(recordingWriter, &(bitStreams[i*10]), bitStreamLengths[i], erased) == BCG729_FRAME_TYPE_INVALID) {
+				printf("%s - Error: frame %d not recorded\n", argv[0], i);
+				exit(-1);
+			}
+		}
+		start = clock();
+		for (i=0; i<framesNbr; i++) {
+			if (i%ERASED_FRAMES_PERIOD == ERASED_FRAMES_PERIOD-1) {
+				bcg729Decoder(decoderChannelContext, NULL, 0, 1, 0, 0, &(reference[i*L_FRAME]));
+			} else {
+				bcg729Decoder(decoderChannelContext, (bitStreamLengths[i]==0)?NULL:&(bitStreams[i*10]), bitStreamLengths[i], 0, (bitStreamLengths[i]==10)?0:1, 0, &(reference[i*L_FRAME]));
+			}
+		}
+		referenceTime = (double)(clock() - start);
+		closeBcg729EncoderChannel(encoderChannelContext);
+		closeBcg729DecoderChannel(decoderChannelContext);
+	}
+
+	recordingSize = bcg729GetRecordingSize(recordingWriter);
+	recording = malloc(recordingSize*sizeof(uint8_t));
+	bcg729WriteRecording(recordingWriter, recording);
+	closeBcg729RecordingWriter(recordingWriter);
+
+	for (j=0; j<READERS_NBR; j++) {
+		decoderChannelContexts[j] = initBcg729DecoderChannel();
+		recordingReaders[j] = initBcg729RecordingReader(recording, recordingSize, decoderChannelContexts[j]);
+		if (recordingReaders[j] == NULL || bcg729GetRecordingFramesNbr(recordingReaders[j]) != (uint32_t)framesNbr) {
+			printf("%s - Error: invalid recording\n", argv[0]);
+			exit(-1);
+		}
+	}
+
+	/*** read the whole recording ***/
+	if (bcg729RecordingRead(recordingReaders[0], framesNbr, output) != (uint32_t)framesNbr) {
+		mismatchNbr++;
+	}
+	for (i=0; i<framesNbr; i++) {
+		if (memcmp(&(output[i*L_FRAME]), &(reference[i*L_FRAME]), L_FRAME*sizeof(int16_t)) != 0) {
+			mismatchNbr++;
+		}
+	}
+
+	/*** random seeks ***/
+	for (j=0; j<SEEKS_NBR; j++) {
+		uint32_t frameIndex, readFramesNbr;
+		seed = seed*1103515245 + 12345;
+		frameIndex = (seed>>8)%framesNbr;
+		start = clock();
+		if (bcg729RecordingSeek(recordingReaders[0], frameIndex) != frameIndex) {
+			mismatchNbr++;
+			continue;
+		}
+		seekTime += (double)(clock() - start);
+		readFramesNbr = bcg729RecordingRead(recordingReaders[0], SEEK_READ_FRAMES, output);
+		for (i=0; i<(int)readFramesNbr; i++) {
+			if (memcmp(&(output[i*L_FRAME]), &(reference[(frameIndex+i)*L_FRAME]), L_FRAME*sizeof(int16_t)) != 0) {
+				mismatchNbr++;
+			}
+		}
+	}
+
+	/*** segments decoded by concurrent readers, interleaved ***/
+	{
+		int segmentLength = (framesNbr + READERS_NBR - 1)/READERS_NBR;
+		for (j=0; j<READERS_NBR; j++) {
+			bcg729RecordingSeek(recordingReaders[j], j*segmentLength);
+		}
+		for (i=0; i<segmentLength; i++) {
+			for (j=0; j<READERS_NBR; j++) {
+				if (j*segmentLength+i < framesNbr) {
+					bcg729RecordingRead(recordingReaders[j], 1, &(output[(j*segmentLength+i)*L_FRAME]));
+				}
+			}
+		}
+		if (memcmp(output, reference, framesNbr*L_FRAME*sizeof(int16_t)) != 0) {
+			mismatchNbr++;
+		}
+	}
+
+	for (j=0; j<READERS_NBR; j++) {
+		closeBcg729RecordingReader(recordingReaders[j]);
+		closeBcg729DecoderChannel(decoderChannelContexts[j]);
+	}
+
+	/*** invalid containers are rejected ***/
+	recording[0] ^= 0xFF;
+	if (initBcg729RecordingReader(recording, recordingSize, decoderChannelContexts[0]) != NULL) {
+		mismatchNbr++;
+	}
+	recording[0] ^= 0xFF;
+	if (initBcg729RecordingReader(recording, RECORDING_HEADER_SIZE, decoderChannelContexts[0]) != NULL) {
+		mismatchNbr++;
+	}
+
+	printf("%s: %d frames, %u bytes of payload, container %u bytes(+%.1f%%)\n", filePrefix, framesNbr, bitStreamsSize, recordingSize, 100.0*(recordingSize-bitStreamsSize)/bitStreamsSize);
+	printf("  seek: %f ms average, decoding from the beginning: %f ms average\n", seekTime*1000/CLOCKS_PER_SEC/SEEKS_NBR, referenceTime*1000/CLOCKS_PER_SEC/2);
+	printf("  frames differing from reference: %d\n", mismatchNbr);
+
+	free(input);
+	free(reference);
+	free(output);
+	free(bitStreams);
+	free(bitStreamLengths);
+	free(recording);
+	exit ((mismatchNbr==0)?0:-1);
+}
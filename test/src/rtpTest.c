@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for RTP payload packetizer/depacketizer                      */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The input is encoded with VAD/DTX enabled and decoded frame by frame,  */
+/*    then encoded in RTP payloads of up to 1 to 4 frames and decoded from   */
+/*    the payloads                                                           */
+/*    Ouput: on stdout, the number of packets and the number of payload      */
+/*           sizes for which the decoded signal differs from the frame by    */
+/*           frame one (must be 0)                                           */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "utils.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+#include "bcg729/rtp.h"
+
+#define RTP_HEADER_LENGTH 12
+#define MAX_FRAMES_PER_PACKET 4
+
+int main(int argc, char *argv[] )
+{
+	int i;
+	uint16_t framesPerPacket;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int framesNbr = 0, framesAllocated = 0;
+	int16_t *input = NULL, *reference, *output;
+	uint8_t packet[RTP_HEADER_LENGTH + 10*MAX_FRAMES_PER_PACKET];
+	int mismatchNbr = 0;
+
+	/*** check the payload length parsing ***/
+	for (i=0; i<=25; i++) {
+		uint16_t expectedFramesNbr = (i%10==0)?i/10:((i%10==2)?i/10+1:0);
+		if (bcg729GetRTPPayloadFramesNbr(i) != expectedFramesNbr) {
+			printf("%s - Error: payload length %d gives %d frames\n", argv[0], i, bcg729GetRTPPayloadFramesNbr(i));
+			exit(-1);
+		}
+	}
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	/*** load the whole input file ***/
+	while (1) {
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			input = realloc(input, framesAllocated*L_FRAME*sizeof(int16_t));
+		}
+		if (inputIsBinary) {
+			if (fread(&(input[framesNbr*L_FRAME]), sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(input[framesNbr*L_FRAME])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(input[framesNbr*L_FRAME+i])) != 1) break;
+			}
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	reference = malloc(framesNbr*L_FRAME*sizeof(int16_t));
+	output = malloc(framesNbr*L_FRAME*sizeof(int16_t));
+
+	/*** reference: frame by frame ***/
+	{
+		bcg729EncoderChannelContextStruct *encoderChannelContext = initBcg729EncoderChannel(1);
+		bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+		for (i=0; i<framesNbr; i++) {
+			uint8_t bitStream[10];
+			uint8_t bitStreamLength;
+			bcg729Encoder(encoderChannelContext, &(input[i*L_FRAME]), bitStream, &bitStreamLength);
+			bcg729Decoder(decoderChannelContext, (bitStreamLength==0)?NULL:bitStream, bitStreamLength, 0, (bitStreamLength==10)?0:1, 0, &(reference[i*L_FRAME])); /* untransmitted frames are decoded from a NULL bitStream */
+		}
+		closeBcg729EncoderChannel(encoderChannelContext);
+		closeBcg729DecoderChannel(decoderChannelContext);
+	}
+
+	/*** RTP payloads ***/
+	for (framesPerPacket=1; framesPerPacket<=MAX_FRAMES_PER_PACKET; framesPerPacket++) {
+		bcg729EncoderChannelContextStruct *encoderChannelContext = initBcg729EncoderChannel(1);
+		bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+		int frameIndex = 0; /* the sender timestamp, in frames */
+		int decodedFrameIndex = 0; /* the receiver timestamp, in frames */
+		int packetsNbr = 0;
+
+		while (frameIndex < framesNbr) {
+			uint16_t payloadFirstFrame, framesConsumed, payloadLength;
+			uint16_t packetFramesNbr = (framesNbr - frameIndex < framesPerPacket)?(uint16_t)(framesNbr - frameIndex):framesPerPacket;
+
+			memset(packet, 0xAA, RTP_HEADER_LENGTH); /* the RTP header */
+			payloadLength = bcg729EncodeRTPPayload(encoderChannelContext, &(input[frameIndex*L_FRAME]), packetFramesNbr, packet, RTP_HEADER_LENGTH, &payloadFirstFrame, &framesConsumed);
+			for (i=0; i<RTP_HEADER_LENGTH; i++) {
+				if (packet[i] != 0xAA) {
+					printf("%s - Error: RTP header overwritten\n", argv[0]);
+					exit(-1);
+				}
+			}
+
+			if (payloadLength > 0) {
+				/* receiver: frames between the last received one and the packet timestamp are untransmitted */
+				for (; decodedFrameIndex < frameIndex + payloadFirstFrame; decodedFrameIndex++) {
+					bcg729Decoder(decoderChannelContext, NULL, 0, 0, 1, 0, &(output[decodedFrameIndex*L_FRAME]));
+				}
+				decodedFrameIndex += bcg729DecodeRTPPayload(decoderChannelContext, &(packet[RTP_HEADER_LENGTH]), payloadLength, &(output[decodedFrameIndex*L_FRAME]));
+				packetsNbr++;
+			}
+			frameIndex += framesConsumed;
+		}
+		for (; decodedFrameIndex < framesNbr; decodedFrameIndex++) {
+			bcg729Decoder(decoderChannelContext, NULL, 0, 0, 1, 0, &(output[decodedFrameIndex*L_FRAME]));
+		}
+		closeBcg729EncoderChannel(encoderChannelContext);
+		closeBcg729DecoderChannel(decoderChannelContext);
+
+		if (memcmp(output, reference, framesNbr*L_FRAME*sizeof(int16_t)) != 0) {
+			for (i=0; i<framesNbr*L_FRAME && output[i]==reference[i]; i++);
+			printf("  %d frames per packet: decoded signal mismatch at frame %d\n", framesPerPacket, i/L_FRAME);
+			mismatchNbr++;
+		}
+		printf("%s: %d frames per packet, %d packets\n", filePrefix, framesPerPacket, packetsNbr);
+	}
+
+	free(input);
+	free(reference);
+	free(output);
+	exit ((mismatchNbr==0)?0:-1);
+}
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for strided(interleaved) encoder input and decoder output    */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The input is processed on 8 channels, each one starting at a different */
+/*    frame, interleaved in a buffer holding one more unused slot per sample */
+/*    period. In each input and output format:                               */
+/*      - bcg729EncoderStrided reads the interleaved buffer, its bitstreams  */
+/*        must be the bcg729EncoderFormatted ones on the contiguous frames   */
+/*      - bcg729DecoderStrided writes the interleaved buffer, its samples    */
+/*        must be the bcg729DecoderFormatted ones and the unused slot left   */
+/*        untouched                                                          */
+/*    Ouput: on stdout, for each format the processing times and the number  */
+/*           of differing frames(must be 0)                                  */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+
+#define CHANNELS_NBR 8
+#define STRIDE (CHANNELS_NBR+1) /* one unused slot per sample period, it must be left untouched by the decoder */
+#define CHANNEL_OFFSET 37 /* in frames, first frame processed by each channel */
+#define MAX_FRAMES_NBR 1000 /* limit the frames processed in each format */
+#define MAX_FACTOR 6 /* 48kHz */
+#define GUARD 0xA5
+
+#define INPUT_FORMATS_NBR 8
+static const char *inputFormatsName[INPUT_FORMATS_NBR] = {"PCM16", "float", "mu-law", "A-law", "PCM16 16kHz", "PCM16 48kHz", "float 16kHz", "float 48kHz"};
+static const int inputFormatsFactor[INPUT_FORMATS_NBR] = {1, 1, 1, 1, 2, 6, 2, 6};
+static const int inputFormatsSampleSize[INPUT_FORMATS_NBR] = {2, 4, 1, 1, 2, 2, 4, 4};
+
+#define OUTPUT_FORMATS_NBR 6
+static const char *outputFormatsName[OUTPUT_FORMATS_NBR] = {"PCM16", "float", "mu-law", "A-law", "PCM16 16kHz", "PCM16 48kHz"};
+static const int outputFormatsFactor[OUTPUT_FORMATS_NBR] = {1, 1, 1, 1, 2, 6};
+static const int outputFormatsSampleSize[OUTPUT_FORMATS_NBR] = {2, 4, 1, 1, 2, 2};
+
+/* write sample n of a frame in the input format: higher rates repeat the 8kHz samples, any byte being a valid G711 code the sample high byte is used */
+static void writeInputSample(int format, int16_t sample, uint8_t *output)
+{
+	float floatSample = (float)sample/32768.0f;
+	uint8_t code = (uint8_t)(sample>>8);
+
+	switch (inputFormatsSampleSize[format]) {
+		case 4:
+			memcpy(output, &floatSample, 4);
+			break;
+		case 1:
+			*output = code;
+			break;
+		default:
+			memcpy(output, &sample, 2);
+			break;
+	}
+}
+
+int main(int argc, char *argv[] )
+{
+	int i, j, k, format;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int framesNbr = 0, framesAllocated = 0;
+	int16_t *input = NULL;
+	uint8_t contiguous[CHANNELS_NBR][L_FRAME*MAX_FACTOR*4];
+	uint8_t interleaved[L_FRAME*MAX_FACTOR*STRIDE*4];
+	uint8_t bitStream[CHANNELS_NBR][10], referenceBitStream[10], bitStreamLength[CHANNELS_NBR], referenceBitStreamLength;
+	int differingFramesNbr = 0;
+	clock_t start;
+	double referenceTime, stridedTime;
+
+	bcg729EncoderChannelContextStruct *referenceEncoderChannelContexts[CHANNELS_NBR], *encoderChannelContexts[CHANNELS_NBR];
+	bcg729DecoderChannelContextStruct *referenceDecoderChannelContexts[CHANNELS_NBR], *decoderChannelContexts[CHANNELS_NBR];
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	/*** load the whole input file ***/
+	while (1) {
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			input = realloc(input, framesAllocated*L_FRAME*sizeof(int16_t));
+		}
+		if (inputIsBinary) {
+			if (fread(&(input[framesNbr*L_FRAME]), sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(input[framesNbr*L_FRAME])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(input[framesNbr*L_FRAME+i])) != 1) break;
+			}
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+	printf("%s: %d channels of %d frames, interleaved with a stride of %d\n", filePrefix, CHANNELS_NBR, (framesNbr<MAX_FRAMES_NBR)?framesNbr:MAX_FRAMES_NBR, STRIDE);
+
+	/*** encoder: strided input against contiguous frames ***/
+	for (format=0; format<INPUT_FORMATS_NBR; format++) {
+		int factor = inputFormatsFactor[format];
+		int sampleSize = inputFormatsSampleSize[format];
+		int formatDifferingFramesNbr = 0;
+		referenceTime = 0.0;
+		stridedTime = 0.0;
+
+		for (j=0; j<CHANNELS_NBR; j++) {
+			referenceEncoderChannelContexts[j] = initBcg729EncoderChannel(1);
+			encoderChannelContexts[j] = initBcg729EncoderChannel(1);
+			bcg729SetEncoderInputFormat(referenceEncoderChannelContexts[j], (uint8_t)format);
+			bcg729SetEncoderInputFormat(encoderChannelContexts[j], (uint8_t)format);
+		}
+		for (i=0; i<framesNbr && i<MAX_FRAMES_NBR; i++) {
+			/* build the contiguous frames and the interleaved buffer */
+			for (j=0; j<CHANNELS_NBR; j++) {
+				const int16_t *frame = &(input[((i + j*CHANNEL_OFFSET)%framesNbr)*L_FRAME]);
+				for (k=0; k<L_FRAME*factor; k++) {
+					writeInputSample(format, frame[k/factor], &(contiguous[j][k*sampleSize]));
+					writeInputSample(format, frame[k/factor], &(interleaved[(k*STRIDE+j)*sampleSize]));
+				}
+			}
+			for (j=0; j<CHANNELS_NBR; j++) {
+				start = clock();
+				bcg729EncoderFormatted(referenceEncoderChannelContexts[j], contiguous[j], referenceBitStream, &referenceBitStreamLength);
+				referenceTime += ((double) (clock() - start));
+				start = clock();
+				bcg729EncoderStrided(encoderChannelContexts[j], &(interleaved[j*sampleSize]), STRIDE, bitStream[j], &(bitStreamLength[j]));
+				stridedTime += ((double) (clock() - start));
+				if (bitStreamLength[j] != referenceBitStreamLength || memcmp(bitStream[j], referenceBitStream, referenceBitStreamLength) != 0) {
+					formatDifferingFramesNbr++;
+				}
+			}
+		}
+		for (j=0; j<CHANNELS_NBR; j++) {
+			closeBcg729EncoderChannel(referenceEncoderChannelContexts[j]);
+			closeBcg729EncoderChannel(encoderChannelContexts[j]);
+		}
+		printf("  encoder %-11s: contiguous %f us/frame, strided %f us/frame, %d frames differing\n", inputFormatsName[format], referenceTime*1000000/CLOCKS_PER_SEC/(CHANNELS_NBR*i), stridedTime*1000000/CLOCKS_PER_SEC/(CHANNELS_NBR*i), formatDifferingFramesNbr);
+		differingFramesNbr += formatDifferingFramesNbr;
+	}
+
+	/*** decoder: strided output against contiguous frames ***/
+	for (format=0; format<OUTPUT_FORMATS_NBR; format++) {
+		int sampleSize = outputFormatsSampleSize[format];
+		int frameSamplesNbr = L_FRAME*outputFormatsFactor[format];
+		int formatDifferingFramesNbr = 0;
+		referenceTime = 0.0;
+		stridedTime = 0.0;
+
+		for (j=0; j<CHANNELS_NBR; j++) {
+			encoderChannelContexts[j] = initBcg729EncoderChannel(1);
+			referenceDecoderChannelContexts[j] = initBcg729DecoderChannel();
+			decoderChannelContexts[j] = initBcg729DecoderChannel();
+			bcg729SetDecoderOutputFormat(referenceDecoderChannelContexts[j], (uint8_t)format);
+			bcg729SetDecoderOutputFormat(decoderChannelContexts[j], (uint8_t)format);
+		}
+		for (i=0; i<framesNbr && i<MAX_FRAMES_NBR; i++) {
+			int frameDiffers = 0;
+			memset(interleaved, GUARD, (size_t)frameSamplesNbr*STRIDE*sampleSize);
+			for (j=0; j<CHANNELS_NBR; j++) {
+				bcg729Encoder(encoderChannelContexts[j], &(input[((i + j*CHANNEL_OFFSET)%framesNbr)*L_FRAME]), bitStream[j], &(bitStreamLength[j]));
+				start = clock();
+				bcg729DecoderFormatted(referenceDecoderChannelContexts[j], bitStream[j], bitStreamLength[j], 0, (bitStreamLength[j]==10)?0:1, 0, contiguous[j]);
+				referenceTime += ((double) (clock() - start));
+				start = clock();
+				bcg729DecoderStrided(decoderChannelContexts[j], bitStream[j], bitStreamLength[j], 0, (bitStreamLength[j]==10)?0:1, 0, &(interleaved[j*sampleSize]), STRIDE);
+				stridedTime += ((double) (clock() - start));
+			}
+			/* check every channel samples and the unused slot */
+			for (j=0; j<CHANNELS_NBR; j++) {
+				frameDiffers = 0;
+				for (k=0; k<frameSamplesNbr; k++) {
+					if (memcmp(&(interleaved[(k*STRIDE+j)*sampleSize]), &(contiguous[j][k*sampleSize]), sampleSize) != 0) {
+						frameDiffers = 1;
+					}
+				}
+				formatDifferingFramesNbr += frameDiffers;
+			}
+			for (k=0; k<frameSamplesNbr*sampleSize; k++) {
+				if (interleaved[((k/sampleSize)*STRIDE+CHANNELS_NBR)*sampleSize + k%sampleSize] != GUARD) {
+					formatDifferingFramesNbr++;
+					break;
+				}
+			}
+		}
+		for (j=0; j<CHANNELS_NBR; j++) {
+			closeBcg729EncoderChannel(encoderChannelContexts[j]);
+			closeBcg729DecoderChannel(referenceDecoderChannelContexts[j]);
+			closeBcg729DecoderChannel(decoderChannelContexts[j]);
+		}
+		printf("  decoder %-11s: contiguous %f us/frame, strided %f us/frame, %d frames differing\n", outputFormatsName[format], referenceTime*1000000/CLOCKS_PER_SEC/(CHANNELS_NBR*i), stridedTime*1000000/CLOCKS_PER_SEC/(CHANNELS_NBR*i), formatDifferingFramesNbr);
+		differingFramesNbr += formatDifferingFramesNbr;
+	}
+
+	free(input);
+	exit ((differingFramesNbr==0)?0:-1);
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for tandem encoding with encoder hints                       */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The input is encoded and decoded, then the decoded signal is encoded   */
+/*    again with and without the hints given by the decoder                  */
+/*    Ouput: on stdout, the second encoding times and the SNR of the second  */
+/*           generation decoded signals against the first generation one     */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <math.h>
+#include <time.h>
+
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "utils.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+
+/* maximum SNR loss allowed when using the hints, in dB */
+#define MAX_HINTS_SNR_LOSS 0.5
+
+/* encode a signal and decode it, the hints are used by the encoder when given and retrieved from the decoder when requested */
+static double tandem(int16_t *input, int framesNbr, bcg729EncoderHints *inputHints, bcg729EncoderHints *outputHints, int16_t *output)
+{
+	int i;
+	uint8_t bitStream[10];
+	uint8_t bitStreamLength;
+	clock_t start;
+	double encoderTime = 0.0;
+	bcg729EncoderChannelContextStruct *encoderChannelContext = initBcg729EncoderChannel(0);
+	bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+
+	for (i=0; i<framesNbr; i++) {
+		start = clock();
+		if (inputHints != NULL) {
+			bcg729SetEncoderHints(encoderChannelContext, &(inputHints[i]));
+		}
+		bcg729Encoder(encoderChannelContext, &(input[i*L_FRAME]), bitStream, &bitStreamLength);
+		encoderTime += ((double) (clock() - start));
+
+		bcg729Decoder(decoderChannelContext, bitStream, bitStreamLength, 0, 0, 0, &(output[i*L_FRAME]));
+		if (outputHints != NULL) {
+			bcg729GetEncoderHints(decoderChannelContext, &(outputHints[i]));
+		}
+	}
+
+	closeBcg729EncoderChannel(encoderChannelContext);
+	closeBcg729DecoderChannel(decoderChannelContext);
+	return encoderTime;
+}
+
+/* SNR of signal against reference: the encoder lookahead delays the signal by a subframe */
+static double computeSNR(int16_t *reference, int16_t *signal, int framesNbr)
+{
+	int i;
+	double signalEnergy = 0.0, noiseEnergy = 0.0;
+
+	for (i=L_SUBFRAME; i<framesNbr*L_FRAME; i++) {
+		double diff = (double)signal[i] - (double)reference[i-L_SUBFRAME];
+		signalEnergy += (double)reference[i-L_SUBFRAME]*(double)reference[i-L_SUBFRAME];
+		noiseEnergy += diff*diff;
+	}
+	return 10.0*log10((signalEnergy+1.0)/(noiseEnergy+1.0));
+}
+
+int main(int argc, char *argv[] )
+{
+	int i;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int framesNbr = 0, framesAllocated = 0;
+	int16_t *input = NULL, *firstGeneration, *secondGeneration, *secondGenerationHints;
+	bcg729EncoderHints *hints;
+	double encoderTime, encoderHintsTime, SNR, SNRHints;
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	/*** load the whole input file ***/
+	while (1) {
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			input = realloc(input, framesAllocated*L_FRAME*sizeof(int16_t));
+		}
+		if (inputIsBinary) {
+			if (fread(&(input[framesNbr*L_FRAME]), sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(input[framesNbr*L_FRAME])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(input[framesNbr*L_FRAME+i])) != 1) break;
+			}
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	firstGeneration = malloc(framesNbr*L_FRAME*sizeof(int16_t));
+	secondGeneration = malloc(framesNbr*L_FRAME*sizeof(int16_t));
+	secondGenerationHints = malloc(framesNbr*L_FRAME*sizeof(int16_t));
+	hints = malloc(framesNbr*sizeof(bcg729EncoderHints));
+
+	/*** first generation: get the decoded signal and the hints ***/
+	tandem(input, framesNbr, NULL, hints, firstGeneration);
+
+	/*** second generation with and without hints ***/
+	encoderTime = tandem(firstGeneration, framesNbr, NULL, NULL, secondGeneration);
+	encoderHintsTime = tandem(firstGeneration, framesNbr, hints, NULL, secondGenerationHints);
+	SNR = computeSNR(firstGeneration, secondGeneration, framesNbr);
+	SNRHints = computeSNR(firstGeneration, secondGenerationHints, framesNbr);
+
+	printf("%s: %d frames\n  tandem encoder         : %f us/frame, SNR %.2f dB\n  tandem encoder hinted  : %f us/frame (x%.2f), SNR %.2f dB\n", filePrefix, framesNbr,
+		encoderTime*1000000/CLOCKS_PER_SEC/framesNbr, SNR, encoderHintsTime*1000000/CLOCKS_PER_SEC/framesNbr, encoderTime/encoderHintsTime, SNRHints);
+
+	free(input);
+	free(firstGeneration);
+	free(secondGeneration);
+	free(secondGenerationHints);
+	free(hints);
+	exit ((SNRHints > SNR - MAX_HINTS_SNR_LOSS)?0:-1);
+}
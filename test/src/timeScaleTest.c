@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for pitch synchronous time scaling                           */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The input is encoded and decoded with bcg729DecoderTimeScale at x1,    */
+/*    x1.25, x1.5 and x2 speeds                                              */
+/*    Ouput: on stdout, the output length and decoding time for each speed.  */
+/*           At x1 the output must be the reference one, at other speeds its */
+/*           length must be within one pitch period of the expected one     */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+#include "utils.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+
+#define SPEEDS_NBR 4
+static const uint16_t speeds[SPEEDS_NBR] = {256, 320, 384, 512}; /* in Q8 */
+
+int main(int argc, char *argv[] )
+{
+	int i, j;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int framesNbr = 0, framesAllocated = 0;
+	int16_t *input = NULL, *reference, *output;
+	uint8_t *bitStreams;
+	uint8_t *bitStreamLengths;
+	int errorNbr = 0;
+	clock_t start;
+	double referenceTime;
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	/*** load the whole input file ***/
+	while (1) {
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			input = realloc(input, framesAllocated*L_FRAME*sizeof(int16_t));
+		}
+		if (inputIsBinary) {
+			if (fread(&(input[framesNbr*L_FRAME]), sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(input[framesNbr*L_FRAME])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(input[framesNbr*L_FRAME+i])) != 1) break;
+			}
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+
+	reference = malloc(framesNbr*L_FRAME*sizeof(int16_t));
+	output = malloc((framesNbr+1)*L_FRAME*sizeof(int16_t));
+	bitStreams = malloc(framesNbr*10*sizeof(uint8_t));
+	bitStreamLengths = malloc(framesNbr*sizeof(uint8_t));
+
+	/*** encode and decode the reference ***/
+	{
+		bcg729EncoderChannelContextStruct *encoderChannelContext = initBcg729EncoderChannel(0);
+		bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+		for (i=0; i<framesNbr; i++) {
+			bcg729Encoder(encoderChannelContext, &(input[i*L_FRAME]), &(bitStreams[i*10]), &(bitStreamLengths[i]));
+		}
+		start = clock();
+		for (i=0; i<framesNbr; i++) {
+			bcg729Decoder(decoderChannelContext, &(bitStreams[i*10]), bitStreamLengths[i], 0, 0, 0, &(reference[i*L_FRAME]));
+		}
+		referenceTime = (double)(clock() - start);
+		closeBcg729EncoderChannel(encoderChannelContext);
+		closeBcg729DecoderChannel(decoderChannelContext);
+	}
+
+	printf("%s: %d frames\n", filePrefix, framesNbr);
+
+	for (j=0; j<SPEEDS_NBR; j++) {
+		bcg729DecoderChannelContextStruct *decoderChannelContext = initBcg729DecoderChannel();
+		int64_t outputLength = 0, expectedLength;
+		uint16_t outputFrameLength;
+		double timeScaleTime;
+
+		start = clock();
+		for (i=0; i<framesNbr; i++) {
+			outputLength += bcg729DecoderTimeScale(decoderChannelContext, &(bitStreams[i*10]), bitStreamLengths[i], 0, 0, 0, speeds[j], &(output[outputLength]));
+		}
+		timeScaleTime = (double)(clock() - start);
+		while ((outputFrameLength = bcg729DecoderTimeScaleFlush(decoderChannelContext, &(output[outputLength]))) > 0) {
+			outputLength += outputFrameLength;
+		}
+		expectedLength = (int64_t)framesNbr*L_FRAME*256/speeds[j];
+
+		if (speeds[j] == 256) {
+			if (outputLength != (int64_t)framesNbr*L_FRAME || memcmp(output, reference, framesNbr*L_FRAME*sizeof(int16_t)) != 0) {
+				errorNbr++;
+			}
+		} else if (outputLength > expectedLength + MAXIMUM_INT_PITCH_DELAY || outputLength < expectedLength - MAXIMUM_INT_PITCH_DELAY) {
+			errorNbr++;
+		}
+
+		printf("  x%.2f: output %lld samples for %lld expected, time x%.3f\n", speeds[j]/256.0, (long long)outputLength, (long long)expectedLength, timeScaleTime/referenceTime);
+		closeBcg729DecoderChannel(decoderChannelContext);
+	}
+	printf("  errors: %d\n", errorNbr);
+
+	free(input);
+	free(reference);
+	free(output);
+	free(bitStreams);
+	free(bitStreamLengths);
+	exit ((errorNbr==0)?0:-1);
+}
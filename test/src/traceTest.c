@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for call traces capture and replay                           */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The signal is encoded and decoded on several traced channels: with and */
+/*    without VAD, with silence threshold and encoder hints, erased frames,  */
+/*    RFC3389 payloads, decoder mode changes, a decoder attached during the  */
+/*    stream and an untraced bcg729DecoderAdvance call, multichannel decoding*/
+/*    and an encoder attached after its first frames                         */
+/*    Ouput: on stdout, the trace size and records. The trace is replayed on */
+/*           new channels: bitstreams and decoded frames checksums must      */
+/*           match but on the encoder attached late, the records must be the */
+/*           ones expected, a truncated trace must end on its last complete  */
+/*           record and a trace with an invalid header must be rejected      */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+#include "bcg729/trace.h"
+
+#define ENCODERS_NBR 4
+#define MULTI_CHANNELS_NBR 3
+#define CHANNEL_ID_MAX 32
+#define ERASURE_PERIOD 17 /* one frame out of ERASURE_PERIOD is erased */
+#define LATE_ENCODER_FRAMES 10 /* frames encoded before the trace is attached to the last encoder */
+#define LATE_DECODER_FRAMES 100 /* frames decoded before the trace is attached to decoder 11 */
+#define ADVANCE_FRAME 150 /* the frame decoder 11 advances on without decoding */
+#define NO_POSTFILTER_START 200 /* decoder 11 mode is NO_POSTFILTER on [NO_POSTFILTER_START, NO_POSTFILTER_END[ */
+#define NO_POSTFILTER_END 300
+#define SILENCE_THRESHOLD 64
+
+/* trace output: in memory */
+typedef struct {
+	uint8_t *data;
+	uint32_t size;
+	uint32_t allocated;
+} traceBuffer;
+
+static void traceOutput(void *userData, const uint8_t data[], uint32_t length)
+{
+	traceBuffer *buffer = (traceBuffer *)userData;
+
+	if (buffer->size + length > buffer->allocated) {
+		buffer->allocated = 2*(buffer->size + length);
+		buffer->data = realloc(buffer->data, buffer->allocated);
+	}
+	memcpy(&(buffer->data[buffer->size]), data, length);
+	buffer->size += length;
+}
+
+/* count the records of a trace by type, return the total number */
+static uint32_t countRecords(const uint8_t trace[], uint32_t traceSize, uint32_t recordsNbr[])
+{
+	bcg729TraceReaderStruct *traceReader = initBcg729TraceReader(trace, traceSize);
+	bcg729TraceRecord record;
+	uint8_t type;
+	uint32_t totalNbr = 0;
+
+	memset(recordsNbr, 0, 5*sizeof(uint32_t));
+	while ((type = bcg729TraceReaderNext(traceReader, &record)) != BCG729_TRACE_END) {
+		recordsNbr[type]++;
+		totalNbr++;
+	}
+	closeBcg729TraceReader(traceReader);
+	return totalNbr;
+}
+
+int main(int argc, char *argv[] )
+{
+	int i;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int16_t inputBuffer[L_FRAME];
+	int16_t outputBuffer[L_FRAME];
+	int16_t multiChannelOutput[MULTI_CHANNELS_NBR][L_FRAME];
+	uint8_t bitStream[ENCODERS_NBR][10];
+	uint8_t bitStreamLength[ENCODERS_NBR];
+	uint8_t rfc3389Payload[BCG729_TRACE_MAX_BITSTREAM_LENGTH];
+	uint32_t framesNbr = 0;
+	int errorsNbr = 0;
+
+	/*** capture ***/
+	traceBuffer trace = {NULL, 0, 0};
+	bcg729TraceWriterStruct *traceWriter;
+	bcg729EncoderChannelContextStruct *encoderChannelContexts[ENCODERS_NBR]; /* ids 1 to 4: no VAD, VAD, VAD with silence threshold and hints, attached late */
+	bcg729DecoderChannelContextStruct *decoderChannelContext10, *decoderChannelContext11, *decoderChannelContext12; /* decode encoder 2, 1 and 2 with RFC3389 payloads */
+	bcg729DecoderChannelContextStruct *multiChannelContexts[MULTI_CHANNELS_NBR]; /* ids 20 and 21 traced, the last one is not */
+	bcg729EncoderHints hints;
+	uint32_t expectedRecordsNbr[5] = {0, 0, 0, 0, 0};
+
+	/*** replay ***/
+	bcg729TraceReaderStruct *traceReader;
+	bcg729TraceRecord record;
+	uint8_t type;
+	bcg729EncoderChannelContextStruct *replayEncoders[CHANNEL_ID_MAX];
+	uint8_t replayEncoderInitialState[CHANNEL_ID_MAX];
+	bcg729DecoderChannelContextStruct *replayDecoders[CHANNEL_ID_MAX];
+	uint32_t recordsNbr[5], totalRecordsNbr, lateEncoderOpenNbr = 0;
+	uint32_t comparedEncodeNbr = 0, encodeMismatchesNbr = 0, decodeMismatchesNbr = 0;
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	traceWriter = initBcg729TraceWriter(traceOutput, &trace);
+	encoderChannelContexts[0] = initBcg729EncoderChannel(0);
+	encoderChannelContexts[1] = initBcg729EncoderChannel(1);
+	encoderChannelContexts[2] = initBcg729EncoderChannel(1);
+	encoderChannelContexts[3] = initBcg729EncoderChannel(1);
+	bcg729SetEncoderSilenceThreshold(encoderChannelContexts[2], SILENCE_THRESHOLD);
+	for (i=0; i<ENCODERS_NBR-1; i++) {
+		bcg729SetEncoderTrace(encoderChannelContexts[i], traceWriter, i+1);
+		expectedRecordsNbr[BCG729_TRACE_ENCODER_OPEN]++;
+	}
+	decoderChannelContext10 = initBcg729DecoderChannel();
+	decoderChannelContext11 = initBcg729DecoderChannel();
+	decoderChannelContext12 = initBcg729DecoderChannel();
+	bcg729SetDecoderTrace(decoderChannelContext10, traceWriter, 10);
+	bcg729SetDecoderTrace(decoderChannelContext12, traceWriter, 12);
+	expectedRecordsNbr[BCG729_TRACE_DECODER_OPEN] += 2;
+	for (i=0; i<MULTI_CHANNELS_NBR; i++) {
+		multiChannelContexts[i] = initBcg729DecoderChannel();
+		if (i<MULTI_CHANNELS_NBR-1) {
+			bcg729SetDecoderTrace(multiChannelContexts[i], traceWriter, 20+i);
+			expectedRecordsNbr[BCG729_TRACE_DECODER_OPEN]++;
+		}
+	}
+
+	/*** loop over input file ***/
+	while(1) {
+		const uint8_t *multiChannelBitStreams[MULTI_CHANNELS_NBR];
+		uint8_t multiChannelSIDFrameFlag[MULTI_CHANNELS_NBR], multiChannelFrameErasureFlag[MULTI_CHANNELS_NBR] = {0, 0, 0};
+		int16_t *multiChannelSignals[MULTI_CHANNELS_NBR];
+		uint8_t erasedFlag;
+
+		if (inputIsBinary) {
+			if (fread(inputBuffer, sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(inputBuffer[0])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(inputBuffer[i])) != 1) break;
+			}
+		}
+
+		/* encoders: the last one is traced after its first frames */
+		if (framesNbr == LATE_ENCODER_FRAMES) {
+			bcg729SetEncoderTrace(encoderChannelContexts[3], traceWriter, 4);
+			expectedRecordsNbr[BCG729_TRACE_ENCODER_OPEN]++;
+		}
+		for (i=0; i<ENCODERS_NBR; i++) {
+			bcg729Encoder(encoderChannelContexts[i], inputBuffer, bitStream[i], &(bitStreamLength[i]));
+			if (i<ENCODERS_NBR-1 || framesNbr >= LATE_ENCODER_FRAMES) {
+				expectedRecordsNbr[BCG729_TRACE_ENCODE]++;
+			}
+		}
+
+		/* decoder 10: encoder 2 stream with erasures, its hints are given to encoder 3 */
+		erasedFlag = (framesNbr%ERASURE_PERIOD == ERASURE_PERIOD-1)?1:0;
+		if (erasedFlag) {
+			bcg729Decoder(decoderChannelContext10, NULL, 0, 1, 0, 0, outputBuffer);
+		} else {
+			bcg729Decoder(decoderChannelContext10, (bitStreamLength[1]>0)?bitStream[1]:NULL, bitStreamLength[1], 0, (bitStreamLength[1]==10)?0:1, 0, outputBuffer);
+		}
+		expectedRecordsNbr[BCG729_TRACE_DECODE]++;
+		bcg729GetEncoderHints(decoderChannelContext10, &hints);
+		bcg729SetEncoderHints(encoderChannelContexts[2], &hints);
+
+		/* decoder 11: encoder 1 stream, traced during the stream, with an untraced frame and decoder mode changes */
+		if (framesNbr == LATE_DECODER_FRAMES) {
+			bcg729SetDecoderTrace(decoderChannelContext11, traceWriter, 11);
+			expectedRecordsNbr[BCG729_TRACE_DECODER_OPEN]++;
+		}
+		bcg729SetDecoderMode(decoderChannelContext11, (framesNbr >= NO_POSTFILTER_START && framesNbr < NO_POSTFILTER_END)?BCG729_DECODER_MODE_NO_POSTFILTER:BCG729_DECODER_MODE_STANDARD);
+		if (framesNbr == ADVANCE_FRAME) {
+			bcg729DecoderAdvance(decoderChannelContext11, bitStream[0], 10, 0, 0, 0);
+		} else {
+			bcg729Decoder(decoderChannelContext11, bitStream[0], 10, 0, 0, 0, outputBuffer);
+			if (framesNbr >= LATE_DECODER_FRAMES) {
+				expectedRecordsNbr[BCG729_TRACE_DECODE]++;
+				if (framesNbr == ADVANCE_FRAME+1) { /* the channel state is traced again */
+					expectedRecordsNbr[BCG729_TRACE_DECODER_OPEN]++;
+				}
+			}
+		}
+
+		/* decoder 12: encoder 2 stream with RFC3389 comfort noise payloads */
+		if (bitStreamLength[1] == 2) {
+			bcg729GetRFC3389Payload(encoderChannelContexts[1], rfc3389Payload);
+			bcg729Decoder(decoderChannelContext12, rfc3389Payload, BCG729_TRACE_MAX_BITSTREAM_LENGTH, 0, 1, 1, outputBuffer);
+		} else {
+			bcg729Decoder(decoderChannelContext12, (bitStreamLength[1]>0)?bitStream[1]:NULL, bitStreamLength[1], 0, (bitStreamLength[1]==10)?0:1, 1, outputBuffer);
+		}
+		expectedRecordsNbr[BCG729_TRACE_DECODE]++;
+
+		/* multichannel: encoders 1, 2 and 3 streams */
+		for (i=0; i<MULTI_CHANNELS_NBR; i++) {
+			multiChannelBitStreams[i] = (bitStreamLength[i]>0)?bitStream[i]:NULL;
+			multiChannelSIDFrameFlag[i] = (bitStreamLength[i]==10)?0:1;
+			multiChannelSignals[i] = multiChannelOutput[i];
+		}
+		multiChannelFrameErasureFlag[framesNbr%MULTI_CHANNELS_NBR] = erasedFlag;
+		bcg729DecoderMultiChannel(multiChannelContexts, MULTI_CHANNELS_NBR, multiChannelBitStreams, bitStreamLength, multiChannelFrameErasureFlag, multiChannelSIDFrameFlag, 0, multiChannelSignals);
+		expectedRecordsNbr[BCG729_TRACE_DECODE] += MULTI_CHANNELS_NBR-1;
+
+		framesNbr++;
+	}
+	fclose(fpInput);
+
+	for (i=0; i<ENCODERS_NBR; i++) {
+		bcg729SetEncoderTrace(encoderChannelContexts[i], NULL, 0);
+		closeBcg729EncoderChannel(encoderChannelContexts[i]);
+	}
+	closeBcg729DecoderChannel(decoderChannelContext10);
+	closeBcg729DecoderChannel(decoderChannelContext11);
+	closeBcg729DecoderChannel(decoderChannelContext12);
+	for (i=0; i<MULTI_CHANNELS_NBR; i++) {
+		closeBcg729DecoderChannel(multiChannelContexts[i]);
+	}
+	closeBcg729TraceWriter(traceWriter);
+
+	/*** records ***/
+	totalRecordsNbr = countRecords(trace.data, trace.size, recordsNbr);
+	printf("%s: %u frames, trace of %u bytes: %u records, %u encoder open, %u decoder open, %u encode, %u decode\n", filePrefix, framesNbr, trace.size, totalRecordsNbr,
+		recordsNbr[BCG729_TRACE_ENCODER_OPEN], recordsNbr[BCG729_TRACE_DECODER_OPEN], recordsNbr[BCG729_TRACE_ENCODE], recordsNbr[BCG729_TRACE_DECODE]);
+	for (i=1; i<5; i++) {
+		if (recordsNbr[i] != expectedRecordsNbr[i]) {
+			printf("  %u records of type %d, expected %u\n", recordsNbr[i], i, expectedRecordsNbr[i]);
+			errorsNbr++;
+		}
+	}
+
+	/*** replay ***/
+	memset(replayEncoders, 0, sizeof(replayEncoders));
+	memset(replayDecoders, 0, sizeof(replayDecoders));
+	traceReader = initBcg729TraceReader(trace.data, trace.size);
+	while ((type = bcg729TraceReaderNext(traceReader, &record)) != BCG729_TRACE_END) {
+		uint32_t id = record.channelId;
+		if (id >= CHANNEL_ID_MAX) {
+			printf("  unexpected channel id %u\n", id);
+			errorsNbr++;
+			break;
+		}
+		switch (type) {
+			case BCG729_TRACE_ENCODER_OPEN:
+				closeBcg729EncoderChannel(replayEncoders[id]);
+				replayEncoders[id] = initBcg729TracedEncoderChannel(&record);
+				replayEncoderInitialState[id] = record.initialStateFlag;
+				if (id == 4) {
+					lateEncoderOpenNbr++;
+				}
+				if (record.initialStateFlag != ((id == 4)?0:1)) {
+					printf("  encoder %u initial state flag is %d\n", id, record.initialStateFlag);
+					errorsNbr++;
+				}
+				break;
+			case BCG729_TRACE_ENCODE:
+				bcg729SetEncoderSilenceThreshold(replayEncoders[id], record.silenceThreshold);
+				bcg729SetEncoderHints(replayEncoders[id], (record.hints.flags!=0)?&(record.hints):NULL);
+				bcg729Encoder(replayEncoders[id], record.inputFrame, bitStream[0], &(bitStreamLength[0]));
+				if (replayEncoderInitialState[id]) {
+					comparedEncodeNbr++;
+					if (bitStreamLength[0] != record.bitStreamLength || memcmp(bitStream[0], record.bitStream, bitStreamLength[0]) != 0) {
+						encodeMismatchesNbr++;
+					}
+				}
+				break;
+			case BCG729_TRACE_DECODER_OPEN:
+				closeBcg729DecoderChannel(replayDecoders[id]);
+				replayDecoders[id] = initBcg729TracedDecoderChannel(&record);
+				break;
+			case BCG729_TRACE_DECODE:
+				bcg729SetDecoderMode(replayDecoders[id], record.decoderMode);
+				bcg729Decoder(replayDecoders[id], record.nullBitStreamFlag?NULL:record.bitStream, record.bitStreamLength, record.frameErasureFlag, record.SIDFrameFlag, record.rfc3389PayloadFlag, outputBuffer);
+				if (bcg729TraceChecksum(outputBuffer) != record.signalChecksum) {
+					decodeMismatchesNbr++;
+				}
+				break;
+		}
+	}
+	closeBcg729TraceReader(traceReader);
+	for (i=0; i<CHANNEL_ID_MAX; i++) {
+		closeBcg729EncoderChannel(replayEncoders[i]);
+		closeBcg729DecoderChannel(replayDecoders[i]);
+	}
+	printf("  replay: %u/%u encoded frames compared, %u differ, %u decoded frames differ\n", comparedEncodeNbr, recordsNbr[BCG729_TRACE_ENCODE], encodeMismatchesNbr, decodeMismatchesNbr);
+	if (lateEncoderOpenNbr != 1) {
+		printf("  %u open records for the encoder attached late, expected 1\n", lateEncoderOpenNbr);
+		errorsNbr++;
+	}
+	if (comparedEncodeNbr != recordsNbr[BCG729_TRACE_ENCODE] - (framesNbr - LATE_ENCODER_FRAMES) || encodeMismatchesNbr != 0 || decodeMismatchesNbr != 0) {
+		errorsNbr++;
+	}
+
+	/*** truncated and invalid traces ***/
+	if (countRecords(trace.data, trace.size-3, recordsNbr) != totalRecordsNbr-1) {
+		printf("  truncated trace does not end on its last complete record\n");
+		errorsNbr++;
+	}
+	trace.data[0] ^= 0xFF;
+	if (initBcg729TraceReader(trace.data, trace.size) != NULL) {
+		printf("  trace with an invalid header accepted\n");
+		errorsNbr++;
+	}
+
+	free(trace.data);
+	exit ((errorsNbr==0)?0:-1);
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* Test Program for standalone voice activity detection                      */
+/*    Input: the signal : each frame (80 16 bits PCM values) on a row of a   */
+/*           text CSV file(.in extension) or a raw 16 bits PCM file          */
+/*    The input is processed on 8 channels, each one starting at a different */
+/*    frame, some of them with digital silence periods, by an encoder with   */
+/*    VAD enabled and by bcg729DetectVoiceActivityMultiChannel               */
+/*    Ouput: on stdout, the number of frames on which the decisions differ   */
+/*           (must be 0), the encoder and voice activity detection times     */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "typedef.h"
+#include "codecParameters.h"
+
+#include "testUtils.h"
+
+#include "bcg729/encoder.h"
+#include "bcg729/voiceActivity.h"
+
+#define CHANNELS_NBR 8
+#define CHANNEL_OFFSET 37 /* in frames, first frame processed by each channel */
+#define SILENCE_START 100 /* in frames, digital silence period of one channel out of three */
+#define SILENCE_END 140
+
+/* frame processed by a channel: the input is looped from an offset, one channel out of three gets a digital silence period */
+static const int16_t *getChannelFrame(int channel, int frameIndex, int framesNbr, const int16_t *input, const int16_t *silence)
+{
+	if (channel%3 == 2 && frameIndex >= SILENCE_START && frameIndex < SILENCE_END) {
+		return silence;
+	}
+	return &(input[((frameIndex + channel*CHANNEL_OFFSET)%framesNbr)*L_FRAME]);
+}
+
+int main(int argc, char *argv[] )
+{
+	int i, j;
+	/*** get calling argument ***/
+  	char *filePrefix;
+	getArgument(argc, argv, &filePrefix); /* check argument and set filePrefix if needed */
+
+	/*** input file pointer ***/
+	FILE *fpInput;
+	uint16_t inputIsBinary = 0;
+
+	/*** buffers ***/
+	int framesNbr = 0, framesAllocated = 0;
+	int16_t *input = NULL;
+	int16_t silence[L_FRAME];
+	uint8_t *reference;
+	const int16_t *inputFrames[CHANNELS_NBR];
+	uint8_t voiceActivity[CHANNELS_NBR];
+	uint8_t bitStream[10], bitStreamLength;
+	int differingFramesNbr = 0, activeFramesNbr = 0;
+	clock_t start;
+	double encoderTime = 0.0, voiceActivityTime = 0.0;
+
+	bcg729EncoderChannelContextStruct *encoderChannelContexts[CHANNELS_NBR];
+	bcg729VoiceActivityChannelContextStruct *voiceActivityChannelContexts[CHANNELS_NBR];
+
+	/*** inits ***/
+	/* open the input file */
+	if (argv[1][strlen(argv[1])-1] == 'n') { /* input filename and by n, it's probably a .in : CSV file */
+		if ( (fpInput = fopen(argv[1], "r")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	} else { /* it's probably a binary file */
+		inputIsBinary = 1;
+		if ( (fpInput = fopen(argv[1], "rb")) == NULL) {
+			printf("%s - Error: can't open file  %s\n", argv[0], argv[1]);
+			exit(-1);
+		}
+	}
+
+	/*** load the whole input file ***/
+	while (1) {
+		if (framesNbr == framesAllocated) {
+			framesAllocated += 1024;
+			input = realloc(input, framesAllocated*L_FRAME*sizeof(int16_t));
+		}
+		if (inputIsBinary) {
+			if (fread(&(input[framesNbr*L_FRAME]), sizeof(int16_t), L_FRAME, fpInput) != L_FRAME) break;
+		} else {
+			if (fscanf(fpInput,"%hd",&(input[framesNbr*L_FRAME])) != 1) break;
+			for (i=1; i<L_FRAME; i++) {
+				if (fscanf(fpInput,",%hd",&(input[framesNbr*L_FRAME+i])) != 1) break;
+			}
+		}
+		framesNbr++;
+	}
+	fclose(fpInput);
+	if (framesNbr == 0) {
+		printf("%s - Error: no frame found in  %s\n", argv[0], argv[1]);
+		exit(-1);
+	}
+	memset(silence, 0, L_FRAME*sizeof(int16_t));
+
+	/*** reference: the encoder decisions, active frames are the 10 bytes long ones ***/
+	reference = malloc((size_t)CHANNELS_NBR*framesNbr*sizeof(uint8_t));
+	for (j=0; j<CHANNELS_NBR; j++) {
+		encoderChannelContexts[j] = initBcg729EncoderChannel(1);
+	}
+	for (i=0; i<framesNbr; i++) {
+		for (j=0; j<CHANNELS_NBR; j++) {
+			start = clock();
+			bcg729Encoder(encoderChannelContexts[j], getChannelFrame(j, i, framesNbr, input, silence), bitStream, &bitStreamLength);
+			encoderTime += ((double) (clock() - start));
+			reference[i*CHANNELS_NBR+j] = (bitStreamLength==10)?1:0;
+		}
+	}
+	for (j=0; j<CHANNELS_NBR; j++) {
+		closeBcg729EncoderChannel(encoderChannelContexts[j]);
+	}
+
+	/*** standalone voice activity detection of all channels at once ***/
+	for (j=0; j<CHANNELS_NBR; j++) {
+		voiceActivityChannelContexts[j] = initBcg729VoiceActivityChannel();
+	}
+	for (i=0; i<framesNbr; i++) {
+		for (j=0; j<CHANNELS_NBR; j++) {
+			inputFrames[j] = getChannelFrame(j, i, framesNbr, input, silence);
+		}
+		start = clock();
+		bcg729DetectVoiceActivityMultiChannel(voiceActivityChannelContexts, CHANNELS_NBR, inputFrames, voiceActivity);
+		voiceActivityTime += ((double) (clock() - start));
+		for (j=0; j<CHANNELS_NBR; j++) {
+			if (voiceActivity[j] != reference[i*CHANNELS_NBR+j]) {
+				differingFramesNbr++;
+			}
+			activeFramesNbr += voiceActivity[j];
+		}
+	}
+	for (j=0; j<CHANNELS_NBR; j++) {
+		closeBcg729VoiceActivityChannel(voiceActivityChannelContexts[j]);
+	}
+
+	printf("%s: %d channels of %d frames, %d%% active\n", filePrefix, CHANNELS_NBR, framesNbr, 100*activeFramesNbr/(CHANNELS_NBR*framesNbr));
+	printf("  encoder       : %f us/frame\n  voice activity: %f us/frame (x%.2f)\n", encoderTime*1000000/CLOCKS_PER_SEC/(CHANNELS_NBR*framesNbr), voiceActivityTime*1000000/CLOCKS_PER_SEC/(CHANNELS_NBR*framesNbr), encoderTime/voiceActivityTime);
+	printf("  decisions differing from the encoder ones: %d frames\n", differingFramesNbr);
+
+	free(input);
+	free(reference);
+	exit ((differingFramesNbr==0)?0:-1);
+}
@@ -0,0 +1,633 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* bcg729 command line transcoder                                            */
+/*    Converts between 8 kHz mono 16 bits PCM (raw or WAV), G.711 A-law and  */
+/*    mu-law, G.729 raw bitstreams and G.729 recording containers. Inputs    */
+/*    are memory mapped and files are processed concurrently on a pool of    */
+/*    threads, the throughput in frames per second is reported              */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+#include "bcg729/recording.h"
+
+#define L_FRAME 80
+#define FRAME_LENGTH 10
+#define SID_FRAME_LENGTH 2
+#define WAV_HEADER_SIZE 44
+#define DEFAULT_CHECKPOINT_INTERVAL 500 /* 5 seconds */
+#define ALAW_SILENCE 0xD5 /* G.711 codes of the samples closest to 0, padding the last frame */
+#define ULAW_SILENCE 0xFF
+
+/* file formats, selected by file extension */
+typedef enum {
+	FORMAT_UNKNOWN,
+	FORMAT_RAW, /* 16 bits little endian PCM */
+	FORMAT_WAV,
+	FORMAT_ALAW,
+	FORMAT_ULAW,
+	FORMAT_G729, /* 10 bytes frames concatenated, no VAD/DTX */
+	FORMAT_RECORDING /* bcg729 recording container, see bcg729/recording.h */
+} fileFormat;
+
+static const struct {
+	const char *extension;
+	fileFormat format;
+} extensions[] = {
+	{"raw", FORMAT_RAW}, {"pcm", FORMAT_RAW}, {"sln", FORMAT_RAW},
+	{"wav", FORMAT_WAV},
+	{"al", FORMAT_ALAW}, {"alaw", FORMAT_ALAW},
+	{"ul", FORMAT_ULAW}, {"ulaw", FORMAT_ULAW}, {"mulaw", FORMAT_ULAW},
+	{"g729", FORMAT_G729}, {"729", FORMAT_G729},
+	{"bcgr", FORMAT_RECORDING}
+};
+
+/* command line options */
+typedef struct {
+	uint8_t enableVAD;
+	uint16_t checkpointInterval;
+	int threadsNbr;
+	int quiet;
+} options;
+
+/* one file conversion */
+typedef struct {
+	const char *inputName;
+	char *outputName;
+	const options *options;
+	uint32_t framesNbr;
+	double time; /* in seconds */
+	const char *error; /* NULL on success */
+} conversionJob;
+
+typedef struct {
+	conversionJob *jobs;
+	int jobsNbr;
+	int nextJob;
+	pthread_mutex_t mutex;
+} jobQueue;
+
+/* memory mapped input */
+typedef struct {
+	fileFormat format;
+	uint8_t sampleFormat; /* BCG729_OUTPUT_FORMAT_* of the frames read: PCM16, or G.711 codes decoded from G.729 or copied from a G.711 input */
+	const uint8_t *data;
+	size_t size;
+	size_t position; /* in bytes in data */
+	bcg729DecoderChannelContextStruct *decoderChannelContext;
+	bcg729RecordingReaderStruct *recordingReader;
+} source;
+
+/* buffered output */
+typedef struct {
+	fileFormat format;
+	uint8_t sampleFormat; /* BCG729_INPUT_FORMAT_* of the frames written: PCM16, or G.711 codes encoded to G.729 or copied to a G.711 output */
+	FILE *file;
+	uint32_t dataLength; /* in bytes, WAV header excluded */
+	bcg729EncoderChannelContextStruct *encoderChannelContext;
+	bcg729RecordingWriterStruct *recordingWriter;
+} sink;
+
+static double getTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec/1e9;
+}
+
+static fileFormat getFileFormat(const char *fileName)
+{
+	const char *extension = strrchr(fileName, '.');
+	size_t i;
+
+	if (extension == NULL || strchr(extension, '/') != NULL) {
+		return FORMAT_UNKNOWN;
+	}
+	for (i=0; i<sizeof(extensions)/sizeof(extensions[0]); i++) {
+		if (strcasecmp(extension+1, extensions[i].extension) == 0) {
+			return extensions[i].format;
+		}
+	}
+	return FORMAT_UNKNOWN;
+}
+
+/*****************************************************************************/
+/* input                                                                     */
+/*****************************************************************************/
+static uint32_t readUint32(const uint8_t *buffer)
+{
+	return (uint32_t)buffer[0] | ((uint32_t)buffer[1]<<8) | ((uint32_t)buffer[2]<<16) | ((uint32_t)buffer[3]<<24);
+}
+
+static uint16_t readUint16(const uint8_t *buffer)
+{
+	return (uint16_t)(buffer[0] | (buffer[1]<<8));
+}
+
+/* find the data chunk of a 8 kHz mono 16 bits PCM WAV file */
+static const char *openWav(source *input)
+{
+	size_t position = 12;
+	int formatFound = 0;
+
+	if (input->size < 12 || memcmp(input->data, "RIFF", 4) != 0 || memcmp(&(input->data[8]), "WAVE", 4) != 0) {
+		return "not a WAV file";
+	}
+	while (position + 8 <= input->size) {
+		const uint8_t *chunk = &(input->data[position]);
+		uint32_t chunkSize = readUint32(&(chunk[4]));
+		if (memcmp(chunk, "fmt ", 4) == 0) {
+			if (chunkSize < 16 || position + 8 + 16 > input->size
+				|| readUint16(&(chunk[8])) != 1 || readUint16(&(chunk[10])) != 1 || readUint32(&(chunk[12])) != 8000 || readUint16(&(chunk[22])) != 16) {
+				return "WAV file is not 8 kHz mono 16 bits PCM";
+			}
+			formatFound = 1;
+		} else if (memcmp(chunk, "data", 4) == 0) {
+			if (!formatFound) {
+				return "WAV file data before format";
+			}
+			input->position = position + 8;
+			if (chunkSize < input->size - input->position) { /* ignore chunks after data */
+				input->size = input->position + chunkSize;
+			}
+			return NULL;
+		}
+		position += 8 + (size_t)chunkSize + (chunkSize&1);
+	}
+	return "WAV file without data";
+}
+
+static const char *openSource(source *input, const char *fileName, fileFormat format, uint8_t sampleFormat)
+{
+	struct stat fileStat;
+	int fd;
+
+	memset(input, 0, sizeof(source));
+	input->format = format;
+	input->sampleFormat = sampleFormat;
+	if ((fd = open(fileName, O_RDONLY)) < 0) {
+		return "can't open input";
+	}
+	if (fstat(fd, &fileStat) != 0) {
+		close(fd);
+		return "can't stat input";
+	}
+	input->size = (size_t)fileStat.st_size;
+	if (input->size > 0) {
+		void *data = mmap(NULL, input->size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED) {
+			close(fd);
+			return "can't map input";
+		}
+		madvise(data, input->size, MADV_SEQUENTIAL);
+		input->data = data;
+	}
+	close(fd); /* the mapping stays valid */
+
+	switch (format) {
+		case FORMAT_WAV:
+			return openWav(input);
+		case FORMAT_G729:
+			input->decoderChannelContext = initBcg729DecoderChannel();
+			bcg729SetDecoderOutputFormat(input->decoderChannelContext, sampleFormat);
+			return NULL;
+		case FORMAT_RECORDING:
+			input->decoderChannelContext = initBcg729DecoderChannel();
+			if (input->size > UINT32_MAX || (input->recordingReader = initBcg729RecordingReader(input->data, (uint32_t)input->size, input->decoderChannelContext)) == NULL) {
+				return "invalid recording container";
+			}
+			return NULL;
+		default:
+			return NULL;
+	}
+}
+
+static void closeSource(source *input)
+{
+	if (input->recordingReader != NULL) {
+		closeBcg729RecordingReader(input->recordingReader);
+	}
+	if (input->decoderChannelContext != NULL) {
+		closeBcg729DecoderChannel(input->decoderChannelContext);
+	}
+	if (input->data != NULL) {
+		munmap((void *)input->data, input->size);
+	}
+}
+
+/* get the next frame: 80 samples 16 bits PCM or G.711 codes as given by the input sample format, the last frame is */
+/* padded with silence, return 0 at the end of input */
+static int readFrame(source *input, void *frame)
+{
+	int16_t *signal = (int16_t *)frame;
+	uint8_t codes[L_FRAME];
+	size_t remaining = input->size - input->position;
+	const uint8_t *data;
+	size_t i, samplesNbr;
+
+	if (remaining == 0 && input->format != FORMAT_RECORDING) { /* data is NULL on empty inputs */
+		return 0;
+	}
+	data = &(input->data[input->position]);
+	switch (input->format) {
+		case FORMAT_RAW:
+		case FORMAT_WAV:
+			samplesNbr = (remaining/2 < L_FRAME)?remaining/2:L_FRAME;
+			for (i=0; i<samplesNbr; i++) {
+				signal[i] = (int16_t)readUint16(&(data[2*i]));
+			}
+			input->position += 2*samplesNbr;
+			break;
+		case FORMAT_ALAW:
+		case FORMAT_ULAW:
+			samplesNbr = (remaining < L_FRAME)?remaining:L_FRAME;
+			if (samplesNbr == 0) {
+				return 0;
+			}
+			memcpy(codes, data, samplesNbr);
+			memset(&(codes[samplesNbr]), (input->format == FORMAT_ALAW)?ALAW_SILENCE:ULAW_SILENCE, L_FRAME - samplesNbr);
+			input->position += samplesNbr;
+			if (input->sampleFormat == BCG729_OUTPUT_FORMAT_PCM16) { /* expanded for a PCM or G.711 output */
+				bcg729G711ToLinear(codes, L_FRAME, (input->format == FORMAT_ALAW)?BCG729_INPUT_FORMAT_ALAW:BCG729_INPUT_FORMAT_ULAW, signal);
+			} else { /* the encoder expands them */
+				memcpy(frame, codes, L_FRAME);
+			}
+			return 1;
+		case FORMAT_G729:
+			if (remaining < FRAME_LENGTH) {
+				return 0;
+			}
+			bcg729DecoderFormatted(input->decoderChannelContext, data, FRAME_LENGTH, 0, 0, 0, frame);
+			input->position += FRAME_LENGTH;
+			return 1;
+		default: /* FORMAT_RECORDING */
+			return (int)bcg729RecordingRead(input->recordingReader, 1, signal);
+	}
+
+	if (samplesNbr == 0) {
+		return 0;
+	}
+	for (i=samplesNbr; i<L_FRAME; i++) {
+		signal[i] = 0;
+	}
+	return 1;
+}
+
+/*****************************************************************************/
+/* output                                                                    */
+/*****************************************************************************/
+static void writeUint32(uint8_t *buffer, uint32_t value)
+{
+	buffer[0] = (uint8_t)value;
+	buffer[1] = (uint8_t)(value>>8);
+	buffer[2] = (uint8_t)(value>>16);
+	buffer[3] = (uint8_t)(value>>24);
+}
+
+static void writeWavHeader(FILE *file, uint32_t dataLength)
+{
+	uint8_t header[WAV_HEADER_SIZE] = {'R','I','F','F', 0,0,0,0, 'W','A','V','E', 'f','m','t',' ', 16,0,0,0, 1,0, 1,0, 0x40,0x1F,0,0, 0x80,0x3E,0,0, 2,0, 16,0, 'd','a','t','a', 0,0,0,0};
+
+	writeUint32(&(header[4]), 36 + dataLength);
+	writeUint32(&(header[40]), dataLength);
+	fwrite(header, 1, WAV_HEADER_SIZE, file);
+}
+
+static const char *openSink(sink *output, const char *fileName, fileFormat format, uint8_t sampleFormat, const options *options)
+{
+	memset(output, 0, sizeof(sink));
+	output->format = format;
+	output->sampleFormat = sampleFormat;
+	if ((output->file = fopen(fileName, "wb")) == NULL) {
+		return "can't open output";
+	}
+	setvbuf(output->file, NULL, _IOFBF, 1<<16);
+
+	switch (format) {
+		case FORMAT_WAV:
+			writeWavHeader(output->file, 0); /* rewritten once the length is known */
+			break;
+		case FORMAT_G729:
+			output->encoderChannelContext = initBcg729EncoderChannel(0);
+			bcg729SetEncoderInputFormat(output->encoderChannelContext, sampleFormat);
+			break;
+		case FORMAT_RECORDING:
+			output->encoderChannelContext = initBcg729EncoderChannel(options->enableVAD);
+			bcg729SetEncoderInputFormat(output->encoderChannelContext, sampleFormat);
+			output->recordingWriter = initBcg729RecordingWriter(options->checkpointInterval);
+			break;
+		default:
+			break;
+	}
+	return NULL;
+}
+
+/* write a frame: 80 samples 16 bits PCM or G.711 codes as given by the output sample format */
+static void writeFrame(sink *output, const void *frame)
+{
+	const int16_t *signal = (const int16_t *)frame;
+	uint8_t buffer[2*L_FRAME];
+	uint8_t bitStreamLength;
+	int i;
+
+	switch (output->format) {
+		case FORMAT_RAW:
+		case FORMAT_WAV:
+			for (i=0; i<L_FRAME; i++) {
+				buffer[2*i] = (uint8_t)(signal[i]&0xFF);
+				buffer[2*i+1] = (uint8_t)((signal[i]>>8)&0xFF);
+			}
+			fwrite(buffer, 1, 2*L_FRAME, output->file);
+			output->dataLength += 2*L_FRAME;
+			break;
+		case FORMAT_ALAW:
+		case FORMAT_ULAW:
+			if (output->sampleFormat == BCG729_INPUT_FORMAT_PCM16) { /* compress a PCM, G.711 or recording input */
+				bcg729LinearToG711(signal, L_FRAME, (output->format == FORMAT_ALAW)?BCG729_OUTPUT_FORMAT_ALAW:BCG729_OUTPUT_FORMAT_ULAW, buffer);
+				fwrite(buffer, 1, L_FRAME, output->file);
+			} else { /* compressed by the decoder */
+				fwrite(frame, 1, L_FRAME, output->file);
+			}
+			output->dataLength += L_FRAME;
+			break;
+		case FORMAT_G729:
+			bcg729EncoderFormatted(output->encoderChannelContext, frame, buffer, &bitStreamLength);
+			fwrite(buffer, 1, bitStreamLength, output->file);
+			output->dataLength += bitStreamLength;
+			break;
+		default: /* FORMAT_RECORDING */
+			bcg729EncoderFormatted(output->encoderChannelContext, frame, buffer, &bitStreamLength);
+			bcg729RecordingWriterAddFrame(output->recordingWriter, buffer, bitStreamLength, 0);
+			break;
+	}
+}
+
+static const char *closeSink(sink *output)
+{
+	const char *error = NULL;
+
+	if (output->format == FORMAT_WAV) {
+		fseek(output->file, 0, SEEK_SET);
+		writeWavHeader(output->file, output->dataLength);
+	}
+	if (output->recordingWriter != NULL) {
+		uint32_t recordingSize = bcg729GetRecordingSize(output->recordingWriter);
+		uint8_t *recording = malloc(recordingSize);
+		bcg729WriteRecording(output->recordingWriter, recording);
+		fwrite(recording, 1, recordingSize, output->file);
+		free(recording);
+		closeBcg729RecordingWriter(output->recordingWriter);
+	}
+	if (output->encoderChannelContext != NULL) {
+		closeBcg729EncoderChannel(output->encoderChannelContext);
+	}
+	if (ferror(output->file)) {
+		error = "write error";
+	}
+	if (fclose(output->file) != 0) {
+		error = "write error";
+	}
+	return error;
+}
+
+/*****************************************************************************/
+/* conversion                                                                */
+/*****************************************************************************/
+static void convert(conversionJob *job)
+{
+	fileFormat inputFormat = getFileFormat(job->inputName);
+	fileFormat outputFormat = getFileFormat(job->outputName);
+	source input;
+	sink output;
+	int16_t frame[L_FRAME]; /* 16 bits PCM or G.711 codes */
+	uint8_t sampleFormat = BCG729_INPUT_FORMAT_PCM16; /* G.711 is converted by the encoder or the decoder when there is one, in PCM otherwise */
+	double start = getTime();
+	const char *error;
+
+	job->framesNbr = 0;
+	if (inputFormat == FORMAT_UNKNOWN || outputFormat == FORMAT_UNKNOWN) {
+		job->error = "unknown file extension";
+		return;
+	}
+	if (outputFormat == FORMAT_G729 && job->options->enableVAD) {
+		job->error = "VAD/DTX frames can't be stored in a raw G.729 file, use a .bcgr container";
+		return;
+	}
+	if ((inputFormat == FORMAT_ALAW || inputFormat == FORMAT_ULAW) && (outputFormat == FORMAT_G729 || outputFormat == FORMAT_RECORDING)) {
+		sampleFormat = (inputFormat == FORMAT_ALAW)?BCG729_INPUT_FORMAT_ALAW:BCG729_INPUT_FORMAT_ULAW;
+	}
+	if ((outputFormat == FORMAT_ALAW || outputFormat == FORMAT_ULAW) && inputFormat == FORMAT_G729) {
+		sampleFormat = (outputFormat == FORMAT_ALAW)?BCG729_OUTPUT_FORMAT_ALAW:BCG729_OUTPUT_FORMAT_ULAW;
+	}
+	if ((job->error = openSource(&input, job->inputName, inputFormat, sampleFormat)) != NULL) {
+		closeSource(&input);
+		return;
+	}
+	if ((job->error = openSink(&output, job->outputName, outputFormat, sampleFormat, job->options)) != NULL) {
+		closeSource(&input);
+		return;
+	}
+
+	if (inputFormat == FORMAT_G729 && outputFormat == FORMAT_RECORDING) { /* no transcoding: frames are stored as they are */
+		while (input.size - input.position >= FRAME_LENGTH) {
+			bcg729RecordingWriterAddFrame(output.recordingWriter, &(input.data[input.position]), FRAME_LENGTH, 0);
+			input.position += FRAME_LENGTH;
+			job->framesNbr++;
+		}
+	} else {
+		while (readFrame(&input, frame)) {
+			writeFrame(&output, frame);
+			job->framesNbr++;
+		}
+	}
+
+	error = closeSink(&output);
+	closeSource(&input);
+	job->error = error;
+	job->time = getTime() - start;
+}
+
+static void *worker(void *arg)
+{
+	jobQueue *queue = (jobQueue *)arg;
+
+	while (1) {
+		conversionJob *job;
+		pthread_mutex_lock(&(queue->mutex));
+		job = (queue->nextJob < queue->jobsNbr)?&(queue->jobs[queue->nextJob++]):NULL;
+		pthread_mutex_unlock(&(queue->mutex));
+		if (job == NULL) {
+			return NULL;
+		}
+		convert(job);
+		if (!job->options->quiet) {
+			if (job->error != NULL) {
+				fprintf(stderr, "%s: %s\n", job->inputName, job->error);
+			} else {
+				printf("%s -> %s: %u frames, %.0f frames/s\n", job->inputName, job->outputName, job->framesNbr, (job->time > 0.0)?job->framesNbr/job->time:0.0);
+			}
+		}
+	}
+}
+
+static void printUsage(const char *command)
+{
+	fprintf(stderr, "Usage:\n"
+		"  %s [options] <input> <output>\n"
+		"  %s [options] -t <extension> <input>...\n"
+		"Converts 8 kHz mono audio files, formats are given by the files extensions:\n"
+		"  .raw .pcm .sln : 16 bits little endian PCM\n"
+		"  .wav           : 16 bits PCM WAV\n"
+		"  .al .alaw      : G.711 A-law\n"
+		"  .ul .ulaw      : G.711 mu-law\n"
+		"  .g729 .729     : G.729 10 bytes frames\n"
+		"  .bcgr          : G.729 recording container with random access (see bcg729/recording.h)\n"
+		"Options:\n"
+		"  -t <extension> : convert each input to a file with the same name and this extension\n"
+		"  -j <threads>   : number of files converted concurrently, default is the number of cores\n"
+		"  -v             : enable VAD/DTX (G.729 Annex B), .bcgr output only\n"
+		"  -c <frames>    : .bcgr checkpoint interval, default %d frames\n"
+		"  -q             : quiet, report the total throughput only\n",
+		command, command, DEFAULT_CHECKPOINT_INTERVAL);
+	exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+	options options = {0, DEFAULT_CHECKPOINT_INTERVAL, 0, 0};
+	const char *outputExtension = NULL;
+	conversionJob *jobs;
+	jobQueue queue;
+	pthread_t *threads;
+	int jobsNbr, i, argIndex = 1, errorsNbr = 0;
+	uint64_t framesNbr = 0;
+	double start, time;
+
+	/* options */
+	while (argIndex < argc && argv[argIndex][0] == '-' && argv[argIndex][1] != '\0') {
+		const char *option = argv[argIndex++];
+		if (strcmp(option, "-v") == 0) {
+			options.enableVAD = 1;
+		} else if (strcmp(option, "-q") == 0) {
+			options.quiet = 1;
+		} else if (strcmp(option, "-t") == 0 && argIndex < argc) {
+			outputExtension = argv[argIndex++];
+		} else if (strcmp(option, "-j") == 0 && argIndex < argc) {
+			options.threadsNbr = atoi(argv[argIndex++]);
+		} else if (strcmp(option, "-c") == 0 && argIndex < argc) {
+			int interval = atoi(argv[argIndex++]);
+			if (interval <= 0 || interval > UINT16_MAX) {
+				printUsage(argv[0]);
+			}
+			options.checkpointInterval = (uint16_t)interval;
+		} else {
+			printUsage(argv[0]);
+		}
+	}
+	if (options.threadsNbr <= 0) {
+		long coresNbr = sysconf(_SC_NPROCESSORS_ONLN);
+		options.threadsNbr = (coresNbr > 0)?(int)coresNbr:1;
+	}
+
+	/* jobs */
+	if (outputExtension == NULL) {
+		if (argc - argIndex != 2) {
+			printUsage(argv[0]);
+		}
+		jobsNbr = 1;
+		jobs = calloc(1, sizeof(conversionJob));
+		jobs[0].inputName = argv[argIndex];
+		jobs[0].outputName = strdup(argv[argIndex+1]);
+	} else {
+		if (argc - argIndex < 1) {
+			printUsage(argv[0]);
+		}
+		if (outputExtension[0] == '.') {
+			outputExtension++;
+		}
+		jobsNbr = argc - argIndex;
+		jobs = calloc(jobsNbr, sizeof(conversionJob));
+		for (i=0; i<jobsNbr; i++) {
+			const char *inputName = argv[argIndex+i];
+			const char *extension = strrchr(inputName, '.');
+			size_t baseLength = (extension != NULL && strchr(extension, '/') == NULL)?(size_t)(extension - inputName):strlen(inputName);
+			jobs[i].inputName = inputName;
+			jobs[i].outputName = malloc(baseLength + strlen(outputExtension) + 2);
+			memcpy(jobs[i].outputName, inputName, baseLength);
+			sprintf(&(jobs[i].outputName[baseLength]), ".%s", outputExtension);
+			if (strcmp(jobs[i].outputName, inputName) == 0) {
+				fprintf(stderr, "%s: output would overwrite input\n", inputName);
+				exit(1);
+			}
+		}
+	}
+	for (i=0; i<jobsNbr; i++) {
+		jobs[i].options = &options;
+	}
+	if (options.threadsNbr > jobsNbr) {
+		options.threadsNbr = jobsNbr;
+	}
+
+	start = getTime();
+	queue.jobs = jobs;
+	queue.jobsNbr = jobsNbr;
+	queue.nextJob = 0;
+	pthread_mutex_init(&(queue.mutex), NULL);
+	threads = malloc(options.threadsNbr*sizeof(pthread_t));
+	for (i=0; i<options.threadsNbr; i++) {
+		pthread_create(&(threads[i]), NULL, worker, &queue);
+	}
+	for (i=0; i<options.threadsNbr; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	pthread_mutex_destroy(&(queue.mutex));
+	time = getTime() - start;
+
+	for (i=0; i<jobsNbr; i++) {
+		if (jobs[i].error != NULL) {
+			if (options.quiet) {
+				fprintf(stderr, "%s: %s\n", jobs[i].inputName, jobs[i].error);
+			}
+			errorsNbr++;
+		} else {
+			framesNbr += jobs[i].framesNbr;
+		}
+		free(jobs[i].outputName);
+	}
+	printf("%d files, %llu frames in %.3f s on %d threads: %.0f frames/s (x%.0f real time)\n", jobsNbr - errorsNbr, (unsigned long long)framesNbr, time, options.threadsNbr,
+		(time > 0.0)?framesNbr/time:0.0, (time > 0.0)?framesNbr/time/100.0:0.0);
+
+	free(threads);
+	free(jobs);
+	return (errorsNbr == 0)?0:1;
+}
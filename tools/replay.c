@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2011-2019 Belledonne Communications SARL.
+ *
+ * This file is part of bcg729.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+/*****************************************************************************/
+/*                                                                           */
+/* bcg729 call trace replay benchmark                                        */
+/*    Replays a trace captured with bcg729SetEncoderTrace and                */
+/*    bcg729SetDecoderTrace(see bcg729/trace.h) call by call, in the traced  */
+/*    order, on new channels. Each encoder and decoder call is timed: the    */
+/*    throughput and the latency percentiles are reported, and the outputs   */
+/*    are compared with the traced ones: bitstreams for the encoder channels */
+/*    traced from their creation, decoded frames checksums for the decoders  */
+/*                                                                           */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "bcg729/encoder.h"
+#include "bcg729/decoder.h"
+#include "bcg729/trace.h"
+
+#define L_FRAME 80
+#define CHANNELS_TABLE_INITIAL_SIZE 64 /* power of 2 */
+
+/* a traced channel id, its encoder and decoder sides are created by their OPEN records */
+typedef struct {
+	uint32_t id;
+	uint8_t usedFlag;
+	uint8_t encoderInitialStateFlag; /* the encoder outputs are compared */
+	bcg729EncoderChannelContextStruct *encoderChannelContext;
+	bcg729DecoderChannelContextStruct *decoderChannelContext;
+} channel;
+
+/* channels by id: open addressing hash table */
+typedef struct {
+	channel *channels;
+	uint32_t size; /* power of 2 */
+	uint32_t channelsNbr;
+} channelTable;
+
+/* timing and comparison of one call type */
+typedef struct {
+	uint32_t *latencies; /* in ns */
+	uint64_t callsNbr;
+	uint64_t comparedNbr;
+	uint64_t mismatchesNbr;
+	double time; /* in seconds */
+} callStats;
+
+static double getTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec/1e9;
+}
+
+static uint32_t hashId(uint32_t id)
+{
+	return id*2654435761u; /* Knuth multiplicative hash */
+}
+
+static channel *findChannel(channelTable *table, uint32_t id)
+{
+	uint32_t index = hashId(id)&(table->size-1);
+
+	while (table->channels[index].usedFlag) {
+		if (table->channels[index].id == id) {
+			return &(table->channels[index]);
+		}
+		index = (index+1)&(table->size-1);
+	}
+	return NULL;
+}
+
+static channel *addChannel(channelTable *table, uint32_t id)
+{
+	channel *newChannel = findChannel(table, id);
+	uint32_t index;
+
+	if (newChannel != NULL) {
+		return newChannel;
+	}
+	if (2*(table->channelsNbr+1) > table->size) { /* keep the table half empty */
+		channelTable grown;
+		uint32_t i;
+		grown.size = 2*table->size;
+		grown.channelsNbr = 0;
+		grown.channels = calloc(grown.size, sizeof(channel));
+		for (i=0; i<table->size; i++) {
+			if (table->channels[i].usedFlag) {
+				*addChannel(&grown, table->channels[i].id) = table->channels[i];
+			}
+		}
+		free(table->channels);
+		*table = grown;
+	}
+	index = hashId(id)&(table->size-1);
+	while (table->channels[index].usedFlag) {
+		index = (index+1)&(table->size-1);
+	}
+	newChannel = &(table->channels[index]);
+	newChannel->id = id;
+	newChannel->usedFlag = 1;
+	table->channelsNbr++;
+	return newChannel;
+}
+
+static void closeChannels(channelTable *table)
+{
+	uint32_t i;
+
+	for (i=0; i<table->size; i++) {
+		closeBcg729EncoderChannel(table->channels[i].encoderChannelContext);
+		closeBcg729DecoderChannel(table->channels[i].decoderChannelContext);
+	}
+	free(table->channels);
+}
+
+static int compareLatencies(const void *a, const void *b)
+{
+	uint32_t latencyA = *(const uint32_t *)a, latencyB = *(const uint32_t *)b;
+	return (latencyA > latencyB) - (latencyA < latencyB);
+}
+
+static double getPercentile(const callStats *stats, double percentile)
+{
+	return stats->latencies[(size_t)(percentile*(stats->callsNbr-1)/100.0)]/1e3;
+}
+
+static void printStats(const char *name, callStats *stats)
+{
+	if (stats->callsNbr == 0) {
+		return;
+	}
+	qsort(stats->latencies, stats->callsNbr, sizeof(uint32_t), compareLatencies);
+	printf("  %s: %llu calls, %.0f frames/s (x%.0f real time), latency us: p50 %.2f p90 %.2f p99 %.2f p99.9 %.2f max %.2f\n", name, (unsigned long long)stats->callsNbr,
+		stats->callsNbr/stats->time, stats->callsNbr/stats->time/100.0,
+		getPercentile(stats, 50.0), getPercentile(stats, 90.0), getPercentile(stats, 99.0), getPercentile(stats, 99.9), stats->latencies[stats->callsNbr-1]/1e3);
+}
+
+/* replay the trace once */
+static void replayTrace(const uint8_t trace[], uint32_t traceSize, callStats *encodeStats, callStats *decodeStats, uint32_t *channelsNbr)
+{
+	bcg729TraceReaderStruct *traceReader = initBcg729TraceReader(trace, traceSize);
+	bcg729TraceRecord record;
+	channelTable table;
+	channel *tracedChannel;
+	uint8_t bitStream[10], bitStreamLength;
+	int16_t signal[L_FRAME];
+	struct timespec start, end;
+	uint32_t latency;
+
+	table.size = CHANNELS_TABLE_INITIAL_SIZE;
+	table.channelsNbr = 0;
+	table.channels = calloc(table.size, sizeof(channel));
+
+	while (bcg729TraceReaderNext(traceReader, &record) != BCG729_TRACE_END) {
+		switch (record.type) {
+			case BCG729_TRACE_ENCODER_OPEN:
+				tracedChannel = addChannel(&table, record.channelId);
+				closeBcg729EncoderChannel(tracedChannel->encoderChannelContext);
+				tracedChannel->encoderChannelContext = initBcg729TracedEncoderChannel(&record);
+				tracedChannel->encoderInitialStateFlag = record.initialStateFlag;
+				break;
+			case BCG729_TRACE_DECODER_OPEN:
+				tracedChannel = addChannel(&table, record.channelId);
+				closeBcg729DecoderChannel(tracedChannel->decoderChannelContext);
+				tracedChannel->decoderChannelContext = initBcg729TracedDecoderChannel(&record);
+				break;
+			case BCG729_TRACE_ENCODE:
+				tracedChannel = findChannel(&table, record.channelId);
+				if (tracedChannel == NULL || tracedChannel->encoderChannelContext == NULL) { /* the writer always opens a channel first */
+					break;
+				}
+				bcg729SetEncoderSilenceThreshold(tracedChannel->encoderChannelContext, record.silenceThreshold);
+				bcg729SetEncoderHints(tracedChannel->encoderChannelContext, (record.hints.flags!=0)?&(record.hints):NULL);
+				clock_gettime(CLOCK_MONOTONIC, &start);
+				bcg729Encoder(tracedChannel->encoderChannelContext, record.inputFrame, bitStream, &bitStreamLength);
+				clock_gettime(CLOCK_MONOTONIC, &end);
+				latency = (uint32_t)((end.tv_sec - start.tv_sec)*1000000000L + (end.tv_nsec - start.tv_nsec));
+				encodeStats->latencies[encodeStats->callsNbr++] = latency;
+				encodeStats->time += latency/1e9;
+				if (tracedChannel->encoderInitialStateFlag) {
+					encodeStats->comparedNbr++;
+					if (bitStreamLength != record.bitStreamLength || memcmp(bitStream, record.bitStream, bitStreamLength) != 0) {
+						encodeStats->mismatchesNbr++;
+					}
+				}
+				break;
+			case BCG729_TRACE_DECODE:
+				tracedChannel = findChannel(&table, record.channelId);
+				if (tracedChannel == NULL || tracedChannel->decoderChannelContext == NULL) {
+					break;
+				}
+				bcg729SetDecoderMode(tracedChannel->decoderChannelContext, record.decoderMode);
+				clock_gettime(CLOCK_MONOTONIC, &start);
+				bcg729Decoder(tracedChannel->decoderChannelContext, record.nullBitStreamFlag?NULL:record.bitStream, record.bitStreamLength, record.frameErasureFlag, record.SIDFrameFlag, record.rfc3389PayloadFlag, signal);
+				clock_gettime(CLOCK_MONOTONIC, &end);
+				latency = (uint32_t)((end.tv_sec - start.tv_sec)*1000000000L + (end.tv_nsec - start.tv_nsec));
+				decodeStats->latencies[decodeStats->callsNbr++] = latency;
+				decodeStats->time += latency/1e9;
+				decodeStats->comparedNbr++;
+				if (bcg729TraceChecksum(signal) != record.signalChecksum) {
+					decodeStats->mismatchesNbr++;
+				}
+				break;
+		}
+	}
+
+	*channelsNbr = table.channelsNbr;
+	closeChannels(&table);
+	closeBcg729TraceReader(traceReader);
+}
+
+static void printUsage(const char *command)
+{
+	fprintf(stderr, "Usage:\n"
+		"  %s [options] <trace>\n"
+		"Replays a call trace captured with bcg729SetEncoderTrace and bcg729SetDecoderTrace (see bcg729/trace.h),\n"
+		"reports the encoder and decoder throughput and latency percentiles and checks the outputs match the traced ones.\n"
+		"Options:\n"
+		"  -n <repeats> : replay the trace this number of times, default 1\n",
+		command);
+	exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+	int repeatsNbr = 1, i, argIndex = 1;
+	const char *traceName;
+	const uint8_t *trace;
+	size_t traceSize;
+	struct stat fileStat;
+	int fd;
+	bcg729TraceReaderStruct *traceReader;
+	bcg729TraceRecord record;
+	uint64_t encodeRecordsNbr = 0, decodeRecordsNbr = 0;
+	callStats encodeStats, decodeStats;
+	uint32_t channelsNbr = 0;
+	double start;
+
+	/* options */
+	while (argIndex < argc && argv[argIndex][0] == '-' && argv[argIndex][1] != '\0') {
+		const char *option = argv[argIndex++];
+		if (strcmp(option, "-n") == 0 && argIndex < argc) {
+			repeatsNbr = atoi(argv[argIndex++]);
+			if (repeatsNbr <= 0) {
+				printUsage(argv[0]);
+			}
+		} else {
+			printUsage(argv[0]);
+		}
+	}
+	if (argc - argIndex != 1) {
+		printUsage(argv[0]);
+	}
+	traceName = argv[argIndex];
+
+	/* map the trace */
+	if ((fd = open(traceName, O_RDONLY)) < 0 || fstat(fd, &fileStat) != 0) {
+		fprintf(stderr, "%s: can't open trace\n", traceName);
+		return 1;
+	}
+	traceSize = (size_t)fileStat.st_size;
+	if (traceSize == 0 || traceSize > UINT32_MAX || (trace = mmap(NULL, traceSize, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED) {
+		fprintf(stderr, "%s: can't map trace\n", traceName);
+		return 1;
+	}
+	close(fd); /* the mapping stays valid */
+
+	/* count the calls to size the latencies buffers */
+	if ((traceReader = initBcg729TraceReader(trace, (uint32_t)traceSize)) == NULL) {
+		fprintf(stderr, "%s: invalid trace\n", traceName);
+		return 1;
+	}
+	while (bcg729TraceReaderNext(traceReader, &record) != BCG729_TRACE_END) {
+		if (record.type == BCG729_TRACE_ENCODE) {
+			encodeRecordsNbr++;
+		} else if (record.type == BCG729_TRACE_DECODE) {
+			decodeRecordsNbr++;
+		}
+	}
+	closeBcg729TraceReader(traceReader);
+	memset(&encodeStats, 0, sizeof(callStats));
+	memset(&decodeStats, 0, sizeof(callStats));
+	encodeStats.latencies = malloc((encodeRecordsNbr*repeatsNbr+1)*sizeof(uint32_t));
+	decodeStats.latencies = malloc((decodeRecordsNbr*repeatsNbr+1)*sizeof(uint32_t));
+
+	/* the first decoder channel builds tables shared by all channels: create one before replaying */
+	closeBcg729DecoderChannel(initBcg729DecoderChannel());
+
+	start = getTime();
+	for (i=0; i<repeatsNbr; i++) {
+		replayTrace(trace, (uint32_t)traceSize, &encodeStats, &decodeStats, &channelsNbr);
+	}
+	printf("%s: %u channels, replayed %d times in %.3f s\n", traceName, channelsNbr, repeatsNbr, getTime() - start);
+	printStats("encoder", &encodeStats);
+	printStats("decoder", &decodeStats);
+	printf("  outputs: %llu/%llu encoded frames compared, %llu differ, %llu decoded frames compared, %llu differ\n",
+		(unsigned long long)encodeStats.comparedNbr, (unsigned long long)encodeStats.callsNbr, (unsigned long long)encodeStats.mismatchesNbr,
+		(unsigned long long)decodeStats.comparedNbr, (unsigned long long)decodeStats.mismatchesNbr);
+
+	free(encodeStats.latencies);
+	free(decodeStats.latencies);
+	munmap((void *)trace, traceSize);
+	return (encodeStats.mismatchesNbr == 0 && decodeStats.mismatchesNbr == 0)?0:1;
+}